@@ -0,0 +1,69 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::length_aware_batching configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Groups sequence pairs of similar lengths into the same SIMD vectors of the vectorised alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The vectorised alignment (seqan3::align_cfg::vectorised) computes several sequence pairs in the lanes of one SIMD
+ * vector. All lanes are computed up to the longest sequences of the vector, i.e. the shorter sequence pairs are padded.
+ * By default, the vectors are filled with the sequence pairs in the order of the input, such that with sequences of
+ * mixed lengths most cells may be computed for padding only.
+ *
+ * With this option the alignment buffers windows of seqan3::align_cfg::length_aware_batching::window_size sequence
+ * pairs and sorts every window by the length of the first and then of the second sequence before the vectors are
+ * filled. The results are still returned in the order of the input.
+ * A larger window groups the lengths more tightly but delays the first result and keeps more results in memory.
+ *
+ * This option only affects the unbanded vectorised global alignment and is ignored otherwise.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_length_aware_batching.cpp
+ */
+class length_aware_batching : private pipeable_config_element
+{
+public:
+    //!\brief The number of sequence pairs that are sorted by their lengths at once. Defaults to 1024.
+    uint32_t window_size{1024};
+
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr length_aware_batching() = default; //!< Defaulted.
+    constexpr length_aware_batching(length_aware_batching const &) = default; //!< Defaulted.
+    constexpr length_aware_batching(length_aware_batching &&) = default; //!< Defaulted.
+    constexpr length_aware_batching & operator=(length_aware_batching const &) = default; //!< Defaulted.
+    constexpr length_aware_batching & operator=(length_aware_batching &&) = default; //!< Defaulted.
+    ~length_aware_batching() = default; //!< Defaulted.
+
+    /*!\brief Initialises the window size.
+     * \param window_size The number of sequence pairs that are sorted by their lengths at once.
+     */
+    constexpr explicit length_aware_batching(uint32_t const window_size) noexcept : window_size{window_size}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::length_aware_batching};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_space_traceback configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the begin positions and the alignment with memory linear in the sequence lengths.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default, the begin positions and the alignment are obtained from a trace matrix, which stores one trace
+ * direction for every cell of the alignment matrix. For two sequences of 50,000 symbols these are 2.5 billion cells.
+ *
+ * With this option the alignment is computed by divide and conquer instead (Hirschberg's algorithm in the affine gap
+ * version of Myers and Miller): The alignment matrix is split at its middle column, the optimal path through this
+ * column is found by computing one half of the matrix forwards and the other half backwards, and both halves are
+ * aligned recursively. Only single columns of the alignment matrix are stored, but about three times as many cells
+ * are computed as with a trace matrix.
+ *
+ * The two halves of a split are independent. If seqan3::align_cfg::linear_space_traceback::thread_count is greater
+ * than 1, the halves of the large splits are aligned by different threads.
+ *
+ * This option only affects the unbanded scalar global alignment, also with free end gaps, and is ignored otherwise.
+ * The score and the end positions are the same as without this option. If there are several optimal alignments,
+ * the begin positions and the alignment might be a different one of them.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_linear_space_traceback.cpp
+ *
+ * \note For more information, please refer to the original article:
+ *       MYERS, Eugene W.; MILLER, Webb. Optimal alignments in linear space.
+ *       Bioinformatics, 1988, 4. Jg., Nr. 1, S. 11-17.
+ */
+class linear_space_traceback : private pipeable_config_element
+{
+public:
+    //!\brief The number of threads aligning the halves of the split alignment matrices. Defaults to 1.
+    uint32_t thread_count{1};
+
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr linear_space_traceback() = default; //!< Defaulted.
+    constexpr linear_space_traceback(linear_space_traceback const &) = default; //!< Defaulted.
+    constexpr linear_space_traceback(linear_space_traceback &&) = default; //!< Defaulted.
+    constexpr linear_space_traceback & operator=(linear_space_traceback const &) = default; //!< Defaulted.
+    constexpr linear_space_traceback & operator=(linear_space_traceback &&) = default; //!< Defaulted.
+    ~linear_space_traceback() = default; //!< Defaulted.
+
+    /*!\brief Initialises the number of threads.
+     * \param thread_count The number of threads aligning the halves of the split alignment matrices.
+     */
+    constexpr explicit linear_space_traceback(uint32_t const thread_count) noexcept : thread_count{thread_count}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::linear_space_traceback};
+};
+
+} // namespace seqan3::align_cfg
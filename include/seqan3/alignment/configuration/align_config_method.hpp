@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides global and local alignment configurations.
+ * \brief Provides global, local and seed extension alignment configurations.
  * \author Joshua Kim <joshua.kim AT fu-berlin.de>
  * \author Rene Rahn <rene.rahn AT fu-berlin.de>
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <seqan3/alignment/configuration/detail.hpp>
 #include <seqan3/core/configuration/pipeable_config_element.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
@@ -166,4 +168,102 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::global};
 };
 
+/*!\brief A strong type representing the X-drop threshold of the seqan3::align_cfg::method_extension.
+ * \ingroup alignment_configuration
+ */
+struct x_drop : public seqan3::detail::strong_type<int32_t, x_drop>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, x_drop>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief A strong type representing the Z-drop threshold of the seqan3::align_cfg::method_extension.
+ * \ingroup alignment_configuration
+ */
+struct z_drop : public seqan3::detail::strong_type<int32_t, z_drop>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, z_drop>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief Sets the seed extension alignment method.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Seed-and-extend approaches first find short, similar regions of the two sequences, the seeds, and then extend every
+ * seed in both directions to an alignment. With this method, every element of the range passed to
+ * seqan3::align_pairwise is a tuple of the first sequence, the second sequence and a seqan3::alignment_seed.
+ * The alignment starts with the diagonal of the seed and is extended to the left and to the right of the seed until
+ * the extension does not pay off anymore. The begin and end positions of the result are the extended positions in the
+ * complete sequences and the score is the sum of the scores of the seed diagonal and of both extensions.
+ *
+ * Each extension computes the alignment matrix starting at the seed column by column. A cell is dropped when its score
+ * falls more than seqan3::align_cfg::method_extension::x_drop below the best score found in the previous columns of
+ * the extension (X-drop), and the extension ends when all cells of a column are dropped. Only the cells close to the
+ * best alignment are computed, such that candidates that do not extend well stop after a few columns.
+ * The extension ends with the best cell found so far.
+ *
+ * If seqan3::align_cfg::method_extension::z_drop is set, the extension additionally ends as soon as the best score
+ * of a column falls more than \f$ Z + e * |d| \f$ below the best score found so far, where \f$ e \f$ is the gap
+ * extension penalty and \f$ d \f$ is the number of diagonals between both cells (Z-drop). In contrast to the X-drop,
+ * a long gap does not end the extension if the alignment continues well after it, which is useful for long reads
+ * with large insertions or deletions.
+ *
+ * The extensions can be computed with seqan3::align_cfg::vectorised, which extends one seed per lane.
+ * The vectorised extension computes the score, the begin and the end positions; if the alignment is requested, the
+ * seeds are extended without vectorisation.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_method_extension.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+class method_extension : private pipeable_config_element
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    method_extension() = default; //!< Defaulted.
+    method_extension(method_extension const &) = default; //!< Defaulted.
+    method_extension(method_extension &&) = default; //!< Defaulted.
+    method_extension & operator=(method_extension const &) = default; //!< Defaulted.
+    method_extension & operator=(method_extension &&) = default; //!< Defaulted.
+    ~method_extension() = default; //!< Defaulted.
+
+    /*!\brief Construct method_extension with the X-drop threshold.
+     * \param[in] x_drop_threshold The score difference to the best score at which a cell is dropped; must not be
+     *                             negative.
+     */
+    constexpr method_extension(seqan3::align_cfg::x_drop x_drop_threshold) noexcept :
+        x_drop{x_drop_threshold.get()}
+    {}
+
+    /*!\brief Construct method_extension with the X-drop and the Z-drop threshold.
+     * \param[in] x_drop_threshold The score difference to the best score at which a cell is dropped; must not be
+     *                             negative.
+     * \param[in] z_drop_threshold The score difference to the best score at which the extension ends; must not be
+     *                             negative.
+     */
+    constexpr method_extension(seqan3::align_cfg::x_drop x_drop_threshold,
+                               seqan3::align_cfg::z_drop z_drop_threshold) noexcept :
+        x_drop{x_drop_threshold.get()},
+        z_drop{z_drop_threshold.get()}
+    {}
+    //!\}
+
+    //!\brief The score difference to the best score at which a cell is dropped. Defaults to 30.
+    int32_t x_drop{30};
+    //!\brief The score difference to the best score at which the extension ends. Not set by default.
+    std::optional<int32_t> z_drop{};
+
+    //!\privatesection
+    //!\brief An internal id used to check for a valid alignment configuration.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::extension};
+};
+
 } // namespace seqan3::align_cfg
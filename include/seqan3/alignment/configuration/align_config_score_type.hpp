@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides alignment configuration seqan3::align_cfg::score_type.
+ * \brief Provides alignment configuration seqan3::align_cfg::score_type and seqan3::align_cfg::adaptive_score_type.
  * \author Lydia Buntrock <lydia.buntrock AT fu-berlin.de>
  */
 
@@ -59,4 +59,51 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::score_type};
 };
 
+/*!\brief A configuration element to let the vectorised alignment choose the smallest sufficient score type per
+ *        sequence pair.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default, the vectorised alignment computes all sequence pairs with the configured seqan3::align_cfg::score_type,
+ * such that short sequences occupy as wide SIMD lanes as long ones. With this option the global vectorised alignment
+ * first computes every sequence pair with 8 bit lanes, i.e. 32 alignments per vector with AVX2 and 64 with AVX-512.
+ * Each lane tracks whether its scores came close to the limits of the score type. Only the sequence pairs of such lanes
+ * are computed again with 16 bit lanes, and the ones that still do not fit with 32 bit lanes. Sequence pairs that are
+ * too long for a score type, i.e. a gap over the entire sequence would already exceed its range, skip the respective
+ * width. The results are identical to the ones computed with `seqan3::align_cfg::score_type<int32_t>` and are
+ * returned in the same order.
+ *
+ * The 8 bit lanes are only used with scoring schemes that have a match and a mismatch score only, e.g.
+ * seqan3::nucleotide_scoring_scheme, and if the scores and gap costs leave enough room within 8 bits. Otherwise, the
+ * computation starts with 16 bit lanes.
+ *
+ * This option replaces seqan3::align_cfg::score_type and the reported score has the type `int32_t`. It has no effect
+ * if seqan3::align_cfg::vectorised is not configured, or for the banded, the local and the edit distance alignment.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_adaptive_score_type.cpp
+ */
+class adaptive_score_type : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr adaptive_score_type() = default; //!< Defaulted.
+    constexpr adaptive_score_type(adaptive_score_type const &) = default; //!< Defaulted.
+    constexpr adaptive_score_type(adaptive_score_type &&) = default; //!< Defaulted.
+    constexpr adaptive_score_type & operator=(adaptive_score_type const &) = default; //!< Defaulted.
+    constexpr adaptive_score_type & operator=(adaptive_score_type &&) = default; //!< Defaulted.
+    ~adaptive_score_type() = default; //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    //!\details Shares the id with seqan3::align_cfg::score_type, since both select the score type.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::score_type};
+};
+
 } // namespace seqan3::align_cfg
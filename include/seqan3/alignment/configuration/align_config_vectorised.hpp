@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides seqan3::align_cfg::vectorised configuration.
+ * \brief Provides seqan3::align_cfg::vectorised and seqan3::align_cfg::striped_vectorised configuration.
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
  * \author Lydia Buntrock <lydia.buntrock AT fu-berlin.de>
  */
@@ -58,4 +58,43 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::vectorised};
 };
 
+/*!\brief Vectorises the computation of every single pairwise alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In contrast to seqan3::align_cfg::vectorised, which computes several alignments simultaneously, this option
+ * vectorises the computation within the alignment matrix of one sequence pair. The rows of every column are split
+ * into as many segments as the SIMD register has lanes and every lane computes one of the segments
+ * (striped layout, see Farrar, Bioinformatics 2007). This option speeds up the alignment of long sequences, which
+ * are not available in large numbers. Both options cannot be combined.
+ *
+ * The striped alignment computes the score and the end positions of the unbanded global alignment, also with free
+ * end gaps, and of the unbanded local alignment. The results are the same as without this option. If the begin
+ * positions or the alignment are requested, or if a band is configured, this option is ignored.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_striped_vectorised.cpp
+ */
+class striped_vectorised : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr striped_vectorised() = default; //!< Defaulted.
+    constexpr striped_vectorised(striped_vectorised const &) = default; //!< Defaulted.
+    constexpr striped_vectorised(striped_vectorised &&) = default; //!< Defaulted.
+    constexpr striped_vectorised & operator=(striped_vectorised const &) = default; //!< Defaulted.
+    constexpr striped_vectorised & operator=(striped_vectorised &&) = default; //!< Defaulted.
+    ~striped_vectorised() = default; //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::striped_vectorised};
+};
+
 } // namespace seqan3::align_cfg
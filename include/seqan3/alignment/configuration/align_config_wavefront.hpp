@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the global alignment with the wavefront algorithm.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The dynamic programming alignment computes every cell of the alignment matrix. If the sequences are similar, the
+ * optimal alignment stays close to the main diagonal and most of these cells are not needed.
+ * The wavefront algorithm (WFA) computes the alignment in order of increasing penalty instead: For every penalty
+ * \f$ s \f$ it stores, per diagonal of the alignment matrix, the furthest cell that can be reached with penalty
+ * \f$ s \f$, and it follows runs of matches along the diagonals without computing their cells.
+ * The runtime is in \f$ O((n + m) * s) \f$ and the space is in \f$ O(s^2) \f$, where \f$ s \f$ is the penalty of the
+ * optimal alignment.
+ *
+ * The WFA needs a scoring scheme with a single match score and a single mismatch score, e.g. a
+ * seqan3::nucleotide_scoring_scheme constructed from seqan3::match_score and seqan3::mismatch_score. The scores of the
+ * alignment are translated into penalties that rank the end-to-end alignments of two sequences in the same order.
+ * The score, the positions and the alignment of the result are the same as for the dynamic programming alignment,
+ * but if there are several optimal alignments, the alignment might be a different one of them.
+ *
+ * This option only affects the unbanded scalar global alignment without free end gaps. The alignment falls back to
+ * the dynamic programming alignment if the option is combined with other methods or options, or if the scoring
+ * scheme or the gap costs cannot be translated into penalties.
+ *
+ * ### Adaptive pruning
+ *
+ * With seqan3::align_cfg::wavefront::adaptive_pruning, diagonals that fall too far behind are removed from the
+ * wavefronts (WFA-Adaptive). A wavefront with at least seqan3::align_cfg::wavefront::min_wavefront_length diagonals
+ * is pruned from both of its sides: diagonals whose remaining distance to the end of the alignment matrix exceeds
+ * the smallest remaining distance of all diagonals by more than seqan3::align_cfg::wavefront::max_distance_threshold
+ * are removed. This bounds the width of the wavefronts for long sequences, but the result is no longer
+ * guaranteed to be optimal.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_wavefront.cpp
+ *
+ * \note For more information, please refer to the original article:
+ *       MARCO-SOLA, Santiago, et al. Fast gap-affine pairwise alignment using the wavefront algorithm.
+ *       Bioinformatics, 2021, 37. Jg., Nr. 4, S. 456-463.
+ */
+class wavefront : private pipeable_config_element
+{
+public:
+    //!\brief Whether the wavefronts are pruned adaptively. Defaults to false.
+    bool adaptive_pruning{false};
+    //!\brief The minimal number of diagonals of a wavefront to be pruned. Defaults to 10.
+    uint32_t min_wavefront_length{10};
+    //!\brief The largest difference in the remaining distance to the best diagonal that is kept. Defaults to 50.
+    uint32_t max_distance_threshold{50};
+
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr wavefront() = default; //!< Defaulted.
+    constexpr wavefront(wavefront const &) = default; //!< Defaulted.
+    constexpr wavefront(wavefront &&) = default; //!< Defaulted.
+    constexpr wavefront & operator=(wavefront const &) = default; //!< Defaulted.
+    constexpr wavefront & operator=(wavefront &&) = default; //!< Defaulted.
+    ~wavefront() = default; //!< Defaulted.
+
+    /*!\brief Enables the adaptive pruning with the given parameters.
+     * \param min_wavefront_length The minimal number of diagonals of a wavefront to be pruned.
+     * \param max_distance_threshold The largest difference in the remaining distance to the best diagonal that is
+     *                               kept.
+     */
+    constexpr wavefront(uint32_t const min_wavefront_length, uint32_t const max_distance_threshold) noexcept :
+        adaptive_pruning{true},
+        min_wavefront_length{min_wavefront_length},
+        max_distance_threshold{max_distance_threshold}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::align_cfg
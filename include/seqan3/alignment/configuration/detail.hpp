@@ -22,25 +22,30 @@ namespace seqan3::detail
  */
 enum struct align_config_id : uint8_t
 {
-    band,                  //!< ID for the \ref seqan3::align_cfg::band_fixed_size "band" option.
-    debug,                 //!< ID for the \ref seqan3::align_cfg::detail::debug "debug" option.
-    gap,                   //!< ID for the \ref seqan3::align_cfg::gap_cost_affine "gap_cost_affine" option.
-    global,                //!< ID for the \ref seqan3::align_cfg::method_global "global alignment" option.
-    local,                 //!< ID for the \ref seqan3::align_cfg::method_local "local alignment" option.
-    min_score,             //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
-    on_result,             //!< ID for the \ref seqan3::align_cfg::on_result "on_result" option.
-    output_alignment,      //!< ID for the \ref seqan3::align_cfg::output_alignment "alignment output" option.
-    output_begin_position, //!< ID for the \ref seqan3::align_cfg::output_begin_position "begin position output" option.
-    output_end_position,   //!< ID for the \ref seqan3::align_cfg::output_end_position "end position output" option.
-    output_sequence1_id,   //!< ID for the \ref seqan3::align_cfg::output_sequence1_id "sequence1 id output" option.
-    output_sequence2_id,   //!< ID for the \ref seqan3::align_cfg::output_sequence2_id "sequence2 id output" option.
-    output_score,          //!< ID for the \ref seqan3::align_cfg::output_score "score output" option.
-    parallel,              //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
-    result_type,           //!< ID for the \ref seqan3::align_cfg::detail::result_type "result_type" option.
-    score_type,            //!< ID for the \ref seqan3::align_cfg::score_type "score_type" option.
-    scoring,               //!< ID for the \ref seqan3::align_cfg::scoring_scheme "scoring_scheme" option.
-    vectorised,            //!< ID for the \ref seqan3::align_cfg::vectorised "vectorised" option.
-    SIZE                   //!< Represents the number of configuration elements.
+    band,                   //!< ID for the \ref seqan3::align_cfg::band_fixed_size "band" option.
+    debug,                  //!< ID for the \ref seqan3::align_cfg::detail::debug "debug" option.
+    extension,              //!< ID for the \ref seqan3::align_cfg::method_extension "seed extension" option.
+    gap,                    //!< ID for the \ref seqan3::align_cfg::gap_cost_affine "gap_cost_affine" option.
+    global,                 //!< ID for the \ref seqan3::align_cfg::method_global "global alignment" option.
+    length_aware_batching,  //!< ID for the \ref seqan3::align_cfg::length_aware_batching "batching" option.
+    linear_space_traceback, //!< ID for the \ref seqan3::align_cfg::linear_space_traceback "traceback" option.
+    local,                  //!< ID for the \ref seqan3::align_cfg::method_local "local alignment" option.
+    min_score,              //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
+    on_result,              //!< ID for the \ref seqan3::align_cfg::on_result "on_result" option.
+    output_alignment,       //!< ID for the \ref seqan3::align_cfg::output_alignment "alignment output" option.
+    output_begin_position,  //!< ID for the \ref seqan3::align_cfg::output_begin_position "begin position" option.
+    output_end_position,    //!< ID for the \ref seqan3::align_cfg::output_end_position "end position output" option.
+    output_sequence1_id,    //!< ID for the \ref seqan3::align_cfg::output_sequence1_id "sequence1 id output" option.
+    output_sequence2_id,    //!< ID for the \ref seqan3::align_cfg::output_sequence2_id "sequence2 id output" option.
+    output_score,           //!< ID for the \ref seqan3::align_cfg::output_score "score output" option.
+    parallel,               //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
+    result_type,            //!< ID for the \ref seqan3::align_cfg::detail::result_type "result_type" option.
+    score_type,             //!< ID for the \ref seqan3::align_cfg::score_type "score_type" option.
+    scoring,                //!< ID for the \ref seqan3::align_cfg::scoring_scheme "scoring_scheme" option.
+    striped_vectorised,     //!< ID for the \ref seqan3::align_cfg::striped_vectorised "striped_vectorised" option.
+    vectorised,             //!< ID for the \ref seqan3::align_cfg::vectorised "vectorised" option.
+    wavefront,              //!< ID for the \ref seqan3::align_cfg::wavefront "wavefront" option.
+    SIZE                    //!< Represents the number of configuration elements.
 };
 
 // ----------------------------------------------------------------------------
@@ -58,40 +63,50 @@ inline constexpr std::array<std::array<bool, static_cast<uint8_t>(align_config_i
 {
     {   //band
         //|  debug
-        //|  |  gap
-        //|  |  |  global
-        //|  |  |  |  local
-        //|  |  |  |  |  min_score
-        //|  |  |  |  |  |  on_result
-        //|  |  |  |  |  |  |  output_alignment
-        //|  |  |  |  |  |  |  |  output_begin_position
-        //|  |  |  |  |  |  |  |  |  output_end_position
-        //|  |  |  |  |  |  |  |  |  |  output_sequence1_id
-        //|  |  |  |  |  |  |  |  |  |  |  output_sequence2_id
-        //|  |  |  |  |  |  |  |  |  |  |  |  output_score
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  parallel
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  result_type
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  | score_type
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  scoring
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised
-        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  0: band
-        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  1: debug
-        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  2: gap
-        { 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: global
-        { 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  4: local
-        { 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  5: max_error
-        { 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  6: on_result
-        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  7: output_alignment
-        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  8: output_begin_position
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, // 9: output_end_position
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // 10: output_sequence1_id
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 11: output_sequence2_id
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 12: output_score
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // 13: parallel
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // 14: result_type
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, // 15: score_type
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, // 16: scoring
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // 17: vectorised
+        //|  |  extension
+        //|  |  |  gap
+        //|  |  |  |  global
+        //|  |  |  |  |  length_aware_batching
+        //|  |  |  |  |  |  linear_space_traceback
+        //|  |  |  |  |  |  |  local
+        //|  |  |  |  |  |  |  |  min_score
+        //|  |  |  |  |  |  |  |  |  on_result
+        //|  |  |  |  |  |  |  |  |  |  output_alignment
+        //|  |  |  |  |  |  |  |  |  |  |  output_begin_position
+        //|  |  |  |  |  |  |  |  |  |  |  |  output_end_position
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  output_sequence1_id
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  output_sequence2_id
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  output_score
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  parallel
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  result_type
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  score_type
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  scoring
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  striped_vectorised
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  wavefront
+        { 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  0: band
+        { 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  1: debug
+        { 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0}, //  2: extension
+        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: gap
+        { 1, 1, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  4: global
+        { 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  5: length_aware_batching
+        { 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  6: linear_space_traceback
+        { 1, 1, 0, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  7: local
+        { 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  8: max_error
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  9: on_result
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 10: output_alignment
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 11: output_begin_position
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 12: output_end_position
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 13: output_sequence1_id
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, // 14: output_sequence2_id
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // 15: output_score
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 16: parallel
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 17: result_type
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // 18: score_type
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // 19: scoring
+        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1}, // 20: striped_vectorised
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1}, // 21: vectorised
+        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0} // 22: wavefront
     }
 };
 
@@ -19,6 +19,7 @@
 #include <seqan3/alignment/matrix/detail/alignment_matrix_column_major_range_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_proxy.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/utility/concept/exposition_only/core_language.hpp>
 #include <seqan3/utility/simd/concept.hpp>
 
@@ -111,12 +112,37 @@ public:
     constexpr alignment_score_matrix_one_column(first_sequence_t && first,
                                                 second_sequence_t && second,
                                                 score_t const initial_value = score_t{})
+    {
+        reset(first, second, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resets the matrix to the dimensions of the two given ranges.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Has the same effect as constructing the matrix from the given ranges, but reuses the memory of the column if
+     * it is large enough (see seqan3::detail::reserve_matrix_memory).
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    void reset(first_sequence_t && first, second_sequence_t && second, score_t const initial_value = score_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
+        matrix_base_t::cache = {};
+        matrix_base_t::pool.clear();
+        reserve_matrix_memory(matrix_base_t::pool, matrix_base_t::num_rows + 1);
         matrix_base_t::pool.resize(matrix_base_t::num_rows + 1, element_type{initial_value, initial_value});
     }
-    //!\}
+
+    //!\copydoc seqan3::detail::alignment_score_matrix_one_column_base::capacity
+    using matrix_base_t::capacity;
 
 private:
     //!\copydoc seqan3::detail::alignment_matrix_column_major_range_base::initialise_column
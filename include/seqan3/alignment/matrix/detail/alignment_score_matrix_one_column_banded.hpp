@@ -16,6 +16,7 @@
 #include <seqan3/alignment/matrix/detail/alignment_matrix_column_major_range_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_proxy.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 #include <seqan3/std/span>
@@ -113,6 +114,31 @@ public:
                                                        second_sequence_t && second,
                                                        align_cfg::band_fixed_size const & band,
                                                        score_t const initial_value = score_t{})
+    {
+        reset(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resets the matrix to the dimensions of the two given ranges and the band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first          The first range.
+     * \param[in] second         The second range.
+     * \param[in] band           The seqan3::align_cfg::band_fixed_size in which to calculate the alignment.
+     * \param[in] initial_value  The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Has the same effect as constructing the matrix from the given ranges and band, but reuses the memory of the
+     * column if it is large enough (see seqan3::detail::reserve_matrix_memory).
+     */
+    template <std::ranges::forward_range first_sequence_t,
+              std::ranges::forward_range second_sequence_t>
+    void reset(first_sequence_t && first,
+               second_sequence_t && second,
+               align_cfg::band_fixed_size const & band,
+               score_t const initial_value = score_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -122,10 +148,15 @@ public:
                                            matrix_base_t::num_rows - 1);
 
         band_size = band_col_index + band_row_index + 1;
+        matrix_base_t::cache = {};
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
+        matrix_base_t::pool.clear();
+        reserve_matrix_memory(matrix_base_t::pool, band_size + 1);
         matrix_base_t::pool.resize(band_size + 1, element_type{initial_value, initial_value});
     }
-    //!\}
+
+    //!\copydoc seqan3::detail::alignment_score_matrix_one_column_base::capacity
+    using matrix_base_t::capacity;
 
     //!\brief The column index where the upper bound of the band passes through.
     int32_t band_col_index{};
@@ -58,6 +58,12 @@ public:
     size_type num_cols{};
     //!\brief The number of num_rows.
     size_type num_rows{};
+
+    //!\brief Returns the number of cells that can be stored without reallocation.
+    size_type capacity() const noexcept
+    {
+        return pool.capacity();
+    }
 };
 
 } // namespace seqan3::detail
@@ -65,6 +65,12 @@ public:
     size_type num_cols{};
     //!\brief The number of num_rows.
     size_type num_rows{};
+
+    //!\brief Returns the number of cells that can be stored without reallocation.
+    size_type capacity() const noexcept
+    {
+        return data.capacity();
+    }
 };
 
 } // namespace seqan3::detail
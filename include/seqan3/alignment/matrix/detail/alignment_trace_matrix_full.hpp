@@ -12,12 +12,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 
 #include <seqan3/alignment/matrix/detail/alignment_matrix_column_major_range_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_proxy.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
 #include <seqan3/utility/views/zip.hpp>
 
@@ -118,20 +120,51 @@ public:
     template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
     constexpr alignment_trace_matrix_full(first_sequence_t && first,
                                           second_sequence_t && second,
-                                          [[maybe_unused]] trace_t const initial_value = trace_t{})
+                                          trace_t const initial_value = trace_t{})
+    {
+        reset(first, second, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resets the matrix to the dimensions of the two given ranges.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first  The first range.
+     * \param[in] second The second range.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Has the same effect as constructing the matrix from the given ranges, but reuses the memory of the traceback
+     * matrix if it is large enough (see seqan3::detail::reserve_matrix_memory).
+     * If `coordinate_only` is set to `true`, nothing will be allocated.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    void reset(first_sequence_t && first,
+               second_sequence_t && second,
+               [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
+        matrix_base_t::cache_up = {};
 
         if constexpr (!coordinate_only)
         {
-            // Allocate the matrix here.
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{matrix_base_t::num_rows},
-                                                                    number_cols{matrix_base_t::num_cols}};
+            size_t const cell_count = matrix_base_t::num_rows * matrix_base_t::num_cols;
+
+            reserve_matrix_memory(matrix_base_t::data, cell_count, matrix_memory_growth::exact);
+            matrix_base_t::data.resize(number_rows{matrix_base_t::num_rows}, number_cols{matrix_base_t::num_cols});
+            std::fill_n(matrix_base_t::data.data(), cell_count, trace_t{});
+
+            matrix_base_t::cache_left.clear();
+            reserve_matrix_memory(matrix_base_t::cache_left, matrix_base_t::num_rows);
             matrix_base_t::cache_left.resize(matrix_base_t::num_rows, initial_value);
         }
     }
-    //!\}
+
+    //!\copydoc seqan3::detail::alignment_trace_matrix_base::capacity
+    using matrix_base_t::capacity;
 
     /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
      *        seqan3::detail::trace_directions::none.
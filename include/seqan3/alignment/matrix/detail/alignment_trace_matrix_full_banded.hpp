@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 
@@ -19,6 +20,7 @@
 #include <seqan3/alignment/matrix/detail/alignment_matrix_column_major_range_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_proxy.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/alignment/matrix/detail/trace_iterator_banded.hpp>
 #include <seqan3/utility/views/zip.hpp>
 
@@ -130,10 +132,36 @@ public:
     constexpr alignment_trace_matrix_full_banded(first_sequence_t && first,
                                                  second_sequence_t && second,
                                                  align_cfg::band_fixed_size const & band,
-                                                 [[maybe_unused]] trace_t const initial_value = trace_t{})
+                                                 trace_t const initial_value = trace_t{})
+    {
+        reset(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resets the matrix to the dimensions of the two given ranges and the band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] band          The seqan3::align_cfg::band_fixed_size in which to calculate the alignment.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Has the same effect as constructing the matrix from the given ranges and band, but reuses the memory of the
+     * traceback matrix if it is large enough (see seqan3::detail::reserve_matrix_memory).
+     * If `coordinate_only` is set to `true`, nothing will be allocated.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    void reset(first_sequence_t && first,
+               second_sequence_t && second,
+               align_cfg::band_fixed_size const & band,
+               [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
+        matrix_base_t::cache_up = {};
 
         band_col_index = std::min<int32_t>(std::max<int32_t>(band.upper_diagonal, 0),
                                            matrix_base_t::num_cols - 1);
@@ -144,12 +172,21 @@ public:
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
         if constexpr (!coordinate_only)
         {
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{static_cast<size_type>(band_size)},
-                                                                    number_cols{matrix_base_t::num_cols}};
+            size_t const cell_count = static_cast<size_type>(band_size) * matrix_base_t::num_cols;
+
+            reserve_matrix_memory(matrix_base_t::data, cell_count, matrix_memory_growth::exact);
+            matrix_base_t::data.resize(number_rows{static_cast<size_type>(band_size)},
+                                       number_cols{matrix_base_t::num_cols});
+            std::fill_n(matrix_base_t::data.data(), cell_count, trace_t{});
+
+            matrix_base_t::cache_left.clear();
+            reserve_matrix_memory(matrix_base_t::cache_left, band_size + 1);
             matrix_base_t::cache_left.resize(band_size + 1, initial_value);
         }
     }
-    //!\}
+
+    //!\copydoc seqan3::detail::alignment_trace_matrix_base::capacity
+    using matrix_base_t::capacity;
 
     //!\copydoc seqan3::detail::alignment_trace_matrix_full::trace_path
     auto trace_path(matrix_coordinate const & trace_begin)
@@ -83,7 +83,8 @@ public:
      *
      * \details
      *
-     * Resizes the underlying score and trace matrix to the given dimensions.
+     * Resizes the underlying score and trace matrix to the given dimensions. The matrices are resized in place,
+     * such that their memory is reused if this matrix is used for more than one alignment.
      *
      * ### Complexity
      *
@@ -91,21 +92,41 @@ public:
      *
      * ### Exception
      *
-     * Strong exception guarantee. Might throw std::bad_alloc.
+     * Basic exception guarantee. Might throw std::bad_alloc.
      */
     template <std::integral column_index_t, std::integral row_index_t>
     void resize(column_index_type<column_index_t> const column_count,
                 row_index_type<row_index_t> const row_count,
                 score_type const initial_score = score_type{})
     {
-        score_matrix_t tmp_score_matrix{};
-        tmp_score_matrix.resize(column_count, row_count, initial_score);
-
-        trace_matrix_t tmp_trace_matrix{};
-        tmp_trace_matrix.resize(column_count, row_count);
+        score_matrix.resize(column_count, row_count, initial_score);
+        trace_matrix.resize(column_count, row_count);
+    }
 
-        score_matrix = std::move(tmp_score_matrix);
-        trace_matrix = std::move(tmp_trace_matrix);
+    /*!\brief Resizes the matrix without initialising the score matrix.
+     * \tparam column_index_t The column index type; must model std::integral.
+     * \tparam row_index_t The row index type; must model std::integral.
+     *
+     * \param[in] column_count The number of columns for this matrix.
+     * \param[in] row_count The number of rows for this matrix.
+     * \param[in] initial_score The initial score used to initialise the score matrix.
+     *
+     * \details
+     *
+     * Same as seqan3::detail::combined_score_and_trace_matrix::resize, but calls `resize_for_overwrite` on the
+     * underlying score matrix. Can only be used if the alignment algorithm writes every cell before reading it.
+     *
+     * ### Exception
+     *
+     * Basic exception guarantee. Might throw std::bad_alloc.
+     */
+    template <std::integral column_index_t, std::integral row_index_t>
+    void resize_for_overwrite(column_index_type<column_index_t> const column_count,
+                              row_index_type<row_index_t> const row_count,
+                              score_type const initial_score = score_type{})
+    {
+        score_matrix.resize_for_overwrite(column_count, row_count, initial_score);
+        trace_matrix.resize(column_count, row_count);
     }
 
     /*!\name Iterators
@@ -142,6 +163,20 @@ public:
     {
         return trace_matrix.trace_path(from_coordinate);
     }
+
+    /*!\brief Returns the trace path of a single lane of a vectorised alignment matrix starting from the given
+     *        coordinate and ending in the cell with seqan3::detail::trace_directions::none.
+     * \param[in] from_coordinate A seqan3::matrix_coordinate pointing to the start of the trace to follow.
+     * \param[in] lane The lane of the alignment whose trace shall be followed.
+     *
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     *
+     * \throws std::invalid_argument if the specified coordinate or lane is out of range.
+     */
+    auto trace_path(matrix_coordinate const & from_coordinate, size_t const lane) const
+    {
+        return trace_matrix.trace_path(from_coordinate, lane);
+    }
 };
 
 /*!\brief Combined score and trace matrix iterator for the pairwise sequence alignment.
@@ -0,0 +1,210 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::matrix_memory_statistics, seqan3::detail::reserve_matrix_memory and
+ *        seqan3::detail::matrix_memory_cache.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Counts how often the alignment matrices of the current thread had to allocate memory.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * The alignment matrices keep their memory across the alignment invocations, such that a new alignment only
+ * allocates memory if it needs a bigger matrix than any alignment computed before by the same thread.
+ * Every request for matrix memory is recorded in the statistics of the calling thread, which can be accessed via
+ * seqan3::detail::matrix_memory_statistics::local. This is mainly useful for benchmarks, which want to report
+ * how many allocations were saved by reusing the memory.
+ */
+struct matrix_memory_statistics
+{
+    //!\brief The number of requests that required a new allocation.
+    size_t allocations{};
+    //!\brief The number of requests that were served by the already allocated memory.
+    size_t allocations_avoided{};
+
+    //!\brief Returns the statistics of the current thread.
+    static matrix_memory_statistics & local() noexcept
+    {
+        static thread_local matrix_memory_statistics statistics{};
+        return statistics;
+    }
+
+    //!\brief Resets the counters to zero.
+    void reset() noexcept
+    {
+        allocations = 0;
+        allocations_avoided = 0;
+    }
+};
+
+/*!\brief How the capacity of the matrix memory grows if it is insufficient.
+ * \ingroup alignment_matrix
+ */
+enum struct matrix_memory_growth
+{
+    //!\brief The capacity is at least doubled; used for the memory of single columns.
+    geometric,
+    //!\brief The capacity is set to the requested size; used for the memory of complete matrices.
+    exact
+};
+
+/*!\brief Makes sure that the given storage can hold the requested number of elements without reallocation.
+ * \ingroup alignment_matrix
+ *
+ * \tparam storage_t The type of the storage; must provide the member functions `capacity()` and `reserve()`.
+ *
+ * \param[in,out] storage The storage to reserve the memory for.
+ * \param[in] element_count The number of elements that must fit into the storage.
+ * \param[in] growth How the capacity grows if it is insufficient.
+ *
+ * \details
+ *
+ * If the capacity of the storage is insufficient and `growth` is seqan3::detail::matrix_memory_growth::geometric,
+ * the capacity is at least doubled, such that alignments with slowly increasing sequence lengths do not reallocate
+ * the matrix memory for every invocation. The memory of complete matrices, which grows with the product of the
+ * sequence lengths, is allocated exactly, since it is kept for later alignments.
+ * The request is recorded in the seqan3::detail::matrix_memory_statistics of the current thread.
+ * The size and the content of the storage are not modified.
+ *
+ * ### Exception
+ *
+ * Strong exception guarantee. Might throw std::bad_alloc.
+ */
+template <typename storage_t>
+inline void reserve_matrix_memory(storage_t & storage,
+                                  size_t const element_count,
+                                  matrix_memory_growth const growth = matrix_memory_growth::geometric)
+{
+    matrix_memory_statistics & statistics = matrix_memory_statistics::local();
+
+    if (element_count <= storage.capacity())
+    {
+        ++statistics.allocations_avoided;
+        return;
+    }
+
+    if (growth == matrix_memory_growth::geometric)
+        storage.reserve(std::max<size_t>(element_count, 2 * storage.capacity()));
+    else
+        storage.reserve(element_count);
+
+    ++statistics.allocations;
+}
+
+/*!\brief The number of cells above which an alignment matrix is not kept for the next alignment of the same thread.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * This corresponds to 64 MiB for a trace matrix of seqan3::detail::trace_directions.
+ */
+inline constexpr size_t matrix_memory_cache_cell_limit = size_t{1} << 26;
+
+/*!\brief Releases the matrix memory that the alignments of the current thread keep for later alignments.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * Every matrix that is kept across alignments is stored in a seqan3::detail::matrix_memory_cache::entry, which
+ * registers itself in the cache of the current thread. seqan3::detail::matrix_memory_cache::release resets all
+ * registered matrices of the current thread, which frees their memory.
+ */
+class matrix_memory_cache
+{
+public:
+    template <typename matrix_t>
+    class entry;
+
+    //!\brief Returns the cache of the current thread.
+    static matrix_memory_cache & local() noexcept
+    {
+        static thread_local matrix_memory_cache cache{};
+        return cache;
+    }
+
+    //!\brief Resets all matrices that are kept by the current thread.
+    void release()
+    {
+        for (auto & [entry_id, release_entry] : release_functions)
+            release_entry();
+    }
+
+private:
+    //!\brief Registers the function that releases the memory of an entry and returns the id of the entry.
+    size_t add(std::function<void()> release_entry)
+    {
+        release_functions.emplace_back(next_id, std::move(release_entry));
+        return next_id++;
+    }
+
+    //!\brief Removes the entry with the given id.
+    void remove(size_t const entry_id) noexcept
+    {
+        std::erase_if(release_functions, [entry_id] (auto const & entry) { return entry.first == entry_id; });
+    }
+
+    //!\brief The functions that release the memory of the registered entries.
+    std::vector<std::pair<size_t, std::function<void()>>> release_functions{};
+    //!\brief The id of the next registered entry.
+    size_t next_id{};
+};
+
+/*!\brief A matrix that is kept across alignments and released by seqan3::detail::matrix_memory_cache::release.
+ * \tparam matrix_t The type of the kept matrix (or matrices); must be default constructible and move assignable.
+ *
+ * \details
+ *
+ * Must be declared as a `thread_local` variable.
+ */
+template <typename matrix_t>
+class matrix_memory_cache::entry
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Registers the entry in the cache of the current thread.
+    entry() : entry_id{matrix_memory_cache::local().add([this] () { matrix = matrix_t{}; })}
+    {}
+
+    entry(entry const &) = delete; //!< Deleted.
+    entry(entry &&) = delete; //!< Deleted.
+    entry & operator=(entry const &) = delete; //!< Deleted.
+    entry & operator=(entry &&) = delete; //!< Deleted.
+
+    //!\brief Removes the entry from the cache of the current thread.
+    ~entry()
+    {
+        matrix_memory_cache::local().remove(entry_id);
+    }
+    //!\}
+
+    //!\brief The kept matrix.
+    matrix_t matrix{};
+
+private:
+    //!\brief The id of this entry in the cache.
+    size_t entry_id{};
+};
+
+} // namespace seqan3::detail
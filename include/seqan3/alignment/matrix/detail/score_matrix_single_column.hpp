@@ -12,11 +12,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
 #include <vector>
 
 #include <seqan3/alignment/matrix/detail/affine_cell_proxy.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/utility/concept/exposition_only/core_language.hpp>
 #include <seqan3/utility/container/aligned_allocator.hpp>
 #include <seqan3/utility/simd/concept.hpp>
@@ -40,6 +43,10 @@ namespace seqan3::detail
  * value for the vertical column. Hence, this matrix can only be used for a column
  * based computation layout.
  *
+ * The memory of the columns is kept when the matrix is resized, such that a matrix that is reused for many
+ * alignments, e.g. a `thread_local` matrix, only allocates memory if the current alignment has more rows than any
+ * alignment computed before. See seqan3::detail::reserve_matrix_memory for more details.
+ *
  * ### Range interface
  *
  * The matrix offers a input range interface over the columns of the matrix. Dereferencing the iterator will return
@@ -59,6 +66,8 @@ private:
     using physical_column_t = std::vector<score_t, aligned_allocator<score_t, alignof(score_t)>>;
     //!\brief The type of the virtual score column which only stores one value.
     using virtual_column_t = decltype(views::repeat_n(score_t{}, 1));
+    //!\brief The type of the view over the used part of a physical column.
+    using column_span_t = std::span<score_t>;
 
     class matrix_iterator;
 
@@ -70,6 +79,8 @@ private:
     virtual_column_t vertical_column{};
     //!\brief The number of columns for this matrix.
     size_t number_of_columns{};
+    //!\brief The number of rows for this matrix.
+    size_t number_of_rows{};
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -99,8 +110,8 @@ public:
      * Note the alignment matrix requires the number of columns and rows to be one bigger than the size of sequence1,
      * respectively sequence2.
      * Reallocation happens only if the new column size exceeds the current capacity of the optimal and horizontal
-     * score column. The underlying vectors are initialised with the given `initial_value` or the default value of
-     * the class's score type.
+     * score column. The first `number_of_rows` cells of the columns are initialised with the given `initial_value`
+     * or the default value of the class's score type.
      *
      * ### Complexity
      *
@@ -115,12 +126,50 @@ public:
                 row_index_type<row_index_t> const number_of_rows,
                 score_t const initial_value = score_t{})
     {
+        resize_for_overwrite(number_of_columns, number_of_rows, initial_value);
+        std::ranges::fill_n(optimal_column.begin(), this->number_of_rows, initial_value);
+        std::ranges::fill_n(horizontal_column.begin(), this->number_of_rows, initial_value);
+    }
+
+    /*!\brief Resizes the matrix without initialising the score columns.
+     * \tparam column_index_t The column index type; must model std::integral.
+     * \tparam row_index_t The row index type; must model std::integral.
+     *
+     * \param[in] number_of_columns The number of columns for this matrix.
+     * \param[in] number_of_rows The number of rows for this matrix.
+     * \param[in] initial_value Optional initial score value of the vertical column.
+     *
+     * \details
+     *
+     * In contrast to seqan3::detail::score_matrix_single_column::resize, the optimal and the horizontal score column
+     * keep the values of the previous computation. This can be used if the alignment algorithm writes every cell
+     * before reading it, e.g. the unbanded alignment, which initialises the first column completely.
+     * Only the virtual vertical column is set to the `initial_value`.
+     *
+     * ### Complexity
+     *
+     * Constant if no reallocation is necessary, otherwise linear in the number of rows.
+     *
+     * ### Exception
+     *
+     * Basic exception guarantee. Might throw std::bad_alloc on resizing the internal columns.
+     */
+    template <std::integral column_index_t, std::integral row_index_t>
+    void resize_for_overwrite(column_index_type<column_index_t> const number_of_columns,
+                              row_index_type<row_index_t> const number_of_rows,
+                              score_t const initial_value = score_t{})
+    {
+        size_t const row_count = number_of_rows.get();
+
+        reserve_matrix_memory(optimal_column, row_count);
+        reserve_matrix_memory(horizontal_column, row_count);
+        // Only grows the columns. The cells beyond the current row count are kept for later alignments.
+        optimal_column.resize(std::max(optimal_column.size(), row_count));
+        horizontal_column.resize(std::max(horizontal_column.size(), row_count));
+
         this->number_of_columns = number_of_columns.get();
-        optimal_column.clear();
-        horizontal_column.clear();
-        optimal_column.resize(number_of_rows.get(), initial_value);
-        horizontal_column.resize(number_of_rows.get(), initial_value);
-        vertical_column = views::repeat_n(initial_value, number_of_rows.get());
+        this->number_of_rows = row_count;
+        vertical_column = views::repeat_n(initial_value, row_count);
     }
 
     /*!\name Iterators
@@ -166,8 +215,8 @@ class score_matrix_single_column<score_t>::matrix_iterator
 private:
 
     //!\brief The type of the zipped score column.
-    using matrix_column_t = decltype(views::zip(std::declval<physical_column_t &>(),
-                                                std::declval<physical_column_t &>(),
+    using matrix_column_t = decltype(views::zip(std::declval<column_span_t>(),
+                                                std::declval<column_span_t>(),
                                                 std::declval<virtual_column_t &>()));
 
     //!\brief The transform adaptor to convert the tuple from the zip view into a seqan3::detail::affine_cell_type.
@@ -226,7 +275,9 @@ public:
     //!\brief Returns the range over the current column.
     reference operator*() const
     {
-        return views::zip(host_ptr->optimal_column, host_ptr->horizontal_column, host_ptr->vertical_column)
+        return views::zip(column_span_t{host_ptr->optimal_column.data(), host_ptr->number_of_rows},
+                          column_span_t{host_ptr->horizontal_column.data(), host_ptr->number_of_rows},
+                          host_ptr->vertical_column)
              | transform_to_affine_cell;
     }
     //!\}
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::simd_trace_lane_iterator.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_concept.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Projects an iterator over a vectorised trace matrix onto a single lane.
+ * \ingroup alignment_matrix
+ * \implements seqan3::detail::two_dimensional_matrix_iterator
+ *
+ * \tparam matrix_iter_t The wrapped matrix iterator; must model seqan3::detail::two_dimensional_matrix_iterator and
+ *                       its value type must model seqan3::simd::simd_concept.
+ *
+ * \details
+ *
+ * In the vectorised alignment every cell of the trace matrix stores the trace directions of all alignments computed
+ * in one simd vector. This iterator moves like the wrapped iterator, but dereferencing it returns the
+ * seqan3::detail::trace_directions of the selected lane only. Accordingly, it can be wrapped in a
+ * seqan3::detail::trace_iterator to follow the trace path of a single alignment.
+ */
+template <two_dimensional_matrix_iterator matrix_iter_t>
+//!\cond
+    requires simd_concept<std::iter_value_t<matrix_iter_t>>
+//!\endcond
+class simd_trace_lane_iterator :
+    public two_dimensional_matrix_iterator_base<simd_trace_lane_iterator<matrix_iter_t>, matrix_major_order::column>
+{
+private:
+    //!\brief The type of the base class.
+    using base_t = two_dimensional_matrix_iterator_base<simd_trace_lane_iterator<matrix_iter_t>,
+                                                        matrix_major_order::column>;
+
+    //!\brief Befriend the base class to give access to the wrapped iterator.
+    friend base_t;
+
+    //!\brief The wrapped matrix iterator.
+    matrix_iter_t host_iter{};
+    //!\brief The selected lane.
+    size_t lane{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using value_type = trace_directions; //!< The value type.
+    using reference = trace_directions; //!< The reference type.
+    using pointer = void; //!< The pointer type.
+    using difference_type = std::iter_difference_t<matrix_iter_t>; //!< The difference type.
+    using iterator_category = std::random_access_iterator_tag; //!< The iterator category.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr simd_trace_lane_iterator() = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator(simd_trace_lane_iterator const &) = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator(simd_trace_lane_iterator &&) = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator & operator=(simd_trace_lane_iterator const &) = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator & operator=(simd_trace_lane_iterator &&) = default; //!< Defaulted.
+    ~simd_trace_lane_iterator() = default; //!< Defaulted.
+
+    /*!\brief Constructs from the wrapped matrix iterator and the lane to project on.
+     * \param[in] host_iter The wrapped matrix iterator.
+     * \param[in] lane The selected lane; must be smaller than the number of lanes of the simd vector.
+     */
+    constexpr simd_trace_lane_iterator(matrix_iter_t host_iter, size_t const lane) noexcept :
+        host_iter{std::move(host_iter)},
+        lane{lane}
+    {}
+    //!\}
+
+    //!\brief Returns the trace direction of the selected lane.
+    constexpr reference operator*() const noexcept
+    {
+        return static_cast<trace_directions>((*host_iter)[lane]);
+    }
+
+    // Import advance operator from base class.
+    using base_t::operator+=;
+
+    //!\brief Advances the iterator by the given `offset`.
+    constexpr simd_trace_lane_iterator & operator+=(matrix_offset const & offset) noexcept
+    {
+        host_iter += offset;
+        return *this;
+    }
+
+    //!\copydoc seqan3::detail::two_dimensional_matrix_iterator::coordinate()
+    matrix_coordinate coordinate() const noexcept
+    {
+        return host_iter.coordinate();
+    }
+};
+
+} // namespace seqan3::detail
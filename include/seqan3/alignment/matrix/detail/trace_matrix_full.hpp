@@ -17,12 +17,16 @@
 #include <vector>
 
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
+#include <seqan3/alignment/matrix/detail/simd_trace_lane_iterator.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/utility/concept/exposition_only/core_language.hpp>
 #include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
 #include <seqan3/utility/views/repeat_n.hpp>
 #include <seqan3/utility/views/zip.hpp>
 
@@ -33,12 +37,16 @@ namespace seqan3::detail
  * \ingroup alignment_matrix
  * \implements std::ranges::input_range
  *
- * \tparam trace_t The type of the trace; must be the same as seqan3::detail::trace_directions.
+ * \tparam trace_t The type of the trace; must be the same as seqan3::detail::trace_directions or model
+ *                 seqan3::simd::simd_concept.
  *
  * \details
  *
  * In the default trace back implementation we allocate the entire matrix using one byte per cell to store the
  * seqan3::detail::trace_directions.
+ * In the vectorised alignment every cell stores one simd vector, whose lanes hold the
+ * seqan3::detail::trace_directions of the alignments computed simultaneously. The trace path of a single alignment
+ * is then obtained by passing its lane to trace_path().
  *
  * ### Range interface
  *
@@ -49,7 +57,7 @@ namespace seqan3::detail
  */
 template <typename trace_t>
 //!\cond
-    requires std::same_as<trace_t, trace_directions>
+    requires std::same_as<trace_t, trace_directions> || simd_concept<trace_t>
 //!\endcond
 class trace_matrix_full
 {
@@ -101,7 +109,9 @@ public:
      * Resizes the entire trace matrix storing the best trace path and the horizontal trace column.
      * Note the trace matrix requires the number of columns and rows to be one bigger than the size of sequence1,
      * respectively sequence2 for the initialisation of the matrix.
-     * Reallocation happens only if the new column size exceeds the current capacity of the underlying trace matrix.
+     * Reallocation happens only if the new matrix size exceeds the current capacity of the underlying trace matrix,
+     * in which case exactly the requested size is allocated (see seqan3::detail::reserve_matrix_memory).
+     * The cells are not reset, since the alignment algorithm writes every trace cell before reading it.
      *
      * ### Complexity
      *
@@ -117,6 +127,8 @@ public:
     {
         this->column_count = column_count.get();
         this->row_count = row_count.get();
+        reserve_matrix_memory(complete_matrix, this->row_count * this->column_count, matrix_memory_growth::exact);
+        reserve_matrix_memory(horizontal_column, this->row_count);
         complete_matrix.resize(number_rows{this->row_count}, number_cols{this->column_count});
         horizontal_column.resize(this->row_count);
         vertical_column = views::repeat_n(trace_t{}, this->row_count);
@@ -140,6 +152,32 @@ public:
         return path_t{trace_iterator_t{complete_matrix.begin() + matrix_offset{trace_begin}}, std::default_sentinel};
     }
 
+    /*!\brief Returns the trace path of a single lane of the vectorised trace matrix starting from the given
+     *        coordinate and ending in the cell with seqan3::detail::trace_directions::none.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \param[in] lane The lane of the alignment whose trace shall be followed.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate or lane is out of range.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin, size_t const lane) const
+    //!\cond
+        requires simd_concept<trace_t>
+    //!\endcond
+    {
+        using lane_iter_t = simd_trace_lane_iterator<std::ranges::iterator_t<matrix_t const>>;
+        using trace_iterator_t = trace_iterator<lane_iter_t>;
+        using path_t = std::ranges::subrange<trace_iterator_t, std::default_sentinel_t>;
+
+        if (trace_begin.row >= row_count || trace_begin.col >= column_count)
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        if (lane >= simd_traits<trace_t>::length)
+            throw std::invalid_argument{"The given lane exceeds the number of lanes of the trace matrix."};
+
+        lane_iter_t lane_iter{complete_matrix.begin() + matrix_offset{trace_begin}, lane};
+        return path_t{trace_iterator_t{lane_iter}, std::default_sentinel};
+    }
+
     /*!\name Iterators
      * \{
      */
@@ -174,7 +212,7 @@ public:
  */
 template <typename trace_t>
 //!\cond
-    requires std::same_as<trace_t, trace_directions>
+    requires std::same_as<trace_t, trace_directions> || simd_concept<trace_t>
 //!\endcond
 class trace_matrix_full<trace_t>::iterator
 {
@@ -292,7 +330,7 @@ public:
  */
 template <typename trace_t>
 //!\cond
-    requires std::same_as<trace_t, trace_directions>
+    requires std::same_as<trace_t, trace_directions> || simd_concept<trace_t>
 //!\endcond
 class trace_matrix_full<trace_t>::iterator::column_proxy : public std::ranges::view_interface<column_proxy>
 {
@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_path_buffer.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Stores a single trace path instead of the trace directions of every cell of the alignment matrix.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * The trace path is stored from its begin to its end, i.e. from the top left to the bottom right of the alignment
+ * matrix, as a sequence of seqan3::detail::trace_directions::diagonal, seqan3::detail::trace_directions::up and
+ * seqan3::detail::trace_directions::left. This is the order in which the linear space alignment finds the path.
+ *
+ * Like the trace matrices, the buffer offers the trace_path() member, which follows the trace path backwards from its
+ * end. Thus, it can be used in place of a trace matrix to build the alignment with the
+ * seqan3::detail::aligned_sequence_builder.
+ */
+class trace_path_buffer
+{
+private:
+    class iterator;
+
+    //!\brief The trace directions of the path from its begin to its end.
+    std::vector<trace_directions> directions{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_path_buffer() = default; //!< Defaulted.
+    trace_path_buffer(trace_path_buffer const &) = default; //!< Defaulted.
+    trace_path_buffer(trace_path_buffer &&) = default; //!< Defaulted.
+    trace_path_buffer & operator=(trace_path_buffer const &) = default; //!< Defaulted.
+    trace_path_buffer & operator=(trace_path_buffer &&) = default; //!< Defaulted.
+    ~trace_path_buffer() = default; //!< Defaulted.
+    //!\}
+
+    //!\brief Removes all trace directions.
+    void clear() noexcept
+    {
+        directions.clear();
+    }
+
+    //!\brief Returns the number of trace directions of the path.
+    size_t size() const noexcept
+    {
+        return directions.size();
+    }
+
+    /*!\brief Appends the given number of trace directions to the end of the path.
+     * \param[in] direction The trace direction to append; must be seqan3::detail::trace_directions::diagonal,
+     *                      seqan3::detail::trace_directions::up or seqan3::detail::trace_directions::left.
+     * \param[in] count The number of times the direction is appended.
+     */
+    void append(trace_directions const direction, size_t const count = 1)
+    {
+        assert(direction == trace_directions::diagonal ||
+               direction == trace_directions::up ||
+               direction == trace_directions::left);
+
+        directions.insert(directions.end(), count, direction);
+    }
+
+    /*!\brief Appends the trace path of another buffer to the end of the path.
+     * \param[in] other The buffer whose trace path continues this path.
+     */
+    void append(trace_path_buffer const & other)
+    {
+        directions.insert(directions.end(), other.directions.begin(), other.directions.end());
+    }
+
+    /*!\brief Returns the trace path from the given end coordinate back to the begin of the path.
+     * \param[in] trace_begin A seqan3::detail::matrix_coordinate pointing to the end of the stored path.
+     * \returns A std::ranges::subrange over the trace directions; its iterator provides the current coordinate.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const;
+};
+
+/*!\brief The iterator following the stored trace path backwards.
+ * \implements std::forward_iterator
+ *
+ * \details
+ *
+ * In addition to the trace directions the iterator provides the coordinate of the current cell of the path.
+ * When it reached the end, this is the coordinate of the first cell of the path.
+ */
+class trace_path_buffer::iterator
+{
+private:
+    //!\brief The buffer storing the trace path.
+    trace_path_buffer const * host_ptr{nullptr};
+    //!\brief The number of trace directions that were not visited yet.
+    size_t remaining{};
+    //!\brief The coordinate of the current cell.
+    matrix_coordinate current_coordinate{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using value_type = trace_directions; //!< The value type.
+    using reference = trace_directions; //!< The reference type.
+    using pointer = void; //!< The pointer type.
+    using difference_type = std::ptrdiff_t; //!< The difference type.
+    using iterator_category = std::forward_iterator_tag; //!< The iterator category.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    iterator() = default; //!< Defaulted.
+    iterator(iterator const &) = default; //!< Defaulted.
+    iterator(iterator &&) = default; //!< Defaulted.
+    iterator & operator=(iterator const &) = default; //!< Defaulted.
+    iterator & operator=(iterator &&) = default; //!< Defaulted.
+    ~iterator() = default; //!< Defaulted.
+
+    /*!\brief Constructs the iterator at the end of the stored path.
+     * \param[in] host The buffer storing the trace path.
+     * \param[in] trace_begin The coordinate of the last cell of the path.
+     */
+    iterator(trace_path_buffer const & host, matrix_coordinate const & trace_begin) noexcept :
+        host_ptr{std::addressof(host)},
+        remaining{host.directions.size()},
+        current_coordinate{trace_begin}
+    {}
+    //!\}
+
+    //!\brief Returns the trace direction leading to the current cell.
+    reference operator*() const noexcept
+    {
+        assert(remaining > 0);
+        return host_ptr->directions[remaining - 1];
+    }
+
+    //!\brief Moves to the previous cell of the path.
+    iterator & operator++() noexcept
+    {
+        trace_directions const direction = **this;
+
+        if (direction != trace_directions::left) // diagonal or up
+            --current_coordinate.row;
+        if (direction != trace_directions::up) // diagonal or left
+            --current_coordinate.col;
+
+        --remaining;
+        return *this;
+    }
+
+    //!\brief Moves to the previous cell of the path and returns the previous iterator.
+    iterator operator++(int) noexcept
+    {
+        iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    //!\brief Returns the coordinate of the current cell.
+    matrix_coordinate coordinate() const noexcept
+    {
+        return current_coordinate;
+    }
+
+    //!\brief Checks whether both iterators point to the same cell of the path.
+    friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.remaining == rhs.remaining;
+    }
+
+    //!\brief Checks whether the iterator reached the begin of the path.
+    friend bool operator==(iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.remaining == 0;
+    }
+};
+
+inline auto trace_path_buffer::trace_path(matrix_coordinate const & trace_begin) const
+{
+    return std::ranges::subrange<iterator, std::default_sentinel_t>{iterator{*this, trace_begin},
+                                                                    std::default_sentinel};
+}
+
+} // namespace seqan3::detail
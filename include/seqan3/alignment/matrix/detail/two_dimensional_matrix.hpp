@@ -242,6 +242,26 @@ public:
         storage.resize(this->row_dim * this->col_dim);
     }
 
+    /*!\brief Reserves memory for at least the given number of matrix cells.
+     *
+     * \param new_capacity The number of cells to reserve memory for.
+     *
+     * \details
+     *
+     * Does not change the dimensions of the matrix, but a subsequent call to
+     * seqan3::detail::two_dimensional_matrix::resize with at most `new_capacity` cells will not reallocate.
+     */
+    void reserve(size_t const new_capacity)
+    {
+        storage.reserve(new_capacity);
+    }
+
+    //!\brief Returns the number of cells that can be stored without reallocation.
+    size_t capacity() const noexcept
+    {
+        return storage.capacity();
+    }
+
     //!\copydoc seqan3::detail::matrix::rows
     size_t rows() const noexcept
     {
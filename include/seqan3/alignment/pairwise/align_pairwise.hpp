@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <seqan3/std/concepts>
 #include <functional>
 #include <iostream>
@@ -19,6 +20,7 @@
 #include <tuple>
 #include <type_traits>
 
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/alignment/pairwise/alignment_configurator.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -57,6 +59,8 @@ namespace seqan3
  * Alternatively, you can use std::tie as shown in the example below:
  * \snippet test/snippet/alignment/pairwise/align_pairwise.cpp example2
  *
+ * With seqan3::align_cfg::method_extension, a seqan3::alignment_seed is passed as the third element of the tuple.
+ *
  * ### Compute multiple alignments
  *
  * In many cases one needs to compute multiple pairwise alignments. Accordingly, the align_pairwise interface allows
@@ -126,6 +130,12 @@ namespace seqan3
  * This function is re-entrant, i.e. it is always safe to call in parallel with different inputs. It is thread-safe,
  * i.e. it is safe to call in parallel with the same input under the condition that the input sequences do not change
  * when being iterated over.
+ *
+ * ### Memory
+ *
+ * The alignment matrices are kept by every thread that computes alignments and reused by the following alignments
+ * of this thread. Matrices with more than 2^26 cells are not kept for smaller alignments. Call
+ * seqan3::release_alignment_matrix_memory to free the kept matrices of the calling thread.
  */
 template <typename sequence_t, typename alignment_config_t>
 //!\cond
@@ -139,12 +149,17 @@ constexpr auto align_pairwise(sequence_t && seq, alignment_config_t const & conf
 
     if constexpr (std::is_lvalue_reference_v<sequence_t>)  // Forward tuple elements as references.
     {
-        return align_pairwise(std::tie(get<0>(seq), get<1>(seq)), config);
+        if constexpr (std::tuple_size_v<std::remove_reference_t<sequence_t>> == 3) // Sequence pair with a seed.
+            return align_pairwise(std::tie(get<0>(seq), get<1>(seq), get<2>(seq)), config);
+        else
+            return align_pairwise(std::tie(get<0>(seq), get<1>(seq)), config);
     }
     else
     {
-        static_assert(std::tuple_size_v<std::remove_reference_t<sequence_t>> == 2,
-                      "Alignment configuration error: Expects exactly two sequences for pairwise alignments.");
+        static_assert(std::tuple_size_v<std::remove_reference_t<sequence_t>> == 2 ||
+                      std::tuple_size_v<std::remove_reference_t<sequence_t>> == 3,
+                      "Alignment configuration error: Expects exactly two sequences for pairwise alignments, "
+                      "optionally followed by a seed.");
 
         static_assert(std::ranges::viewable_range<std::tuple_element_t<0, std::remove_reference_t<sequence_t>>> &&
                       std::ranges::viewable_range<std::tuple_element_t<1, std::remove_reference_t<sequence_t>>>,
@@ -177,13 +192,17 @@ constexpr auto align_pairwise(sequence_t && sequences,
     using complete_config_t = std::remove_cvref_t<decltype(complete_config)>;
     using traits_t = detail::alignment_configuration_traits<complete_config_t>;
 
-    auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0))
-                                     | views::chunk(traits_t::alignments_per_vector);
+    // The length aware batching sorts windows of several simd vectors.
+    size_t chunk_size = traits_t::alignments_per_vector;
+    if constexpr (traits_t::is_length_aware_batching)
+        chunk_size = std::max<size_t>(chunk_size, get<align_cfg::length_aware_batching>(complete_config).window_size);
+
+    auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0)) | views::chunk(chunk_size);
 
     using indexed_sequences_t = decltype(indexed_sequence_chunk_view);
     using alignment_result_t = typename traits_t::alignment_result_type;
     using execution_handler_t = std::conditional_t<complete_config_t::template exists<align_cfg::parallel>(),
-                                                   detail::execution_handler_parallel,
+                                                   detail::execution_handler_work_stealing,
                                                    detail::execution_handler_sequential>;
     using executor_t = detail::algorithm_executor_blocking<indexed_sequences_t,
                                                            decltype(algorithm),
@@ -193,7 +212,7 @@ constexpr auto align_pairwise(sequence_t && sequences,
     // Select the execution handler for the alignment configuration.
     auto select_execution_handler = [parallel = complete_config.get_or(align_cfg::parallel{})] ()
     {
-        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_work_stealing>)
         {
             auto thread_count = parallel.thread_count;
             if (!thread_count)
@@ -219,4 +238,26 @@ constexpr auto align_pairwise(sequence_t && sequences,
 }
 //!\endcond
 
+/*!\brief Frees the alignment matrices that the calling thread keeps for its following alignments.
+ * \ingroup alignment_pairwise
+ *
+ * \details
+ *
+ * To avoid allocations, every thread that computes alignments with seqan3::align_pairwise keeps the memory of its
+ * alignment matrices for the following alignments. Matrices with more than 2^26 cells are not kept for smaller
+ * alignments, but the memory of all other matrices is only freed when the thread ends or when this function is called
+ * by the thread. This is useful after computing a few long alignments, e.g. with traceback, in a long running thread.
+ *
+ * Only the memory of the calling thread is freed; the threads of seqan3::align_cfg::parallel keep their matrices
+ * until they end, i.e. until the range returned by seqan3::align_pairwise is destroyed.
+ * This function must not be called while an alignment is computed by the calling thread, e.g. from the callback of
+ * seqan3::align_cfg::on_result.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+inline void release_alignment_matrix_memory()
+{
+    detail::matrix_memory_cache::local().release();
+}
+
 } // namespace seqan3
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -28,14 +29,21 @@
 #include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_adaptive.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_extension.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_linear_space.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_striped.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_wavefront.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_matrix.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion_banded.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion_striped.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_with_trace_recursion.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_with_trace_recursion_banded.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_optimum_tracker_simd.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_optimum_tracker_simd_adaptive.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_optimum_tracker.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_scoring_scheme.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
@@ -91,11 +99,16 @@ private:
     //!\}
 
 public:
-    //!\brief Tests whether the value type of `range_type` is a tuple with exactly 2 members.
+    /*!\brief Tests whether the value type of `range_type` is a tuple with exactly 2 members, or with exactly 3 members
+     *        if the seqan3::align_cfg::method_extension is configured.
+     */
     constexpr static bool expects_tuple_like_value_type()
     {
+        constexpr size_t expected_size =
+            alignment_config_type::template exists<seqan3::align_cfg::method_extension>() ? 3 : 2;
+
         return tuple_like<alignment_config_type> &&
-               std::tuple_size_v<std::ranges::range_value_t<unref_range_type>> == 2;
+               std::tuple_size_v<std::ranges::range_value_t<unref_range_type>> == expected_size;
     }
 
     //!\brief Tests whether the scoring scheme is set and can be invoked with the sequences passed.
@@ -121,8 +134,9 @@ public:
     {
         const bool is_global = alignment_config_type::template exists<seqan3::align_cfg::method_global>();
         const bool is_local = alignment_config_type::template exists<seqan3::align_cfg::method_local>();
+        const bool is_extension = alignment_config_type::template exists<seqan3::align_cfg::method_extension>();
 
-        return (is_global || is_local);
+        return (is_global || is_local || is_extension);
     }
 };
 
@@ -267,7 +281,7 @@ public:
     //!\endcond
     static constexpr auto configure(config_t const & cfg)
     {
-        auto config_with_output = maybe_default_output(cfg);
+        auto config_with_output = maybe_remove_vectorised_options(maybe_default_output(cfg));
         using config_with_output_t = decltype(config_with_output);
 
         // ----------------------------------------------------------------------------
@@ -309,7 +323,7 @@ public:
         static_assert(alignment_contract_t::expects_tuple_like_value_type(),
                       "Alignment configuration error: "
                       "The value type of the sequence ranges must model the seqan3::tuple_like and must contain "
-                      "exactly 2 elements.");
+                      "exactly 2 elements, or exactly 3 elements with a seed for the align_cfg::method_extension.");
 
         static_assert(alignment_contract_t::expects_valid_scoring_scheme(),
                       "Alignment configuration error: "
@@ -390,23 +404,73 @@ private:
                             align_cfg::output_sequence2_id{};
     }
 
+    /*!\brief Removes the options of the vectorised alignment that the configured alignment does not support.
+     *
+     * \tparam config_t The type of the alignment configuration.
+     *
+     * \param[in] config The alignment configuration to check.
+     *
+     * \returns Either the original config or a new config without seqan3::align_cfg::adaptive_score_type,
+     *          seqan3::align_cfg::length_aware_batching, seqan3::align_cfg::striped_vectorised,
+     *          seqan3::align_cfg::linear_space_traceback, seqan3::align_cfg::wavefront and
+     *          seqan3::align_cfg::vectorised.
+     *
+     * \details
+     *
+     * The vectorised seed extension only computes the score, the begin and the end positions. If the alignment is
+     * requested, the seeds are extended with the scalar extension.
+     * The adaptive score type and the length aware batching are only implemented for the unbanded global alignment in
+     * vectorised mode. All other alignments are computed with the default score type and the sequence pairs are
+     * passed to them in chunks of the respective size and in the order of the input.
+     * The striped vectorisation only computes the score and the end positions of the unbanded alignment. Otherwise,
+     * the scalar alignment is computed.
+     * The linear space traceback is only implemented for the unbanded scalar global alignment that computes more than
+     * the score and the end positions. Otherwise, the trace matrix is used or no trace is computed at all.
+     * The wavefront alignment is only implemented for the unbanded scalar global alignment. Whether its scoring can be
+     * translated into penalties is only known at runtime (see make_algorithm()).
+     */
+    template <typename config_t>
+    static constexpr auto maybe_remove_vectorised_options(config_t const & config) noexcept
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (traits_t::is_extension && traits_t::is_vectorised && traits_t::compute_sequence_alignment)
+            return maybe_remove_vectorised_options(config.template remove<align_cfg::vectorised>());
+        else if constexpr (traits_t::is_wavefront &&
+                      (traits_t::is_local || traits_t::is_banded || traits_t::is_vectorised || traits_t::is_debug))
+            return maybe_remove_vectorised_options(config.template remove<align_cfg::wavefront>());
+        else if constexpr (traits_t::is_striped_vectorised &&
+                           (traits_t::is_banded || traits_t::is_debug || traits_t::requires_trace_information))
+            return maybe_remove_vectorised_options(config.template remove<align_cfg::striped_vectorised>());
+        else if constexpr (traits_t::is_linear_space_traceback &&
+                           (traits_t::is_local || traits_t::is_banded || traits_t::is_vectorised ||
+                            traits_t::is_debug || !traits_t::requires_trace_information))
+            return maybe_remove_vectorised_options(config.template remove<align_cfg::linear_space_traceback>());
+        else if constexpr (traits_t::is_vectorised && traits_t::is_global && !traits_t::is_banded && !traits_t::is_debug)
+            return config;
+        else if constexpr (traits_t::is_adaptive_score_type)
+            return maybe_remove_vectorised_options(config.template remove<align_cfg::adaptive_score_type>());
+        else if constexpr (traits_t::is_length_aware_batching)
+            return maybe_remove_vectorised_options(config.template remove<align_cfg::length_aware_batching>());
+        else
+            return config;
+    }
+
     /*!\brief Configures the edit distance algorithm.
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
      * \tparam config_t           The alignment configuration type.
      * \param[in] cfg             The passed configuration object.
+     *
+     * \details
+     *
+     * If seqan3::align_cfg::vectorised is configured, seqan3::detail::edit_distance_algorithm computes the sequence
+     * pairs of a chunk with seqan3::detail::edit_distance_unbanded_simd whenever the requested output allows it.
+     * If seqan3::align_cfg::band_fixed_size is configured, the pairs are computed with
+     * seqan3::detail::edit_distance_banded.
      */
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_edit_distance(config_t const & cfg)
     {
-        using traits_t = alignment_configuration_traits<config_t>;
-
-        // ----------------------------------------------------------------------------
-        // Unsupported configurations
-        // ----------------------------------------------------------------------------
-
-        if constexpr (traits_t::is_banded)
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
-
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
         // ----------------------------------------------------------------------------
@@ -490,12 +554,34 @@ private:
         // refactor step-by-step to the new implementation. The new implementation will be tested in
         // macrobenchmarks to show that it maintains a high performance.
 
+        if constexpr (traits_t::is_extension)
+        {
+            return make_extension_alignment_algorithm(cfg);
+        }
+        else if constexpr (traits_t::is_wavefront)
+        {
+            // Without a penalty translation, e.g. with free end gaps, the alignment is computed without wavefronts.
+            if (make_wavefront_penalties(cfg).has_value())
+                return make_wavefront_alignment_algorithm(cfg);
+            else
+                return make_algorithm<function_wrapper_t, policies_t...>(cfg.template remove<align_cfg::wavefront>());
+        }
+        else if constexpr (traits_t::is_striped_vectorised)
+        {
+            return make_striped_alignment_algorithm(cfg);
+        }
+        else if constexpr (traits_t::is_linear_space_traceback)
+        {
+            return make_linear_space_alignment_algorithm(cfg);
+        }
         // Use old alignment implementation if...
-        if constexpr (traits_t::is_local ||                                          // it is a local alignment,
+        else if constexpr (traits_t::is_local ||                                          // it is a local alignment,
                       traits_t::is_debug ||                                          // it runs in debug mode,
-                      traits_t::compute_sequence_alignment ||                        // it computes more than the begin position.
+                     (traits_t::compute_sequence_alignment && !traits_t::is_vectorised) || // scalar alignment.
                      (traits_t::is_banded && traits_t::compute_begin_positions) ||   // banded && more than end positions.
-                     (traits_t::is_vectorised && traits_t::compute_end_positions))   // simd and more than the score.
+                     (traits_t::is_banded && traits_t::compute_sequence_alignment) || // banded && alignment.
+                     (traits_t::is_vectorised && traits_t::is_banded &&
+                      traits_t::compute_end_positions))                             // banded simd and more than the score.
         {
             using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
             using gap_policy_t = typename select_gap_policy<traits_t>::type;
@@ -504,90 +590,283 @@ private:
 
             return alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, find_optimum_t, gap_init_policy_t, policies_t...>{cfg};
         }
+        else if constexpr (traits_t::is_adaptive_score_type)
+        {
+            return configure_adaptive_score_type<function_wrapper_t>(cfg);
+        }
         else  // Use new alignment algorithm implementation.
         {
-            //----------------------------------------------------------------------------------------------------------
-            // Configure the optimum tracker policy.
-            //----------------------------------------------------------------------------------------------------------
-
-            using scalar_optimum_updater_t = std::conditional_t<traits_t::is_banded,
-                                                                max_score_banded_updater,
-                                                                max_score_updater>;
-
-            using optimum_tracker_policy_t =
-                lazy_conditional_t<traits_t::is_vectorised,
-                                   lazy<policy_optimum_tracker_simd, config_t, max_score_updater_simd_global>,
-                                   lazy<policy_optimum_tracker, config_t, scalar_optimum_updater_t>>;
-
-            //----------------------------------------------------------------------------------------------------------
-            // Configure the gap scheme policy.
-            //----------------------------------------------------------------------------------------------------------
-
-            using gap_cost_policy_t = typename select_gap_recursion_policy<config_t>::type;
-
-            //----------------------------------------------------------------------------------------------------------
-            // Configure the result builder policy.
-            //----------------------------------------------------------------------------------------------------------
-
-            using result_builder_policy_t = policy_alignment_result_builder<config_t>;
-
-            //----------------------------------------------------------------------------------------------------------
-            // Configure the scoring scheme policy.
-            //----------------------------------------------------------------------------------------------------------
-
-            using alignment_method_t = std::conditional_t<traits_t::is_global,
-                                                          seqan3::align_cfg::method_global,
-                                                          seqan3::align_cfg::method_local>;
-
-            using score_t = typename traits_t::score_type;
-            using scoring_scheme_t = typename traits_t::scoring_scheme_type;
-            constexpr bool is_aminoacid_scheme = is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
-
-            using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                            lazy<simd_match_mismatch_scoring_scheme,
-                                                                 score_t,
-                                                                 typename traits_t::scoring_scheme_alphabet_type,
-                                                                 alignment_method_t>,
-                                                            void>;
-            using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                            lazy<simd_matrix_scoring_scheme,
-                                                                 score_t,
-                                                                 typename traits_t::scoring_scheme_alphabet_type,
-                                                                 alignment_method_t>,
-                                                            void>;
-
-            using alignment_scoring_scheme_t = std::conditional_t<traits_t::is_vectorised,
-                                                                  std::conditional_t<is_aminoacid_scheme,
-                                                                                     matrix_simd_scheme_t,
-                                                                                     simple_simd_scheme_t>,
-                                                                  scoring_scheme_t>;
-
-            using scoring_scheme_policy_t = policy_scoring_scheme<config_t, alignment_scoring_scheme_t>;
-
-            //----------------------------------------------------------------------------------------------------------
-            // Configure the alignment matrix policy.
-            //----------------------------------------------------------------------------------------------------------
-
-            using score_matrix_t = score_matrix_single_column<score_t>;
-            using trace_matrix_t = trace_matrix_full<trace_directions>;
-
-            using alignment_matrix_t = std::conditional_t<traits_t::requires_trace_information,
-                                                          combined_score_and_trace_matrix<score_matrix_t,
-                                                                                          trace_matrix_t>,
-                                                          score_matrix_t>;
-            using alignment_matrix_policy_t = policy_alignment_matrix<traits_t, alignment_matrix_t>;
-
-            //----------------------------------------------------------------------------------------------------------
-            // Configure the final alignment algorithm.
-            //----------------------------------------------------------------------------------------------------------
-
-            using algorithm_t = select_alignment_algorithm_t<traits_t,
-                                                             config_t,
-                                                             gap_cost_policy_t,
-                                                             optimum_tracker_policy_t,
-                                                             result_builder_policy_t,
-                                                             scoring_scheme_policy_t,
-                                                             alignment_matrix_policy_t>;
+            return make_pairwise_alignment_algorithm(cfg);
+        }
+    }
+
+    /*!\brief Configures the alignment with seqan3::align_cfg::striped_vectorised.
+     *
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured alignment algorithm.
+     */
+    template <typename config_t>
+    static constexpr auto make_striped_alignment_algorithm(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        return pairwise_alignment_algorithm_striped<config_t,
+                                                    policy_affine_gap_recursion_striped<config_t>,
+                                                    policy_scoring_scheme<config_t,
+                                                                          typename traits_t::scoring_scheme_type>,
+                                                    policy_alignment_result_builder<config_t>>{cfg};
+    }
+
+    /*!\brief Configures the alignment with seqan3::align_cfg::wavefront.
+     *
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured alignment algorithm.
+     */
+    template <typename config_t>
+    static constexpr auto make_wavefront_alignment_algorithm(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        return pairwise_alignment_algorithm_wavefront<config_t,
+                                                      policy_scoring_scheme<config_t,
+                                                                            typename traits_t::scoring_scheme_type>,
+                                                      policy_alignment_result_builder<config_t>>{cfg};
+    }
+
+    /*!\brief Configures the alignment with seqan3::align_cfg::method_extension.
+     *
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured alignment algorithm.
+     *
+     * \details
+     *
+     * The scoring scheme policy stores the scalar scoring scheme also in vectorised mode, since the extension
+     * constructs its vectorised scoring scheme for the lanes it computes with.
+     */
+    template <typename config_t>
+    static constexpr auto make_extension_alignment_algorithm(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        return pairwise_alignment_algorithm_extension<config_t,
+                                                      policy_scoring_scheme<config_t,
+                                                                            typename traits_t::scoring_scheme_type>,
+                                                      policy_alignment_result_builder<config_t>>{cfg};
+    }
+
+    /*!\brief Configures the alignment with seqan3::align_cfg::linear_space_traceback.
+     *
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured alignment algorithm.
+     *
+     * \details
+     *
+     * The policies are the same as for the scalar alignment computing only the score and the end positions.
+     */
+    template <typename config_t>
+    static constexpr auto make_linear_space_alignment_algorithm(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using score_matrix_t = score_matrix_single_column<typename traits_t::score_type>;
+
+        return pairwise_alignment_algorithm_linear_space<config_t,
+                                                         policy_affine_gap_recursion<config_t>,
+                                                         policy_optimum_tracker<config_t, max_score_updater>,
+                                                         policy_alignment_result_builder<config_t>,
+                                                         policy_scoring_scheme<config_t,
+                                                                               typename traits_t::scoring_scheme_type>,
+                                                         policy_alignment_matrix<traits_t, score_matrix_t>>{cfg};
+    }
+
+    /*!\brief Configures the vectorised alignment with seqan3::align_cfg::adaptive_score_type.
+     *
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured alignment algorithm.
+     *
+     * \details
+     *
+     * Constructs the alignment algorithms for 32, 16 and 8 bit lanes, where every algorithm hands the sequence pairs
+     * it cannot compute over to the algorithm with the next wider lanes. The 8 bit lanes are not used with scoring
+     * schemes that are not based on a match and a mismatch score, since the vectorised lookup of such a scoring
+     * scheme needs more than 8 bits. Neither are lanes used whose score type is too small for the largest score
+     * difference between two adjacent cells.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_adaptive_score_type(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using scoring_scheme_t = typename traits_t::scoring_scheme_type;
+        constexpr bool is_aminoacid_scheme = is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
+
+        auto base_cfg = cfg.template remove<align_cfg::adaptive_score_type>();
+        int64_t const score_step = max_score_step(cfg);
+
+        // A score type can only be used if a few steps fit into the range of the score type.
+        auto fits = [score_step] (auto score) constexpr
+        {
+            return 2 * score_step < std::numeric_limits<decltype(score)>::max();
+        };
+
+        auto algorithm_32 = make_pairwise_alignment_algorithm(base_cfg | align_cfg::score_type<int32_t>{});
+
+        if (!fits(int16_t{}))
+            return algorithm_32;
+
+        auto algorithm_16 = make_pairwise_alignment_algorithm(base_cfg | align_cfg::score_type<int16_t>{},
+                                                              std::move(algorithm_32));
+
+        if constexpr (is_aminoacid_scheme)
+        {
+            return algorithm_16;
+        }
+        else
+        {
+            if (!fits(int8_t{}))
+                return algorithm_16;
+
+            return make_pairwise_alignment_algorithm(base_cfg | align_cfg::score_type<int8_t>{},
+                                                     std::move(algorithm_16));
+        }
+    }
+
+    /*!\brief Constructs the alignment algorithm that is not yet implemented by the policies of the old algorithm.
+     *
+     * \tparam config_t The alignment configuration type.
+     * \tparam fallback_algorithm_t The type of the algorithm that computes the sequence pairs exceeding the score type
+     *                              in the adaptive vectorised alignment, or seqan3::detail::empty_type.
+     *
+     * \param[in] cfg The passed configuration object.
+     * \param[in] fallback_algorithm The algorithm that computes the sequence pairs exceeding the score type.
+     *
+     * \returns the configured alignment algorithm.
+     *
+     * \details
+     *
+     * If a fallback algorithm is given, a seqan3::detail::pairwise_alignment_algorithm_adaptive is constructed.
+     * Otherwise, the unbanded or the banded alignment algorithm is constructed.
+     */
+    template <typename config_t, typename fallback_algorithm_t = empty_type>
+    static constexpr auto make_pairwise_alignment_algorithm(config_t const & cfg,
+                                                            fallback_algorithm_t fallback_algorithm = {})
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        constexpr bool is_adaptive = !std::same_as<fallback_algorithm_t, empty_type>;
+
+        //--------------------------------------------------------------------------------------------------------------
+        // Configure the optimum tracker policy.
+        //--------------------------------------------------------------------------------------------------------------
+
+        using scalar_optimum_updater_t = std::conditional_t<traits_t::is_banded,
+                                                            max_score_banded_updater,
+                                                            max_score_updater>;
+
+        using simd_optimum_tracker_t =
+            std::conditional_t<is_adaptive,
+                               lazy<policy_optimum_tracker_simd_adaptive, config_t, max_score_updater_simd_global>,
+                               lazy<policy_optimum_tracker_simd, config_t, max_score_updater_simd_global>>;
+
+        using optimum_tracker_policy_t =
+            lazy_conditional_t<traits_t::is_vectorised,
+                               simd_optimum_tracker_t,
+                               lazy<policy_optimum_tracker, config_t, scalar_optimum_updater_t>>;
+
+        //--------------------------------------------------------------------------------------------------------------
+        // Configure the gap scheme policy.
+        //--------------------------------------------------------------------------------------------------------------
+
+        using gap_cost_policy_t = typename select_gap_recursion_policy<config_t>::type;
+
+        //--------------------------------------------------------------------------------------------------------------
+        // Configure the result builder policy.
+        //--------------------------------------------------------------------------------------------------------------
+
+        using result_builder_policy_t = policy_alignment_result_builder<config_t>;
+
+        //--------------------------------------------------------------------------------------------------------------
+        // Configure the scoring scheme policy.
+        //--------------------------------------------------------------------------------------------------------------
+
+        using alignment_method_t = std::conditional_t<traits_t::is_global,
+                                                      seqan3::align_cfg::method_global,
+                                                      seqan3::align_cfg::method_local>;
+
+        using score_t = typename traits_t::score_type;
+        using scoring_scheme_t = typename traits_t::scoring_scheme_type;
+        constexpr bool is_aminoacid_scheme = is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
+
+        using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                        lazy<simd_match_mismatch_scoring_scheme,
+                                                             score_t,
+                                                             typename traits_t::scoring_scheme_alphabet_type,
+                                                             alignment_method_t>,
+                                                        void>;
+        using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                        lazy<simd_matrix_scoring_scheme,
+                                                             score_t,
+                                                             typename traits_t::scoring_scheme_alphabet_type,
+                                                             alignment_method_t>,
+                                                        void>;
+
+        using alignment_scoring_scheme_t = std::conditional_t<traits_t::is_vectorised,
+                                                              std::conditional_t<is_aminoacid_scheme,
+                                                                                 matrix_simd_scheme_t,
+                                                                                 simple_simd_scheme_t>,
+                                                              scoring_scheme_t>;
+
+        using scoring_scheme_policy_t = policy_scoring_scheme<config_t, alignment_scoring_scheme_t>;
+
+        //--------------------------------------------------------------------------------------------------------------
+        // Configure the alignment matrix policy.
+        //--------------------------------------------------------------------------------------------------------------
+
+        using score_matrix_t = score_matrix_single_column<score_t>;
+        using trace_matrix_t = trace_matrix_full<typename traits_t::trace_type>;
+
+        using alignment_matrix_t = std::conditional_t<traits_t::requires_trace_information,
+                                                      combined_score_and_trace_matrix<score_matrix_t,
+                                                                                      trace_matrix_t>,
+                                                      score_matrix_t>;
+        using alignment_matrix_policy_t = policy_alignment_matrix<traits_t, alignment_matrix_t>;
+
+        //--------------------------------------------------------------------------------------------------------------
+        // Configure the final alignment algorithm.
+        //--------------------------------------------------------------------------------------------------------------
+
+        using algorithm_t = select_alignment_algorithm_t<traits_t,
+                                                         config_t,
+                                                         gap_cost_policy_t,
+                                                         optimum_tracker_policy_t,
+                                                         result_builder_policy_t,
+                                                         scoring_scheme_policy_t,
+                                                         alignment_matrix_policy_t>;
+        if constexpr (is_adaptive)
+        {
+            return pairwise_alignment_algorithm_adaptive<fallback_algorithm_t,
+                                                         config_t,
+                                                         gap_cost_policy_t,
+                                                         optimum_tracker_policy_t,
+                                                         result_builder_policy_t,
+                                                         scoring_scheme_policy_t,
+                                                         alignment_matrix_policy_t>{cfg, std::move(fallback_algorithm)};
+        }
+        else
+        {
             return algorithm_t{cfg};
         }
     }
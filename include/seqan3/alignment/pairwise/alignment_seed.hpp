@@ -0,0 +1,45 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::alignment_seed.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The seed from which the seqan3::align_cfg::method_extension extends the alignment.
+ * \ingroup alignment_pairwise
+ *
+ * \details
+ *
+ * A seed is a diagonal of the alignment matrix, usually a region where both sequences match. It begins at
+ * seqan3::alignment_seed::sequence1_position in the first sequence and at seqan3::alignment_seed::sequence2_position
+ * in the second sequence and spans seqan3::alignment_seed::length symbols of both sequences.
+ * The seed must lie within both sequences, but its symbols do not need to match; they are scored with the configured
+ * scoring scheme.
+ */
+struct alignment_seed
+{
+    //!\brief The position of the first symbol of the seed in the first sequence.
+    size_t sequence1_position{};
+    //!\brief The position of the first symbol of the seed in the second sequence.
+    size_t sequence2_position{};
+    //!\brief The number of symbols of the seed.
+    size_t length{};
+
+    //!\brief Checks whether both seeds are equal.
+    friend bool operator==(alignment_seed const &, alignment_seed const &) = default;
+};
+
+} // namespace seqan3
@@ -82,6 +82,10 @@
  *
  * \include{doc} doc/fragments/alignment_configuration_align_config_method_local.md
  *
+ * The \ref seqan3::align_cfg::method_extension "seed extension" computes the alignment around a given
+ * seqan3::alignment_seed. It extends the seed to both sides until the score drops too far below the best score,
+ * which is the extension step of seed-and-extend approaches.
+ *
  * # Using scoring and gap schemes
  *
  * To compute an alignment a scoring and a gap scheme must be provided which give a "score" for substituting, inserting,
@@ -270,6 +274,7 @@
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/alignment_configurator.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/alignment_seed.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_algorithm.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
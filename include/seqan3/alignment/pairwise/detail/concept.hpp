@@ -15,6 +15,7 @@
 #include <seqan3/std/ranges>
 #include <tuple>
 
+#include <seqan3/alignment/pairwise/alignment_seed.hpp>
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 
@@ -46,6 +47,32 @@ concept sequence_pair = requires ()
 };
 //!\endcond
 
+/*!\interface seqan3::detail::seeded_sequence_pair <>
+ * \brief A helper concept to check if a type is a sequence pair with a seed.
+ * \ingroup alignment_pairwise
+ *
+ * \tparam t The type to check.
+ *
+ * \details
+ *
+ * This concept checks if the given type models seqan3::tuple_like with exactly three elements, where the first two
+ * elements fulfil the requirements of seqan3::detail::sequence_pair and the third element is convertible to
+ * seqan3::alignment_seed. Such a tuple is the input of the seqan3::align_cfg::method_extension.
+ */
+//!\cond
+template <typename t>
+concept seeded_sequence_pair = requires ()
+{
+    requires tuple_like<t>;
+    requires std::tuple_size_v<t> == 3;
+    requires std::ranges::forward_range<std::tuple_element_t<0, t>>;
+    requires std::ranges::forward_range<std::tuple_element_t<1, t>>;
+    requires semialphabet<std::ranges::range_value_t<std::tuple_element_t<0, t>>>;
+    requires semialphabet<std::ranges::range_value_t<std::tuple_element_t<1, t>>>;
+    requires std::convertible_to<std::tuple_element_t<2, t>, alignment_seed>;
+};
+//!\endcond
+
 /*!\interface seqan3::detail::sequence_pair_range <>
  * \brief A helper concept to check if a type is a range over seqan3::detail::sequence_pair.
  * \ingroup alignment_pairwise
@@ -55,11 +82,13 @@ concept sequence_pair = requires ()
  * \details
  *
  * This concept checks if the given type models a std::ranges::forward_range and that the value type of the
- * range models seqan3::detail::sequence_pair.
+ * range models seqan3::detail::sequence_pair or seqan3::detail::seeded_sequence_pair.
  */
 //!\cond
 template <typename t>
-concept sequence_pair_range = std::ranges::forward_range<t> && sequence_pair<std::ranges::range_value_t<t>>;
+concept sequence_pair_range = std::ranges::forward_range<t> &&
+                              (sequence_pair<std::ranges::range_value_t<t>> ||
+                               seeded_sequence_pair<std::ranges::range_value_t<t>>);
 //!\endcond
 
 /*!\interface seqan3::detail::indexed_sequence_pair_range <>
@@ -75,7 +104,8 @@ concept sequence_pair_range = std::ranges::forward_range<t> && sequence_pair<std
  * that shall be aligned and an index that is used to identify the aligned sequence pair.
  * The caller can then infer the aligned sequences from the returned seqan3::alignment_result.
  * The layout of this indexed sequence type looks as follows:
- * * the first type of the pair must model seqan3::detail::sequence_pair, and
+ * * the first type of the pair must model seqan3::detail::sequence_pair or seqan3::detail::seeded_sequence_pair,
+ *   and
  * * the second type of the pair refers to the respective index type, which can be any type but must model
  *   std::copy_constructible.
  */
@@ -86,7 +116,8 @@ concept indexed_sequence_pair_range = std::ranges::forward_range<t> &&
 {
     requires tuple_like<decltype(value)>;
     requires std::tuple_size_v<decltype(value)> == 2;
-    requires sequence_pair<std::tuple_element_t<0, decltype(value)>>;
+    requires sequence_pair<std::tuple_element_t<0, decltype(value)>> ||
+             seeded_sequence_pair<std::tuple_element_t<0, decltype(value)>>;
     requires std::copy_constructible<std::tuple_element_t<1, decltype(value)>>;
 };
 //!\endcond
@@ -99,15 +130,15 @@ concept indexed_sequence_pair_range = std::ranges::forward_range<t> &&
  *
  * \details
  *
- * The given type must model seqan3::detail::sequence_pair and both contained types must model
- * std::ranges::viewable_range.
+ * The given type must model seqan3::detail::sequence_pair or seqan3::detail::seeded_sequence_pair and both
+ * contained sequence types must model std::ranges::viewable_range.
  *
  * \see seqan3::detail::align_pairwise_range_input
  */
 //!\cond
 template <typename t>
 concept align_pairwise_single_input =
-    sequence_pair<std::remove_reference_t<t>> &&
+    (sequence_pair<std::remove_reference_t<t>> || seeded_sequence_pair<std::remove_reference_t<t>>) &&
     std::is_lvalue_reference_v<t> ||
     (std::ranges::viewable_range<std::tuple_element_t<0, std::remove_reference_t<t>>> &&
      std::ranges::viewable_range<std::tuple_element_t<1, std::remove_reference_t<t>>>);
@@ -134,7 +165,7 @@ concept align_pairwise_single_input =
 template <typename t>
 concept align_pairwise_range_input =
     std::ranges::forward_range<t> &&
-    sequence_pair<std::ranges::range_value_t<t>> &&
+    (sequence_pair<std::ranges::range_value_t<t>> || seeded_sequence_pair<std::ranges::range_value_t<t>>) &&
     ((std::ranges::viewable_range<t> && std::is_lvalue_reference_v<std::ranges::range_reference_t<t>>) ||
      align_pairwise_single_input<std::remove_reference_t<std::ranges::range_reference_t<t>>>);
 //!\endcond
@@ -12,8 +12,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <seqan3/std/concepts>
+#include <numeric>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <tuple>
+#include <vector>
 
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
@@ -156,9 +161,168 @@ public:
         requires traits_type::is_vectorised && std::invocable<callback_t, alignment_result_type>
     //!\endcond
     auto operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        if constexpr (traits_type::is_length_aware_batching)
+        {
+            compute_length_sorted_batches(indexed_sequence_pairs, callback);
+            return;
+        }
+
+        // More sequence pairs than fit into one simd vector are computed in consecutive batches.
+        auto batch_begin = std::ranges::begin(indexed_sequence_pairs);
+        auto const pairs_end = std::ranges::end(indexed_sequence_pairs);
+        while (batch_begin != pairs_end)
+        {
+            auto batch_end = std::ranges::next(batch_begin, traits_type::alignments_per_vector, pairs_end);
+            std::ranges::subrange batch{batch_begin, batch_end};
+
+            auto & alignment_matrix = compute_simd_batch(batch);
+
+            size_t lane = 0;
+            for (auto && [sequence_pair, idx] : batch)
+                make_simd_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                            std::move(idx),
+                                            lane++,
+                                            alignment_matrix,
+                                            callback);
+
+            batch_begin = batch_end;
+        }
+    }
+
+protected:
+    /*!\brief Computes the sequence pairs in batches of similar lengths and invokes the callback in the input order.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Implements seqan3::align_cfg::length_aware_batching. The results are buffered until all sequence pairs were
+     * computed.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires traits_type::is_vectorised
+    //!\endcond
+    void compute_length_sorted_batches(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t & callback)
+    {
+        using std::get;
+        using view_pair_t = decltype(as_view_pair(*std::ranges::begin(indexed_sequence_pairs)));
+
+        std::vector<view_pair_t> pairs{};
+        for (auto && indexed_sequence_pair : indexed_sequence_pairs)
+            pairs.push_back(as_view_pair(indexed_sequence_pair));
+
+        std::vector<size_t> positions(pairs.size());
+        std::iota(positions.begin(), positions.end(), 0u);
+        sort_by_sequence_lengths(pairs, positions);
+
+        std::vector<alignment_result_type> results(pairs.size());
+
+        for (size_t batch_begin = 0; batch_begin < pairs.size(); batch_begin += traits_type::alignments_per_vector)
+        {
+            size_t const batch_size = std::min(traits_type::alignments_per_vector, pairs.size() - batch_begin);
+            auto & alignment_matrix = compute_simd_batch(std::span{pairs.data() + batch_begin, batch_size});
+
+            for (size_t lane = 0; lane < batch_size; ++lane)
+            {
+                view_pair_t & view_pair = pairs[batch_begin + lane];
+                size_t const position = positions[batch_begin + lane];
+
+                make_simd_result_and_invoke(std::move(get<0>(view_pair)),
+                                            std::move(get<1>(view_pair)),
+                                            lane,
+                                            alignment_matrix,
+                                            [&] (auto && result) { results[position] = std::move(result); });
+            }
+        }
+
+        for (alignment_result_type & result : results)
+            callback(std::move(result));
+    }
+
+    /*!\brief Refers to the sequences of an indexed sequence pair without copying them.
+     * \tparam indexed_sequence_pair_t The type of the indexed sequence pair.
+     * \param[in] indexed_sequence_pair The indexed sequence pair.
+     * \returns A tuple over a tuple of the two sequences as views and the index.
+     *
+     * \details
+     *
+     * A range over the returned tuples models seqan3::detail::indexed_sequence_pair_range. It is used to reorder the
+     * sequence pairs before they are computed.
+     */
+    template <typename indexed_sequence_pair_t>
+    static auto as_view_pair(indexed_sequence_pair_t && indexed_sequence_pair)
+    {
+        using std::get;
+
+        auto && [sequence_pair, idx] = indexed_sequence_pair;
+        return std::tuple{std::tuple{std::views::all(get<0>(sequence_pair)), std::views::all(get<1>(sequence_pair))},
+                          idx};
+    }
+
+    /*!\brief Sorts the sequence pairs by the length of the first and then of the second sequence.
+     * \tparam view_pair_t The type of the sequence pairs as returned by as_view_pair().
+     * \param[in,out] pairs The sequence pairs to sort.
+     * \param[in,out] positions The positions of the sequence pairs within the input; reordered alongside the pairs.
+     *
+     * \details
+     *
+     * Consecutive sequence pairs are computed in the same simd vector. Sorting them by their lengths reduces the
+     * number of cells that are computed for the padding of the shorter sequence pairs. The sort is stable.
+     */
+    template <typename view_pair_t>
+    static void sort_by_sequence_lengths(std::vector<view_pair_t> & pairs, std::vector<size_t> & positions)
+    {
+        using std::get;
+
+        auto sequence_lengths = [&] (size_t const index)
+        {
+            auto & [sequence1, sequence2] = get<0>(pairs[index]);
+            return std::pair{std::ranges::distance(sequence1), std::ranges::distance(sequence2)};
+        };
+
+        std::vector<size_t> order(pairs.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::ranges::stable_sort(order, std::less<>{}, sequence_lengths);
+
+        std::vector<view_pair_t> sorted_pairs{};
+        std::vector<size_t> sorted_positions{};
+        sorted_pairs.reserve(pairs.size());
+        sorted_positions.reserve(positions.size());
+        for (size_t const index : order)
+        {
+            sorted_pairs.push_back(std::move(pairs[index]));
+            sorted_positions.push_back(positions[index]);
+        }
+
+        pairs = std::move(sorted_pairs);
+        positions = std::move(sorted_positions);
+    }
+
+    /*!\brief Computes the alignment matrix of one batch of sequence pairs in the vectorised alignment.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \param[in] indexed_sequence_pairs The batch of indexed sequence pairs; must not contain more than
+     *                                   traits_type::alignments_per_vector pairs.
+     * \returns A reference to the computed alignment matrix.
+     *
+     * \details
+     *
+     * The i-th sequence pair of the batch is computed in the i-th lane of the simd vectors. The results of the lanes
+     * are obtained with make_simd_result_and_invoke().
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t>
+    //!\cond
+        requires traits_type::is_vectorised
+    //!\endcond
+    auto & compute_simd_batch(indexed_sequence_pairs_t && indexed_sequence_pairs)
     {
         using simd_collection_t = std::vector<score_type, aligned_allocator<score_type, alignof(score_type)>>;
-        using original_score_t = typename traits_type::original_score_type;
 
         // Extract the batch of sequences for the first and the second sequence.
         auto seq1_collection = indexed_sequence_pairs | views::elements<0> | views::elements<0>;
@@ -184,24 +348,52 @@ public:
 
         compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix);
 
-        size_t index = 0;
-        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
-        {
-            original_score_t score = this->optimal_score[index] -
-                                     (this->padding_offsets[index] * this->scoring_scheme.padding_match_score());
-            matrix_coordinate coordinate{row_index_type{size_t{this->optimal_coordinate.row[index]}},
-                                         column_index_type{size_t{this->optimal_coordinate.col[index]}}};
-            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
-                                         std::move(idx),
-                                         std::move(score),
-                                         std::move(coordinate),
-                                         alignment_matrix,
-                                         callback);
-            ++index;
-        }
+        return alignment_matrix;
+    }
+
+    /*!\brief Builds the alignment result of one lane after compute_simd_batch() and invokes the callback with it.
+     * \tparam sequence_pair_t The type of the sequence pair.
+     * \tparam index_t The type of the index.
+     * \tparam alignment_matrix_t The type of the alignment matrix.
+     * \tparam callback_t The type of the callback function.
+     *
+     * \param[in] sequence_pair The sequence pair that was computed in the given lane.
+     * \param[in] idx The index of the sequence pair.
+     * \param[in] lane The lane of the sequence pair.
+     * \param[in] alignment_matrix The alignment matrix returned by compute_simd_batch().
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     *
+     * \details
+     *
+     * Removes the padding offset from the tracked score and coordinate of the lane before the result is built.
+     */
+    template <typename sequence_pair_t, typename index_t, typename alignment_matrix_t, typename callback_t>
+    //!\cond
+        requires traits_type::is_vectorised
+    //!\endcond
+    void make_simd_result_and_invoke(sequence_pair_t && sequence_pair,
+                                     index_t && idx,
+                                     size_t const lane,
+                                     alignment_matrix_t && alignment_matrix,
+                                     callback_t && callback)
+    {
+        using original_score_t = typename traits_type::original_score_type;
+
+        original_score_t score = this->optimal_score[lane] -
+                                 (this->padding_offsets[lane] * this->scoring_scheme.padding_match_score());
+        // The tracked coordinate was projected along the diagonal onto the border of the padded matrix.
+        size_t const padding_offset = this->padding_offsets[lane];
+        matrix_coordinate coordinate{row_index_type{size_t{this->optimal_coordinate.row[lane]} - padding_offset},
+                                     column_index_type{size_t{this->optimal_coordinate.col[lane]} - padding_offset}};
+        this->make_result_and_invoke(std::forward<sequence_pair_t>(sequence_pair),
+                                     std::forward<index_t>(idx),
+                                     std::move(score),
+                                     std::move(coordinate),
+                                     alignment_matrix,
+                                     callback,
+                                     lane);
     }
 
-protected:
     /*!\brief Converts a batch of sequences to a sequence of simd vectors.
      * \tparam simd_sequence_t The type of the simd sequence; must model std::ranges::output_range for the `score_type`.
      * \tparam sequence_collection_t The type of the collection containing the sequences; must model
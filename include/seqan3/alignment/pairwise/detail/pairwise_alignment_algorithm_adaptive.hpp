@@ -0,0 +1,197 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_adaptive.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <seqan3/std/span>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The vectorised alignment algorithm that hands sequence pairs exceeding its score type over to an algorithm
+ *        with a wider score type.
+ * \ingroup alignment_pairwise
+ * \copydetails seqan3::detail::pairwise_alignment_algorithm
+ * \tparam fallback_algorithm_t The type of the algorithm computing the sequence pairs that do not fit into the score
+ *                              type of this algorithm; must be invocable with any number of indexed sequence pairs
+ *                              and must report the results in the order of the given sequence pairs.
+ *
+ * \details
+ *
+ * This algorithm implements seqan3::align_cfg::adaptive_score_type. It computes the sequence pairs with the configured
+ * small score type, e.g. `int8_t`, and the optimum tracker policy seqan3::detail::policy_optimum_tracker_simd_adaptive,
+ * which reports the lanes whose scores might have overflowed. The sequence pairs of these lanes and the sequence pairs
+ * that are too long for the score type are computed by the fallback algorithm. The results
+ * are buffered and reported in the order of the given sequence pairs.
+ */
+template <typename fallback_algorithm_t, typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_adaptive :
+    protected pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>
+{
+protected:
+    //!\brief The type of the base class.
+    using base_algorithm_t = pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>;
+
+    // Import the configured types.
+    using typename base_algorithm_t::traits_type;
+    using typename base_algorithm_t::alignment_result_type;
+
+    static_assert(traits_type::is_vectorised, "The adaptive score type requires the vectorised alignment.");
+
+    //!\brief The algorithm computing the sequence pairs that do not fit into the score type.
+    fallback_algorithm_t fallback_algorithm{};
+    //!\brief The buffered results of the current sequence pairs.
+    std::vector<alignment_result_type> results{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_adaptive() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive(pairwise_alignment_algorithm_adaptive const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive(pairwise_alignment_algorithm_adaptive &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive & operator=(pairwise_alignment_algorithm_adaptive const &) = default;
+                                                                                                    //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive & operator=(pairwise_alignment_algorithm_adaptive &&) = default;
+                                                                                                    //!< Defaulted.
+    ~pairwise_alignment_algorithm_adaptive() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration and the fallback algorithm.
+     * \param config The configuration passed into the algorithm.
+     * \param fallback_algorithm The algorithm computing the sequence pairs that do not fit into the score type.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm.
+     */
+    pairwise_alignment_algorithm_adaptive(alignment_configuration_t const & config,
+                                          fallback_algorithm_t fallback_algorithm) :
+        base_algorithm_t{config},
+        fallback_algorithm{std::move(fallback_algorithm)}
+    {}
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the alignment matrices or
+     *         seqan3::invalid_alignment_configuration if an invalid configuration for the given sequences is detected.
+     *
+     * \details
+     *
+     * The sequence pairs are computed in batches of traits_type::alignments_per_vector pairs. The callback is invoked
+     * in the order of the given sequence pairs after all of them were computed.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+        using view_pair_t = decltype(this->as_view_pair(*std::ranges::begin(indexed_sequence_pairs)));
+
+        // The sequence pairs and their positions within the given range.
+        std::vector<view_pair_t> pairs{};
+        std::vector<size_t> positions{};
+        std::vector<view_pair_t> fallback_pairs{};
+        std::vector<size_t> fallback_positions{};
+
+        size_t pair_count = 0;
+        for (auto && indexed_sequence_pair : indexed_sequence_pairs)
+        {
+            view_pair_t view_pair = this->as_view_pair(indexed_sequence_pair);
+            auto & [sequence1, sequence2] = get<0>(view_pair);
+
+            // Longer sequences exceed the matrix index type or the safe score range of the optimum tracker.
+            if (std::max<size_t>(std::ranges::distance(sequence1), std::ranges::distance(sequence2)) <=
+                this->max_sequence_size)
+            {
+                pairs.push_back(std::move(view_pair));
+                positions.push_back(pair_count++);
+            }
+            else
+            {
+                fallback_pairs.push_back(std::move(view_pair));
+                fallback_positions.push_back(pair_count++);
+            }
+        }
+
+        if constexpr (traits_type::is_length_aware_batching)
+            this->sort_by_sequence_lengths(pairs, positions);
+
+        results.clear();
+        results.resize(pair_count);
+
+        for (size_t batch_begin = 0; batch_begin < pairs.size(); batch_begin += traits_type::alignments_per_vector)
+        {
+            size_t const batch_size = std::min(traits_type::alignments_per_vector, pairs.size() - batch_begin);
+            auto & alignment_matrix = this->compute_simd_batch(std::span{pairs.data() + batch_begin, batch_size});
+
+            for (size_t lane = 0; lane < batch_size; ++lane)
+            {
+                view_pair_t & view_pair = pairs[batch_begin + lane];
+                size_t const position = positions[batch_begin + lane];
+
+                if (this->lane_exceeds_score_range(lane))
+                {
+                    fallback_pairs.push_back(std::move(view_pair));
+                    fallback_positions.push_back(position);
+                }
+                else
+                {
+                    this->make_simd_result_and_invoke(std::move(get<0>(view_pair)),
+                                                      std::move(get<1>(view_pair)),
+                                                      lane,
+                                                      alignment_matrix,
+                                                      [&] (auto && result)
+                                                      {
+                                                          results[position] = std::move(result);
+                                                      });
+                }
+            }
+        }
+
+        // The fallback algorithm reports the results in the order of the given sequence pairs.
+        size_t fallback_index = 0;
+        if (!fallback_pairs.empty())
+            fallback_algorithm(fallback_pairs, [&] (auto && result)
+            {
+                results[fallback_positions[fallback_index++]] = std::move(result);
+            });
+
+        for (alignment_result_type & result : results)
+            callback(std::move(result));
+    }
+    //!\}
+};
+
+} // namespace seqan3::detail
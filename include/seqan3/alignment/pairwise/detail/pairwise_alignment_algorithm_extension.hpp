@@ -0,0 +1,907 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_extension.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_path_buffer.hpp>
+#include <seqan3/alignment/pairwise/alignment_seed.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/detail/simd_matrix_scoring_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to extend seeds with the X-drop and the Z-drop.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm; must
+ *                    contain a scoring scheme policy with the scalar scoring scheme and the result builder policy.
+ *
+ * \details
+ *
+ * This algorithm implements seqan3::align_cfg::method_extension. Every sequence pair is given with a
+ * seqan3::alignment_seed. The prefixes of both sequences before the seed are extended from right to left and the
+ * suffixes after the seed from left to right. Both extensions compute the global alignment matrix that starts at the
+ * seed, but they may end in any cell. The score of the seed is the sum of the scores of its diagonal.
+ *
+ * An extension computes the matrix column by column. Let \f$ B \f$ be the best score of the previous columns. Cells
+ * whose score is less than \f$ B - X \f$ are dropped, i.e. they are set to a score that no alignment continues from.
+ * Only the rows between the first and the last cell that was not dropped in the previous column are computed, plus
+ * the rows below them that are reached with a gap. The extension ends if all cells of a column are dropped, if the
+ * sequences end, or if the best score of a column is worse than the Z-drop allows. The extension ends in the cell
+ * with the best score; of several cells with the same score, the first one in column-major order is chosen.
+ *
+ * In vectorised mode the left extensions of several seeds are computed in the lanes of a simd vector, and then the
+ * right extensions. Cells beyond the end of the sequences of a lane are dropped. The vectorised extension always
+ * computes with 32 bit lanes, independent of the configured score type.
+ *
+ * If the alignment is requested, the scalar extension stores the trace directions of the computed cells and follows
+ * them back from the best cell. Otherwise, the begin positions are computed from a trace path that leads from the
+ * begin to the end of the extended alignment.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_extension : protected policies_t...
+{
+protected:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The configured scoring scheme type.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The alphabet of the configured scoring scheme.
+    using alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_extension && !traits_type::is_banded,
+                  "The extension is only implemented for the unbanded align_cfg::method_extension.");
+
+    //!\brief The simd vector type of the vectorised extension.
+    using simd_score_type = simd_type_t<int32_t>;
+    //!\brief The vectorised scoring scheme, which is selected like the one of the vectorised global alignment.
+    using simd_scoring_scheme_type =
+        std::conditional_t<is_type_specialisation_of_v<scoring_scheme_type, aminoacid_scoring_scheme>,
+                           simd_matrix_scoring_scheme<simd_score_type, alphabet_type, align_cfg::method_global>,
+                           simd_match_mismatch_scoring_scheme<simd_score_type, alphabet_type, align_cfg::method_global>>;
+
+    //!\brief The number of seeds that are extended at once.
+    static constexpr size_t lane_count = traits_type::is_vectorised ? simd_traits<simd_score_type>::length : 1;
+    //!\brief The score of a dropped cell; far enough from the limits to add a few scores without overflow.
+    static constexpr int32_t dropped_score{std::numeric_limits<int32_t>::lowest() / 4};
+    //!\brief The largest X-drop and Z-drop; larger thresholds would not drop cells before they reach dropped_score.
+    static constexpr int32_t max_threshold{std::numeric_limits<int32_t>::max() / 8};
+
+    /*!\brief The part of a sequence before or after the seed, in the order in which it is extended.
+     * \tparam iterator_t The iterator type of the sequence; must model std::random_access_iterator.
+     */
+    template <std::random_access_iterator iterator_t>
+    struct extension_sequence
+    {
+        //!\brief The iterator to the first symbol after the seed or to the first symbol of the seed.
+        iterator_t seed_border{};
+        //!\brief The number of symbols of the extended part.
+        size_t size{};
+        //!\brief Whether the part before the seed is extended, i.e. the symbols are read from right to left.
+        bool reverse{};
+
+        //!\brief Returns the symbol at the given position of the extension.
+        auto operator[](size_t const position) const
+        {
+            std::iter_difference_t<iterator_t> const offset = position;
+            return reverse ? seed_border[-1 - offset] : seed_border[offset];
+        }
+    };
+
+    //!\brief The best cell of an extension.
+    template <typename score_t>
+    struct extension_optimum
+    {
+        //!\brief The best score.
+        score_t score{};
+        //!\brief The column of the best score, i.e. the number of extended symbols of the first sequence.
+        score_t column{};
+        //!\brief The row of the best score, i.e. the number of extended symbols of the second sequence.
+        score_t row{};
+    };
+
+    //!\brief The columns of the alignment matrix that are kept during the extension.
+    template <typename score_t>
+    struct dp_column_buffer
+    {
+        //!\brief The best scores of the cells of the last computed column.
+        std::vector<score_t> best_scores{};
+        //!\brief The scores of the alignments ending with a gap in the second sequence in the last computed column.
+        std::vector<score_t> horizontal_scores{};
+    };
+
+    //!\brief Gives the vectorised extension access to the trace path of the current lane.
+    struct lane_trace_path
+    {
+        //!\brief The trace path of the current lane.
+        trace_path_buffer const & trace;
+
+        //!\brief Returns the trace path of the current lane.
+        auto trace_path(matrix_coordinate const & trace_begin, size_t const) const
+        {
+            return trace.trace_path(trace_begin);
+        }
+    };
+
+    //!\brief The score difference to the best score at which a cell is dropped.
+    int32_t x_drop{};
+    //!\brief The score difference to the best score at which an extension ends, if set.
+    std::optional<int32_t> z_drop{};
+    //!\brief The score of the first gap character of a gap.
+    int32_t gap_open_score{};
+    //!\brief The score of every further gap character of a gap.
+    int32_t gap_extension_score{};
+    //!\brief The vectorised scoring scheme; only used in vectorised mode.
+    std::conditional_t<traits_type::is_vectorised, simd_scoring_scheme_type, empty_type> simd_scoring_scheme{};
+    //!\brief The columns of the scalar extension.
+    dp_column_buffer<int32_t> scalar_columns{};
+    //!\brief The columns of the vectorised extension.
+    dp_column_buffer<simd_score_type> simd_columns{};
+    //!\brief The ranks of the second sequences of the lanes, computed as far as the extension reached them.
+    std::vector<simd_score_type> row_ranks{};
+    //!\brief The trace directions of the computed cells of the current scalar extension.
+    std::vector<trace_directions> trace_cells{};
+    //!\brief The position of the first trace direction of every column within trace_cells.
+    std::vector<size_t> trace_column_offsets{};
+    //!\brief The first computed row of every column.
+    std::vector<size_t> trace_column_first_rows{};
+    //!\brief The trace directions of the current extension from its best cell back to the seed.
+    std::vector<trace_directions> extension_trace{};
+    //!\brief The trace path of the current alignment.
+    trace_path_buffer trace{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_extension() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_extension(pairwise_alignment_algorithm_extension const &) = default;
+                                                                                                    //!< Defaulted.
+    pairwise_alignment_algorithm_extension(pairwise_alignment_algorithm_extension &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_extension & operator=(pairwise_alignment_algorithm_extension const &) = default;
+                                                                                                    //!< Defaulted.
+    pairwise_alignment_algorithm_extension & operator=(pairwise_alignment_algorithm_extension &&) = default;
+                                                                                                    //!< Defaulted.
+    ~pairwise_alignment_algorithm_extension() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the X-drop or the Z-drop is negative.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm, the thresholds and the gap scores. In vectorised mode
+     * the vectorised scoring scheme is constructed from the configured scoring scheme.
+     */
+    pairwise_alignment_algorithm_extension(alignment_configuration_t const & config) : policies_t(config)...
+    {
+        auto const & method_config = get<align_cfg::method_extension>(config);
+        if (method_config.x_drop < 0 || method_config.z_drop.value_or(0) < 0)
+            throw invalid_alignment_configuration{"The X-drop and the Z-drop of align_cfg::method_extension must not "
+                                                  "be negative."};
+
+        x_drop = std::min(method_config.x_drop, max_threshold);
+        if (method_config.z_drop.has_value())
+            z_drop = std::min(*method_config.z_drop, max_threshold);
+
+        align_cfg::gap_cost_affine const & gap_cost = config.get_or(align_cfg::gap_cost_affine{});
+        gap_open_score = gap_cost.open_score + gap_cost.extension_score;
+        gap_extension_score = gap_cost.extension_score;
+
+        if constexpr (traits_type::is_vectorised)
+            simd_scoring_scheme = simd_scoring_scheme_type{this->scoring_scheme};
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Extends the seeds of the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs with their seeds.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::invalid_argument if a seed exceeds its sequences.
+     * \throws std::bad_alloc during allocation of the columns or the trace directions.
+     *
+     * \details
+     *
+     * Extends the seed of every sequence pair to both sides. For every computed alignment the given callback is
+     * invoked with the respective alignment result.
+     *
+     * ### Complexity
+     *
+     * Let `c` be the number of computed cells, which depends on the X-drop and on the similarity of the sequences
+     * around the seed, and let `m` be the length of the second sequence. The runtime is in \f$ O(c + m) \f$ and the
+     * space is in \f$ O(m) \f$, or in \f$ O(c + m) \f$ if the alignment is computed.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        if constexpr (traits_type::is_vectorised)
+        {
+            compute_vectorised(indexed_sequence_pairs, callback);
+        }
+        else
+        {
+            for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+            {
+                alignment_seed const seed = get<2>(sequence_pair);
+                auto [left1, left2, right1, right2] = make_extension_sequences(sequence_pair);
+
+                extension_optimum<int32_t> const left = extend_scalar(left1, left2);
+
+                if constexpr (traits_type::compute_sequence_alignment)
+                {
+                    trace.clear();
+                    trace_back(left);
+                    for (trace_directions const direction : extension_trace)
+                        trace.append(direction);
+                    trace.append(trace_directions::diagonal, seed.length);
+                }
+
+                extension_optimum<int32_t> const right = extend_scalar(right1, right2);
+
+                if constexpr (traits_type::compute_sequence_alignment)
+                {
+                    trace_back(right);
+                    for (auto it = extension_trace.rbegin(); it != extension_trace.rend(); ++it)
+                        trace.append(*it);
+                }
+
+                make_extension_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                                 std::move(idx),
+                                                 left,
+                                                 seed_score(left1, left2, seed.length),
+                                                 right,
+                                                 trace,
+                                                 callback);
+            }
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Extends the seeds of the sequence pairs in batches of seqan3::detail::pairwise_alignment_algorithm_extension::lane_count.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs.
+     * \tparam callback_t The type of the callback function.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs with their seeds.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <typename indexed_sequence_pairs_t, typename callback_t>
+    void compute_vectorised(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t & callback)
+    {
+        using std::get;
+        using lane_sequences_t = decltype(make_extension_sequences(get<0>(*std::ranges::begin(indexed_sequence_pairs))));
+
+        std::vector<lane_sequences_t> lanes{};
+        lanes.reserve(lane_count);
+
+        auto batch_begin = std::ranges::begin(indexed_sequence_pairs);
+        auto const pairs_end = std::ranges::end(indexed_sequence_pairs);
+        while (batch_begin != pairs_end)
+        {
+            auto batch_end = std::ranges::next(batch_begin, lane_count, pairs_end);
+            std::ranges::subrange batch{batch_begin, batch_end};
+
+            lanes.clear();
+            for (auto && [sequence_pair, idx] : batch)
+                lanes.push_back(make_extension_sequences(sequence_pair));
+
+            std::array<extension_optimum<int32_t>, lane_count> const left = extend_vectorised<0>(lanes);
+            std::array<extension_optimum<int32_t>, lane_count> const right = extend_vectorised<2>(lanes);
+
+            size_t lane = 0;
+            for (auto && [sequence_pair, idx] : batch)
+            {
+                make_extension_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                                 std::move(idx),
+                                                 left[lane],
+                                                 seed_score(get<0>(lanes[lane]),
+                                                            get<1>(lanes[lane]),
+                                                            get<2>(sequence_pair).length),
+                                                 right[lane],
+                                                 lane_trace_path{trace},
+                                                 callback,
+                                                 lane);
+                ++lane;
+            }
+
+            batch_begin = batch_end;
+        }
+    }
+
+    /*!\brief Checks the seed and returns the parts of both sequences before and after the seed.
+     * \tparam sequence_pair_t The type of the sequence pair; must model seqan3::detail::seeded_sequence_pair.
+     * \param[in] sequence_pair The sequence pair with its seed.
+     * \returns A tuple with the parts of the first and the second sequence before the seed and the parts of the first
+     *          and the second sequence after the seed.
+     * \throws std::invalid_argument if the seed exceeds one of the sequences.
+     */
+    template <typename sequence_pair_t>
+    static auto make_extension_sequences(sequence_pair_t && sequence_pair)
+    {
+        using std::get;
+
+        alignment_seed const seed = get<2>(sequence_pair);
+        auto && sequence1 = get<0>(sequence_pair);
+        auto && sequence2 = get<1>(sequence_pair);
+        size_t const sequence1_size = std::ranges::distance(sequence1);
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+
+        if (seed.sequence1_position > sequence1_size || seed.length > sequence1_size - seed.sequence1_position ||
+            seed.sequence2_position > sequence2_size || seed.length > sequence2_size - seed.sequence2_position)
+            throw std::invalid_argument{"The seed exceeds the sequences of the seed extension."};
+
+        auto split = [&] (auto && sequence, size_t const size, size_t const seed_position)
+        {
+            using iterator_t = std::ranges::iterator_t<decltype(sequence)>;
+            iterator_t const seed_begin = std::ranges::next(std::ranges::begin(sequence), seed_position);
+
+            return std::pair{extension_sequence<iterator_t>{seed_begin, seed_position, true},
+                             extension_sequence<iterator_t>{std::ranges::next(seed_begin, seed.length),
+                                                            size - seed_position - seed.length,
+                                                            false}};
+        };
+
+        auto [left1, right1] = split(sequence1, sequence1_size, seed.sequence1_position);
+        auto [left2, right2] = split(sequence2, sequence2_size, seed.sequence2_position);
+        return std::tuple{left1, left2, right1, right2};
+    }
+
+    /*!\brief Returns the score of the diagonal of the seed.
+     * \param[in] left1 The part of the first sequence before the seed.
+     * \param[in] left2 The part of the second sequence before the seed.
+     * \param[in] seed_length The length of the seed.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    int32_t seed_score(sequence1_t const & left1, sequence2_t const & left2, size_t const seed_length) const
+    {
+        int32_t score = 0;
+        for (size_t position = 0; position < seed_length; ++position)
+            score += this->scoring_scheme.score(left1.seed_border[position], left2.seed_border[position]);
+
+        return score;
+    }
+
+    /*!\brief Builds the result of the extended seed and invokes the callback.
+     * \param[in] sequence_pair The sequence pair with its seed.
+     * \param[in] idx The index of the sequence pair.
+     * \param[in] left The best cell of the extension before the seed.
+     * \param[in] seed_score The score of the diagonal of the seed.
+     * \param[in] right The best cell of the extension after the seed.
+     * \param[in] trace_path The trace path of the alignment, if the alignment was computed.
+     * \param[in] callback The callback to invoke with the result.
+     * \param[in] lane The lane of the sequence pair in vectorised mode.
+     *
+     * \details
+     *
+     * If the begin positions are requested without the alignment, the trace path is set to a path from the begin to
+     * the end of the extended alignment.
+     */
+    template <typename sequence_pair_t, typename index_t, typename trace_path_t, typename callback_t>
+    void make_extension_result_and_invoke(sequence_pair_t && sequence_pair,
+                                          index_t && idx,
+                                          extension_optimum<int32_t> const & left,
+                                          int32_t const seed_score,
+                                          extension_optimum<int32_t> const & right,
+                                          trace_path_t const & trace_path,
+                                          callback_t & callback,
+                                          size_t const lane = 0)
+    {
+        using std::get;
+
+        alignment_seed const seed = get<2>(sequence_pair);
+        size_t const begin1 = seed.sequence1_position - left.column;
+        size_t const begin2 = seed.sequence2_position - left.row;
+        size_t const end1 = seed.sequence1_position + seed.length + right.column;
+        size_t const end2 = seed.sequence2_position + seed.length + right.row;
+
+        if constexpr (traits_type::requires_trace_information && !traits_type::compute_sequence_alignment)
+        {
+            size_t const diagonal_length = std::min(end1 - begin1, end2 - begin2);
+            trace.clear();
+            trace.append(trace_directions::diagonal, diagonal_length);
+            trace.append(trace_directions::left, end1 - begin1 - diagonal_length);
+            trace.append(trace_directions::up, end2 - begin2 - diagonal_length);
+        }
+
+        original_score_type const score = static_cast<original_score_type>(left.score + seed_score + right.score);
+
+        this->make_result_and_invoke(std::forward<sequence_pair_t>(sequence_pair),
+                                     std::forward<index_t>(idx),
+                                     score,
+                                     matrix_coordinate{row_index_type{end2}, column_index_type{end1}},
+                                     trace_path,
+                                     callback,
+                                     lane);
+    }
+
+    /*!\brief Extends a single pair of sequence parts.
+     * \param[in] sequence1 The part of the first sequence to extend.
+     * \param[in] sequence2 The part of the second sequence to extend.
+     * \returns The best cell of the extension.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    extension_optimum<int32_t> extend_scalar(sequence1_t const & sequence1, sequence2_t const & sequence2)
+    {
+        auto column_scores = [&] (size_t const column)
+        {
+            return [&, symbol1 = sequence1[column - 1]] (size_t const row) -> int32_t
+            {
+                return this->scoring_scheme.score(symbol1, sequence2[row - 1]);
+            };
+        };
+
+        auto column_validity = [] (size_t const)
+        {
+            return [] (size_t const) { return true; };
+        };
+
+        return extend<int32_t, traits_type::compute_sequence_alignment>(sequence1.size,
+                                                                         sequence2.size,
+                                                                         -1,
+                                                                         column_scores,
+                                                                         column_validity);
+    }
+
+    /*!\brief Extends the sequence parts of all lanes at once.
+     * \tparam first_index The position of the part of the first sequence within the lane sequences; the part of the
+     *                     second sequence follows it.
+     * \param[in] lanes The sequence parts of the lanes.
+     * \returns The best cells of the extensions of the lanes.
+     */
+    template <size_t first_index, typename lane_sequences_t>
+    std::array<extension_optimum<int32_t>, lane_count> extend_vectorised(std::vector<lane_sequences_t> const & lanes)
+    {
+        using std::get;
+
+        simd_score_type sequence1_sizes{};
+        simd_score_type sequence2_sizes{};
+        simd_score_type active{};
+        size_t column_count = 0;
+        size_t row_count = 0;
+        for (size_t lane = 0; lane < lanes.size(); ++lane)
+        {
+            sequence1_sizes[lane] = get<first_index>(lanes[lane]).size;
+            sequence2_sizes[lane] = get<first_index + 1>(lanes[lane]).size;
+            active[lane] = -1;
+            column_count = std::max(column_count, get<first_index>(lanes[lane]).size);
+            row_count = std::max(row_count, get<first_index + 1>(lanes[lane]).size);
+        }
+
+        // The ranks of the second sequences are only computed for the rows the extension reaches.
+        row_ranks.clear();
+        auto ranks_of_row = [&] (size_t const row) -> simd_score_type const &
+        {
+            while (row_ranks.size() < row)
+            {
+                size_t const position = row_ranks.size();
+                simd_score_type ranks = simd::fill<simd_score_type>(simd_scoring_scheme_type::padding_symbol);
+                for (size_t lane = 0; lane < lanes.size(); ++lane)
+                    if (position < get<first_index + 1>(lanes[lane]).size)
+                        ranks[lane] = seqan3::to_rank(get<first_index + 1>(lanes[lane])[position]);
+
+                row_ranks.push_back(ranks);
+            }
+
+            return row_ranks[row - 1];
+        };
+
+        auto column_scores = [&] (size_t const column)
+        {
+            simd_score_type ranks = simd::fill<simd_score_type>(simd_scoring_scheme_type::padding_symbol);
+            for (size_t lane = 0; lane < lanes.size(); ++lane)
+                if (column <= get<first_index>(lanes[lane]).size)
+                    ranks[lane] = seqan3::to_rank(get<first_index>(lanes[lane])[column - 1]);
+
+            return [&, profile = simd_scoring_scheme.make_score_profile(ranks)] (size_t const row)
+            {
+                return simd_scoring_scheme.score(profile, ranks_of_row(row));
+            };
+        };
+
+        auto column_validity = [&] (size_t const column)
+        {
+            simd_score_type const column_valid = simd::fill<simd_score_type>(column) <= sequence1_sizes;
+            return [&, column_valid] (size_t const row) -> simd_score_type
+            {
+                return column_valid & (simd::fill<simd_score_type>(row) <= sequence2_sizes);
+            };
+        };
+
+        extension_optimum<simd_score_type> const optimum =
+            extend<simd_score_type, false>(column_count, row_count, active, column_scores, column_validity);
+
+        std::array<extension_optimum<int32_t>, lane_count> optima{};
+        for (size_t lane = 0; lane < lanes.size(); ++lane)
+            optima[lane] = {optimum.score[lane], optimum.column[lane], optimum.row[lane]};
+
+        return optima;
+    }
+
+    /*!\brief Computes the extension column by column until all cells of a column are dropped.
+     * \tparam score_t The score type; either int32_t or the simd vector type.
+     * \tparam with_trace Whether the trace directions of the computed cells are stored; only for the scalar
+     *                    extension.
+     *
+     * \param[in] column_count The largest number of symbols of the first sequence parts.
+     * \param[in] row_count The largest number of symbols of the second sequence parts.
+     * \param[in] active The mask of the lanes that are extended.
+     * \param[in] column_scores Returns for a column the function that returns the score of the symbols of a row.
+     * \param[in] column_validity Returns for a column the function that returns the mask of the lanes whose sequence
+     *                            parts contain the cell.
+     *
+     * \returns The best cell of the extension.
+     *
+     * \details
+     *
+     * Let \f$ G \f$ be the score of the first gap character of a gap and \f$ E \f$ the score of every further gap
+     * character. The cells are computed by
+     *
+     * * \f$ L_{i,j} = \max(H_{i-1,j} + G, L_{i-1,j} + E) \f$
+     * * \f$ U_{i,j} = \max(H_{i,j-1} + G, U_{i,j-1} + E) \f$
+     * * \f$ H_{i,j} = \max(H_{i-1,j-1} + s(i, j), U_{i,j}, L_{i,j}) \f$
+     *
+     * where the scores of all dropped cells and of all cells outside of the computed rows are the dropped_score.
+     */
+    template <typename score_t, bool with_trace, typename column_scores_t, typename column_validity_t>
+    extension_optimum<score_t> extend(size_t const column_count,
+                                      size_t const row_count,
+                                      score_t active,
+                                      column_scores_t && column_scores,
+                                      column_validity_t && column_validity)
+    {
+        auto & columns = [&] () -> auto &
+        {
+            if constexpr (simd_concept<score_t>)
+                return simd_columns;
+            else
+                return scalar_columns;
+        }();
+
+        columns.best_scores.resize(std::max(columns.best_scores.size(), row_count + 1));
+        columns.horizontal_scores.resize(std::max(columns.horizontal_scores.size(), row_count + 1));
+        score_t * const best_scores = columns.best_scores.data();
+        score_t * const horizontal_scores = columns.horizontal_scores.data();
+
+        score_t const dropped = broadcast<score_t>(dropped_score);
+        score_t const gap_open = broadcast<score_t>(gap_open_score);
+        score_t const gap_extension = broadcast<score_t>(gap_extension_score);
+
+        extension_optimum<score_t> optimum{broadcast<score_t>(0), broadcast<score_t>(0), broadcast<score_t>(0)};
+
+        if constexpr (with_trace)
+        {
+            trace_cells.clear();
+            trace_column_offsets.clear();
+            trace_column_first_rows.clear();
+            trace_column_offsets.push_back(0);
+            trace_column_first_rows.push_back(0);
+            trace_cells.push_back(trace_directions::none);
+        }
+
+        // The first column only contains the gap in the first sequence that starts at the seed.
+        score_t threshold = broadcast<score_t>(-x_drop);
+        best_scores[0] = active ? broadcast<score_t>(0) : dropped;
+        horizontal_scores[0] = dropped;
+        size_t first_row = 0;
+        size_t last_row = 0;
+        {
+            auto is_valid = column_validity(0);
+            score_t vertical = dropped;
+            for (size_t row = 1; row <= row_count; ++row)
+            {
+                score_t const open = best_scores[row - 1] + gap_open;
+                vertical = max_score(open, vertical + gap_extension);
+                auto const alive = is_valid(row) & active & (vertical >= threshold);
+                vertical = alive ? vertical : dropped;
+                best_scores[row] = vertical;
+                horizontal_scores[row] = dropped;
+
+                if constexpr (with_trace)
+                    trace_cells.push_back(trace_directions::up | (open >= vertical ? trace_directions::up_open
+                                                                                   : trace_directions::none));
+
+                if (!any_lane(alive))
+                    break;
+
+                last_row = row;
+                update_optimum(optimum, vertical, 0, row);
+            }
+        }
+
+        for (size_t column = 1; column <= column_count; ++column)
+        {
+            threshold = optimum.score - broadcast<score_t>(x_drop);
+
+            if constexpr (with_trace)
+            {
+                trace_column_offsets.push_back(trace_cells.size());
+                trace_column_first_rows.push_back(first_row);
+            }
+
+            auto score_of_row = column_scores(column);
+            auto is_valid = column_validity(column);
+            score_t diagonal = dropped;
+            score_t vertical = dropped;
+            score_t best_above = dropped;
+            score_t column_max = dropped;
+            score_t column_max_row = broadcast<score_t>(0);
+            std::optional<size_t> next_first_row{};
+            size_t next_last_row = 0;
+
+            for (size_t row = first_row; row <= row_count; ++row)
+            {
+                bool const in_previous_column = row <= last_row;
+                score_t const previous_best = in_previous_column ? best_scores[row] : dropped;
+                score_t const previous_horizontal = in_previous_column ? horizontal_scores[row] : dropped;
+
+                score_t const horizontal_open = previous_best + gap_open;
+                score_t horizontal = max_score(horizontal_open, previous_horizontal + gap_extension);
+                score_t const vertical_open = best_above + gap_open;
+                vertical = (row > first_row) ? max_score(vertical_open, vertical + gap_extension) : dropped;
+                score_t const match = (row > 0) ? diagonal + score_of_row(row) : dropped;
+                score_t best = max_score(match, max_score(vertical, horizontal));
+
+                if constexpr (with_trace)
+                {
+                    trace_directions direction = (best == match) ? trace_directions::diagonal
+                                               : (best == vertical) ? trace_directions::up : trace_directions::left;
+                    if (vertical_open >= vertical)
+                        direction |= trace_directions::up_open;
+                    if (horizontal_open >= horizontal)
+                        direction |= trace_directions::left_open;
+
+                    trace_cells.push_back(direction);
+                }
+
+                auto const alive = is_valid(row) & active & (best >= threshold);
+                best = alive ? best : dropped;
+                vertical = alive ? vertical : dropped;
+                horizontal = alive ? horizontal : dropped;
+
+                diagonal = previous_best;
+                best_scores[row] = best;
+                horizontal_scores[row] = horizontal;
+                best_above = best;
+
+                if (any_lane(alive))
+                {
+                    if (!next_first_row.has_value())
+                        next_first_row = row;
+                    next_last_row = row;
+                }
+                else if (!in_previous_column) // Rows further down can only be reached from dropped cells.
+                {
+                    break;
+                }
+
+                update_optimum(optimum, best, column, row);
+                auto const column_improved = best > column_max;
+                column_max = column_improved ? best : column_max;
+                column_max_row = column_improved ? broadcast<score_t>(row) : column_max_row;
+            }
+
+            if (!next_first_row.has_value()) // All cells were dropped.
+                break;
+
+            first_row = *next_first_row;
+            last_row = next_last_row;
+
+            if (z_drop.has_value())
+            {
+                for (size_t lane = 0; lane < lanes_of<score_t>; ++lane)
+                {
+                    int64_t const best = lane_value(optimum.score, lane);
+                    int64_t const best_column_max = lane_value(column_max, lane);
+                    if (!lane_value(active, lane) || best_column_max == dropped_score)
+                        continue;
+
+                    int64_t const diagonal_distance = std::abs((static_cast<int64_t>(column) -
+                                                                lane_value(optimum.column, lane)) -
+                                                               (lane_value(column_max_row, lane) -
+                                                                lane_value(optimum.row, lane)));
+                    if (best - best_column_max > *z_drop + std::max(0, -gap_extension_score) * diagonal_distance)
+                        deactivate_lane(active, lane);
+                }
+
+                if (!any_lane(active))
+                    break;
+            }
+        }
+
+        return optimum;
+    }
+
+    /*!\brief Follows the stored trace directions from the best cell of the scalar extension back to the seed.
+     * \param[in] optimum The best cell of the extension.
+     *
+     * \details
+     *
+     * The trace directions are stored in extension_trace in the order in which they are found.
+     */
+    void trace_back(extension_optimum<int32_t> const & optimum)
+    {
+        enum struct state { best, vertical, horizontal };
+
+        auto directions_of = [&] (size_t const column, size_t const row)
+        {
+            assert(row >= trace_column_first_rows[column]);
+            return trace_cells[trace_column_offsets[column] + row - trace_column_first_rows[column]];
+        };
+
+        extension_trace.clear();
+        size_t column = optimum.column;
+        size_t row = optimum.row;
+        state current = state::best;
+
+        while (column > 0 || row > 0)
+        {
+            trace_directions const directions = directions_of(column, row);
+
+            if (current == state::best)
+            {
+                if ((directions & trace_directions::diagonal) == trace_directions::diagonal)
+                {
+                    extension_trace.push_back(trace_directions::diagonal);
+                    --column;
+                    --row;
+                }
+                else
+                {
+                    current = ((directions & trace_directions::up) == trace_directions::up) ? state::vertical
+                                                                                             : state::horizontal;
+                }
+            }
+            else if (current == state::vertical)
+            {
+                extension_trace.push_back(trace_directions::up);
+                if ((directions & trace_directions::up_open) == trace_directions::up_open)
+                    current = state::best;
+                --row;
+            }
+            else // state::horizontal
+            {
+                extension_trace.push_back(trace_directions::left);
+                if ((directions & trace_directions::left_open) == trace_directions::left_open)
+                    current = state::best;
+                --column;
+            }
+        }
+    }
+
+    /*!\name Helpers for the scalar and the vectorised extension
+     * \{
+     */
+    //!\brief The number of lanes of the given score type.
+    template <typename score_t>
+    static constexpr size_t lanes_of = simd_concept<score_t> ? simd_traits<simd_score_type>::length : 1;
+
+    //!\brief Returns the given value in every lane.
+    template <typename score_t>
+    static score_t broadcast(int32_t const value) noexcept
+    {
+        if constexpr (simd_concept<score_t>)
+            return simd::fill<score_t>(value);
+        else
+            return value;
+    }
+
+    //!\brief Returns the larger score per lane.
+    template <typename score_t>
+    static score_t max_score(score_t const & lhs, score_t const & rhs) noexcept
+    {
+        return (lhs > rhs) ? lhs : rhs;
+    }
+
+    //!\brief Returns the value of the given lane.
+    template <typename value_t>
+    static int32_t lane_value(value_t const & value, size_t const lane) noexcept
+    {
+        if constexpr (simd_concept<value_t>)
+            return value[lane];
+        else
+            return value;
+    }
+
+    //!\brief Whether the mask is set in any lane.
+    template <typename mask_t>
+    static bool any_lane(mask_t const & mask) noexcept
+    {
+        if constexpr (simd_concept<mask_t>)
+        {
+            for (size_t lane = 0; lane < simd_traits<mask_t>::length; ++lane)
+                if (mask[lane])
+                    return true;
+
+            return false;
+        }
+        else
+        {
+            return mask;
+        }
+    }
+
+    //!\brief Removes the given lane from the mask of the extended lanes.
+    template <typename score_t>
+    static void deactivate_lane(score_t & active, size_t const lane) noexcept
+    {
+        if constexpr (simd_concept<score_t>)
+            active[lane] = 0;
+        else
+            active = 0;
+    }
+
+    //!\brief Stores the given cell as the best cell of every lane in which its score is larger than the best score.
+    template <typename score_t>
+    static void update_optimum(extension_optimum<score_t> & optimum,
+                               score_t const & score,
+                               size_t const column,
+                               size_t const row) noexcept
+    {
+        auto const improved = score > optimum.score;
+        optimum.score = improved ? score : optimum.score;
+        optimum.column = improved ? broadcast<score_t>(column) : optimum.column;
+        optimum.row = improved ? broadcast<score_t>(row) : optimum.row;
+    }
+    //!\}
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,545 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_linear_space.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <future>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_linear_space_traceback.hpp>
+#include <seqan3/alignment/matrix/detail/score_matrix_single_column.hpp>
+#include <seqan3/alignment/matrix/detail/trace_path_buffer.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the alignment with memory linear in the sequence lengths.
+ * \ingroup alignment_pairwise
+ * \copydetails seqan3::detail::pairwise_alignment_algorithm
+ *
+ * \details
+ *
+ * This algorithm implements seqan3::align_cfg::linear_space_traceback. The policies are the same as for the scalar
+ * alignment that only computes the score, in particular seqan3::detail::policy_affine_gap_recursion and the
+ * seqan3::detail::score_matrix_single_column. The score and the end positions are computed as in the base algorithm.
+ * Afterwards, the begin positions are found by aligning the reversed prefixes of the sequences that end in the end
+ * positions, and the alignment between the begin and the end positions is found by divide and conquer
+ * (see compute_trace()). The resulting trace path is stored in a seqan3::detail::trace_path_buffer, which replaces
+ * the trace matrix when the alignment result is built.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_linear_space :
+    protected pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>
+{
+protected:
+    //!\brief The type of the base class.
+    using base_algorithm_t = pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>;
+
+    // Import the configured types.
+    using typename base_algorithm_t::traits_type;
+    using typename base_algorithm_t::score_type;
+    using typename base_algorithm_t::alignment_result_type;
+    using typename base_algorithm_t::affine_cell_type;
+
+    static_assert(!traits_type::is_vectorised && !traits_type::is_banded && traits_type::is_global,
+                  "The linear space traceback is only implemented for the unbanded scalar global alignment.");
+
+    //!\brief The single column score matrix used for the forward and the backward computation.
+    using score_matrix_type = score_matrix_single_column<score_type>;
+
+    //!\brief The score matrices of one thread computing the trace.
+    struct workspace
+    {
+        //!\brief The matrix computed from the begin of the current sub-problem.
+        score_matrix_type forward_matrix{};
+        //!\brief The matrix computed from the end of the current sub-problem.
+        score_matrix_type backward_matrix{};
+    };
+
+    //!\brief The smallest number of cells of a sub-problem that is split between two threads.
+    static constexpr size_t minimal_parallel_cell_count{1ull << 20};
+
+    //!\brief The number of threads computing the trace of one alignment.
+    uint32_t thread_count{1};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_linear_space() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_space(pairwise_alignment_algorithm_linear_space const &) = default;
+                                                                                                 //!< Defaulted.
+    pairwise_alignment_algorithm_linear_space(pairwise_alignment_algorithm_linear_space &&) = default;
+                                                                                                 //!< Defaulted.
+    pairwise_alignment_algorithm_linear_space & operator=(pairwise_alignment_algorithm_linear_space const &) = default;
+                                                                                                 //!< Defaulted.
+    pairwise_alignment_algorithm_linear_space & operator=(pairwise_alignment_algorithm_linear_space &&) = default;
+                                                                                                 //!< Defaulted.
+    ~pairwise_alignment_algorithm_linear_space() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and the number of threads computing the trace.
+     */
+    pairwise_alignment_algorithm_linear_space(alignment_configuration_t const & config) : base_algorithm_t{config}
+    {
+        thread_count = std::max<uint32_t>(1u, config.get_or(align_cfg::linear_space_traceback{}).thread_count);
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the alignment matrices.
+     *
+     * \details
+     *
+     * For every sequence pair the score and the end positions are computed first. Then the trace is computed with
+     * memory linear in the sequence lengths and the callback is invoked with the alignment result.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence and `m` be the length of the second sequence. The runtime is in
+     * \f$ O(n * m) \f$, where the cells are computed about three times and four times with free leading gaps.
+     * The space is in \f$ O(n + m) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        workspace thread_workspace{};
+        trace_path_buffer trace{};
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            auto && [alignment_matrix, index_matrix] = this->acquire_matrices(sequence1_size, sequence2_size);
+
+            this->compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair), alignment_matrix, index_matrix);
+            compute_trace_path(get<0>(sequence_pair), get<1>(sequence_pair), thread_workspace, trace);
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         this->optimal_score,
+                                         this->optimal_coordinate,
+                                         trace,
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Computes the trace path from the begin positions to the end positions of the optimal alignment.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::bidirectional_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::bidirectional_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in,out] thread_workspace The score matrices of the current thread.
+     * \param[out] trace The buffer to store the trace path in.
+     *
+     * \details
+     *
+     * Expects that the optimum was computed by the base algorithm. Without free leading gaps the alignment begins in
+     * the origin of the alignment matrix. Otherwise, the reversed prefixes of the sequences are aligned from the end
+     * positions, and the best cell in the first row or the first column, respectively, is the begin of the alignment.
+     */
+    template <std::ranges::bidirectional_range sequence1_t, std::ranges::bidirectional_range sequence2_t>
+    void compute_trace_path(sequence1_t && sequence1,
+                            sequence2_t && sequence2,
+                            workspace & thread_workspace,
+                            trace_path_buffer & trace) const
+    {
+        size_t const sequence1_end = this->optimal_coordinate.col;
+        size_t const sequence2_end = this->optimal_coordinate.row;
+
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+        std::ranges::subrange sequence1_prefix{sequence1_it, std::ranges::next(sequence1_it, sequence1_end)};
+        std::ranges::subrange sequence2_prefix{sequence2_it, std::ranges::next(sequence2_it, sequence2_end)};
+
+        size_t sequence1_begin = 0;
+        size_t sequence2_begin = 0;
+
+        if (this->first_row_is_free || this->first_column_is_free)
+        {
+            score_type best_score = std::numeric_limits<score_type>::lowest();
+
+            // The last row and the last column of the reversed prefixes are the first row and column of the matrix.
+            auto track_cell = [&] (score_type const score, size_t const row_index, size_t const column_index)
+            {
+                if (score > best_score)
+                {
+                    best_score = score;
+                    sequence1_begin = sequence1_end - column_index;
+                    sequence2_begin = sequence2_end - row_index;
+                }
+            };
+
+            compute_columns(sequence1_prefix | std::views::reverse,
+                            sequence2_prefix | std::views::reverse,
+                            false,
+                            thread_workspace.forward_matrix,
+                            [&] (auto && column, size_t const column_index)
+            {
+                size_t row_index = 0;
+                for (auto && cell : column)
+                {
+                    if ((this->first_row_is_free && row_index == sequence2_end) ||
+                        (this->first_column_is_free && column_index == sequence1_end))
+                        track_cell(cell.best_score(), row_index, column_index);
+
+                    ++row_index;
+                }
+            });
+
+            assert(best_score == this->optimal_score);
+        }
+
+        trace.clear();
+        compute_trace(std::ranges::subrange{std::ranges::next(sequence1_it, sequence1_begin),
+                                            std::ranges::end(sequence1_prefix)},
+                      std::ranges::subrange{std::ranges::next(sequence2_it, sequence2_begin),
+                                            std::ranges::end(sequence2_prefix)},
+                      false,
+                      false,
+                      thread_workspace,
+                      trace,
+                      thread_count);
+    }
+
+    /*!\brief Computes the trace path of a sub-problem by divide and conquer.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::bidirectional_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::bidirectional_range.
+     *
+     * \param[in] sequence1 The part of the first sequence of the sub-problem.
+     * \param[in] sequence2 The part of the second sequence of the sub-problem.
+     * \param[in] begins_in_horizontal_gap Whether a horizontal gap at the begin continues a gap of the enclosing
+     *                                     problem, i.e. does not pay the gap open score.
+     * \param[in] ends_in_horizontal_gap Whether a horizontal gap at the end continues in the enclosing problem.
+     * \param[in,out] thread_workspace The score matrices of the current thread.
+     * \param[out] trace The buffer to append the trace path to.
+     * \param[in] threads The number of threads that may compute the sub-problem.
+     *
+     * \details
+     *
+     * The sub-problem is split at the middle symbol of the first sequence. The scores of the middle column are
+     * computed from the begin of the sub-problem and the scores of the column after the middle symbol are computed
+     * from the end of the sub-problem. The optimal path leaves the middle column either with a diagonal or with a
+     * horizontal step in some row. For every row, the sum of the scores of both columns gives the best score through
+     * the respective step, where two horizontal gaps joined by the horizontal step pay the gap open score only once.
+     * The parts of the sequences before and after the best step are aligned recursively and the joined horizontal
+     * gap is passed on by begins_in_horizontal_gap and ends_in_horizontal_gap (see Myers and Miller, 1988).
+     * Vertical gaps never cross the split, since a path can only leave a column with a diagonal or a horizontal step.
+     *
+     * If more than one thread may compute the sub-problem and it is large enough, the part before the best step is
+     * aligned by a new thread.
+     */
+    template <std::ranges::bidirectional_range sequence1_t, std::ranges::bidirectional_range sequence2_t>
+    void compute_trace(sequence1_t sequence1,
+                       sequence2_t sequence2,
+                       bool const begins_in_horizontal_gap,
+                       bool const ends_in_horizontal_gap,
+                       workspace & thread_workspace,
+                       trace_path_buffer & trace,
+                       uint32_t const threads) const
+    {
+        size_t const sequence1_size = std::ranges::distance(sequence1);
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+
+        if (sequence2_size == 0)
+            return trace.append(trace_directions::left, sequence1_size);
+
+        if (sequence1_size == 0)
+            return trace.append(trace_directions::up, sequence2_size);
+
+        if (sequence1_size == 1)
+            return align_single_column(*std::ranges::begin(sequence1),
+                                       sequence2,
+                                       begins_in_horizontal_gap,
+                                       ends_in_horizontal_gap,
+                                       trace);
+
+        // ---------------------------------------------------------------------
+        // Compute the column of the middle symbol from both sides.
+        // ---------------------------------------------------------------------
+
+        size_t const middle = sequence1_size / 2;
+        auto const sequence1_middle_it = std::ranges::next(std::ranges::begin(sequence1), middle);
+        auto const sequence1_suffix_it = std::ranges::next(sequence1_middle_it);
+
+        compute_columns(std::ranges::subrange{std::ranges::begin(sequence1), sequence1_middle_it},
+                        sequence2,
+                        begins_in_horizontal_gap,
+                        thread_workspace.forward_matrix,
+                        [] (auto &&, size_t) {});
+        compute_columns(std::ranges::subrange{sequence1_suffix_it, std::ranges::end(sequence1)} | std::views::reverse,
+                        sequence2 | std::views::reverse,
+                        ends_in_horizontal_gap,
+                        thread_workspace.backward_matrix,
+                        [] (auto &&, size_t) {});
+
+        // ---------------------------------------------------------------------
+        // Find the best step leaving the middle column.
+        // ---------------------------------------------------------------------
+
+        auto forward_column = *thread_workspace.forward_matrix.begin();
+        auto backward_column = *thread_workspace.backward_matrix.begin();
+
+        auto forward_it = std::ranges::begin(forward_column);
+        auto backward_it = std::ranges::next(std::ranges::begin(backward_column), sequence2_size);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        score_type best_score = std::numeric_limits<score_type>::lowest();
+        size_t best_row = 0;
+        bool best_is_diagonal = false;
+
+        for (size_t row = 0; row <= sequence2_size; ++row, ++forward_it)
+        {
+            auto forward_cell = *forward_it;
+            // Both horizontal scores contain the step leaving the middle column and its gap open score.
+            score_type const horizontal_score = forward_cell.horizontal_score() +
+                                                (*backward_it).horizontal_score() -
+                                                this->gap_open_score;
+            if (horizontal_score > best_score)
+            {
+                best_score = horizontal_score;
+                best_row = row;
+                best_is_diagonal = false;
+            }
+
+            if (row == sequence2_size)
+                break;
+
+            score_type const diagonal_score = forward_cell.best_score() +
+                                              this->scoring_scheme.score(*sequence1_middle_it, *sequence2_it) +
+                                              (*--backward_it).best_score();
+            if (diagonal_score >= best_score)
+            {
+                best_score = diagonal_score;
+                best_row = row;
+                best_is_diagonal = true;
+            }
+
+            ++sequence2_it;
+        }
+
+        // ---------------------------------------------------------------------
+        // Align the parts before and after the best step.
+        // ---------------------------------------------------------------------
+
+        auto const sequence2_split_it = std::ranges::next(std::ranges::begin(sequence2), best_row);
+        std::ranges::subrange sequence1_prefix{std::ranges::begin(sequence1), sequence1_middle_it};
+        std::ranges::subrange sequence1_suffix{sequence1_suffix_it, std::ranges::end(sequence1)};
+        std::ranges::subrange sequence2_prefix{std::ranges::begin(sequence2), sequence2_split_it};
+        std::ranges::subrange sequence2_suffix{best_is_diagonal ? std::ranges::next(sequence2_split_it)
+                                                                : sequence2_split_it,
+                                               std::ranges::end(sequence2)};
+        trace_directions const step = best_is_diagonal ? trace_directions::diagonal : trace_directions::left;
+
+        if (threads > 1 && sequence1_size * sequence2_size >= minimal_parallel_cell_count)
+        {
+            trace_path_buffer prefix_trace{};
+            auto prefix_task = std::async(std::launch::async, [&] ()
+            {
+                workspace prefix_workspace{};
+                compute_trace(sequence1_prefix, sequence2_prefix, begins_in_horizontal_gap, !best_is_diagonal,
+                              prefix_workspace, prefix_trace, threads / 2);
+            });
+
+            trace_path_buffer suffix_trace{};
+            compute_trace(sequence1_suffix, sequence2_suffix, !best_is_diagonal, ends_in_horizontal_gap,
+                          thread_workspace, suffix_trace, threads - threads / 2);
+            prefix_task.get();
+
+            trace.append(prefix_trace);
+            trace.append(step);
+            trace.append(suffix_trace);
+        }
+        else
+        {
+            compute_trace(sequence1_prefix, sequence2_prefix, begins_in_horizontal_gap, !best_is_diagonal,
+                          thread_workspace, trace, 1u);
+            trace.append(step);
+            compute_trace(sequence1_suffix, sequence2_suffix, !best_is_diagonal, ends_in_horizontal_gap,
+                          thread_workspace, trace, 1u);
+        }
+    }
+
+    /*!\brief Computes the trace path of a sub-problem with a single symbol of the first sequence.
+     * \tparam alphabet1_t The type of the symbol of the first sequence.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] alphabet1 The symbol of the first sequence.
+     * \param[in] sequence2 The part of the second sequence of the sub-problem.
+     * \param[in] begins_in_horizontal_gap Whether a horizontal gap in the first row continues a gap.
+     * \param[in] ends_in_horizontal_gap Whether a horizontal gap in the last row continues a gap.
+     * \param[out] trace The buffer to append the trace path to.
+     *
+     * \details
+     *
+     * The path consists of a vertical gap, a diagonal or horizontal step in some row and another vertical gap.
+     * All rows are tested for the best step.
+     */
+    template <typename alphabet1_t, std::ranges::forward_range sequence2_t>
+    void align_single_column(alphabet1_t const & alphabet1,
+                             sequence2_t && sequence2,
+                             bool const begins_in_horizontal_gap,
+                             bool const ends_in_horizontal_gap,
+                             trace_path_buffer & trace) const
+    {
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+
+        auto vertical_gap_score = [&] (size_t const length) -> score_type
+        {
+            if (length == 0)
+                return score_type{};
+
+            return this->gap_open_score + static_cast<score_type>(length - 1) * this->gap_extension_score;
+        };
+
+        score_type best_score = std::numeric_limits<score_type>::lowest();
+        size_t best_row = 0;
+        bool best_is_diagonal = false;
+
+        auto sequence2_it = std::ranges::begin(sequence2);
+        for (size_t row = 0; row <= sequence2_size; ++row)
+        {
+            bool const continues_gap = (row == 0 && begins_in_horizontal_gap) ||
+                                       (row == sequence2_size && ends_in_horizontal_gap);
+            score_type const horizontal_score = vertical_gap_score(row) +
+                                                (continues_gap ? this->gap_extension_score : this->gap_open_score) +
+                                                vertical_gap_score(sequence2_size - row);
+            if (horizontal_score > best_score)
+            {
+                best_score = horizontal_score;
+                best_row = row;
+                best_is_diagonal = false;
+            }
+
+            if (row == sequence2_size)
+                break;
+
+            score_type const diagonal_score = vertical_gap_score(row) +
+                                              this->scoring_scheme.score(alphabet1, *sequence2_it) +
+                                              vertical_gap_score(sequence2_size - row - 1);
+            if (diagonal_score >= best_score)
+            {
+                best_score = diagonal_score;
+                best_row = row;
+                best_is_diagonal = true;
+            }
+
+            ++sequence2_it;
+        }
+
+        trace.append(trace_directions::up, best_row);
+        trace.append(best_is_diagonal ? trace_directions::diagonal : trace_directions::left);
+        trace.append(trace_directions::up, sequence2_size - best_row - best_is_diagonal);
+    }
+
+    /*!\brief Computes the columns of the global alignment matrix of the given sequences.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     * \tparam column_callback_t The type of the callback invoked with every computed column.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] begins_in_horizontal_gap Whether a horizontal gap in the first row does not pay the gap open score.
+     * \param[in,out] score_matrix The single column score matrix to compute.
+     * \param[in] on_column The callback invoked with the column and its index after every computed column.
+     *
+     * \details
+     *
+     * Computes the same recursion as seqan3::detail::pairwise_alignment_algorithm, but always without free end gaps.
+     * After the computation the column of the score matrix contains the scores of the last column.
+     */
+    template <std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename column_callback_t>
+    void compute_columns(sequence1_t && sequence1,
+                         sequence2_t && sequence2,
+                         bool const begins_in_horizontal_gap,
+                         score_matrix_type & score_matrix,
+                         column_callback_t && on_column) const
+    {
+        score_matrix.resize(column_index_type{static_cast<size_t>(std::ranges::distance(sequence1)) + 1},
+                            row_index_type{static_cast<size_t>(std::ranges::distance(sequence2)) + 1});
+
+        auto column = *score_matrix.begin();
+
+        // Initialise the first column.
+        auto column_it = column.begin();
+        *column_it = affine_cell_type{score_type{},
+                                      begins_in_horizontal_gap ? this->gap_extension_score : this->gap_open_score,
+                                      this->gap_open_score};
+
+        for ([[maybe_unused]] auto const & unused : sequence2)
+        {
+            auto cell = *++column_it;
+            score_type const vertical_score = cell.vertical_score();
+            *column_it = affine_cell_type{vertical_score,
+                                          vertical_score + this->gap_open_score,
+                                          vertical_score + this->gap_extension_score};
+        }
+
+        size_t column_index = 0;
+        on_column(column, column_index);
+
+        // Compute the remaining columns.
+        for (auto const & alphabet1 : sequence1)
+        {
+            column_it = column.begin();
+            auto cell = *column_it;
+            score_type diagonal = cell.best_score();
+            score_type const horizontal_score = cell.horizontal_score();
+            *column_it = affine_cell_type{horizontal_score,
+                                          horizontal_score + this->gap_extension_score,
+                                          horizontal_score + this->gap_open_score};
+
+            for (auto const & alphabet2 : sequence2)
+            {
+                auto cell = *++column_it;
+                score_type const next_diagonal = cell.best_score();
+                *column_it = this->compute_inner_cell(diagonal, cell, this->scoring_scheme.score(alphabet1, alphabet2));
+                diagonal = next_diagonal;
+            }
+
+            on_column(column, ++column_index);
+        }
+    }
+};
+
+} // namespace seqan3::detail
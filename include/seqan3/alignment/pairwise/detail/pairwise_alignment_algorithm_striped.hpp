@@ -0,0 +1,342 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_striped.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the score of single pairwise alignments with the striped
+ *        vectorisation within the alignment matrix.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm; must
+ *                    contain seqan3::detail::policy_affine_gap_recursion_striped, a scoring scheme policy and the
+ *                    result builder policy.
+ *
+ * \details
+ *
+ * This algorithm implements seqan3::align_cfg::striped_vectorised. In contrast to seqan3::align_cfg::vectorised,
+ * which computes one sequence pair per lane, the sequence pairs are computed one after another and every sequence pair
+ * uses all lanes of the simd vector (see seqan3::detail::policy_affine_gap_recursion_striped).
+ * The algorithm computes the global alignment, also with free end gaps, and the local alignment, but only the
+ * score and the end positions of the optimal alignment.
+ * The optimum is tracked in the same cells and with the same tie breaking as in the scalar algorithms, such that the
+ * results are identical.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_striped : protected policies_t...
+{
+protected:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of a striped column of the gap recursion policy.
+    using striped_column_type = typename pairwise_alignment_algorithm_striped::striped_column_type;
+    //!\brief The simd vector type of the gap recursion policy.
+    using score_type = typename pairwise_alignment_algorithm_striped::score_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(!traits_type::is_vectorised && !traits_type::is_banded && !traits_type::requires_trace_information,
+                  "The striped alignment computes only the score and the end positions of the unbanded alignment.");
+
+    //!\brief The striped score profiles of the symbols of the first sequence against the second sequence.
+    striped_column_type profile{};
+    //!\brief The offset of the profile of every symbol of the first sequence within the profile.
+    std::vector<size_t> profile_offsets{};
+    //!\brief The best score found so far.
+    original_score_type optimal_score{};
+    //!\brief The coordinate of the best score found so far.
+    matrix_coordinate optimal_coordinate{};
+    //!\brief The optimal scores of the column that contains the local optimum.
+    striped_column_type local_optimum_column{};
+    //!\brief Whether the cells of the last row are searched for the optimum.
+    bool test_last_row_cell{false};
+    //!\brief Whether the cells of the last column are searched for the optimum.
+    bool test_last_column_cell{false};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_striped() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped & operator=(pairwise_alignment_algorithm_striped const &) = default;
+                                                                                                    //!< Defaulted.
+    pairwise_alignment_algorithm_striped & operator=(pairwise_alignment_algorithm_striped &&) = default;
+                                                                                                    //!< Defaulted.
+    ~pairwise_alignment_algorithm_striped() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and the cells that are searched for the optimum.
+     */
+    pairwise_alignment_algorithm_striped(alignment_configuration_t const & config) : policies_t(config)...
+    {
+        auto method_global_config = config.get_or(align_cfg::method_global{});
+        test_last_row_cell = method_global_config.free_end_gaps_sequence1_trailing;
+        test_last_column_cell = method_global_config.free_end_gaps_sequence2_trailing;
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the striped columns.
+     *
+     * \details
+     *
+     * Computes the alignment matrix of every sequence pair column by column, where every column is computed with
+     * simd vectors. For every computed alignment the given callback is invoked with the respective alignment result.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence, `L` be the number of
+     * lanes of the simd vector and `S` be the number of different symbols in the first sequence. The runtime is in
+     * \f$ O(n * m / L) \f$ vector operations plus the propagation of the vertical gaps between the segments, which
+     * rarely needs more than one pass over a column. The space is in \f$ O(S * m) \f$ for the profile.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair));
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         optimal_score,
+                                         optimal_coordinate,
+                                         this->optimal_column,
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Computes the alignment matrix and tracks the optimum.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     *
+     * \details
+     *
+     * In the global alignment the cells of the last row are tracked after each column and the cells of the last
+     * column after the final column as in seqan3::detail::policy_optimum_tracker. In the local alignment the first
+     * column with the largest score is tracked and the row of the first cell with this score is searched once after
+     * the last column.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    void compute_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+
+        this->initialise_striped_columns(sequence2_size);
+        profile.clear();
+        profile_offsets.assign(alphabet_size<std::ranges::range_value_t<sequence1_t>>,
+                               std::numeric_limits<size_t>::max());
+
+        if constexpr (traits_type::is_local)
+        {
+            optimal_score = original_score_type{};
+            optimal_coordinate = matrix_coordinate{row_index_type{0u}, column_index_type{0u}};
+        }
+        else
+        {
+            optimal_score = std::numeric_limits<original_score_type>::lowest();
+            optimal_coordinate = matrix_coordinate{row_index_type{sequence2_size}, column_index_type{0u}};
+            track_last_row_cell(sequence2_size, 0u);
+        }
+
+        size_t column_index = 0;
+        for (auto && alphabet1 : sequence1)
+        {
+            size_t const offset = profile_offset(alphabet1, sequence2);
+            score_type const column_max = this->compute_striped_column(profile.data() + offset, ++column_index);
+
+            if constexpr (traits_type::is_local)
+                track_column(column_max, column_index);
+            else
+                track_last_row_cell(sequence2_size, column_index);
+        }
+
+        if constexpr (traits_type::is_local)
+        {
+            track_local_optimum_row(sequence2_size);
+        }
+        else
+        {
+            if (test_last_column_cell)
+            {
+                for (size_t row_index = 0; row_index <= sequence2_size; ++row_index)
+                    track_cell(row_index, column_index);
+            }
+            else if (!test_last_row_cell)
+            {
+                track_cell(sequence2_size, column_index);
+            }
+        }
+    }
+
+    /*!\brief Returns the offset of the striped profile of the given symbol and computes the profile if necessary.
+     * \tparam alphabet1_t The type of the symbol of the first sequence; must model seqan3::semialphabet.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] alphabet1 The symbol of the first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \details
+     *
+     * The profile is only computed for the symbols that occur in the first sequence. The rows beyond the end of the
+     * second sequence are scored with 0.
+     */
+    template <semialphabet alphabet1_t, std::ranges::forward_range sequence2_t>
+    size_t profile_offset(alphabet1_t const & alphabet1, sequence2_t && sequence2)
+    {
+        size_t & offset = profile_offsets[seqan3::to_rank(alphabet1)];
+
+        if (offset == std::numeric_limits<size_t>::max())
+        {
+            offset = profile.size();
+            profile.resize(offset + this->segment_size, score_type{});
+
+            size_t row = 0;
+            for (auto && alphabet2 : sequence2)
+            {
+                profile[offset + row % this->segment_size][row / this->segment_size] =
+                    this->scoring_scheme.score(alphabet1, alphabet2);
+                ++row;
+            }
+        }
+
+        return offset;
+    }
+
+    /*!\brief Tracks the cell of the last row of the current column if the last row is searched for the optimum.
+     * \param[in] row_index The index of the last row.
+     * \param[in] column_index The index of the current column.
+     */
+    void track_last_row_cell(size_t const row_index, size_t const column_index) noexcept
+    {
+        if (test_last_row_cell)
+            track_cell(row_index, column_index);
+    }
+
+    /*!\brief Updates the optimum with the given cell of the current column if its score is not smaller.
+     * \param[in] row_index The index of the row.
+     * \param[in] column_index The index of the current column.
+     */
+    void track_cell(size_t const row_index, size_t const column_index) noexcept
+    {
+        original_score_type const score = this->striped_score(row_index, column_index);
+
+        if (score >= optimal_score)
+        {
+            optimal_score = score;
+            optimal_coordinate = matrix_coordinate{row_index_type{row_index}, column_index_type{column_index}};
+        }
+    }
+
+    /*!\brief Updates the optimum of the local alignment if the current column contains a larger score.
+     * \param[in] column_max The largest score per lane of the current column.
+     * \param[in] column_index The index of the current column.
+     *
+     * \details
+     *
+     * Only the column index is tracked and the scores of the column are kept, such that the row is resolved once by
+     * seqan3::detail::pairwise_alignment_algorithm_striped::track_local_optimum_row. The rows beyond the end of the
+     * second sequence never exceed the optimum of the previous columns, hence the larger score is also found in a row
+     * of the second sequence.
+     */
+    void track_column(score_type const & column_max, size_t const column_index)
+    {
+        original_score_type largest_score = column_max[0];
+        for (size_t lane = 1; lane < this->lane_count; ++lane)
+            largest_score = std::max<original_score_type>(largest_score, column_max[lane]);
+
+        if (largest_score <= optimal_score)
+            return;
+
+        optimal_score = largest_score;
+        optimal_coordinate = matrix_coordinate{row_index_type{0u}, column_index_type{column_index}};
+        local_optimum_column.assign(this->optimal_column.begin(), this->optimal_column.end());
+    }
+
+    /*!\brief Sets the row of the local optimum to the first row with the optimal score in the tracked column.
+     * \param[in] sequence2_size The size of the second sequence.
+     */
+    void track_local_optimum_row(size_t const sequence2_size) noexcept
+    {
+        if (optimal_coordinate.col == 0u) // no positive score
+            return;
+
+        // The rows of a lane are consecutive, hence enumerating lane-wise visits the rows in ascending order.
+        for (size_t lane = 0; lane < this->lane_count; ++lane)
+        {
+            for (size_t segment = 0; segment < this->segment_size; ++segment)
+            {
+                size_t const row_index = lane * this->segment_size + segment + 1;
+
+                if (row_index > sequence2_size)
+                    break;
+
+                if (local_optimum_column[segment][lane] == optimal_score)
+                {
+                    optimal_coordinate.row = row_index;
+                    return;
+                }
+            }
+        }
+
+        assert(false); // the optimum is always found in a row of the second sequence
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,649 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_wavefront.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_path_buffer.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The penalties of the wavefront alignment that correspond to the scores of the alignment configuration.
+ * \ingroup alignment_pairwise
+ *
+ * \details
+ *
+ * Let \f$ M \f$ be the match score, \f$ X \f$ the mismatch score, \f$ G \f$ the gap open score and \f$ E \f$ the gap
+ * extension score. Every end-to-end alignment of two sequences of lengths \f$ n \f$ and \f$ m \f$ with \f$ a \f$
+ * mismatches, \f$ b \f$ gaps and \f$ c \f$ gap characters has \f$ (n + m - 2a - c) / 2 \f$ matches. Hence, its score is
+ * \f$ (M * (n + m) - P) / 2 \f$ with the penalty \f$ P = 2(M - X) * a - 2G * b + (M - 2E) * c \f$.
+ * All penalties are divided by their greatest common divisor, which is stored as the penalty_factor.
+ */
+struct wavefront_penalties
+{
+    //!\brief The score of a match.
+    int32_t match_score{};
+    //!\brief The penalty of a mismatch.
+    int32_t mismatch{};
+    //!\brief The penalty of opening a gap, without the penalty of its first gap character.
+    int32_t gap_open{};
+    //!\brief The penalty of a gap character.
+    int32_t gap_extension{};
+    //!\brief The factor by which the penalties were divided.
+    int32_t penalty_factor{1};
+};
+
+/*!\brief Translates the scores of the alignment configuration into the penalties of the wavefront alignment.
+ * \ingroup alignment_pairwise
+ * \tparam alignment_configuration_t The type of the alignment configuration.
+ * \param[in] config The alignment configuration.
+ * \returns The penalties or std::nullopt if the configured alignment cannot be computed with the wavefront algorithm.
+ *
+ * \details
+ *
+ * The wavefront alignment is only possible for the global alignment without free end gaps and with a scoring scheme
+ * that has a single match and a single mismatch score. Further, all penalties must be positive, except for the gap
+ * open penalty, which can be 0.
+ */
+template <typename alignment_configuration_t>
+std::optional<wavefront_penalties> make_wavefront_penalties(alignment_configuration_t const & config)
+{
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    using alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+
+    if constexpr (!traits_type::is_global)
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        auto const & method_global_config = config.get_or(align_cfg::method_global{});
+        if (method_global_config.free_end_gaps_sequence1_leading ||
+            method_global_config.free_end_gaps_sequence2_leading ||
+            method_global_config.free_end_gaps_sequence1_trailing ||
+            method_global_config.free_end_gaps_sequence2_trailing)
+            return std::nullopt;
+
+        auto const & scoring_scheme = get<align_cfg::scoring_scheme>(config).scheme;
+        auto score = [&] (size_t const rank1, size_t const rank2) -> int32_t
+        {
+            return scoring_scheme.score(assign_rank_to(rank1, alphabet_type{}),
+                                        assign_rank_to(rank2, alphabet_type{}));
+        };
+
+        int32_t const match_score = score(0, 0);
+        int32_t const mismatch_score = score(0, 1);
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_type>; ++rank1)
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_type>; ++rank2)
+                if (score(rank1, rank2) != (rank1 == rank2 ? match_score : mismatch_score))
+                    return std::nullopt;
+
+        align_cfg::gap_cost_affine const & gap_cost = config.get_or(align_cfg::gap_cost_affine{});
+
+        wavefront_penalties penalties{match_score,
+                                      2 * (match_score - mismatch_score),
+                                      -2 * gap_cost.open_score,
+                                      match_score - 2 * gap_cost.extension_score};
+
+        if (penalties.mismatch <= 0 || penalties.gap_open < 0 || penalties.gap_extension <= 0)
+            return std::nullopt;
+
+        penalties.penalty_factor = std::gcd(penalties.mismatch, std::gcd(penalties.gap_open, penalties.gap_extension));
+        penalties.mismatch /= penalties.penalty_factor;
+        penalties.gap_open /= penalties.penalty_factor;
+        penalties.gap_extension /= penalties.penalty_factor;
+        return penalties;
+    }
+}
+
+/*!\brief The alignment algorithm type to compute the global alignment with the wavefront algorithm.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm; must
+ *                    contain a scoring scheme policy and the result builder policy.
+ *
+ * \details
+ *
+ * This algorithm implements seqan3::align_cfg::wavefront. The scores are translated into penalties (see
+ * seqan3::detail::wavefront_penalties) and the wavefronts are computed for increasing penalties until the last cell of
+ * the alignment matrix is reached.
+ *
+ * Let \f$ k = h - v \f$ be the diagonal of the cell in column \f$ h \f$ and row \f$ v \f$. The wavefront of penalty
+ * \f$ s \f$ stores per diagonal the largest column \f$ h \f$ that is reached by an alignment with penalty \f$ s \f$,
+ * where the alignment ends with a match or mismatch (M), a gap in the second sequence (I) or a gap in the first
+ * sequence (D). With the mismatch penalty \f$ x \f$, the gap open penalty \f$ o \f$ and the gap extension penalty
+ * \f$ e \f$, the wavefronts are computed by:
+ *
+ * * \f$ I_{s,k} = \max(M_{s-o-e,k-1}, I_{s-e,k-1}) + 1 \f$
+ * * \f$ D_{s,k} = \max(M_{s-o-e,k+1}, D_{s-e,k+1}) \f$
+ * * \f$ M_{s,k} = \max(M_{s-x,k} + 1, I_{s,k}, D_{s,k}) \f$, followed by all matches along the diagonal.
+ *
+ * All wavefronts are kept for the traceback, which follows the origins of the stored values from the last cell back
+ * to the origin of the alignment matrix. If no trace is required, only the wavefronts that can still be read by the
+ * recursion are kept in a cyclic buffer.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_wavefront : protected policies_t...
+{
+protected:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(!traits_type::is_vectorised && !traits_type::is_banded && traits_type::is_global,
+                  "The wavefront alignment is only implemented for the unbanded scalar global alignment.");
+
+    //!\brief The value of an offset that is not reached.
+    static constexpr int32_t invalid_offset{std::numeric_limits<int32_t>::min() / 2};
+
+    //!\brief The offsets of the three components of a wavefront.
+    struct wavefront_type
+    {
+        //!\brief The smallest diagonal of the wavefront.
+        int32_t lowest_diagonal{1};
+        //!\brief The largest diagonal of the wavefront.
+        int32_t highest_diagonal{0};
+        //!\brief The diagonal stored at the first position of the offset vectors.
+        int32_t first_diagonal{0};
+        //!\brief The offsets of the alignments ending with a match or mismatch.
+        std::vector<int32_t> match_offsets{};
+        //!\brief The offsets of the alignments ending with a gap in the second sequence.
+        std::vector<int32_t> insertion_offsets{};
+        //!\brief The offsets of the alignments ending with a gap in the first sequence.
+        std::vector<int32_t> deletion_offsets{};
+
+        //!\brief Whether the wavefront contains any diagonal.
+        bool empty() const noexcept
+        {
+            return lowest_diagonal > highest_diagonal;
+        }
+
+        //!\brief Returns the offset of the given component on the given diagonal or the invalid offset.
+        static int32_t offset(std::vector<int32_t> const & offsets,
+                              wavefront_type const & wavefront,
+                              int32_t const diagonal) noexcept
+        {
+            if (offsets.empty() || diagonal < wavefront.lowest_diagonal || diagonal > wavefront.highest_diagonal)
+                return invalid_offset;
+
+            return offsets[diagonal - wavefront.first_diagonal];
+        }
+    };
+
+    //!\brief The penalties of the wavefront alignment.
+    wavefront_penalties penalties{};
+    //!\brief Whether the wavefronts are pruned adaptively.
+    bool adaptive_pruning{false};
+    //!\brief The minimal number of diagonals of a wavefront to be pruned.
+    int32_t min_wavefront_length{};
+    //!\brief The largest difference in the remaining distance to the best diagonal that is kept.
+    int32_t max_distance_threshold{};
+    //!\brief The wavefronts computed so far; reused between the sequence pairs.
+    std::vector<wavefront_type> wavefronts{};
+    //!\brief The number of stored wavefronts if they are stored cyclically, or 0 if all wavefronts are stored.
+    size_t wavefront_cycle_length{0};
+    //!\brief The trace path of the current alignment.
+    trace_path_buffer trace{};
+    //!\brief The trace directions found by the traceback from the end to the begin of the alignment.
+    std::vector<std::pair<trace_directions, int32_t>> reversed_trace{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_wavefront() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront const &) = default;
+                                                                                                    //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront & operator=(pairwise_alignment_algorithm_wavefront const &) = default;
+                                                                                                    //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront & operator=(pairwise_alignment_algorithm_wavefront &&) = default;
+                                                                                                    //!< Defaulted.
+    ~pairwise_alignment_algorithm_wavefront() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm, the penalties and the pruning parameters.
+     * Expects that seqan3::detail::make_wavefront_penalties returns the penalties for the given configuration.
+     */
+    pairwise_alignment_algorithm_wavefront(alignment_configuration_t const & config) : policies_t(config)...
+    {
+        std::optional<wavefront_penalties> configured_penalties = make_wavefront_penalties(config);
+        assert(configured_penalties.has_value());
+        penalties = *configured_penalties;
+
+        auto const & wavefront_config = config.get_or(align_cfg::wavefront{});
+        adaptive_pruning = wavefront_config.adaptive_pruning;
+        min_wavefront_length = wavefront_config.min_wavefront_length;
+        max_distance_threshold = wavefront_config.max_distance_threshold;
+
+        // Without trace, the recursion only reads the wavefronts of the last max(x, o + e) penalties.
+        if constexpr (!traits_type::requires_trace_information)
+            wavefront_cycle_length = std::max(penalties.mismatch, penalties.gap_open + penalties.gap_extension) + 1;
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the wavefronts.
+     *
+     * \details
+     *
+     * Computes the wavefronts of every sequence pair and, if required, the trace path of the optimal alignment.
+     * For every computed alignment the given callback is invoked with the respective alignment result.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `s` be the penalty of
+     * the optimal alignment. The runtime is in \f$ O((n + m) * s) \f$ and the space is in \f$ O(s^2) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            int32_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            int32_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            int32_t const penalty = compute_wavefronts(get<0>(sequence_pair), get<1>(sequence_pair));
+
+            if constexpr (traits_type::requires_trace_information)
+                compute_trace_path(penalty, sequence1_size - sequence2_size, sequence1_size);
+
+            original_score_type const score =
+                static_cast<original_score_type>((static_cast<int64_t>(penalties.match_score) *
+                                                  (sequence1_size + sequence2_size) -
+                                                  static_cast<int64_t>(penalty) * penalties.penalty_factor) / 2);
+
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         score,
+                                         matrix_coordinate{row_index_type{static_cast<size_t>(sequence2_size)},
+                                                           column_index_type{static_cast<size_t>(sequence1_size)}},
+                                         trace,
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Computes the wavefronts until the last cell of the alignment matrix is reached.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns The penalty of the optimal alignment.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    int32_t compute_wavefronts(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        int32_t const sequence1_size = std::ranges::distance(sequence1);
+        int32_t const sequence2_size = std::ranges::distance(sequence2);
+        int32_t const last_diagonal = sequence1_size - sequence2_size;
+
+        for (int32_t penalty = 0; ; ++penalty)
+        {
+            if (wavefront_position(penalty) == wavefronts.size())
+                wavefronts.emplace_back();
+
+            wavefront_type & wavefront = wavefronts[wavefront_position(penalty)];
+            if (penalty == 0)
+                initialise_wavefront(wavefront);
+            else
+                compute_next_wavefront(penalty, sequence1_size, sequence2_size);
+
+            if (wavefront.empty())
+                continue;
+
+            extend_matches(wavefront, sequence1, sequence2);
+
+            if (wavefront_type::offset(wavefront.match_offsets, wavefront, last_diagonal) >= sequence1_size)
+                return penalty;
+
+            if (adaptive_pruning)
+                prune_wavefront(wavefront, sequence1_size, sequence2_size);
+        }
+    }
+
+    //!\brief Returns the position of the wavefront of the given penalty in the stored wavefronts.
+    size_t wavefront_position(int32_t const penalty) const noexcept
+    {
+        return (wavefront_cycle_length == 0) ? penalty : penalty % wavefront_cycle_length;
+    }
+
+    /*!\brief Initialises the wavefront of penalty 0 with the origin of the alignment matrix.
+     * \param[in,out] wavefront The wavefront to initialise.
+     */
+    void initialise_wavefront(wavefront_type & wavefront)
+    {
+        wavefront.lowest_diagonal = 0;
+        wavefront.highest_diagonal = 0;
+        wavefront.first_diagonal = 0;
+        wavefront.match_offsets.assign(1, 0);
+        wavefront.insertion_offsets.clear();
+        wavefront.deletion_offsets.clear();
+    }
+
+    /*!\brief The offsets that are reached on a diagonal before the matches are followed.
+     * \details
+     * The offsets are invalid if the respective cell is not reached or lies outside of the alignment matrix.
+     */
+    struct source_offsets
+    {
+        //!\brief The offset reached by a mismatch.
+        int32_t mismatch{invalid_offset};
+        //!\brief The offset reached by a gap in the second sequence.
+        int32_t insertion{invalid_offset};
+        //!\brief The offset reached by a gap in the first sequence.
+        int32_t deletion{invalid_offset};
+
+        //!\brief The largest of the offsets.
+        int32_t best() const noexcept
+        {
+            return std::max({mismatch, insertion, deletion});
+        }
+    };
+
+    /*!\brief Computes the offsets on a diagonal from the wavefronts of smaller penalties.
+     * \param[in] penalty The penalty of the wavefront.
+     * \param[in] diagonal The diagonal to compute the offsets for.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     * \returns The offsets reached by the three kinds of the last alignment column.
+     */
+    source_offsets compute_source_offsets(int32_t const penalty,
+                                          int32_t const diagonal,
+                                          int32_t const sequence1_size,
+                                          int32_t const sequence2_size) const noexcept
+    {
+        auto wavefront_at = [&] (int32_t const source_penalty) -> wavefront_type const *
+        {
+            if (source_penalty < 0 || wavefronts[wavefront_position(source_penalty)].empty())
+                return nullptr;
+
+            return &wavefronts[wavefront_position(source_penalty)];
+        };
+
+        auto match_offset = [] (wavefront_type const * wavefront, int32_t const diagonal)
+        {
+            return wavefront ? wavefront_type::offset(wavefront->match_offsets, *wavefront, diagonal) : invalid_offset;
+        };
+
+        wavefront_type const * mismatch_source = wavefront_at(penalty - penalties.mismatch);
+        wavefront_type const * open_source = wavefront_at(penalty - penalties.gap_open - penalties.gap_extension);
+        wavefront_type const * extension_source = wavefront_at(penalty - penalties.gap_extension);
+
+        int32_t insertion = match_offset(open_source, diagonal - 1);
+        int32_t deletion = match_offset(open_source, diagonal + 1);
+        if (extension_source)
+        {
+            insertion = std::max(insertion,
+                                 wavefront_type::offset(extension_source->insertion_offsets,
+                                                        *extension_source,
+                                                        diagonal - 1));
+            deletion = std::max(deletion,
+                                wavefront_type::offset(extension_source->deletion_offsets,
+                                                       *extension_source,
+                                                       diagonal + 1));
+        }
+
+        source_offsets offsets{match_offset(mismatch_source, diagonal) + 1, insertion + 1, deletion};
+
+        // The column of a cell must not exceed the first sequence and its row must not exceed the second sequence.
+        auto validate = [&] (int32_t & offset)
+        {
+            if (offset < 0 || offset > sequence1_size || offset - diagonal > sequence2_size)
+                offset = invalid_offset;
+        };
+
+        validate(offsets.mismatch);
+        validate(offsets.insertion);
+        validate(offsets.deletion);
+        return offsets;
+    }
+
+    /*!\brief Computes the wavefront of the given penalty from the wavefronts of smaller penalties.
+     * \param[in] penalty The penalty of the wavefront to compute.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     */
+    void compute_next_wavefront(int32_t const penalty, int32_t const sequence1_size, int32_t const sequence2_size)
+    {
+        wavefront_type & wavefront = wavefronts[wavefront_position(penalty)];
+        wavefront.lowest_diagonal = std::numeric_limits<int32_t>::max();
+        wavefront.highest_diagonal = std::numeric_limits<int32_t>::min();
+
+        // The diagonals of the wavefront are the diagonals of the source wavefronts and their neighbours.
+        for (int32_t const source_penalty : {penalty - penalties.mismatch,
+                                             penalty - penalties.gap_open - penalties.gap_extension,
+                                             penalty - penalties.gap_extension})
+        {
+            if (source_penalty < 0 || wavefronts[wavefront_position(source_penalty)].empty())
+                continue;
+
+            wavefront_type const & source = wavefronts[wavefront_position(source_penalty)];
+            wavefront.lowest_diagonal = std::min(wavefront.lowest_diagonal, source.lowest_diagonal - 1);
+            wavefront.highest_diagonal = std::max(wavefront.highest_diagonal, source.highest_diagonal + 1);
+        }
+
+        wavefront.lowest_diagonal = std::max(wavefront.lowest_diagonal, -sequence2_size);
+        wavefront.highest_diagonal = std::min(wavefront.highest_diagonal, sequence1_size);
+        if (wavefront.empty())
+            return;
+
+        size_t const width = wavefront.highest_diagonal - wavefront.lowest_diagonal + 1;
+        wavefront.first_diagonal = wavefront.lowest_diagonal;
+        wavefront.match_offsets.resize(width);
+        wavefront.insertion_offsets.resize(width);
+        wavefront.deletion_offsets.resize(width);
+
+        for (int32_t diagonal = wavefront.lowest_diagonal; diagonal <= wavefront.highest_diagonal; ++diagonal)
+        {
+            source_offsets const offsets = compute_source_offsets(penalty, diagonal, sequence1_size, sequence2_size);
+            size_t const position = diagonal - wavefront.first_diagonal;
+
+            wavefront.insertion_offsets[position] = offsets.insertion;
+            wavefront.deletion_offsets[position] = offsets.deletion;
+            wavefront.match_offsets[position] = offsets.best();
+        }
+    }
+
+    /*!\brief Follows the matches on every diagonal of the wavefront.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in,out] wavefront The wavefront to extend.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    void extend_matches(wavefront_type & wavefront, sequence1_t && sequence1, sequence2_t && sequence2) const
+    {
+        int32_t const sequence1_size = std::ranges::distance(sequence1);
+        int32_t const sequence2_size = std::ranges::distance(sequence2);
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        for (int32_t diagonal = wavefront.lowest_diagonal; diagonal <= wavefront.highest_diagonal; ++diagonal)
+        {
+            int32_t & offset = wavefront.match_offsets[diagonal - wavefront.first_diagonal];
+            if (offset == invalid_offset)
+                continue;
+
+            while (offset < sequence1_size && offset - diagonal < sequence2_size &&
+                   this->scoring_scheme.score(sequence1_it[offset], sequence2_it[offset - diagonal]) ==
+                   penalties.match_score)
+                ++offset;
+        }
+    }
+
+    /*!\brief Removes the diagonals from both sides of the wavefront that fall behind the best diagonal.
+     * \param[in,out] wavefront The wavefront to prune.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     *
+     * \details
+     *
+     * The remaining distance of a diagonal is the larger of the number of remaining columns and remaining rows of its
+     * offset. Diagonals whose remaining distance exceeds the smallest one by more than the threshold are removed.
+     */
+    void prune_wavefront(wavefront_type & wavefront, int32_t const sequence1_size, int32_t const sequence2_size) const
+    {
+        if (wavefront.highest_diagonal - wavefront.lowest_diagonal + 1 < min_wavefront_length)
+            return;
+
+        auto remaining_distance = [&] (int32_t const diagonal) -> int64_t
+        {
+            int32_t const offset = wavefront.match_offsets[diagonal - wavefront.first_diagonal];
+            if (offset == invalid_offset)
+                return std::numeric_limits<int64_t>::max() / 2;
+
+            return std::max(sequence1_size - offset, sequence2_size - (offset - diagonal));
+        };
+
+        int64_t min_distance = std::numeric_limits<int64_t>::max();
+        for (int32_t diagonal = wavefront.lowest_diagonal; diagonal <= wavefront.highest_diagonal; ++diagonal)
+            min_distance = std::min(min_distance, remaining_distance(diagonal));
+
+        while (wavefront.lowest_diagonal < wavefront.highest_diagonal &&
+               remaining_distance(wavefront.lowest_diagonal) - min_distance > max_distance_threshold)
+            ++wavefront.lowest_diagonal;
+
+        while (wavefront.lowest_diagonal < wavefront.highest_diagonal &&
+               remaining_distance(wavefront.highest_diagonal) - min_distance > max_distance_threshold)
+            --wavefront.highest_diagonal;
+    }
+
+    /*!\brief Follows the origins of the wavefront offsets from the last cell back to the origin.
+     * \param[in] penalty The penalty of the optimal alignment.
+     * \param[in] last_diagonal The diagonal of the last cell of the alignment matrix.
+     * \param[in] last_offset The offset of the last cell of the alignment matrix.
+     *
+     * \details
+     *
+     * The found trace path is stored in the trace path buffer.
+     */
+    void compute_trace_path(int32_t penalty, int32_t const last_diagonal, int32_t const last_offset)
+    {
+        enum struct component { match, insertion, deletion };
+
+        int32_t const sequence1_size = last_offset;
+        int32_t const sequence2_size = last_offset - last_diagonal;
+        int32_t const open_penalty = penalties.gap_open + penalties.gap_extension;
+
+        reversed_trace.clear();
+        component state = component::match;
+        int32_t diagonal = last_diagonal;
+        int32_t offset = last_offset;
+
+        while (true)
+        {
+            if (state == component::match)
+            {
+                if (penalty == 0) // Only matches remain to the origin.
+                {
+                    reversed_trace.emplace_back(trace_directions::diagonal, offset);
+                    break;
+                }
+
+                source_offsets const offsets = compute_source_offsets(penalty, diagonal, sequence1_size,
+                                                                      sequence2_size);
+                int32_t const source_offset = offsets.best();
+                reversed_trace.emplace_back(trace_directions::diagonal, offset - source_offset);
+                offset = source_offset;
+
+                if (offset == offsets.mismatch)
+                {
+                    reversed_trace.emplace_back(trace_directions::diagonal, 1);
+                    penalty -= penalties.mismatch;
+                    --offset;
+                }
+                else
+                {
+                    state = (offset == offsets.insertion) ? component::insertion : component::deletion;
+                }
+            }
+            else if (state == component::insertion)
+            {
+                reversed_trace.emplace_back(trace_directions::left, 1);
+                wavefront_type const & source = wavefronts[penalty - open_penalty >= 0 ? penalty - open_penalty : 0];
+                state = (penalty >= open_penalty &&
+                         wavefront_type::offset(source.match_offsets, source, diagonal - 1) + 1 == offset)
+                      ? component::match : component::insertion;
+                penalty -= (state == component::match) ? open_penalty : penalties.gap_extension;
+                --diagonal;
+                --offset;
+            }
+            else // component::deletion
+            {
+                reversed_trace.emplace_back(trace_directions::up, 1);
+                wavefront_type const & source = wavefronts[penalty - open_penalty >= 0 ? penalty - open_penalty : 0];
+                state = (penalty >= open_penalty &&
+                         wavefront_type::offset(source.match_offsets, source, diagonal + 1) == offset)
+                      ? component::match : component::deletion;
+                penalty -= (state == component::match) ? open_penalty : penalties.gap_extension;
+                ++diagonal;
+            }
+        }
+
+        trace.clear();
+        for (auto it = reversed_trace.rbegin(); it != reversed_trace.rend(); ++it)
+            trace.append(it->first, it->second);
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,289 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::policy_affine_gap_recursion_striped.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Implements the affine gap recursion for one sequence pair whose columns are computed in the striped layout.
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The type of the alignment configuration.
+ *
+ * \details
+ *
+ * Computes the same recursion as seqan3::detail::policy_affine_gap_recursion, but vectorises the computation within
+ * one column of the alignment matrix. The `m` rows of a column are split into `L` segments, where `L` is the number of
+ * lanes of the simd vector, and the i-th vector of the column holds the rows `i, i + s, i + 2s, ...` with
+ * `s = ceil(m / L)`. Thus, the vectors of one column depend on each other only through the vertical gaps.
+ * The vertical gaps are first computed within every segment and afterwards propagated across the segments until they
+ * do not change any cell anymore ("lazy F loop").
+ * The first sequence is enumerated column-wise and the second sequence is given as a striped score profile, i.e. the
+ * scores of one symbol of the first sequence against all symbols of the second sequence in the striped layout.
+ *
+ * \note For more information, please refer to the original article:
+ *       FARRAR, Michael. Striped Smith–Waterman speeds database searches six times over other SIMD implementations.
+ *       Bioinformatics, 2007, 23. Jg., Nr. 2, S. 156-161.
+ */
+template <typename alignment_configuration_t>
+class policy_affine_gap_recursion_striped
+{
+protected:
+    //!\brief The configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The simd vector type holding one vector of a striped column.
+    using score_type = simd::simd_type_t<original_score_type>;
+    //!\brief The type of a striped column.
+    using striped_column_type = std::vector<score_type, aligned_allocator<score_type, alignof(score_type)>>;
+
+    //!\brief The number of lanes, i.e. the number of segments of a column.
+    static constexpr size_t lane_count = simd_traits<score_type>::length;
+
+    //!\brief The score for a gap extension.
+    score_type gap_extension_score{};
+    //!\brief The score for a gap opening including the gap extension.
+    score_type gap_open_score{};
+    //!\brief The scalar score for a gap extension.
+    original_score_type scalar_gap_extension_score{};
+    //!\brief The scalar score for a gap opening including the gap extension.
+    original_score_type scalar_gap_open_score{};
+    //!\brief A score that represents minus infinity and cannot underflow when gap scores are added.
+    original_score_type scalar_lowest_score{std::numeric_limits<original_score_type>::lowest() / 2};
+
+    //!\brief Initialisation state of the first row of the alignment.
+    bool first_row_is_free{};
+    //!\brief Initialisation state of the first column of the alignment.
+    bool first_column_is_free{};
+
+    //!\brief The optimal scores of the current column without the first row.
+    striped_column_type optimal_column{};
+    //!\brief The horizontal scores of the next column without the first row.
+    striped_column_type horizontal_column{};
+    //!\brief The number of simd vectors of a column.
+    size_t segment_size{};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    policy_affine_gap_recursion_striped() = default; //!< Defaulted.
+    policy_affine_gap_recursion_striped(policy_affine_gap_recursion_striped const &) = default; //!< Defaulted.
+    policy_affine_gap_recursion_striped(policy_affine_gap_recursion_striped &&) = default; //!< Defaulted.
+    policy_affine_gap_recursion_striped & operator=(policy_affine_gap_recursion_striped const &) = default;
+                                                                                                  //!< Defaulted.
+    policy_affine_gap_recursion_striped & operator=(policy_affine_gap_recursion_striped &&) = default;
+                                                                                                  //!< Defaulted.
+    ~policy_affine_gap_recursion_striped() = default; //!< Defaulted.
+
+    /*!\brief Construction and initialisation using the alignment configuration.
+     * \param[in] config The alignment configuration.
+     *
+     * \details
+     *
+     * Initialises the gap scores and the free end gaps of the leading gaps. In the local alignment the first row
+     * and the first column are always free. If no gap cost model was provided by the user the default gap costs `-10`
+     * and `-1` are set for the gap open score and the gap extension score respectively.
+     */
+    explicit policy_affine_gap_recursion_striped(alignment_configuration_t const & config)
+    {
+        auto const & selected_gap_scheme = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                                    align_cfg::extension_score{-1}});
+
+        scalar_gap_extension_score = selected_gap_scheme.extension_score;
+        scalar_gap_open_score = selected_gap_scheme.open_score + scalar_gap_extension_score;
+        gap_extension_score = simd::fill<score_type>(scalar_gap_extension_score);
+        gap_open_score = simd::fill<score_type>(scalar_gap_open_score);
+
+        auto method_global_config = config.get_or(align_cfg::method_global{});
+        first_row_is_free = method_global_config.free_end_gaps_sequence1_leading || traits_type::is_local;
+        first_column_is_free = method_global_config.free_end_gaps_sequence2_leading || traits_type::is_local;
+    }
+    //!\}
+
+    /*!\brief Initialises the striped columns with the first column of the alignment matrix.
+     * \param[in] sequence2_size The size of the second sequence, i.e. the number of rows without the first row.
+     *
+     * \details
+     *
+     * The rows beyond the end of the second sequence pad the last segments and are initialised like regular rows.
+     * They never influence a row of the second sequence.
+     */
+    void initialise_striped_columns(size_t const sequence2_size)
+    {
+        segment_size = std::max<size_t>(1, (sequence2_size + lane_count - 1) / lane_count);
+        optimal_column.resize(segment_size);
+        horizontal_column.resize(segment_size);
+
+        for (size_t segment = 0; segment < segment_size; ++segment)
+        {
+            for (size_t lane = 0; lane < lane_count; ++lane)
+            {
+                size_t const row = lane * segment_size + segment + 1;
+                optimal_column[segment][lane] = first_column_is_free
+                                              ? original_score_type{}
+                                              : static_cast<original_score_type>(
+                                                    scalar_gap_open_score +
+                                                    static_cast<int64_t>(row - 1) * scalar_gap_extension_score);
+            }
+
+            horizontal_column[segment] = optimal_column[segment] + gap_open_score;
+        }
+    }
+
+    /*!\brief Returns the optimal score of the cell in the first row of the given column.
+     * \param[in] column_index The index of the column.
+     */
+    original_score_type first_row_score(size_t const column_index) const noexcept
+    {
+        if (column_index == 0 || first_row_is_free)
+            return original_score_type{};
+
+        return static_cast<original_score_type>(scalar_gap_open_score +
+                                                static_cast<int64_t>(column_index - 1) * scalar_gap_extension_score);
+    }
+
+    /*!\brief Returns the optimal score of the given row of the current column.
+     * \param[in] row_index The index of the row; must not be greater than the size of the second sequence.
+     * \param[in] column_index The index of the current column.
+     */
+    original_score_type striped_score(size_t const row_index, size_t const column_index) const noexcept
+    {
+        if (row_index == 0)
+            return first_row_score(column_index);
+
+        return optimal_column[(row_index - 1) % segment_size][(row_index - 1) / segment_size];
+    }
+
+    /*!\brief Computes the next column of the alignment matrix.
+     * \param[in] profile Points to the striped scores of the current symbol of the first sequence against the second
+     *                    sequence; must hold segment_size vectors.
+     * \param[in] column_index The index of the column to compute; must be greater than 0.
+     * \returns The largest optimal score per lane of the computed column; only computed in the local alignment.
+     *
+     * \details
+     *
+     * Computes the column by the recursion of seqan3::detail::policy_affine_gap_recursion::compute_inner_cell, where
+     * the vertical gaps are passed between the segments by the lazy F loop. In the local alignment the optimal
+     * scores are not smaller than 0.
+     */
+    score_type compute_striped_column(score_type const * profile, size_t const column_index) noexcept
+    {
+        score_type const lowest_score = simd::fill<score_type>(scalar_lowest_score);
+        score_type column_max = simd::fill<score_type>(original_score_type{});
+
+        // The diagonal of the first row of a segment is the last row of the previous segment in the previous column.
+        score_type diagonal_score = shift_lanes_up(optimal_column[segment_size - 1],
+                                                   first_row_score(column_index - 1));
+        score_type vertical_score = lowest_score;
+        vertical_score[0] = first_row_score(column_index) + scalar_gap_open_score;
+
+        for (size_t segment = 0; segment < segment_size; ++segment)
+        {
+            score_type optimal_score = diagonal_score + profile[segment];
+            diagonal_score = optimal_column[segment];
+
+            score_type horizontal_score = horizontal_column[segment];
+            optimal_score = (optimal_score < vertical_score) ? vertical_score : optimal_score;
+            optimal_score = (optimal_score < horizontal_score) ? horizontal_score : optimal_score;
+
+            if constexpr (traits_type::is_local)
+            {
+                optimal_score = (optimal_score < score_type{}) ? score_type{} : optimal_score;
+                column_max = (column_max < optimal_score) ? optimal_score : column_max;
+            }
+
+            optimal_column[segment] = optimal_score;
+
+            score_type tmp = optimal_score + gap_open_score;
+            vertical_score += gap_extension_score;
+            horizontal_score += gap_extension_score;
+            vertical_score = (vertical_score < tmp) ? tmp : vertical_score;
+            horizontal_column[segment] = (horizontal_score < tmp) ? tmp : horizontal_score;
+        }
+
+        // Lazy F loop: Pass the vertical gaps leaving the end of a segment to the beginning of the next segment.
+        // After lane_count passes every segment has received the vertical gaps of all previous segments.
+        vertical_score = shift_lanes_up(vertical_score, scalar_lowest_score);
+        for (size_t segment = 0, pass = 0; pass < lane_count && any_greater(vertical_score,
+                                                                            optimal_column[segment] + gap_open_score);)
+        {
+            score_type optimal_score = optimal_column[segment];
+            optimal_score = (optimal_score < vertical_score) ? vertical_score : optimal_score;
+
+            if constexpr (traits_type::is_local)
+                column_max = (column_max < optimal_score) ? optimal_score : column_max;
+
+            optimal_column[segment] = optimal_score;
+
+            score_type tmp = optimal_score + gap_open_score;
+            horizontal_column[segment] = (horizontal_column[segment] < tmp) ? tmp : horizontal_column[segment];
+
+            vertical_score += gap_extension_score;
+            vertical_score = (vertical_score < lowest_score) ? lowest_score : vertical_score;
+
+            if (++segment == segment_size)
+            {
+                vertical_score = shift_lanes_up(vertical_score, scalar_lowest_score);
+                segment = 0;
+                ++pass;
+            }
+        }
+
+        return column_max;
+    }
+
+private:
+    /*!\brief Moves every value to the next lane and sets the first lane to the given value.
+     * \param[in] vector The vector to shift.
+     * \param[in] first_value The value of the first lane.
+     */
+    static score_type shift_lanes_up(score_type const & vector, original_score_type const first_value) noexcept
+    {
+        score_type result{};
+        result[0] = first_value;
+
+        for (size_t lane = 1; lane < lane_count; ++lane)
+            result[lane] = vector[lane - 1];
+
+        return result;
+    }
+
+    /*!\brief Returns whether any lane of the first vector is greater than the same lane of the second vector.
+     * \param[in] lhs The left hand side of the comparison.
+     * \param[in] rhs The right hand side of the comparison.
+     */
+    static bool any_greater(score_type const & lhs, score_type const & rhs) noexcept
+    {
+        auto const mask = lhs > rhs;
+
+        for (size_t lane = 0; lane < lane_count; ++lane)
+            if (mask[lane])
+                return true;
+
+        return false;
+    }
+};
+
+} // namespace seqan3::detail
@@ -73,41 +73,72 @@ protected:
         diagonal_score += sequence_score;
         score_type horizontal_score = previous_cell.horizontal_score();
         score_type vertical_score = previous_cell.vertical_score();
-        trace_directions best_trace = trace_directions::diagonal;
-
-        diagonal_score = (diagonal_score < vertical_score)
-                       ? (best_trace = previous_cell.vertical_trace(), vertical_score)
-                       : (best_trace |= previous_cell.vertical_trace(), diagonal_score);
-        diagonal_score = (diagonal_score < horizontal_score)
-                       ? (best_trace = previous_cell.horizontal_trace(), horizontal_score)
-                       : (best_trace |= previous_cell.horizontal_trace(), diagonal_score);
-
-        score_type tmp = diagonal_score + gap_open_score;
-        vertical_score += gap_extension_score;
-        horizontal_score += gap_extension_score;
-
-        // store the vertical_score and horizontal_score value in the next path
-        trace_directions next_vertical_trace = trace_directions::up;
-        trace_directions next_horizontal_trace = trace_directions::left;
-
-        vertical_score = (vertical_score < tmp)
-                       ? (next_vertical_trace = trace_directions::up_open, tmp)
-                       : vertical_score;
-        horizontal_score = (horizontal_score < tmp)
-                         ? (next_horizontal_trace = trace_directions::left_open, tmp)
-                         : horizontal_score;
-
-        return {{diagonal_score, horizontal_score, vertical_score},
-                {best_trace, next_horizontal_trace, next_vertical_trace}};
+
+        if constexpr (simd_concept<trace_type>)
+        {
+            // In the vectorised alignment the trace of every lane is selected with the comparison masks.
+            auto is_vertical = diagonal_score < vertical_score;
+            trace_type best_trace = is_vertical ? previous_cell.vertical_trace()
+                                                : (as_trace(trace_directions::diagonal) | previous_cell.vertical_trace());
+            diagonal_score = is_vertical ? vertical_score : diagonal_score;
+
+            auto is_horizontal = diagonal_score < horizontal_score;
+            best_trace = is_horizontal ? previous_cell.horizontal_trace()
+                                       : (best_trace | previous_cell.horizontal_trace());
+            diagonal_score = is_horizontal ? horizontal_score : diagonal_score;
+
+            score_type tmp = diagonal_score + gap_open_score;
+            vertical_score += gap_extension_score;
+            horizontal_score += gap_extension_score;
+
+            auto vertical_is_opened = vertical_score < tmp;
+            auto horizontal_is_opened = horizontal_score < tmp;
+
+            return {{diagonal_score,
+                     horizontal_is_opened ? tmp : horizontal_score,
+                     vertical_is_opened ? tmp : vertical_score},
+                    {best_trace,
+                     horizontal_is_opened ? as_trace(trace_directions::left_open) : as_trace(trace_directions::left),
+                     vertical_is_opened ? as_trace(trace_directions::up_open) : as_trace(trace_directions::up)}};
+        }
+        else
+        {
+            trace_directions best_trace = trace_directions::diagonal;
+
+            diagonal_score = (diagonal_score < vertical_score)
+                           ? (best_trace = previous_cell.vertical_trace(), vertical_score)
+                           : (best_trace |= previous_cell.vertical_trace(), diagonal_score);
+            diagonal_score = (diagonal_score < horizontal_score)
+                           ? (best_trace = previous_cell.horizontal_trace(), horizontal_score)
+                           : (best_trace |= previous_cell.horizontal_trace(), diagonal_score);
+
+            score_type tmp = diagonal_score + gap_open_score;
+            vertical_score += gap_extension_score;
+            horizontal_score += gap_extension_score;
+
+            // store the vertical_score and horizontal_score value in the next path
+            trace_directions next_vertical_trace = trace_directions::up;
+            trace_directions next_horizontal_trace = trace_directions::left;
+
+            vertical_score = (vertical_score < tmp)
+                           ? (next_vertical_trace = trace_directions::up_open, tmp)
+                           : vertical_score;
+            horizontal_score = (horizontal_score < tmp)
+                             ? (next_horizontal_trace = trace_directions::left_open, tmp)
+                             : horizontal_score;
+
+            return {{diagonal_score, horizontal_score, vertical_score},
+                    {best_trace, next_horizontal_trace, next_vertical_trace}};
+        }
     }
 
     //!\copydoc seqan3::detail::policy_affine_gap_recursion::initialise_origin_cell
     affine_cell_type initialise_origin_cell() const noexcept
     {
         return {base_t::initialise_origin_cell(),
-                {trace_directions::none,
-                 first_row_is_free ? trace_directions::none : trace_directions::left_open,
-                 first_column_is_free ? trace_directions::none : trace_directions::up_open}};
+                {as_trace(trace_directions::none),
+                 as_trace(first_row_is_free ? trace_directions::none : trace_directions::left_open),
+                 as_trace(first_column_is_free ? trace_directions::none : trace_directions::up_open)}};
     }
 
     //!\copydoc seqan3::detail::policy_affine_gap_recursion::initialise_first_column_cell
@@ -116,8 +147,8 @@ protected:
     {
         return {base_t::initialise_first_column_cell(previous_cell),
                 {previous_cell.vertical_trace(),
-                 trace_directions::left_open,
-                 first_column_is_free ? trace_directions::none : trace_directions::up}};
+                 as_trace(trace_directions::left_open),
+                 as_trace(first_column_is_free ? trace_directions::none : trace_directions::up)}};
     }
 
     //!\copydoc seqan3::detail::policy_affine_gap_recursion::initialise_first_row_cell
@@ -126,8 +157,20 @@ protected:
     {
         return {base_t::initialise_first_row_cell(previous_cell),
                 {previous_cell.horizontal_trace(),
-                 first_row_is_free ? trace_directions::none : trace_directions::left,
-                 trace_directions::up_open}};
+                 as_trace(first_row_is_free ? trace_directions::none : trace_directions::left),
+                 as_trace(trace_directions::up_open)}};
+    }
+
+    /*!\brief Converts the given trace direction into the configured trace type.
+     * \param[in] direction The trace direction to convert.
+     * \returns The direction itself or, in the vectorised alignment, a simd vector with the direction in every lane.
+     */
+    static constexpr trace_type as_trace(trace_directions const direction) noexcept
+    {
+        if constexpr (simd_concept<trace_type>)
+            return simd::fill<trace_type>(static_cast<typename simd_traits<trace_type>::scalar_type>(direction));
+        else
+            return direction;
     }
 };
 } // namespace seqan3::detail
@@ -12,10 +12,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <tuple>
 
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/detail/coordinate_matrix.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
@@ -135,6 +137,12 @@ protected:
      * Acquires a thread local alignment and index matrix. Initialises the matrices with the given
      * sequence sizes and the initial score value. In the banded alignment, the alignment matrix is reduced to
      * the column count times the band size.
+     * The matrices are reused by all alignments computed by the same thread, such that memory is only allocated if
+     * the current alignment needs a bigger matrix than all previous ones. A matrix with more than
+     * seqan3::detail::matrix_memory_cache_cell_limit cells is released again by the next smaller alignment, and
+     * seqan3::release_alignment_matrix_memory releases the matrices of the calling thread.
+     * If the alignment matrix offers a `resize_for_overwrite` member function, it is used for the unbanded alignment
+     * to skip the initialisation of the matrix memory.
      *
      * ### Exception
      *
@@ -154,8 +162,15 @@ protected:
         if constexpr (traits_t::is_banded)
             check_valid_band_configuration(sequence1_size, sequence2_size);
 
-        static thread_local alignment_matrix_t alignment_matrix{};
-        static thread_local coordinate_matrix<matrix_index_type> index_matrix{};
+        struct cached_matrices
+        {
+            alignment_matrix_t alignment_matrix{};
+            coordinate_matrix<matrix_index_type> index_matrix{};
+            size_t cell_count{}; // The largest number of cells requested since the matrices were released.
+        };
+
+        static thread_local matrix_memory_cache::entry<cached_matrices> cache{};
+        auto & [alignment_matrix, index_matrix, cached_cell_count] = cache.matrix;
 
         // Increase dimension by one for the initialisation of the matrix.
         size_t const column_count = sequence1_size + 1;
@@ -170,7 +185,26 @@ protected:
             row_count = std::min<int64_t>(upper_diagonal - lower_diagonal + 2, row_count);
         }
 
-        alignment_matrix.resize(column_index_type{column_count}, row_index_type{row_count}, initial_score);
+        // Do not keep the memory of an alignment matrix beyond the cache limit for smaller alignments.
+        size_t const cell_count = column_count * row_count;
+        if (cached_cell_count > matrix_memory_cache_cell_limit && cell_count <= matrix_memory_cache_cell_limit)
+        {
+            alignment_matrix = alignment_matrix_t{};
+            cached_cell_count = 0;
+        }
+        cached_cell_count = std::max(cached_cell_count, cell_count);
+
+        // The unbanded alignment initialises the complete first column and writes every cell before reading it.
+        // Hence, the memory of the previous alignment does not need to be reset.
+        if constexpr (!traits_t::is_banded &&
+                      requires { alignment_matrix.resize_for_overwrite(column_index_type{column_count},
+                                                                       row_index_type{row_count},
+                                                                       initial_score); })
+            alignment_matrix.resize_for_overwrite(column_index_type{column_count},
+                                                  row_index_type{row_count},
+                                                  initial_score);
+        else
+            alignment_matrix.resize(column_index_type{column_count}, row_index_type{row_count}, initial_score);
 
         return std::tie(alignment_matrix, index_matrix);
     }
@@ -80,13 +80,15 @@ protected:
      * \param[in] end_positions The matrix coordinate of the best alignment score.
      * \param[in] alignment_matrix The alignment matrix to obtain the trace back from.
      * \param[in] callback The callback to invoke with the generated result.
+     * \param[in] lane The lane of the sequence pair if the alignment matrix was computed in vectorised mode.
      *
      * \details
      *
      * Generates a seqan3::alignment_result object with the results computed during the alignment. Depending on the
      * \ref seqan3_align_cfg_output_configurations "seqan3::align_cfg::output_*" configuration only the requested values
      * are stored. In some cases some additional work is done to generate the requested result. For example computing
-     * the associated alignment from the traceback matrix.
+     * the associated alignment from the traceback matrix. In the vectorised alignment the trace of the given lane is
+     * followed.
      */
     template <typename sequence_pair_t,
               typename index_t,
@@ -102,7 +104,8 @@ protected:
                                 [[maybe_unused]] score_t score,
                                 [[maybe_unused]] matrix_coordinate_t end_positions,
                                 [[maybe_unused]] alignment_matrix_t const & alignment_matrix,
-                                callback_t && callback)
+                                callback_t && callback,
+                                [[maybe_unused]] size_t const lane = 0)
     {
         using std::get;
         using invalid_t = std::nullopt_t *;
@@ -133,14 +136,29 @@ protected:
 
         if constexpr (traits_type::requires_trace_information)
         {
+            auto trace_path = [&] ()
+            {
+                if constexpr (traits_type::is_vectorised)
+                    return alignment_matrix.trace_path(end_positions, lane);
+                else
+                    return alignment_matrix.trace_path(end_positions);
+            };
+
             aligned_sequence_builder builder{get<0>(sequence_pair), get<1>(sequence_pair)};
-            auto aligned_sequence_result = builder(alignment_matrix.trace_path(end_positions));
+            auto aligned_sequence_result = builder(trace_path());
 
             if constexpr (traits_type::compute_begin_positions)
             {
                 result.data.begin_positions.first = aligned_sequence_result.first_sequence_slice_positions.first;
                 result.data.begin_positions.second = aligned_sequence_result.second_sequence_slice_positions.first;
             }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+            {
+                static_assert(!std::same_as<decltype(result.data.alignment), invalid_t>,
+                              "Invalid configuration. Expected result with alignment!");
+                result.data.alignment = std::move(aligned_sequence_result.alignment);
+            }
         }
 
         callback(std::move(result));
@@ -0,0 +1,179 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::policy_optimum_tracker_simd_adaptive.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_optimum_tracker_simd.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the largest absolute score difference between a cell of the alignment matrix and its predecessors.
+ * \ingroup alignment_pairwise
+ * \tparam alignment_configuration_t The type of the alignment configuration; must be a type specialisation of
+ *                                   seqan3::configuration.
+ * \param[in] config The alignment configuration with the scoring scheme and the gap costs.
+ *
+ * \details
+ *
+ * The difference is bounded by the largest absolute score of the scoring scheme, the gap open score including the
+ * gap extension score and the score of the padding symbols used in the vectorised alignment, which is at most 1 for
+ * scoring schemes that are not based on a match and a mismatch score.
+ */
+template <typename alignment_configuration_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+int64_t max_score_step(alignment_configuration_t const & config)
+{
+    using traits_t = alignment_configuration_traits<alignment_configuration_t>;
+    using alphabet_t = typename traits_t::scoring_scheme_alphabet_type;
+
+    auto const & scoring_scheme = get<align_cfg::scoring_scheme>(config).scheme;
+    auto const & gap_scheme = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                       align_cfg::extension_score{-1}});
+
+    int64_t step = std::max<int64_t>(1, std::abs(int64_t{gap_scheme.open_score} + gap_scheme.extension_score));
+    step = std::max<int64_t>(step, std::abs(int64_t{gap_scheme.extension_score}));
+
+    for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+    {
+        for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+        {
+            int64_t const score = scoring_scheme.score(assign_rank_to(rank1, alphabet_t{}),
+                                                       assign_rank_to(rank2, alphabet_t{}));
+            step = std::max<int64_t>(step, std::abs(score));
+        }
+    }
+
+    return step;
+}
+
+/*!\brief Implements the tracker of the vectorised global alignment, which additionally detects lanes whose scores
+ *        might have exceeded the range of the score type.
+ * \ingroup alignment_pairwise
+ * \copydetails seqan3::detail::policy_optimum_tracker
+ *
+ * \details
+ *
+ * The vectorised alignment with small score types, e.g. 8 bit lanes, computes with wrapping integer arithmetic.
+ * To detect an overflow, every lane tracks the smallest and the largest score of all cells of its alignment matrix.
+ * Every cell differs from its predecessors by at most the value returned by seqan3::detail::max_score_step.
+ * Hence, as long as all scores of a lane stay within the range of the score type shrunk by this value on both ends,
+ * no intermediate value can overflow and all scores of the lane are exact. If a lane leaves this range, the
+ * alignment of the lane must be computed again with a wider score type, which is done by
+ * seqan3::detail::pairwise_alignment_algorithm_adaptive.
+ */
+template <typename alignment_configuration_t, std::semiregular optimum_updater_t>
+class policy_optimum_tracker_simd_adaptive :
+    protected policy_optimum_tracker_simd<alignment_configuration_t, optimum_updater_t>
+{
+protected:
+    //!\brief The type of the base class.
+    using base_policy_t = policy_optimum_tracker_simd<alignment_configuration_t, optimum_updater_t>;
+
+    // Import the configured types.
+    using typename base_policy_t::score_type;
+    using typename base_policy_t::scalar_type;
+    using typename base_policy_t::matrix_coordinate_type;
+
+    //!\brief The smallest score of any cell per lane.
+    score_type lowest_score{};
+    //!\brief The largest score of any cell per lane.
+    score_type highest_score{};
+    //!\brief The smallest score per lane that guarantees that no value overflowed.
+    score_type lower_score_limit{};
+    //!\brief The largest score per lane that guarantees that no value overflowed.
+    score_type upper_score_limit{};
+    //!\brief The length of the longest sequence whose first row or column stays within the safe score range.
+    size_t max_sequence_size{};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    policy_optimum_tracker_simd_adaptive() = default; //!< Defaulted.
+    policy_optimum_tracker_simd_adaptive(policy_optimum_tracker_simd_adaptive const &) = default; //!< Defaulted.
+    policy_optimum_tracker_simd_adaptive(policy_optimum_tracker_simd_adaptive &&) = default; //!< Defaulted.
+    policy_optimum_tracker_simd_adaptive & operator=(policy_optimum_tracker_simd_adaptive const &) = default;
+                                                                                                   //!< Defaulted.
+    policy_optimum_tracker_simd_adaptive & operator=(policy_optimum_tracker_simd_adaptive &&) = default;
+                                                                                                   //!< Defaulted.
+    ~policy_optimum_tracker_simd_adaptive() = default; //!< Defaulted.
+
+    /*!\brief Construction and initialisation using the alignment configuration.
+     * \param[in] config The alignment configuration used to determine the safe score range.
+     */
+    policy_optimum_tracker_simd_adaptive(alignment_configuration_t const & config) : base_policy_t{config}
+    {
+        int64_t const lowest = std::numeric_limits<scalar_type>::lowest();
+        int64_t const highest = std::numeric_limits<scalar_type>::max();
+        int64_t const step = max_score_step(config);
+
+        // If the step does not leave any valid score, every lane is reported.
+        lower_score_limit = simd::fill<score_type>(static_cast<scalar_type>(std::min(lowest + step, highest)));
+        upper_score_limit = simd::fill<score_type>(static_cast<scalar_type>(std::max(highest - step, lowest)));
+
+        // The gaps in the first row and column of longer sequences would leave the safe range in any case.
+        auto const & gap_scheme = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                           align_cfg::extension_score{-1}});
+        int64_t const open_score = gap_scheme.open_score;
+        int64_t const extension_score = gap_scheme.extension_score;
+        int64_t const gap_range = -(lowest + step) - std::abs(open_score);
+
+        if (gap_range < 0)
+            max_sequence_size = 0;
+        else if (extension_score == 0)
+            max_sequence_size = highest;
+        else
+            max_sequence_size = std::min<int64_t>(highest, gap_range / std::abs(extension_score));
+    }
+    //!\}
+
+    //!\copydoc seqan3::detail::policy_optimum_tracker::reset_optimum
+    void reset_optimum()
+    {
+        base_policy_t::reset_optimum();
+        lowest_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::max());
+        highest_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::lowest());
+    }
+
+    /*!\brief Tracks the range of the scores and forwards the cell to the base policy.
+     * \copydetails seqan3::detail::policy_optimum_tracker::track_cell
+     */
+    template <typename cell_t>
+    decltype(auto) track_cell(cell_t && cell, matrix_coordinate_type coordinate) noexcept
+    {
+        score_type const score = cell.best_score();
+        lowest_score = (score < lowest_score) ? score : lowest_score;
+        highest_score = (highest_score < score) ? score : highest_score;
+
+        return base_policy_t::track_cell(std::forward<cell_t>(cell), std::move(coordinate));
+    }
+
+    /*!\brief Returns whether the scores of the given lane left the safe range since the last reset.
+     * \param[in] lane The lane to check.
+     */
+    bool lane_exceeds_score_range(size_t const lane) const noexcept
+    {
+        return lowest_score[lane] < lower_score_limit[lane] || highest_score[lane] > upper_score_limit[lane];
+    }
+};
+} // namespace seqan3::detail
@@ -18,6 +18,8 @@
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_length_aware_batching.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_space_traceback.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
@@ -25,6 +27,7 @@
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -132,6 +135,20 @@ public:
     static constexpr bool is_debug = configuration_t::template exists<detail::debug_mode>();
     //!\brief Flag indicating whether a user provided callback was given.
     static constexpr bool is_one_way_execution = configuration_t::template exists<align_cfg::on_result>();
+    //!\brief Flag indicating whether the vectorised alignment selects the score type per sequence pair.
+    static constexpr bool is_adaptive_score_type = configuration_t::template exists<align_cfg::adaptive_score_type>();
+    //!\brief Flag indicating whether the vectorised alignment sorts the sequence pairs by their lengths.
+    static constexpr bool is_length_aware_batching =
+        configuration_t::template exists<align_cfg::length_aware_batching>();
+    //!\brief Flag indicating whether the alignment is computed with memory linear in the sequence lengths.
+    static constexpr bool is_linear_space_traceback =
+        configuration_t::template exists<align_cfg::linear_space_traceback>();
+    //!\brief Flag indicating whether the single sequence pairs are computed with the striped vectorisation.
+    static constexpr bool is_striped_vectorised = configuration_t::template exists<align_cfg::striped_vectorised>();
+    //!\brief Flag indicating whether the alignment is computed with the wavefront algorithm.
+    static constexpr bool is_wavefront = configuration_t::template exists<align_cfg::wavefront>();
+    //!\brief Flag indicating whether the alignment extends a seed with the seqan3::align_cfg::method_extension.
+    static constexpr bool is_extension = configuration_t::template exists<align_cfg::method_extension>();
     //!\brief The selected scoring scheme.
     using scoring_scheme_type = decltype(get<align_cfg::scoring_scheme>(std::declval<configuration_t>()).scheme);
     //!\brief The alphabet of the selected scoring scheme.
@@ -157,7 +174,10 @@ public:
     //!\brief The number of alignments that can be computed in one simd vector.
     static constexpr size_t alignments_per_vector = [] () constexpr
                                                     {
-                                                        if constexpr (is_vectorised)
+                                                        // The adaptive score type starts with 8 bit lanes.
+                                                        if constexpr (is_vectorised && is_adaptive_score_type)
+                                                            return simd_traits<simd_type_t<int8_t>>::length;
+                                                        else if constexpr (is_vectorised)
                                                             return simd_traits<score_type>::length;
                                                         else
                                                             return 1;
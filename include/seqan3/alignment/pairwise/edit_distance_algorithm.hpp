@@ -16,7 +16,9 @@
 
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
 
 namespace seqan3::detail
 {
@@ -34,6 +36,14 @@ namespace seqan3::detail
  * if an edit distance should be computed. On invocation it delegates the call to the actual implementation
  * of the edit distance algorithm, while the interface is unified with the execution model of the pairwise alignment
  * algorithms.
+ *
+ * If seqan3::align_cfg::vectorised is configured and neither a minimal score nor the begin positions or the alignment
+ * are requested, the sequence pairs of one chunk are computed simultaneously by
+ * seqan3::detail::edit_distance_unbanded_simd. Pairs whose second sequence does not fit into one machine word are
+ * computed by seqan3::detail::edit_distance_unbanded. The results are reported in the order of the chunk.
+ *
+ * If seqan3::align_cfg::band_fixed_size is configured, every sequence pair is computed by
+ * seqan3::detail::edit_distance_banded.
  */
 template <typename config_t, typename traits_t>
 class edit_distance_algorithm
@@ -44,8 +54,33 @@ private:
     //!\brief The configured alignment result type.
     using alignment_result_type = typename configuration_traits_type::alignment_result_type;
 
+    //!\brief The banded algorithm if seqan3::align_cfg::band_fixed_size is configured.
+    using banded_algorithm_type = std::conditional_t<configuration_traits_type::is_banded,
+                                                     edit_distance_banded<config_t,
+                                                                          traits_t::is_semi_global_type::value>,
+                                                     empty_type>;
+
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+    /*!\brief Whether the sequence pairs of the given range are computed by
+     *        seqan3::detail::edit_distance_unbanded_simd.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs.
+     */
+    template <typename indexed_sequence_pairs_t>
+    static constexpr bool use_simd = []() constexpr
+    {
+        using sequence_pair_t = std::tuple_element_t<0, std::ranges::range_value_t<indexed_sequence_pairs_t>>;
+        using query_alphabet_t = std::ranges::range_value_t<std::tuple_element_t<1, sequence_pair_t>>;
+
+        if constexpr (semialphabet<query_alphabet_t>)
+            return configuration_traits_type::is_vectorised &&
+                   !configuration_traits_type::is_banded &&
+                   !configuration_traits_type::requires_trace_information &&
+                   !config_t::template exists<align_cfg::min_score>();
+        else
+            return false;
+    }();
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -67,9 +102,15 @@ public:
      * incompatible configurations between the passed configuration and the one used during configuration of this
      * class. Further, the function object will be stored in a std::function which requires copyable objects and
      * in parallel executions the function object must be copied as well.
+     *
+     * \throws seqan3::invalid_alignment_configuration if a band is configured that starts in a region without free
+     *         gaps.
      */
     constexpr edit_distance_algorithm(config_t const & cfg) : cfg_ptr{new config_t(cfg)}
-    {}
+    {
+        if constexpr (configuration_traits_type::is_banded)
+            banded_algorithm = banded_algorithm_type{cfg};
+    }
     //!}
 
     /*!\brief Invokes the alignment computation for every indexed sequence pair contained in the given range.
@@ -95,13 +136,105 @@ public:
     {
         using std::get;
 
-        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
-            compute_single_pair(index,
-                                get<0>(sequence_pair),
-                                get<1>(sequence_pair),
-                                std::forward<callback_t>(callback));
+        if constexpr (configuration_traits_type::is_banded)
+        {
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+                banded_algorithm(index, get<0>(sequence_pair), get<1>(sequence_pair), callback);
+        }
+        else if constexpr (use_simd<indexed_sequence_pairs_t>)
+        {
+            compute_simd(indexed_sequence_pairs, callback);
+        }
+        else
+        {
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+                compute_single_pair(index,
+                                    get<0>(sequence_pair),
+                                    get<1>(sequence_pair),
+                                    std::forward<callback_t>(callback));
+        }
     }
 private:
+    /*!\brief Computes the alignments of the given range with one sequence pair per simd lane.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs.
+     * \tparam callback_t The type of the callback function that is called with the alignment result.
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     *
+     * \details
+     *
+     * The range is processed in groups that contain at most
+     * seqan3::detail::edit_distance_unbanded_simd::lanes pairs whose second sequence fits into a lane. All other pairs
+     * of a group are computed by compute_single_pair() when the results of the group are reported.
+     */
+    template <typename indexed_sequence_pairs_t, typename callback_t>
+    void compute_simd(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t & callback)
+    {
+        using std::get;
+        using sequence_pair_t = std::tuple_element_t<0, std::ranges::range_value_t<indexed_sequence_pairs_t>>;
+        using query_alphabet_t = std::ranges::range_value_t<std::tuple_element_t<1, sequence_pair_t>>;
+        using simd_algorithm_t = edit_distance_unbanded_simd<query_alphabet_t, traits_t::is_semi_global_type::value>;
+        using result_value_t = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+        using score_t = typename configuration_traits_type::original_score_type;
+
+        // Keeps the buffers of the algorithm across the chunks processed by the same thread.
+        thread_local simd_algorithm_t algorithm{};
+
+        auto fits = [] (auto && indexed_sequence_pair)
+        {
+            return simd_algorithm_t::fits(std::ranges::size(get<1>(get<0>(indexed_sequence_pair))));
+        };
+
+        auto group_end = std::ranges::begin(indexed_sequence_pairs);
+        auto const end = std::ranges::end(indexed_sequence_pairs);
+        while (group_end != end)
+        {
+            auto group_begin = group_end;
+            algorithm.clear();
+
+            for (size_t lane = 0u; lane < simd_algorithm_t::lanes && group_end != end; ++group_end)
+            {
+                if (auto && indexed_sequence_pair = *group_end; fits(indexed_sequence_pair))
+                {
+                    auto && sequence_pair = get<0>(indexed_sequence_pair);
+                    algorithm.set_lane(get<0>(sequence_pair), get<1>(sequence_pair));
+                    ++lane;
+                }
+            }
+
+            algorithm.compute();
+
+            size_t lane = 0u;
+            for (; group_begin != group_end; ++group_begin)
+            {
+                auto && [sequence_pair, index] = *group_begin;
+
+                if (!fits(*group_begin))
+                {
+                    compute_single_pair(index, get<0>(sequence_pair), get<1>(sequence_pair), callback);
+                    continue;
+                }
+
+                result_value_t result{};
+
+                if constexpr (configuration_traits_type::output_sequence1_id)
+                    result.sequence1_id = index;
+
+                if constexpr (configuration_traits_type::output_sequence2_id)
+                    result.sequence2_id = index;
+
+                if constexpr (configuration_traits_type::compute_score)
+                    result.score = static_cast<score_t>(algorithm.score(lane));
+
+                if constexpr (configuration_traits_type::compute_end_positions)
+                    result.end_positions = {column_index_type{algorithm.end_position_first(lane)},
+                                            row_index_type{std::ranges::size(get<1>(sequence_pair))}};
+
+                ++lane;
+                callback(alignment_result_type{std::move(result)});
+            }
+        }
+    }
 
     /*!\brief Invokes the actual alignment computation for a single pair of sequences.
      * \tparam    first_range_t  The type of the first sequence (or packed sequences); must model
@@ -130,6 +263,8 @@ private:
 
     //!\brief The alignment configuration stored on the heap.
     std::shared_ptr<std::remove_cvref_t<config_t>> cfg_ptr{};
+    //!\brief The banded algorithm, which only stores the band and the maximal number of errors.
+    [[no_unique_address]] banded_algorithm_type banded_algorithm{};
 };
 
 } // namespace seqan3::detail
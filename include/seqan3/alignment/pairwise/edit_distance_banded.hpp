@@ -0,0 +1,619 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_banded.
+ */
+
+#pragma once
+
+#include <seqan3/std/bit>
+#include <cassert>
+#include <limits>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the edit distance within a fixed band of the alignment matrix.
+ * \ingroup alignment_pairwise
+ * \tparam config_t       The alignment configuration type.
+ * \tparam is_semi_global Whether leading and trailing gaps in the first sequence are free.
+ *
+ * \details
+ *
+ * This is the banded variant of Myers' bit-vector algorithm implemented by seqan3::detail::edit_distance_unbanded.
+ * Following Hyyrö, only the cells between the lower and the upper diagonal of seqan3::align_cfg::band_fixed_size are
+ * represented. The bit-vectors cover the rows of the band within the current column and are shifted by one row
+ * whenever the band moves down, so that a column is computed in \f$\lceil band / w \rceil\f$ steps for a machine word
+ * of \f$w\f$ bits. The runtime is \f$O(n \cdot \lceil band / w \rceil)\f$ instead of \f$O(n \cdot \lceil m / w \rceil)\f$
+ * for a first sequence of size \f$n\f$ and a second sequence of size \f$m\f$.
+ *
+ * Cells outside of the band are unreachable, i.e. the alignment never leaves the band. Within the band the
+ * neighbouring cells still differ by at most one, which is why the cells above and below the band can be replaced
+ * by values that never win the minimum: the horizontal delta above the band and the vertical delta of a row entering
+ * the band from below are both set to +1.
+ *
+ * If the begin positions or the alignment are requested, the vertical deltas of all columns are stored and the
+ * trace is recomputed from them. This needs \f$O(n \cdot \lceil band / w \rceil)\f$ words of memory.
+ * The buffers are thread local and are reused for all sequence pairs computed by the same thread.
+ */
+template <typename config_t, bool is_semi_global>
+class edit_distance_banded
+{
+private:
+    //!\brief The configuration traits.
+    using traits_type = alignment_configuration_traits<config_t>;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The score type of the result.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The type of one block of the bit-vectors.
+    using word_type = uint64_t;
+
+    //!\brief The number of bits of #word_type.
+    static constexpr size_t word_size = bits_of<word_type>;
+    //!\brief Whether the vertical deltas of all columns need to be stored.
+    static constexpr bool compute_trace = traits_type::compute_begin_positions ||
+                                          traits_type::compute_sequence_alignment;
+
+    //!\brief The thread local buffers of the algorithm.
+    struct buffer_type
+    {
+        //!\brief The match bit-vectors of the second sequence, one per rank.
+        std::vector<word_type> pattern{};
+        //!\brief The positive vertical deltas of the current column.
+        std::vector<word_type> vp{};
+        //!\brief The negative vertical deltas of the current column.
+        std::vector<word_type> vn{};
+        //!\brief The match bit-vector of the rows of the current column.
+        std::vector<word_type> eq{};
+        //!\brief The positive vertical deltas of all columns.
+        std::vector<word_type> trace_vp{};
+        //!\brief The negative vertical deltas of all columns.
+        std::vector<word_type> trace_vn{};
+        //!\brief The first row of the band in all columns.
+        std::vector<size_t> trace_top{};
+        //!\brief The score of the row above the first row of the band in all columns.
+        std::vector<int64_t> trace_base{};
+        //!\brief The number of words stored per column.
+        size_t words{};
+        //!\brief The first computed column.
+        size_t first_column{};
+    };
+
+    //!\brief The result of the forward computation.
+    struct distance_type
+    {
+        //!\brief The edit distance.
+        int64_t distance{};
+        //!\brief The column of the last row in which the alignment ends.
+        size_t end_column{};
+    };
+
+    struct trace_path_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_banded() = default;                                         //!< Defaulted.
+    edit_distance_banded(edit_distance_banded const &) = default;             //!< Defaulted.
+    edit_distance_banded(edit_distance_banded &&) = default;                  //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded const &) = default; //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded &&) = default;      //!< Defaulted.
+    ~edit_distance_banded() = default;                                        //!< Defaulted.
+
+    /*!\brief Initialises the band and the maximal number of errors from the given configuration.
+     * \param[in] config The alignment configuration; must contain seqan3::align_cfg::band_fixed_size.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band starts in a region without free gaps.
+     */
+    explicit edit_distance_banded(config_t const & config)
+    {
+        using seqan3::get;
+
+        auto const band = config.get_or(align_cfg::band_fixed_size{});
+        lower_diagonal = band.lower_diagonal;
+        upper_diagonal = band.upper_diagonal;
+
+        if constexpr (config_t::template exists<align_cfg::min_score>())
+            max_errors = -static_cast<int64_t>(get<align_cfg::min_score>(config).score);
+
+        bool invalid_band = upper_diagonal < lower_diagonal;
+        std::string error_cause = (invalid_band) ? " The upper diagonal is smaller than the lower diagonal." : "";
+
+        // The leading gaps of the second sequence are never free in the edit distance.
+        invalid_band |= upper_diagonal < 0 || (lower_diagonal > 0 && !is_semi_global);
+        error_cause += " The band starts in a region without free gaps.";
+
+        if (invalid_band)
+            throw invalid_alignment_configuration{"The selected band [" + std::to_string(lower_diagonal) + ":" +
+                                                  std::to_string(upper_diagonal) + "] cannot be used with the current "
+                                                  "alignment configuration:" + error_cause};
+    }
+    //!\}
+
+    /*!\brief Computes the banded edit distance of the given sequence pair and invokes the callback with the result.
+     * \tparam database_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam query_t    The type of the second sequence; must model std::ranges::forward_range and its value type
+     *                    must model seqan3::semialphabet.
+     * \tparam callback_t The type of the callback.
+     * \param[in] idx      The index of the sequence pair.
+     * \param[in] database The first sequence.
+     * \param[in] query    The second sequence.
+     * \param[in] callback The callback to invoke with the seqan3::alignment_result.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band ends in a region without free gaps.
+     */
+    template <std::ranges::forward_range database_t, std::ranges::forward_range query_t, typename callback_t>
+    void operator()([[maybe_unused]] size_t const idx,
+                    database_t && database,
+                    query_t && query,
+                    callback_t && callback) const
+    {
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        static thread_local buffer_type buffer{};
+
+        size_t const database_size = std::ranges::distance(database);
+        size_t const query_size = std::ranges::distance(query);
+        distance_type const result = compute(buffer, database, query, database_size, query_size);
+        bool const is_valid = result.distance <= max_errors;
+
+        result_value_type res_vt{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            res_vt.sequence1_id = idx;
+
+        if constexpr (traits_type::output_sequence2_id)
+            res_vt.sequence2_id = idx;
+
+        if constexpr (traits_type::compute_score)
+            res_vt.score = is_valid ? static_cast<score_type>(-result.distance) : matrix_inf<score_type>;
+
+        // Invalid alignments are reported at the end of both sequences like in seqan3::detail::edit_distance_unbanded.
+        advanceable_alignment_coordinate<> end_positions{column_index_type{database_size},
+                                                         row_index_type{query_size}};
+        advanceable_alignment_coordinate<> begin_positions = end_positions;
+
+        if (is_valid)
+            end_positions.first = result.end_column;
+
+        if constexpr (compute_trace)
+        {
+            if (is_valid)
+            {
+                std::vector<trace_directions> path = trace(buffer, database, query, result.end_column, query_size);
+                matrix_coordinate const trace_end{row_index_type{query_size}, column_index_type{result.end_column}};
+                std::ranges::subrange trace_path{trace_path_iterator{&path, trace_end}, std::default_sentinel};
+
+                aligned_sequence_builder builder{database, query};
+                auto trace_res = builder(trace_path);
+                begin_positions.first = trace_res.first_sequence_slice_positions.first;
+                begin_positions.second = trace_res.second_sequence_slice_positions.first;
+
+                if constexpr (traits_type::compute_sequence_alignment)
+                    res_vt.alignment = std::move(trace_res.alignment);
+            }
+        }
+
+        if constexpr (traits_type::compute_end_positions)
+            res_vt.end_positions = end_positions;
+
+        if constexpr (traits_type::compute_begin_positions)
+            res_vt.begin_positions = begin_positions;
+
+        callback(alignment_result_type{std::move(res_vt)});
+    }
+
+private:
+    /*!\brief Checks whether the band is valid for the given sequence sizes.
+     * \param[in] database_size The size of the first sequence.
+     * \param[in] query_size    The size of the second sequence.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band ends in a region without free gaps.
+     */
+    void check_valid_band_configuration(size_t const database_size, size_t const query_size) const
+    {
+        int64_t const diagonal = static_cast<int64_t>(database_size) - static_cast<int64_t>(query_size);
+
+        // The band must contain the last cell or, if the trailing gaps of the first sequence are free, a cell of the
+        // last row.
+        if (diagonal < lower_diagonal || (diagonal > upper_diagonal && !is_semi_global))
+            throw invalid_alignment_configuration{"The selected band [" + std::to_string(lower_diagonal) + ":" +
+                                                  std::to_string(upper_diagonal) + "] cannot be used with the current "
+                                                  "alignment configuration: The band ends in a region without free "
+                                                  "gaps."};
+    }
+
+    //!\brief Returns the first row of the band without the first row of the matrix in the given column.
+    size_t band_begin(size_t const column) const noexcept
+    {
+        return std::max<int64_t>(1, static_cast<int64_t>(column) - upper_diagonal);
+    }
+
+    //!\brief Returns the last row of the band in the given column.
+    size_t band_end(size_t const column, size_t const query_size) const noexcept
+    {
+        return std::min<int64_t>(query_size, static_cast<int64_t>(column) - lower_diagonal);
+    }
+
+    //!\brief Returns whether the given cell is inside of the band.
+    bool in_band(size_t const row, size_t const column) const noexcept
+    {
+        int64_t const diagonal = static_cast<int64_t>(column) - static_cast<int64_t>(row);
+        return diagonal >= lower_diagonal && diagonal <= upper_diagonal;
+    }
+
+    //!\brief Returns the difference between the number of bits set in `vp` and `vn` within the first `count` bits.
+    static int64_t sum_of_deltas(word_type const * vp, word_type const * vn, size_t const count) noexcept
+    {
+        int64_t sum{};
+        size_t const full_words = count / word_size;
+        for (size_t k = 0; k < full_words; ++k)
+            sum += std::popcount(vp[k]) - std::popcount(vn[k]);
+
+        if (size_t const rest = count % word_size; rest != 0u)
+        {
+            word_type const mask = (word_type{1u} << rest) - 1u;
+            sum += std::popcount(vp[full_words] & mask) - std::popcount(vn[full_words] & mask);
+        }
+
+        return sum;
+    }
+
+    /*!\brief Computes the banded edit distance.
+     * \param[in,out] buffer     The buffers of the algorithm.
+     * \param[in] database       The first sequence.
+     * \param[in] query          The second sequence.
+     * \param[in] database_size  The size of the first sequence.
+     * \param[in] query_size     The size of the second sequence.
+     * \returns The edit distance and the end column in the last row.
+     */
+    template <typename database_t, typename query_t>
+    distance_type compute(buffer_type & buffer,
+                          database_t && database,
+                          query_t && query,
+                          size_t const database_size,
+                          size_t const query_size) const
+    {
+        using alphabet_t = std::ranges::range_value_t<query_t>;
+        static_assert(semialphabet<alphabet_t>, "The value type of the second sequence must model "
+                                                "seqan3::semialphabet.");
+
+        check_valid_band_configuration(database_size, query_size);
+
+        // The rows of the band in one column without the first row of the matrix.
+        size_t const band_size = std::min<uint64_t>(static_cast<uint64_t>(upper_diagonal - lower_diagonal) + 1u,
+                                                     std::max<size_t>(query_size, 1u));
+        size_t const words = (band_size + word_size - 1u) / word_size;
+        size_t const query_words = (query_size + word_size - 1u) / word_size;
+        // The pattern is padded, such that a window of `words` words can be read at every row.
+        size_t const pattern_words = query_words + words + 1u;
+
+        buffer.pattern.assign(alphabet_size<alphabet_t> * pattern_words, 0u);
+        size_t row = 0u;
+        for (auto && letter : query)
+        {
+            buffer.pattern[seqan3::to_rank(letter) * pattern_words + row / word_size] |=
+                word_type{1u} << (row % word_size);
+            ++row;
+        }
+
+        buffer.vp.assign(words + 1u, ~word_type{0u});
+        buffer.vn.assign(words + 1u, 0u);
+        buffer.eq.assign(words, 0u);
+
+        // Columns left of the band contain no cells and columns right of the band do not reach the last row.
+        size_t const first_column = std::max<int64_t>(lower_diagonal, 0);
+        size_t const last_column = std::min<int64_t>(database_size,
+                                                     static_cast<int64_t>(query_size) + upper_diagonal);
+
+        size_t top = 1u;
+        size_t bottom = band_end(first_column, query_size);
+        // The score of the row above `top`; the scores of the first column are 0, 1, 2, ...
+        int64_t base{};
+
+        distance_type result{std::numeric_limits<int64_t>::max(), first_column};
+
+        auto store_column = [&] ()
+        {
+            if constexpr (compute_trace)
+            {
+                buffer.trace_vp.insert(buffer.trace_vp.end(), buffer.vp.begin(), buffer.vp.begin() + words);
+                buffer.trace_vn.insert(buffer.trace_vn.end(), buffer.vn.begin(), buffer.vn.begin() + words);
+                buffer.trace_top.push_back(top);
+                buffer.trace_base.push_back(base);
+            }
+        };
+
+        auto update_result = [&] (size_t const column)
+        {
+            if (bottom != query_size || (!is_semi_global && column != database_size))
+                return;
+
+            int64_t const score = base + sum_of_deltas(buffer.vp.data(), buffer.vn.data(), bottom + 1u - top);
+            if (score <= result.distance)
+                result = distance_type{score, column};
+        };
+
+        if constexpr (compute_trace)
+        {
+            buffer.trace_vp.clear();
+            buffer.trace_vn.clear();
+            buffer.trace_top.clear();
+            buffer.trace_base.clear();
+            buffer.words = words;
+            buffer.first_column = first_column;
+        }
+
+        store_column();
+        update_result(first_column);
+
+        auto database_it = std::ranges::next(std::ranges::begin(database), first_column);
+        for (size_t column = first_column + 1u; column <= last_column; ++column, ++database_it)
+        {
+            size_t const new_top = band_begin(column);
+            size_t const new_bottom = band_end(column, query_size);
+
+            // The horizontal delta of the row above the band. Outside of the band it is +1, such that the cell above
+            // never provides the minimum.
+            word_type carry_hp = 1u;
+            if (new_top != top)
+            {
+                // The band moves down: the score of the old first row plus the horizontal delta of +1.
+                base += 1 + static_cast<int64_t>(buffer.vp[0] & 1u) - static_cast<int64_t>(buffer.vn[0] & 1u);
+
+                for (size_t k = 0; k < words; ++k)
+                {
+                    buffer.vp[k] = (buffer.vp[k] >> 1u) | (buffer.vp[k + 1u] << (word_size - 1u));
+                    buffer.vn[k] = (buffer.vn[k] >> 1u) | (buffer.vn[k + 1u] << (word_size - 1u));
+                }
+            }
+            else
+            {
+                // The first row of the matrix is part of the band until the upper diagonal leaves it.
+                if (static_cast<int64_t>(column) <= upper_diagonal)
+                    carry_hp = is_semi_global ? 0u : 1u;
+
+                base += carry_hp;
+            }
+
+            // A row that enters the band from below has a vertical delta of +1 in the previous column.
+            if (new_bottom != bottom)
+            {
+                size_t const bit = new_bottom - new_top;
+                buffer.vp[bit / word_size] |= word_type{1u} << (bit % word_size);
+                buffer.vn[bit / word_size] &= ~(word_type{1u} << (bit % word_size));
+            }
+
+            top = new_top;
+            bottom = new_bottom;
+
+            // The match bit-vector of the rows of the band.
+            size_t const offset = top - 1u;
+            size_t const shift = offset % word_size;
+            word_type const * pattern = buffer.pattern.data() +
+                                        seqan3::to_rank(static_cast<alphabet_t>(*database_it)) * pattern_words +
+                                        offset / word_size;
+            size_t const active_words = (bottom + word_size - top) / word_size;
+            for (size_t k = 0; k < active_words; ++k)
+                buffer.eq[k] = (shift == 0u) ? pattern[k]
+                                             : (pattern[k] >> shift) | (pattern[k + 1u] << (word_size - shift));
+
+            word_type carry_d0 = 0u;
+            word_type carry_hn = 0u;
+            for (size_t k = 0; k < active_words; ++k)
+            {
+                word_type & vp = buffer.vp[k];
+                word_type & vn = buffer.vn[k];
+
+                word_type x = buffer.eq[k] | vn;
+                word_type const t = vp + (x & vp) + carry_d0;
+                carry_d0 = (carry_d0 != 0u) ? t <= vp : t < vp;
+
+                word_type const d0 = (t ^ vp) | x;
+                word_type const hn = vp & d0;
+                word_type const hp = vn | ~(vp | d0);
+
+                x = (hp << 1u) | carry_hp;
+                carry_hp = hp >> (word_size - 1u);
+
+                vn = x & d0;
+                vp = (hn << 1u) | carry_hn | ~(x | d0);
+                carry_hn = hn >> (word_size - 1u);
+            }
+
+            store_column();
+            update_result(column);
+        }
+
+        return result;
+    }
+
+    /*!\brief Recomputes the trace from the stored vertical deltas.
+     * \param[in] buffer     The buffers filled by compute().
+     * \param[in] database   The first sequence.
+     * \param[in] query      The second sequence.
+     * \param[in] end_column The column in which the trace starts.
+     * \param[in] query_size The size of the second sequence.
+     * \returns The trace directions from the end of the alignment to its begin.
+     *
+     * \details
+     *
+     * Like seqan3::detail::edit_distance_trace_matrix_full, a horizontal gap is preferred over a vertical gap and a
+     * vertical gap over a (mis)match.
+     */
+    template <typename database_t, typename query_t>
+    std::vector<trace_directions> trace(buffer_type const & buffer,
+                                        database_t && database,
+                                        query_t && query,
+                                        size_t const end_column,
+                                        size_t const query_size) const
+    {
+        using alphabet_t = std::ranges::range_value_t<query_t>;
+
+        auto score_at = [&] (size_t const row, size_t const column) -> int64_t
+        {
+            assert(column >= buffer.first_column);
+
+            if (row == 0u)
+                return is_semi_global ? 0 : static_cast<int64_t>(column);
+
+            size_t const index = column - buffer.first_column;
+            size_t const top = buffer.trace_top[index];
+            assert(row >= top);
+            return buffer.trace_base[index] + sum_of_deltas(buffer.trace_vp.data() + index * buffer.words,
+                                                            buffer.trace_vn.data() + index * buffer.words,
+                                                            row + 1u - top);
+        };
+
+        // The sequences are only forward ranges, so the letters of the trace are gathered in advance.
+        std::vector<size_t> database_ranks{};
+        database_ranks.reserve(end_column);
+        for (auto && letter : database | std::views::take(end_column))
+            database_ranks.push_back(seqan3::to_rank(static_cast<alphabet_t>(letter)));
+
+        std::vector<size_t> query_ranks{};
+        query_ranks.reserve(query_size);
+        for (auto && letter : query)
+            query_ranks.push_back(seqan3::to_rank(letter));
+
+        std::vector<trace_directions> path{};
+        size_t row = query_size;
+        size_t column = end_column;
+        int64_t score = score_at(row, column);
+
+        while (row > 0u || (!is_semi_global && column > 0u))
+        {
+            if (row == 0u)
+            {
+                path.push_back(trace_directions::left);
+                --column;
+                continue;
+            }
+
+            if (column > buffer.first_column && in_band(row, column - 1u) && score_at(row, column - 1u) + 1 == score)
+            {
+                path.push_back(trace_directions::left);
+                --column;
+                score -= 1;
+            }
+            else if (in_band(row - 1u, column) && score_at(row - 1u, column) + 1 == score)
+            {
+                path.push_back(trace_directions::up);
+                --row;
+                score -= 1;
+            }
+            else
+            {
+                assert(column > 0u && in_band(row - 1u, column - 1u));
+                score -= database_ranks[column - 1u] != query_ranks[row - 1u];
+                path.push_back(trace_directions::diagonal);
+                --row;
+                --column;
+                assert(score == score_at(row, column));
+            }
+        }
+
+        return path;
+    }
+
+    //!\brief The lower diagonal of the band.
+    int64_t lower_diagonal{std::numeric_limits<int32_t>::lowest()};
+    //!\brief The upper diagonal of the band.
+    int64_t upper_diagonal{std::numeric_limits<int32_t>::max()};
+    //!\brief The maximal number of errors given by seqan3::align_cfg::min_score.
+    int64_t max_errors{std::numeric_limits<int64_t>::max()};
+};
+
+/*!\brief The iterator over the trace path computed by seqan3::detail::edit_distance_banded.
+ *
+ * \details
+ *
+ * The iterator walks the stored trace directions and keeps track of the current coordinate, as required by
+ * seqan3::detail::aligned_sequence_builder.
+ */
+template <typename config_t, bool is_semi_global>
+struct edit_distance_banded<config_t, is_semi_global>::trace_path_iterator
+{
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Input iterator tag.
+    using iterator_category = std::input_iterator_tag;
+    //!\copydoc seqan3::detail::trace_iterator_base::value_type
+    using value_type = detail::trace_directions;
+    //!\copydoc seqan3::detail::trace_iterator_base::difference_type
+    using difference_type = std::ptrdiff_t;
+    //!\}
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator*
+    value_type operator*() const
+    {
+        return (position < path->size()) ? (*path)[position] : value_type::none;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::coordinate
+    [[nodiscard]] matrix_coordinate const & coordinate() const
+    {
+        return coordinate_;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    trace_path_iterator & operator++()
+    {
+        value_type const dir = *(*this);
+
+        if (dir == value_type::left || dir == value_type::diagonal)
+            --coordinate_.col;
+
+        if (dir == value_type::up || dir == value_type::diagonal)
+            --coordinate_.row;
+
+        ++position;
+        return *this;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    void operator++(int)
+    {
+        ++(*this);
+    }
+
+    //!\brief Returns whether the end of the trace path was reached.
+    friend bool operator==(trace_path_iterator const & it, std::default_sentinel_t)
+    {
+        return it.position == it.path->size();
+    }
+
+    //!\brief The trace directions.
+    std::vector<trace_directions> const * path{nullptr};
+    //!\brief The current coordinate.
+    matrix_coordinate coordinate_{};
+    //!\brief The current position within the trace directions.
+    size_t position{};
+};
+
+} // namespace seqan3::detail
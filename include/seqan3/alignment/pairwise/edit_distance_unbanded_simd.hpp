@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_unbanded_simd.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the unbanded edit distance of several sequence pairs at once, one pair per simd lane.
+ * \ingroup alignment_pairwise
+ * \tparam alphabet_t     The alphabet of the query sequences; must model seqan3::semialphabet.
+ * \tparam is_semi_global Whether leading and trailing gaps in the database sequence are free.
+ *
+ * \details
+ *
+ * This is the inter-sequence variant of Myers' bit-vector algorithm implemented by
+ * seqan3::detail::edit_distance_unbanded. Every lane of a `simd_type_t<uint64_t>` holds the vertical delta vectors of
+ * one query (the second sequence) of at most #max_query_size letters, so that one column of up to #lanes alignment
+ * matrices is computed by a handful of vector instructions (4 matrices with AVX2, 8 with AVX-512). The database
+ * sequences (the first sequences) may have any length. They are translated into a profile that stores the bit
+ * masks of all lanes of one column in one vector. Lanes whose database is exhausted continue to compute on an empty
+ * bit mask, but their score is no longer updated.
+ *
+ * Only the score and the end positions are computed. Alignments that need the trace, a minimal score or longer
+ * queries are computed by seqan3::detail::edit_distance_unbanded.
+ *
+ * ### Usage
+ *
+ * Assign the sequence pairs with set_lane(), call compute() and read the results with score() and
+ * end_position_first(). The end position in the second sequence is always its size. A call to clear() prepares the
+ * object for the next batch without releasing its memory.
+ */
+template <semialphabet alphabet_t, bool is_semi_global>
+class edit_distance_unbanded_simd
+{
+public:
+    //!\brief The simd vector holding one machine word per lane.
+    using word_type = simd_type_t<uint64_t>;
+    //!\brief The simd vector holding the scores and the end positions.
+    using score_type = simd_type_t<int64_t>;
+
+    //!\brief The number of sequence pairs computed at once.
+    static constexpr size_t lanes = simd_traits<word_type>::length;
+    //!\brief The maximal size of a query sequence.
+    static constexpr size_t max_query_size = 64u;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_simd() = default;                                                //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd const &) = default;             //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd &&) = default;                  //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd const &) = default; //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd &&) = default;      //!< Defaulted.
+    ~edit_distance_unbanded_simd() = default;                                               //!< Defaulted.
+    //!\}
+
+    /*!\brief Returns whether a query can be assigned to a lane.
+     * \param[in] query_size The size of the query sequence.
+     */
+    static constexpr bool fits(size_t const query_size) noexcept
+    {
+        return query_size > 0u && query_size <= max_query_size;
+    }
+
+    //!\brief Resets all lanes, such that a new batch can be assigned.
+    void clear() noexcept
+    {
+        used_lanes = 0u;
+        query_sizes.fill(0u);
+        database_sizes.fill(0u);
+        // Keeps the capacity; the columns are zero-initialised again when they are needed.
+        profile.clear();
+    }
+
+    /*!\brief Assigns a sequence pair to the next free lane.
+     * \tparam database_t The type of the database sequence; must model std::ranges::forward_range.
+     * \tparam query_t    The type of the query sequence; must model std::ranges::sized_range.
+     * \param[in] database The first sequence.
+     * \param[in] query    The second sequence; its size must satisfy fits().
+     * \returns The lane the pair was assigned to.
+     *
+     * \details
+     *
+     * The letters of the database are converted to `alphabet_t` like in seqan3::detail::edit_distance_unbanded.
+     * At most #lanes pairs can be assigned before clear() must be called.
+     */
+    template <std::ranges::forward_range database_t, std::ranges::sized_range query_t>
+    size_t set_lane(database_t && database, query_t && query)
+    {
+        assert(used_lanes < lanes);
+        assert(fits(std::ranges::size(query)));
+
+        size_t const lane = used_lanes++;
+
+        std::array<uint64_t, alphabet_size<alphabet_t>> bit_masks{};
+        size_t position = 0u;
+        for (auto && letter : query)
+            bit_masks[seqan3::to_rank(letter)] |= 1ull << position++;
+
+        query_sizes[lane] = position;
+
+        // Columns beyond the end of a database match nothing.
+        size_t const database_size = std::ranges::distance(database);
+        if (profile.size() < database_size)
+            profile.resize(database_size);
+
+        database_sizes[lane] = database_size;
+
+        // Writes the lanes as scalars, since inserting into a simd vector reloads the whole vector.
+        uint64_t * column = reinterpret_cast<uint64_t *>(profile.data()) + lane;
+        for (auto && letter : database)
+        {
+            *column = bit_masks[seqan3::to_rank(static_cast<alphabet_t>(letter))];
+            column += lanes;
+        }
+
+        return lane;
+    }
+
+    //!\brief Computes the edit distance of all assigned sequence pairs.
+    void compute() noexcept
+    {
+        word_type score_mask{};
+        score_type database_size{};
+        score_type score{};
+        for (size_t lane = 0u; lane < lanes; ++lane)
+        {
+            // Unused lanes have an empty database and are never updated.
+            size_t const query_size = std::max<size_t>(query_sizes[lane], 1u);
+            score_mask[lane] = 1ull << (query_size - 1u);
+            score[lane] = query_size;
+            database_size[lane] = database_sizes[lane];
+        }
+
+        word_type vp = simd::fill<word_type>(~0ull);
+        word_type vn{};
+        score_type best_score = score;
+        score_type best_column{};
+        score_type column_index{};
+        score_type const one = simd::fill<score_type>(1);
+        word_type const hp0 = simd::fill<word_type>(is_semi_global ? 0u : 1u);
+
+        for (word_type const & b : profile)
+        {
+            word_type x = b | vn;
+            word_type const t = vp + (x & vp);
+            word_type const d0 = (t ^ vp) | x;
+            word_type const hn = vp & d0;
+            word_type const hp = vn | ~(vp | d0);
+
+            x = (hp << 1u) | hp0;
+            vn = x & d0;
+            vp = (hn << 1u) | ~(x | d0);
+
+            // The comparisons yield -1 in every lane where they hold.
+            score_type const active = column_index < database_size;
+            score += (((hn & score_mask) != 0u) - ((hp & score_mask) != 0u)) & active;
+            column_index += one;
+
+            if constexpr (is_semi_global)
+            {
+                score_type const improved = (score <= best_score) & active;
+                best_score = (score & improved) | (best_score & ~improved);
+                best_column = (column_index & improved) | (best_column & ~improved);
+            }
+        }
+
+        if constexpr (is_semi_global)
+        {
+            scores = best_score;
+            end_columns = best_column;
+        }
+        else
+        {
+            scores = score;
+            end_columns = database_size;
+        }
+    }
+
+    /*!\brief Returns the alignment score of the given lane, i.e. the negative edit distance.
+     * \param[in] lane The lane returned by set_lane().
+     */
+    int64_t score(size_t const lane) const noexcept
+    {
+        assert(lane < used_lanes);
+        return -scores[lane];
+    }
+
+    /*!\brief Returns the end position in the first sequence of the given lane.
+     * \param[in] lane The lane returned by set_lane().
+     */
+    size_t end_position_first(size_t const lane) const noexcept
+    {
+        assert(lane < used_lanes);
+        return end_columns[lane];
+    }
+
+private:
+    //!\brief The bit masks of the database letters with one vector per column and one lane per sequence pair.
+    std::vector<word_type, aligned_allocator<word_type, alignof(word_type)>> profile{};
+    //!\brief The sizes of the queries.
+    std::array<size_t, lanes> query_sizes{};
+    //!\brief The sizes of the databases.
+    std::array<size_t, lanes> database_sizes{};
+    //!\brief The number of assigned lanes.
+    size_t used_lanes{};
+    //!\brief The computed edit distances.
+    score_type scores{};
+    //!\brief The computed end positions in the first sequences.
+    score_type end_columns{};
+};
+
+} // namespace seqan3::detail
@@ -14,8 +14,10 @@
 
 #include <limits>
 #include <tuple>
+#include <utility>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/alignment/pairwise/detail/alignment_algorithm_state.hpp>
 #include <seqan3/utility/type_traits/basic.hpp>
 #include <seqan3/utility/views/slice.hpp>
@@ -39,6 +41,12 @@ namespace seqan3::detail
  * iterators are used as a global state within this particular alignment instance and are accessed from the alignment
  * algorithm.
  *
+ * The memory of the matrices is reused for all alignments computed by the same algorithm instance. When the instance
+ * is destroyed, the matrices are kept in a `thread_local` cache, from which the next instance created by this thread
+ * takes them over. Thus, repeated invocations of seqan3::align_pairwise only allocate memory if they need bigger
+ * matrices than before. Matrices with more than seqan3::detail::matrix_memory_cache_cell_limit cells are not kept,
+ * and seqan3::release_alignment_matrix_memory frees the cache of the calling thread.
+ *
  * \remarks The template parameters of this CRTP-policy are selected in the
  *          seqan3::detail::alignment_configurator::select_matrix_policy when selecting the alignment for the given
  *          configuration.
@@ -58,7 +66,23 @@ private:
     constexpr alignment_matrix_policy(alignment_matrix_policy &&) = default; //!< Defaulted.
     constexpr alignment_matrix_policy & operator=(alignment_matrix_policy const &) = default; //!< Defaulted.
     constexpr alignment_matrix_policy & operator=(alignment_matrix_policy &&) = default; //!< Defaulted.
-    ~alignment_matrix_policy() = default; //!< Defaulted.
+
+    /*!\brief Hands the matrices over to the thread local cache if they are bigger than the cached ones, but not
+     *        bigger than seqan3::detail::matrix_memory_cache_cell_limit.
+     */
+    ~alignment_matrix_policy()
+    {
+        auto & [cached_score_matrix, cached_trace_matrix] = cached_matrices();
+
+        auto keep = [] (auto & matrix, auto & cached_matrix)
+        {
+            if (matrix.capacity() > cached_matrix.capacity() && matrix.capacity() <= matrix_memory_cache_cell_limit)
+                cached_matrix = std::move(matrix);
+        };
+
+        keep(score_matrix, cached_score_matrix);
+        keep(trace_matrix, cached_trace_matrix);
+    }
 
     //!\brief Initialise the policy.
     template <typename configuration_t>
@@ -76,13 +100,15 @@ private:
      * \details
      *
      * Initialises the underlying score and trace matrices and sets the respective matrix iterators to the begin of the
-     * corresponding matrix.
+     * corresponding matrix. The matrices are reset in place, such that the memory of the previous alignment computed
+     * by this algorithm is reused if it is large enough.
      */
     template <typename sequence1_t, typename sequence2_t>
     constexpr void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
     {
-        score_matrix = score_matrix_t{sequence1, sequence2};
-        trace_matrix = trace_matrix_t{sequence1, sequence2};
+        acquire_cached_matrices();
+        score_matrix.reset(sequence1, sequence2);
+        trace_matrix.reset(sequence1, sequence2);
 
         initialise_matrix_iterator();
     }
@@ -107,6 +133,7 @@ private:
      * smallest representable value and subtract the gap extension score (assumed to be always negative) from it.
      * In the algorithm we never write to this cell and only add the extension costs to the read value. This way we
      * can get the smallest possible value as an infinity.
+     * As in the unbanded case, the matrices are reset in place to reuse their memory.
      */
     template <typename sequence1_t, typename sequence2_t, typename score_t>
     constexpr void allocate_matrix(sequence1_t && sequence1,
@@ -117,12 +144,31 @@ private:
         assert(state.gap_extension_score <= 0); // We expect it to never be positive.
 
         score_t inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
-        score_matrix = score_matrix_t{sequence1, sequence2, band, inf};
-        trace_matrix = trace_matrix_t{sequence1, sequence2, band};
+        acquire_cached_matrices();
+        score_matrix.reset(sequence1, sequence2, band, inf);
+        trace_matrix.reset(sequence1, sequence2, band);
 
         initialise_matrix_iterator();
     }
 
+    //!\brief Returns the matrices that are kept for the next algorithm instance of the current thread.
+    static std::pair<score_matrix_t, trace_matrix_t> & cached_matrices() noexcept
+    {
+        static thread_local matrix_memory_cache::entry<std::pair<score_matrix_t, trace_matrix_t>> cache{};
+        return cache.matrix;
+    }
+
+    //!\brief Exchanges the matrices with the cached ones if the latter provide more memory.
+    void acquire_cached_matrices()
+    {
+        auto & [cached_score_matrix, cached_trace_matrix] = cached_matrices();
+
+        if (cached_score_matrix.capacity() > score_matrix.capacity())
+            std::swap(score_matrix, cached_score_matrix);
+        if (cached_trace_matrix.capacity() > trace_matrix.capacity())
+            std::swap(trace_matrix, cached_trace_matrix);
+    }
+
     //!\brief Initialises the score and trace matrix iterator after allocating the matrices.
     constexpr void initialise_matrix_iterator() noexcept
     {
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <seqan3/std/concepts>
+#include <utility>
 
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
@@ -143,12 +144,13 @@ public:
                                  simd_alphabet_ranks_type const & ranks) const noexcept
     {
         simd_score_t const matrix_index = score_profile + ranks; // Compute the matrix indices for the lookup.
-        simd_score_t result{};
 
-        for (size_t idx = 0; idx < simd_traits<simd_score_t>::length; ++idx)
-            result[idx] = scoring_scheme_data.data()[matrix_index[idx]];
-
-        return result;
+        // The vector is constructed from the looked up scores; assigning them lane by lane to a value initialised
+        // vector makes gcc warn about an uninitialised vector if the vector has only a single lane.
+        return [&] <size_t ...idx> (std::index_sequence<idx...>)
+        {
+            return simd_score_t{scoring_scheme_data.data()[matrix_index[idx]]...};
+        }(std::make_index_sequence<simd_traits<simd_score_t>::length>{});
     }
     //!\}
 
@@ -208,7 +210,7 @@ private:
         };
 
         // For the global alignment we extend the alphabet by one symbol to handle sequences with different size.
-        scoring_scheme_data.resize(index_offset * index_offset, score_for_padding_symbol);
+        scoring_scheme_data.assign(index_offset * index_offset, score_for_padding_symbol);
 
         // Convert the scoring matrix into a linear vector to allow gather operations later on.
         using alphabet_size_t = std::remove_const_t<decltype(seqan3::alphabet_size<alphabet_t>)>;
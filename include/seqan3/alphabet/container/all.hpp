@@ -20,3 +20,4 @@
 
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
 #include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/container/packed_concatenated_sequences.hpp>
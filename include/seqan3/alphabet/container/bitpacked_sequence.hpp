@@ -12,9 +12,12 @@
 
 #pragma once
 
+#include <array>
 #include <seqan3/std/concepts>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
 #include <type_traits>
 
 #include <sdsl/int_vector.hpp>
@@ -24,6 +27,7 @@
 #include <seqan3/alphabet/views/to_rank.hpp>
 #include <seqan3/core/concept/cereal.hpp>
 #include <seqan3/core/range/detail/random_access_iterator.hpp>
+#include <seqan3/utility/detail/bit_packing.hpp>
 #include <seqan3/utility/math.hpp>
 #include <seqan3/utility/views/convert.hpp>
 
@@ -66,10 +70,13 @@ template <writable_semialphabet alphabet_type>
 //!\endcond
 class bitpacked_sequence
 {
-private:
-    //!\brief The number of bits needed to represent a single letter of the alphabet_type.
+public:
+    /*!\brief The number of bits needed to represent a single letter of the alphabet_type.
+     * \experimentalapi{Experimental since version 3.2.}
+     */
     static constexpr size_t bits_per_letter = detail::ceil_log2(alphabet_size<alphabet_type>);
 
+private:
     static_assert(bits_per_letter <= 64, "alphabet must be representable in at most 64bit.");
 
     //!\brief Type of the underlying SDSL vector.
@@ -78,6 +85,15 @@ private:
     //!\brief The data storage.
     data_type data;
 
+    //!\brief Whether the letters are (un)packed in bulk with seqan3::detail::pack_bits and seqan3::detail::unpack_bits.
+    static constexpr bool bulk_packing = bits_per_letter > 0; // a width of 0 means run-time width in the SDSL
+
+    //!\brief The type of the ranks that are (un)packed in bulk.
+    using packed_rank_type = std::conditional_t<bits_per_letter <= 8, uint8_t, uint64_t>;
+
+    //!\brief The number of letters that are (un)packed in one go.
+    static constexpr size_t bulk_chunk_size = 4096;
+
     //!\brief Proxy data type returned by seqan3::bitpacked_sequence as reference to element.
     class reference_proxy_type : public alphabet_proxy<reference_proxy_type, alphabet_type>
     {
@@ -594,6 +610,79 @@ public:
     {
         return data;
     }
+
+    /*!\brief Provides read access to the packed letters as a range of 64 bit words.
+     * \returns A std::span over the `ceil(size() * bits_per_letter / 64)` words that hold the letters.
+     *
+     * \details
+     *
+     * The ranks of the letters are stored back to back with #bits_per_letter bits each, beginning at the least
+     * significant bit of the first word, i.e. the letter at position `i` occupies the bits
+     * `[i * bits_per_letter, (i + 1) * bits_per_letter)` of the concatenated words. A letter spans two words if
+     * #bits_per_letter does not divide 64. The bits after the last letter are unspecified.
+     *
+     * This allows algorithms to process many letters with a single word operation, e.g. 32 seqan3::dna4 letters.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    std::span<uint64_t const> words() const noexcept
+    {
+        return {data.data(), static_cast<size_t>((data.bit_size() + 63) / 64)};
+    }
+
+    /*!\brief Copies consecutive letters into a buffer.
+     * \param[in]  pos    The position of the first letter.
+     * \param[out] output The letters at `[pos, pos + output.size())` are written to this buffer.
+     * \throws std::out_of_range if `pos + output.size() > size()`.
+     *
+     * \details
+     *
+     * This is equivalent to `std::ranges::copy_n(begin() + pos, output.size(), output.begin())`, but unpacks whole
+     * words at a time instead of accessing the letters one by one.
+     *
+     * ### Complexity
+     *
+     * Linear in `output.size()`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (never modifies data).
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    void extract(size_type const pos, std::span<value_type> const output) const
+    {
+        if (pos > size() || output.size() > size() - pos) // [[unlikely]]
+        {
+            throw std::out_of_range{"Trying to extract elements behind the last in bitpacked_sequence."};
+        }
+
+        if constexpr (bulk_packing)
+        {
+            std::array<packed_rank_type, bulk_chunk_size> ranks;
+
+            for (size_t done = 0; done < output.size(); done += bulk_chunk_size)
+            {
+                size_t const count = std::min(output.size() - done, bulk_chunk_size);
+                detail::unpack_bits<bits_per_letter>(data.data(), (pos + done) * bits_per_letter, count, ranks.data());
+
+                for (size_t i = 0; i < count; ++i)
+                    assign_rank_to(ranks[i], output[done + i]);
+            }
+        }
+        else
+        {
+            std::ranges::copy_n(begin() + pos, output.size(), output.begin());
+        }
+    }
     //!\}
 
     /*!\name Capacity
@@ -836,6 +925,15 @@ public:
     {
         auto const pos_as_num = std::distance(cbegin(), pos);
 
+        if constexpr (bulk_packing)
+        {
+            if (static_cast<size_type>(pos_as_num) == size())
+            {
+                append_packed(begin_it, std::ranges::distance(begin_it, end_it));
+                return begin() + pos_as_num;
+            }
+        }
+
         auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it}
                | views::convert<value_type>
                | views::to_rank;
@@ -952,6 +1050,63 @@ public:
         data.push_back(to_rank(value));
     }
 
+    /*!\brief Appends the elements of the given range to the end of the container.
+     * \tparam other_range_t Must model std::ranges::input_range and its value type must be convertible to value_type.
+     * \param[in] range The elements to append.
+     *
+     * \details
+     *
+     * The letters are packed into whole words at a time, which is much faster than calling push_back() for every
+     * letter. Constructing, assigning and inserting at end() take the same route.
+     *
+     * If the new size() is greater than capacity() then all iterators and references (including the past-the-end
+     * iterator) are invalidated. Otherwise only the past-the-end iterator is invalidated.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of range, worst-case linear in size() + the size of range.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    template <std::ranges::input_range other_range_t>
+    void append(other_range_t && range)
+    //!\cond
+        requires std::common_reference_with<std::ranges::range_value_t<other_range_t>, value_type>
+    //!\endcond
+    {
+        if constexpr (std::ranges::forward_range<other_range_t>)
+        {
+            insert(cend(), std::ranges::begin(range), std::ranges::end(range));
+        }
+        else if constexpr (bulk_packing)
+        {
+            std::array<value_type, bulk_chunk_size> buffer;
+            auto it = std::ranges::begin(range);
+
+            while (it != std::ranges::end(range))
+            {
+                size_t count = 0;
+                for (; count < bulk_chunk_size && it != std::ranges::end(range); ++count, ++it)
+                    buffer[count] = static_cast<value_type>(*it);
+
+                if (size() + count > capacity())
+                    reserve(std::max(size() + count, 2 * capacity()));
+
+                append_packed(buffer.begin(), count);
+            }
+        }
+        else
+        {
+            for (auto && value : range)
+                push_back(static_cast<value_type>(value));
+        }
+    }
+
     /*!\brief Removes the last element of the container.
      *
      * Calling pop_back() on an empty container is undefined. In debug mode an assertion will be thrown.
@@ -1142,6 +1297,31 @@ public:
         archive(data);
     }
     //!\endcond
+
+private:
+    //!\brief Appends the count elements beginning at it, packing whole words at a time.
+    template <typename iterator_t>
+    void append_packed(iterator_t it, size_t const count)
+    {
+        size_t const old_size = size();
+        data.resize(old_size + count);
+
+        auto rank_view = std::views::counted(it, static_cast<std::iter_difference_t<iterator_t>>(count))
+                       | views::convert<value_type>
+                       | views::to_rank;
+        auto rank_it = std::ranges::begin(rank_view);
+        std::array<packed_rank_type, bulk_chunk_size> ranks;
+
+        for (size_t done = 0; done < count; done += bulk_chunk_size)
+        {
+            size_t const chunk_size = std::min(count - done, bulk_chunk_size);
+            for (size_t i = 0; i < chunk_size; ++i, ++rank_it)
+                ranks[i] = static_cast<packed_rank_type>(*rank_it);
+
+            detail::pack_bits<bits_per_letter>(ranks.data(), chunk_size, data.data(),
+                                               (old_size + done) * bits_per_letter);
+        }
+    }
 };
 
 } // namespace seqan3
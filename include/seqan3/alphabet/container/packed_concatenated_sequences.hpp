@@ -0,0 +1,698 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::packed_concatenated_sequences.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <seqan3/std/bit>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/range/detail/random_access_iterator.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/memory_mapped_streambuf.hpp>
+#include <seqan3/utility/detail/bit_packing.hpp>
+#include <seqan3/utility/detail/elias_fano.hpp>
+
+namespace seqan3
+{
+
+/*!\brief An immutable container of sequences that stores the letters bit packed and the delimiters Elias-Fano
+ *        encoded, and that can be memory mapped from a file.
+ * \ingroup alphabet_container
+ * \implements std::ranges::random_access_range
+ * \implements std::ranges::sized_range
+ * \implements std::ranges::common_range
+ * \tparam alphabet_type The alphabet of the sequences; must satisfy seqan3::semialphabet and have at most 256 letters.
+ *
+ * \details
+ *
+ * Like seqan3::concatenated_sequences, all sequences are stored back to back in a single buffer, but the
+ * letters use only #bits_per_letter bits (2 for seqan3::dna4, 4 for seqan3::dna5 or seqan3::dna15) and the begin
+ * positions of the sequences are compressed with seqan3::detail::elias_fano_sequence (about 10 bits per sequence for
+ * short reads instead of 64). 500 million reads of 150 bp seqan3::dna4 thus need about 19 GB instead of 79 GB.
+ *
+ * The container cannot be modified after construction. It is either constructed from a range of sequences, built in
+ * parallel with a seqan3::packed_concatenated_sequences::builder or loaded from a file that was written by #save.
+ * Loading can map the file into memory, in which case no data is copied: the operating system reads the pages on
+ * demand and shares them between all processes that map the same file.
+ *
+ * The elements are random access views on the packed letters; use #extract to unpack a whole sequence at once.
+ *
+ * ### The file format
+ *
+ * A file consists of 64 bit little-endian words: a header of 16 words (a magic number, the alphabet size, the number
+ * of bits per letter, the number of sequences and of letters, the parameters of the Elias-Fano encoding and reserved
+ * words), followed by the packed letters and the Elias-Fano encoding of the `size() + 1` delimiters. The in-memory
+ * representation is the same, hence saving writes a single buffer and loading does not need to decode anything.
+ * Files can only be written and read on little-endian machines.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/container/packed_concatenated_sequences.cpp
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <semialphabet alphabet_type>
+class packed_concatenated_sequences
+{
+    static_assert(alphabet_size<alphabet_type> <= 256,
+                  "packed_concatenated_sequences supports alphabets with at most 256 letters.");
+
+public:
+    /*!\brief The number of bits per letter: the size of the rank, rounded up to a power of two.
+     * \details
+     * No letter spans two words, which makes unpacking single letters cheap.
+     */
+    static constexpr size_t bits_per_letter = std::bit_ceil(std::max<size_t>(std::bit_width(
+                                                  static_cast<size_t>(alphabet_size<alphabet_type> - 1u)), 1u));
+
+private:
+    //!\brief Unpacks a single letter.
+    struct letter_decoder
+    {
+        //!\brief The packed letters.
+        uint64_t const * words{nullptr};
+
+        //!\brief Returns the letter at the given position.
+        alphabet_type operator()(size_t const position) const noexcept
+        {
+            size_t const bit = position * bits_per_letter;
+            return assign_rank_to((words[bit / 64u] >> (bit % 64u)) & ((uint64_t{1} << bits_per_letter) - 1u),
+                                  alphabet_type{});
+        }
+    };
+
+    //!\brief The number of words of the header.
+    static constexpr size_t header_words = 16;
+
+    //!\brief The first word of a file: "SQ3PACKS" in little-endian byte order.
+    static constexpr uint64_t magic_number = 0x534B'4341'5033'5153ULL;
+
+    //!\brief The version of the file format.
+    static constexpr uint64_t format_version = 1;
+
+    //!\brief The positions of the fields in the header.
+    enum header_field : size_t
+    {
+        magic_field,
+        version_field,
+        alphabet_size_field,
+        bits_per_letter_field,
+        sequence_count_field,
+        letter_count_field,
+        letter_words_field,
+        low_bits_field,
+        low_words_field,
+        high_words_field,
+        sample_words_field
+    };
+
+    //!\brief Returns the number of words needed for the given number of letters.
+    static constexpr size_t letter_words(size_t const letter_count) noexcept
+    {
+        return (letter_count * bits_per_letter + 63u) / 64u;
+    }
+
+public:
+    class builder;
+
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief A random access view on the packed letters of a sequence.
+    using reference = decltype(std::views::iota(size_t{}, size_t{}) | std::views::transform(letter_decoder{}));
+    //!\brief Same as reference; use #extract to obtain a container.
+    using value_type = reference;
+    //!\brief Same as reference, the container cannot be modified.
+    using const_reference = reference;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator = detail::random_access_iterator<packed_concatenated_sequences const>;
+    //!\brief Same as iterator, the container cannot be modified.
+    using const_iterator = iterator;
+    //!\brief A signed integer type (usually std::ptrdiff_t).
+    using difference_type = std::ptrdiff_t;
+    //!\brief An unsigned integer type (usually std::size_t).
+    using size_type = size_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Constructs an empty container without allocating memory.
+    packed_concatenated_sequences() noexcept
+    {
+        attach();
+    }
+
+    //!\brief Copies the data, also if other is memory mapped.
+    packed_concatenated_sequences(packed_concatenated_sequences const & other) :
+        buffer{other.mapping ? std::vector<uint64_t>(other.data(), other.data() + other.buffer_words())
+                             : other.buffer}
+    {
+        attach();
+    }
+
+    //!\brief Moves the data, other is left empty.
+    packed_concatenated_sequences(packed_concatenated_sequences && other) noexcept
+    {
+        attach();
+        swap(other);
+    }
+
+    //!\brief Copies the data, also if other is memory mapped.
+    packed_concatenated_sequences & operator=(packed_concatenated_sequences const & other)
+    {
+        packed_concatenated_sequences copy{other};
+        swap(copy);
+        return *this;
+    }
+
+    //!\brief Swaps the data with other.
+    packed_concatenated_sequences & operator=(packed_concatenated_sequences && other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~packed_concatenated_sequences() = default; //!< Defaulted.
+
+    /*!\brief Constructs the container from a range of sequences.
+     * \tparam rng_of_rng_type The type of the range; its elements must be input ranges over letters that are
+     *                         convertible to `alphabet_type`.
+     * \param[in] rng_of_rng The sequences.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the cumulative size of `rng_of_rng`.
+     */
+    template <std::ranges::input_range rng_of_rng_type>
+    //!\cond
+        requires (!std::same_as<std::remove_cvref_t<rng_of_rng_type>, packed_concatenated_sequences>) &&
+                 std::ranges::input_range<std::ranges::range_reference_t<rng_of_rng_type>> &&
+                 std::convertible_to<std::ranges::range_reference_t<std::ranges::range_reference_t<rng_of_rng_type>>,
+                                     alphabet_type>
+    //!\endcond
+    explicit packed_concatenated_sequences(rng_of_rng_type && rng_of_rng)
+    {
+        builder sequences{};
+        sequences.append(std::forward<rng_of_rng_type>(rng_of_rng));
+        *this = sequences.finalise();
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first sequence.
+    iterator begin() const noexcept
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    //!\brief Returns an iterator behind the last sequence.
+    iterator end() const noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    iterator cend() const noexcept
+    {
+        return end();
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Returns the sequence at position i.
+     * \param[in] i The position.
+     * \returns A random access view on the packed letters.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant: two neighbouring delimiters are decoded, see seqan3::detail::elias_fano_sequence.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee. Accessing a position behind the last sequence is undefined behaviour.
+     */
+    reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        auto [first, last] = delimiters.adjacent(i);
+        return std::views::iota(static_cast<size_t>(first), static_cast<size_t>(last))
+             | std::views::transform(letter_decoder{data() + header_words});
+    }
+
+    /*!\brief Returns the sequence at position i.
+     * \param[in] i The position.
+     * \throws std::out_of_range if `i >= size()`.
+     */
+    reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in packed_concatenated_sequences."};
+        return (*this)[i];
+    }
+
+    //!\brief Returns the first sequence; the container must not be empty.
+    reference front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    //!\brief Returns the last sequence; the container must not be empty.
+    reference back() const noexcept
+    {
+        return (*this)[size() - 1u];
+    }
+
+    /*!\brief Unpacks the sequence at position i into a container.
+     * \param[in]  i        The position.
+     * \param[out] sequence The sequence is assigned to this container, which is resized accordingly.
+     * \throws std::out_of_range if `i >= size()`.
+     *
+     * \details
+     *
+     * Whole words are unpacked at a time with seqan3::detail::unpack_bits. Reusing the output container avoids
+     * allocations when many sequences are extracted.
+     */
+    void extract(size_type const i, std::vector<alphabet_type> & sequence) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to extract element behind the last in packed_concatenated_sequences."};
+
+        auto [first, last] = delimiters.adjacent(i);
+        sequence.resize(last - first);
+
+        std::array<uint8_t, 4096> ranks;
+        for (size_t done = 0; done < sequence.size(); done += ranks.size())
+        {
+            size_t const count = std::min(sequence.size() - done, ranks.size());
+            detail::unpack_bits<bits_per_letter>(data() + header_words, (first + done) * bits_per_letter, count,
+                                                 ranks.data());
+
+            for (size_t j = 0; j < count; ++j)
+                assign_rank_to(ranks[j], sequence[done + j]);
+        }
+    }
+
+    /*!\brief Returns the packed letters of all sequences.
+     * \details
+     * The layout is the one of seqan3::bitpacked_sequence::words, with #bits_per_letter bits per letter.
+     */
+    std::span<uint64_t const> words() const noexcept
+    {
+        return {data() + header_words, letter_words(concat_size())};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of sequences.
+    size_type size() const noexcept
+    {
+        return delimiters.size() - 1u;
+    }
+
+    //!\brief Checks whether the container is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0u;
+    }
+
+    //!\brief Returns the cumulative size of all sequences.
+    size_type concat_size() const noexcept
+    {
+        return data()[letter_count_field];
+    }
+
+    //!\brief Returns whether the data is read from a memory mapped file.
+    bool is_memory_mapped() const noexcept
+    {
+        return mapping != nullptr;
+    }
+    //!\}
+
+    /*!\name Persistence
+     * \{
+     */
+    /*!\brief Writes the container to a file.
+     * \param[in] path The file.
+     * \throws seqan3::file_open_error if the file cannot be opened, or on big-endian machines.
+     * \throws std::ios_base::failure if writing fails.
+     */
+    void save(std::filesystem::path const & path) const
+    {
+        check_endianness(path);
+
+        std::ofstream file{path, std::ios::binary};
+        if (!file.is_open())
+            throw file_open_error{"Could not open file " + path.string() + " for writing."};
+
+        file.exceptions(std::ios::badbit | std::ios::failbit);
+        file.write(reinterpret_cast<char const *>(data()), buffer_words() * sizeof(uint64_t));
+    }
+
+    /*!\brief Reads a container from a file that was written by #save.
+     * \param[in] path       The file.
+     * \param[in] memory_map Whether to map the file into memory (see seqan3::memory_mapped_streambuf) instead of
+     *                       reading it.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped, or on big-endian machines.
+     * \throws seqan3::format_error if the file is not a container of this `alphabet_type`.
+     *
+     * \details
+     *
+     * A memory mapped container only reads the pages it accesses. The file must not be modified while it is mapped.
+     * Copies of a memory mapped container hold their data in memory.
+     */
+    static packed_concatenated_sequences load(std::filesystem::path const & path, bool const memory_map = true)
+    {
+        check_endianness(path);
+
+        packed_concatenated_sequences sequences{empty_tag{}};
+
+        if (memory_map)
+        {
+            sequences.mapping = std::make_shared<memory_mapped_streambuf>(path);
+
+            if (sequences.mapping->size() % sizeof(uint64_t) != 0u ||
+                sequences.mapping->size() < header_words * sizeof(uint64_t))
+            {
+                throw format_error{"The file " + path.string() + " is not a packed_concatenated_sequences file."};
+            }
+        }
+        else
+        {
+            std::ifstream file{path, std::ios::binary | std::ios::ate};
+            if (!file.is_open())
+                throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+            size_t const file_size = static_cast<size_t>(file.tellg());
+            if (file_size % sizeof(uint64_t) != 0u || file_size < header_words * sizeof(uint64_t))
+                throw format_error{"The file " + path.string() + " is not a packed_concatenated_sequences file."};
+
+            sequences.buffer.resize(file_size / sizeof(uint64_t));
+            file.seekg(0);
+            file.read(reinterpret_cast<char *>(sequences.buffer.data()), file_size);
+        }
+
+        sequences.validate(path);
+        sequences.attach();
+        return sequences;
+    }
+    //!\}
+
+    //!\brief Swaps the contents with another container.
+    void swap(packed_concatenated_sequences & other) noexcept
+    {
+        std::swap(buffer, other.buffer);
+        std::swap(mapping, other.mapping);
+        std::swap(delimiters, other.delimiters);
+    }
+
+    //!\brief Two containers are equal if they hold the same sequences.
+    friend bool operator==(packed_concatenated_sequences const & lhs, packed_concatenated_sequences const & rhs)
+    {
+        return std::ranges::equal(lhs, rhs, [] (auto && lhs_sequence, auto && rhs_sequence)
+        {
+            return std::ranges::equal(lhs_sequence, rhs_sequence);
+        });
+    }
+
+private:
+    //!\brief A tag for constructing a container without data.
+    struct empty_tag {};
+
+    //!\brief Constructs a container without data, the caller has to set the buffer and call attach().
+    explicit packed_concatenated_sequences(empty_tag) noexcept
+    {}
+
+    //!\brief The representation of an empty container: no letters and the single delimiter 0.
+    static constexpr std::array<uint64_t, header_words + 2u> empty_data = [] () constexpr
+    {
+        std::array<uint64_t, header_words + 2u> words{};
+        words[magic_field] = magic_number;
+        words[version_field] = format_version;
+        words[alphabet_size_field] = alphabet_size<alphabet_type>;
+        words[bits_per_letter_field] = bits_per_letter;
+        words[high_words_field] = 1u;
+        words[sample_words_field] = 1u;
+        words[header_words] = 1u; // the high bit vector of the delimiter 0; its sample is 0
+        return words;
+    }();
+
+    //!\brief Returns the header, followed by the letters and the delimiters.
+    uint64_t const * data() const noexcept
+    {
+        if (mapping)
+            return reinterpret_cast<uint64_t const *>(mapping->data());
+        return buffer.empty() ? empty_data.data() : buffer.data();
+    }
+
+    //!\brief Returns the number of words of the header, the letters and the delimiters.
+    size_t buffer_words() const noexcept
+    {
+        if (mapping)
+            return mapping->size() / sizeof(uint64_t);
+        return buffer.empty() ? empty_data.size() : buffer.size();
+    }
+
+    //!\brief Returns the layout of the delimiters that is stored in the header.
+    detail::elias_fano_sequence::layout delimiter_layout() const noexcept
+    {
+        uint64_t const * const header = data();
+        return {header[sequence_count_field] + 1u,
+                header[low_bits_field],
+                header[low_words_field],
+                header[high_words_field],
+                header[sample_words_field]};
+    }
+
+    //!\brief Sets up the delimiters after the data has changed.
+    void attach() noexcept
+    {
+        delimiters = detail::elias_fano_sequence{data() + header_words + data()[letter_words_field],
+                                                 delimiter_layout()};
+    }
+
+    //!\brief Checks the header of a loaded file.
+    void validate(std::filesystem::path const & path) const
+    {
+        uint64_t const * const header = data();
+        auto fail = [&] (std::string const & reason)
+        {
+            throw format_error{"The file " + path.string() + " is not a valid packed_concatenated_sequences file: "
+                               + reason + "."};
+        };
+
+        if (header[magic_field] != magic_number)
+            fail("the magic number does not match");
+        if (header[version_field] != format_version)
+            fail("the version " + std::to_string(header[version_field]) + " is not supported");
+        if (header[alphabet_size_field] != alphabet_size<alphabet_type> ||
+            header[bits_per_letter_field] != bits_per_letter)
+        {
+            fail("it was written for a different alphabet");
+        }
+        if (header[letter_words_field] != letter_words(header[letter_count_field]) ||
+            delimiter_layout() != detail::elias_fano_sequence::compute_layout(header[sequence_count_field] + 1u,
+                                                                              header[letter_count_field]))
+        {
+            fail("the header is inconsistent");
+        }
+        if (buffer_words() != header_words + header[letter_words_field] + delimiter_layout().total_words())
+            fail("the file size does not match the header");
+    }
+
+    //!\brief Throws if the file format is not supported on this machine.
+    static void check_endianness(std::filesystem::path const & path)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+        {
+            throw file_open_error{"Could not access file " + path.string() + ": packed_concatenated_sequences files "
+                                  "are only supported on little-endian machines."};
+        }
+    }
+
+    //!\brief The header, the letters and the delimiters; empty if the data is memory mapped.
+    std::vector<uint64_t> buffer{};
+    //!\brief The memory mapped file, if any.
+    std::shared_ptr<memory_mapped_streambuf> mapping{};
+    //!\brief A view on the delimiters in the buffer or the mapping.
+    detail::elias_fano_sequence delimiters{};
+};
+
+/*!\brief Builds a seqan3::packed_concatenated_sequences, also from multiple threads at the same time.
+ * \ingroup alphabet_container
+ *
+ * \details
+ *
+ * Batches of sequences can be appended concurrently. Each call packs its batch into a local buffer and then copies the
+ * packed words into the shared buffer under a lock, so the expensive part runs in parallel. The batches are stored
+ * in the order in which they acquire the lock; #append returns the position of the first sequence of the batch.
+ *
+ * If the number of sequences and letters is known (approximately) in advance, #reserve allocates the final buffer up
+ * front and neither appending nor #finalise reallocate.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <semialphabet alphabet_type>
+class packed_concatenated_sequences<alphabet_type>::builder
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    builder() = default; //!< Defaulted.
+    builder(builder const &) = delete; //!< Deleted, the builder holds a mutex.
+    builder(builder &&) = delete; //!< Deleted, the builder holds a mutex.
+    builder & operator=(builder const &) = delete; //!< Deleted, the builder holds a mutex.
+    builder & operator=(builder &&) = delete; //!< Deleted, the builder holds a mutex.
+    ~builder() = default; //!< Defaulted.
+    //!\}
+
+    /*!\brief Allocates memory for the given number of sequences and letters.
+     * \param[in] sequence_count The expected number of sequences.
+     * \param[in] letter_count   The expected cumulative size of the sequences.
+     */
+    void reserve(size_t const sequence_count, size_t const letter_count)
+    {
+        std::lock_guard lock{mutex};
+        buffer.reserve(header_words + letter_words(letter_count) +
+                       detail::elias_fano_sequence::compute_layout(sequence_count + 1u, letter_count).total_words());
+        delimiters.reserve(sequence_count + 1u);
+    }
+
+    /*!\brief Appends a batch of sequences; thread-safe.
+     * \tparam rng_of_rng_type The type of the batch; its elements must be input ranges over letters that are
+     *                         convertible to `alphabet_type`.
+     * \param[in] batch The sequences.
+     * \returns The position of the first sequence of the batch in the finalised container.
+     */
+    template <std::ranges::input_range rng_of_rng_type>
+    //!\cond
+        requires std::ranges::input_range<std::ranges::range_reference_t<rng_of_rng_type>> &&
+                 std::convertible_to<std::ranges::range_reference_t<std::ranges::range_reference_t<rng_of_rng_type>>,
+                                     alphabet_type>
+    //!\endcond
+    size_t append(rng_of_rng_type && batch)
+    {
+        std::vector<uint8_t> ranks{};
+        std::vector<uint64_t> lengths{};
+
+        for (auto && sequence : batch)
+        {
+            size_t const old_size = ranks.size();
+            for (auto && letter : sequence)
+                ranks.push_back(static_cast<uint8_t>(seqan3::to_rank(static_cast<alphabet_type>(letter))));
+
+            lengths.push_back(ranks.size() - old_size);
+        }
+
+        std::vector<uint64_t> packed(letter_words(ranks.size()));
+        detail::pack_bits<bits_per_letter>(ranks.data(), ranks.size(), packed.data(), 0u);
+
+        std::lock_guard lock{mutex};
+        size_t const first_sequence = delimiters.size() - 1u;
+        size_t const first_letter = delimiters.back();
+
+        for (uint64_t const length : lengths)
+            delimiters.push_back(delimiters.back() + length);
+
+        // The letters of the batch begin at bit `shift` of the first word; the bits behind the last letter are zero.
+        buffer.resize(header_words + letter_words(first_letter + ranks.size()));
+        uint64_t * const words = buffer.data() + header_words + first_letter * bits_per_letter / 64u;
+        size_t const shift = first_letter * bits_per_letter % 64u;
+        size_t const available = buffer.size() - (words - buffer.data());
+
+        for (size_t i = 0; i < packed.size(); ++i)
+        {
+            words[i] |= packed[i] << shift;
+            if (shift != 0u && i + 1u < available)
+                words[i + 1u] |= packed[i] >> (64u - shift);
+        }
+
+        return first_sequence;
+    }
+
+    /*!\brief Returns the container of all appended sequences and resets the builder.
+     * \details
+     * Must not be called concurrently with #append.
+     */
+    packed_concatenated_sequences finalise()
+    {
+        std::lock_guard lock{mutex};
+
+        size_t const letter_count = delimiters.back();
+        detail::elias_fano_sequence::layout const layout =
+            detail::elias_fano_sequence::compute_layout(delimiters.size(), letter_count);
+
+        buffer.resize(header_words + letter_words(letter_count) + layout.total_words());
+
+        uint64_t * const header = buffer.data();
+        std::fill_n(header, header_words, uint64_t{});
+        header[magic_field] = magic_number;
+        header[version_field] = format_version;
+        header[alphabet_size_field] = alphabet_size<alphabet_type>;
+        header[bits_per_letter_field] = bits_per_letter;
+        header[sequence_count_field] = delimiters.size() - 1u;
+        header[letter_count_field] = letter_count;
+        header[letter_words_field] = letter_words(letter_count);
+        header[low_bits_field] = layout.low_bits;
+        header[low_words_field] = layout.low_words;
+        header[high_words_field] = layout.high_words;
+        header[sample_words_field] = layout.sample_words;
+
+        detail::elias_fano_sequence::encode(delimiters,
+                                            layout,
+                                            buffer.data() + header_words + letter_words(letter_count));
+
+        packed_concatenated_sequences sequences{empty_tag{}};
+        sequences.buffer = std::move(buffer);
+        sequences.attach();
+
+        buffer = std::vector<uint64_t>(header_words);
+        delimiters = std::vector<uint64_t>{0u};
+        return sequences;
+    }
+
+private:
+    //!\brief Protects all members.
+    std::mutex mutex{};
+    //!\brief The space for the header, followed by the letters; the delimiters are added by finalise().
+    std::vector<uint64_t> buffer = std::vector<uint64_t>(header_words);
+    //!\brief The begin positions of the sequences, followed by the number of letters.
+    std::vector<uint64_t> delimiters{0u};
+};
+
+} // namespace seqan3
@@ -46,6 +46,7 @@
  * | Sanger, Illumina    | Sanger, Illumina 1.8+       | Phred+33 | seqan3::phred63       | [0 .. 62]         | [0 .. 62]  | [33 .. 95]  <br> ['!' .. '_'] |
  * | PacBio              | Sanger, Illumina 1.8+       | Phred+33 | seqan3::phred94       | [0 .. 93]         | [0 .. 93]  | [33 .. 126] <br> ['!' .. '~'] |
  * | Solexa              | Solexa, Illumina [1.0; 1.8[ | Phred+64 | seqan3::phred68solexa | [-5 .. 62]        | [0 .. 67]  | [59 .. 126] <br> [';' .. '~'] |
+ * | Illumina (binned)   | Sanger, Illumina 1.8+       | Phred+33 | seqan3::phred_binned  | 8 bins of [0 .. ] | [0 .. 7]   | [33 .. 126] <br> ['!' .. '~'] |
  *
  * The most distributed format is the *Sanger* or *Illumina 1.8+* format.
  * Despite typical Phred scores for Illumina machines range from 0 to 41, it is possible that processed reads reach
@@ -54,6 +55,8 @@
  * seqan3::phred94, as these use the full range of the Phred quality scores.
  * For other formats, like Solexa and Illumina 1.0 to 1.7, the type seqan3::phred68solexa is provided. To also cover the
  * Solexa format, the Phred score is stored as a **signed** integer starting at -5.
+ * If the exact scores are not needed, seqan3::phred_binned reduces them to the eight levels of Illumina's quality
+ * binning; stored in a seqan3::bitpacked_sequence it needs 3 bits per quality score.
  *
  * The following figure gives a graphical explanation of the different Alphabet Types:
  *
@@ -123,4 +126,5 @@
 #include <seqan3/alphabet/quality/phred68solexa.hpp>
 #include <seqan3/alphabet/quality/phred94.hpp>
 #include <seqan3/alphabet/quality/phred_base.hpp>
+#include <seqan3/alphabet/quality/phred_binned.hpp>
 #include <seqan3/alphabet/quality/qualified.hpp>
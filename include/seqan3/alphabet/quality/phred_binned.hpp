@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::phred_binned quality scores.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+
+#include <seqan3/alphabet/alphabet_base.hpp>
+#include <seqan3/alphabet/quality/concept.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Quality type that bins Phred scores into the eight levels of Illumina's quality binning.
+ * \implements seqan3::writable_quality_alphabet
+ * \if DEV \implements seqan3::detail::writable_constexpr_alphabet \endif
+ * \implements seqan3::trivially_copyable
+ * \implements seqan3::standard_layout
+ * \implements std::regular
+ *
+ * \ingroup alphabet_quality
+ *
+ * \details
+ *
+ * Every Phred score is mapped to the representative score of its bin:
+ *
+ * | Phred score  | [0 .. 2] | [3 .. 9] | [10 .. 19] | [20 .. 24] | [25 .. 29] | [30 .. 34] | [35 .. 39] | [40 .. ] |
+ * |:-------------|:--------:|:--------:|:----------:|:----------:|:----------:|:----------:|:----------:|:--------:|
+ * | binned score | 2        | 6        | 15         | 22         | 27         | 33         | 37         | 40       |
+ * | character    | `#`      | `'`      | `0`        | `7`        | `<`        | `B`        | `F`        | `I`      |
+ *
+ * The binning is lossy, but it is what current Illumina instruments write anyway and it hardly affects variant calling.
+ * With only eight letters, a seqan3::bitpacked_sequence of seqan3::phred_binned needs 3 bits per quality score instead
+ * of a byte. Use it as `quality_container` and `quality_alphabet` of the seqan3::sequence_file_input_traits to bin the
+ * qualities while reading:
+ *
+ * \include test/snippet/alphabet/quality/phred_binned.cpp
+ *
+ * All Phred+33 characters (`'!'` to `'~'`) are valid and are binned. This allows converting them in bulk, see
+ * seqan3::bulk_assign_char_to.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+class phred_binned : public alphabet_base<phred_binned, 8, char>
+{
+private:
+    //!\brief The base class.
+    using base_t = alphabet_base<phred_binned, 8, char>;
+
+    //!\brief Befriend seqan3::alphabet_base.
+    friend base_t;
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The integer representation of the quality score.
+    using phred_type = int8_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr phred_binned()                                 noexcept = default; //!< Defaulted.
+    constexpr phred_binned(phred_binned const &)             noexcept = default; //!< Defaulted.
+    constexpr phred_binned(phred_binned &&)                  noexcept = default; //!< Defaulted.
+    constexpr phred_binned & operator=(phred_binned const &) noexcept = default; //!< Defaulted.
+    constexpr phred_binned & operator=(phred_binned &&)      noexcept = default; //!< Defaulted.
+    ~phred_binned()                                          noexcept = default; //!< Defaulted.
+
+    //!\brief Allow explicit construction from any other quality type by binning its Phred score.
+    template <typename other_qual_type>
+    //!\cond
+        requires (!std::same_as<phred_binned, other_qual_type>) && quality_alphabet<other_qual_type>
+    //!\endcond
+    explicit constexpr phred_binned(other_qual_type const & other) noexcept
+    {
+        assign_phred(seqan3::to_phred(other));
+    }
+    //!\}
+
+    /*!\name Read functions
+     * \{
+     */
+    //!\brief Return the representative Phred score of the bin.
+    constexpr phred_type to_phred() const noexcept
+    {
+        return rank_to_phred[to_rank()];
+    }
+    //!\}
+
+    /*!\name Write functions
+     * \{
+     */
+    //!\brief Assign the bin of the given Phred score.
+    constexpr phred_binned & assign_phred(phred_type const p) noexcept
+    {
+        return assign_rank(phred_to_rank[static_cast<uint8_t>(p)]);
+    }
+    //!\}
+
+    //!\brief All Phred+33 characters, i.e. `'!'` to `'~'`, are valid.
+    static constexpr bool char_is_valid(char_type const chr) noexcept
+    {
+        return chr >= '!' && chr <= '~';
+    }
+
+    /*!\brief The representative Phred score of every bin.
+     * \details
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    static constexpr std::array<phred_type, alphabet_size> rank_to_phred{2, 6, 15, 22, 27, 33, 37, 40};
+
+private:
+    //!\brief Phred to rank conversion table; negative scores are mapped to the first bin.
+    static constexpr std::array<rank_type, 256> phred_to_rank = [] () constexpr
+    {
+        // The smallest Phred score of bins 1 to 7.
+        constexpr std::array<int, alphabet_size - 1> bin_begin{3, 10, 20, 25, 30, 35, 40};
+
+        std::array<rank_type, 256> ret{};
+        for (int phred = std::numeric_limits<phred_type>::lowest();
+             phred <= std::numeric_limits<phred_type>::max();
+             ++phred)
+        {
+            rank_type rank = 0;
+            for (int const begin : bin_begin)
+                rank += phred >= begin;
+            ret[static_cast<uint8_t>(phred)] = rank;
+        }
+        return ret;
+    }();
+
+    //!\copydoc seqan3::dna4::char_to_rank
+    static constexpr rank_type char_to_rank(char_type const chr)
+    {
+        int const phred = static_cast<int>(chr) - '!';
+        return (phred < 0) ? 0 : phred_to_rank[std::min(phred, 127)];
+    }
+
+    //!\copydoc seqan3::dna4::rank_to_char
+    static constexpr char_type rank_to_char(rank_type const rank)
+    {
+        return static_cast<char_type>(rank_to_phred[rank] + '!');
+    }
+};
+
+} // namespace seqan3
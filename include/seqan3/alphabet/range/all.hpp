@@ -18,5 +18,10 @@
 
 #pragma once
 
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/alphabet/range/bulk_hash.hpp>
+#include <seqan3/alphabet/range/bulk_quality_control.hpp>
+#include <seqan3/alphabet/range/bulk_reverse_complement.hpp>
+#include <seqan3/alphabet/range/bulk_translate.hpp>
 #include <seqan3/alphabet/range/hash.hpp>
 #include <seqan3/alphabet/range/sequence.hpp>
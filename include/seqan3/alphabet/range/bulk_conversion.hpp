@@ -0,0 +1,754 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bulk_assign_char_to, seqan3::bulk_to_char and related functions.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/bit>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <seqan3/alphabet/alphabet_base.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/exception.hpp>
+#include <seqan3/utility/detail/type_name_as_string.hpp>
+#include <seqan3/utility/simd/detail/builtin_simd_intrinsics.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief An alphabet that can be converted to and from `char` with the lookup tables of
+ *        seqan3::detail::bulk_conversion_table.
+ * \ingroup alphabet_range
+ */
+template <typename alphabet_t>
+concept bulk_char_convertible = writable_alphabet<alphabet_t> &&
+                                std::same_as<alphabet_char_t<alphabet_t>, char> &&
+                                (alphabet_size<alphabet_t> <= 256) &&
+                                std::default_initializable<alphabet_t>;
+
+//!\brief The blocks of a char table that need to be looked up, see seqan3::detail::bulk_conversion_table.
+//!\ingroup alphabet_range
+struct bulk_conversion_nibble_lookup
+{
+    //!\brief The value of all entries in blocks that are not looked up.
+    uint8_t fallback{};
+    //!\brief The number of blocks that are looked up.
+    size_t count{};
+    //!\brief The high nibble of the blocks that are looked up.
+    std::array<uint8_t, 16> high_nibble{};
+    //!\brief The entries of the blocks that are looked up, indexed by the low nibble.
+    std::array<std::array<uint8_t, 16>, 16> blocks{};
+};
+
+/*!\brief Splits a char table into the blocks that need to be looked up.
+ * \ingroup alphabet_range
+ */
+constexpr bulk_conversion_nibble_lookup make_bulk_conversion_nibble_lookup(std::array<uint8_t, 256> const & table)
+{
+    bulk_conversion_nibble_lookup lookup{};
+    lookup.fallback = table[0];
+
+    for (size_t high = 0; high < 16; ++high)
+    {
+        bool differs = false;
+        for (size_t low = 0; low < 16; ++low)
+            differs |= table[high * 16 + low] != lookup.fallback;
+
+        if (differs)
+        {
+            lookup.high_nibble[lookup.count] = high;
+            for (size_t low = 0; low < 16; ++low)
+                lookup.blocks[lookup.count][low] = table[high * 16 + low];
+            ++lookup.count;
+        }
+    }
+
+    return lookup;
+}
+
+/*!\brief The lookup tables used for the bulk conversion of an alphabet.
+ * \ingroup alphabet_range
+ * \tparam alphabet_t The alphabet; must model seqan3::detail::bulk_char_convertible.
+ *
+ * \details
+ *
+ * All tables are computed at compile time from seqan3::assign_char_to, seqan3::char_is_valid_for and
+ * seqan3::to_char. Besides the plain tables, the ways in which the conversions can be vectorised are determined:
+ *
+ *   * If the conversion is an offset with clamping (the quality alphabets), it is computed arithmetically.
+ *   * Otherwise, the 256 entries of the char tables are split by the high nibble of the character into 16 blocks
+ *     of 16 entries. Every block that does not consist of the same value as the block of `'\0'` is looked up with a
+ *     shuffle instruction. The nucleotide alphabets need four such lookups.
+ *   * The rank to char conversion is a single shuffle for alphabets with up to 16 letters.
+ */
+template <bulk_char_convertible alphabet_t>
+struct bulk_conversion_table
+{
+    //!\brief The size of the alphabet.
+    static constexpr size_t size = alphabet_size<alphabet_t>;
+
+    //!\brief Maps every character to the rank it is assigned to.
+    static constexpr std::array<uint8_t, 256> char_to_rank = [] () constexpr
+    {
+        std::array<uint8_t, 256> table{};
+        for (size_t i = 0; i < 256; ++i)
+            table[i] = seqan3::to_rank(seqan3::assign_char_to(static_cast<char>(i), alphabet_t{}));
+        return table;
+    }();
+
+    //!\brief Maps every character to `0xff` if it is valid for the alphabet and to `0x00` otherwise.
+    static constexpr std::array<uint8_t, 256> char_is_valid = [] () constexpr
+    {
+        std::array<uint8_t, 256> table{};
+        for (size_t i = 0; i < 256; ++i)
+            table[i] = seqan3::char_is_valid_for<alphabet_t>(static_cast<char>(i)) ? 0xff : 0x00;
+        return table;
+    }();
+
+    //!\brief Maps every rank to its character.
+    static constexpr std::array<char, size> rank_to_char = [] () constexpr
+    {
+        std::array<char, size> table{};
+        for (size_t rank = 0; rank < size; ++rank)
+            table[rank] = seqan3::to_char(seqan3::assign_rank_to(rank, alphabet_t{}));
+        return table;
+    }();
+
+    /*!\brief Whether an object of the alphabet consists of nothing but its rank.
+     *
+     * \details
+     *
+     * This is the case for all alphabets derived from seqan3::alphabet_base with a single byte, which can then be
+     * written to directly.
+     */
+    static constexpr bool rank_is_representation = sizeof(alphabet_t) == 1 &&
+                                                   std::is_trivially_copyable_v<alphabet_t> &&
+                                                   std::is_base_of_v<alphabet_base<alphabet_t, size, char>,
+                                                                     alphabet_t>;
+
+    //!\brief The character of the first rank.
+    static constexpr char offset = rank_to_char[0];
+
+    //!\brief Whether char_to_rank is `std::clamp(chr - offset, 0, size - 1)` for signed characters.
+    static constexpr bool char_to_rank_is_offset = [] () constexpr
+    {
+        for (size_t i = 0; i < 256; ++i)
+        {
+            int const difference = static_cast<int>(static_cast<signed char>(i)) - static_cast<int>(offset);
+            if (char_to_rank[i] != std::clamp<int>(difference, 0, static_cast<int>(size) - 1))
+                return false;
+        }
+        return true;
+    }();
+
+    //!\brief Whether exactly the characters from `offset` to `offset + size - 1` are valid.
+    static constexpr bool char_is_valid_is_offset = [] () constexpr
+    {
+        for (size_t i = 0; i < 256; ++i)
+            if ((char_is_valid[i] != 0) != (static_cast<uint8_t>(i - static_cast<uint8_t>(offset)) < size))
+                return false;
+        return true;
+    }();
+
+    //!\brief Whether rank_to_char is `rank + offset`.
+    static constexpr bool rank_to_char_is_offset = [] () constexpr
+    {
+        for (size_t rank = 0; rank < size; ++rank)
+            if (rank_to_char[rank] != static_cast<char>(offset + rank))
+                return false;
+        return true;
+    }();
+
+    //!\brief The blocks of #char_to_rank.
+    static constexpr bulk_conversion_nibble_lookup char_to_rank_lookup =
+        make_bulk_conversion_nibble_lookup(char_to_rank);
+    //!\brief The blocks of #char_is_valid.
+    static constexpr bulk_conversion_nibble_lookup char_is_valid_lookup =
+        make_bulk_conversion_nibble_lookup(char_is_valid);
+
+    //!\brief #rank_to_char padded to 16 entries for alphabets with up to 16 letters.
+    static constexpr std::array<uint8_t, 16> rank_to_char_lookup = [] () constexpr
+    {
+        std::array<uint8_t, 16> table{};
+        for (size_t rank = 0; rank < std::min<size_t>(size, 16); ++rank)
+            table[rank] = static_cast<uint8_t>(rank_to_char[rank]);
+        return table;
+    }();
+};
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+/*!\brief The vector instructions used by the bulk conversion; 256 bit with AVX2 and 128 bit with SSE4.
+ * \ingroup alphabet_range
+ */
+struct bulk_conversion_simd
+{
+#   if defined(__AVX2__)
+    //!\brief The vector type.
+    using vector_type = __m256i;
+    //!\brief The number of bytes in a vector.
+    static constexpr size_t width = 32;
+    //!\brief The movemask of a vector of which all bytes are set.
+    static constexpr uint32_t full_mask = 0xffffffff;
+
+    //!\brief Loads an unaligned vector.
+    static vector_type load(void const * memory)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(memory));
+    }
+
+    //!\brief Loads 16 bytes into the low lane and the 16 bytes at offset 48 into the high lane, see load_deinterleaved.
+    static vector_type load_parts(uint8_t const * memory)
+    {
+        return _mm256_loadu2_m128i(reinterpret_cast<__m128i const *>(memory + 48),
+                                   reinterpret_cast<__m128i const *>(memory));
+    }
+
+    //!\brief Stores an unaligned vector.
+    static void store(void * memory, vector_type const vector)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(memory), vector);
+    }
+
+    //!\brief Sets all bytes to value.
+    static vector_type fill(uint8_t const value)
+    {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    }
+
+    //!\brief Loads a 16 byte lookup table into both lanes.
+    static vector_type table(std::array<uint8_t, 16> const & lookup)
+    {
+        return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(lookup.data())));
+    }
+
+    //!\brief Looks up every byte of index (which must be smaller than 16) in the table.
+    static vector_type shuffle(vector_type const table, vector_type const index)
+    {
+        return _mm256_shuffle_epi8(table, index);
+    }
+
+    //!\brief Byte-wise `lhs == rhs`.
+    static vector_type equal(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_cmpeq_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise `mask ? rhs : lhs`.
+    static vector_type blend(vector_type const lhs, vector_type const rhs, vector_type const mask)
+    {
+        return _mm256_blendv_epi8(lhs, rhs, mask);
+    }
+
+    //!\brief Byte-wise `lhs & rhs`.
+    static vector_type bit_and(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_and_si256(lhs, rhs);
+    }
+
+    //!\brief Byte-wise `lhs | rhs`.
+    static vector_type bit_or(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_or_si256(lhs, rhs);
+    }
+
+    //!\brief The high nibble of every byte.
+    static vector_type high_nibble(vector_type const vector)
+    {
+        return bit_and(_mm256_srli_epi16(vector, 4), fill(0x0f));
+    }
+
+    //!\brief Byte-wise wrapping addition.
+    static vector_type add(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_add_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise wrapping subtraction.
+    static vector_type subtract(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_sub_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise saturating subtraction of signed bytes.
+    static vector_type subtract_signed_saturated(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_subs_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise sum of unsigned bytes, saturated at 255.
+    static vector_type add_unsigned_saturated(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_adds_epu8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise maximum of signed bytes.
+    static vector_type max_signed(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_max_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise minimum of signed bytes.
+    static vector_type min_signed(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_min_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise minimum of unsigned bytes.
+    static vector_type min_unsigned(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm256_min_epu8(lhs, rhs);
+    }
+
+    //!\brief The most significant bit of every byte.
+    static uint32_t mask(vector_type const vector)
+    {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(vector));
+    }
+
+    //!\brief Reverses the order of the bytes.
+    static vector_type reverse(vector_type const vector)
+    {
+        __m256i const reversed_lanes = _mm256_shuffle_epi8(vector,
+                                                           _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                                                            7, 6, 5, 4, 3, 2, 1, 0,
+                                                                            15, 14, 13, 12, 11, 10, 9, 8,
+                                                                            7, 6, 5, 4, 3, 2, 1, 0));
+        return _mm256_permute2x128_si256(reversed_lanes, reversed_lanes, 0x01);
+    }
+#   else // SSE4
+    //!\brief The vector type.
+    using vector_type = __m128i;
+    //!\brief The number of bytes in a vector.
+    static constexpr size_t width = 16;
+    //!\brief The movemask of a vector of which all bytes are set.
+    static constexpr uint32_t full_mask = 0xffff;
+
+    //!\brief Loads an unaligned vector.
+    static vector_type load(void const * memory)
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(memory));
+    }
+
+    //!\brief Loads 16 bytes, see load_deinterleaved.
+    static vector_type load_parts(uint8_t const * memory)
+    {
+        return load(memory);
+    }
+
+    //!\brief Stores an unaligned vector.
+    static void store(void * memory, vector_type const vector)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(memory), vector);
+    }
+
+    //!\brief Sets all bytes to value.
+    static vector_type fill(uint8_t const value)
+    {
+        return _mm_set1_epi8(static_cast<char>(value));
+    }
+
+    //!\brief Loads a 16 byte lookup table.
+    static vector_type table(std::array<uint8_t, 16> const & lookup)
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(lookup.data()));
+    }
+
+    //!\brief Looks up every byte of index (which must be smaller than 16) in the table.
+    static vector_type shuffle(vector_type const table, vector_type const index)
+    {
+        return _mm_shuffle_epi8(table, index);
+    }
+
+    //!\brief Byte-wise `lhs == rhs`.
+    static vector_type equal(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_cmpeq_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise `mask ? rhs : lhs`.
+    static vector_type blend(vector_type const lhs, vector_type const rhs, vector_type const mask)
+    {
+        return _mm_blendv_epi8(lhs, rhs, mask);
+    }
+
+    //!\brief Byte-wise `lhs & rhs`.
+    static vector_type bit_and(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_and_si128(lhs, rhs);
+    }
+
+    //!\brief Byte-wise `lhs | rhs`.
+    static vector_type bit_or(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_or_si128(lhs, rhs);
+    }
+
+    //!\brief The high nibble of every byte.
+    static vector_type high_nibble(vector_type const vector)
+    {
+        return bit_and(_mm_srli_epi16(vector, 4), fill(0x0f));
+    }
+
+    //!\brief Byte-wise wrapping addition.
+    static vector_type add(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_add_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise wrapping subtraction.
+    static vector_type subtract(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_sub_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise saturating subtraction of signed bytes.
+    static vector_type subtract_signed_saturated(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_subs_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise sum of unsigned bytes, saturated at 255.
+    static vector_type add_unsigned_saturated(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_adds_epu8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise maximum of signed bytes.
+    static vector_type max_signed(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_max_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise minimum of signed bytes.
+    static vector_type min_signed(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_min_epi8(lhs, rhs);
+    }
+
+    //!\brief Byte-wise minimum of unsigned bytes.
+    static vector_type min_unsigned(vector_type const lhs, vector_type const rhs)
+    {
+        return _mm_min_epu8(lhs, rhs);
+    }
+
+    //!\brief The most significant bit of every byte.
+    static uint32_t mask(vector_type const vector)
+    {
+        return static_cast<uint32_t>(_mm_movemask_epi8(vector));
+    }
+
+    //!\brief Reverses the order of the bytes.
+    static vector_type reverse(vector_type const vector)
+    {
+        return _mm_shuffle_epi8(vector, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+    }
+#   endif
+
+    /*!\brief The shuffle that moves byte `3 * i + stream` of 48 bytes to byte `i`, if it is in the given part of 16
+     *        bytes; all other bytes are set to 0.
+     */
+    static constexpr std::array<uint8_t, 16> deinterleave_mask(size_t const stream, size_t const part)
+    {
+        std::array<uint8_t, 16> mask{};
+        for (size_t i = 0; i < 16; ++i)
+        {
+            size_t const position = 3 * i + stream;
+            mask[i] = position / 16 == part ? static_cast<uint8_t>(position % 16) : 0x80;
+        }
+        return mask;
+    }
+
+    //!\brief Collects the bytes `3 * i + stream` of three parts of 16 bytes in every lane.
+    template <size_t stream>
+    static vector_type deinterleave(vector_type const first, vector_type const second, vector_type const third)
+    {
+        return bit_or(bit_or(shuffle(first, table(deinterleave_mask(stream, 0))),
+                             shuffle(second, table(deinterleave_mask(stream, 1)))),
+                      shuffle(third, table(deinterleave_mask(stream, 2))));
+    }
+
+    /*!\brief Loads `3 * width` bytes and splits them into the bytes at the positions `3 * i`, `3 * i + 1` and
+     *        `3 * i + 2`.
+     */
+    static void load_deinterleaved(void const * memory, vector_type & first, vector_type & second, vector_type & third)
+    {
+        // Every lane holds 48 consecutive bytes, such that the bytes can be collected with in-lane shuffles.
+        uint8_t const * bytes = static_cast<uint8_t const *>(memory);
+        vector_type const part0 = load_parts(bytes);
+        vector_type const part1 = load_parts(bytes + 16);
+        vector_type const part2 = load_parts(bytes + 32);
+
+        first = deinterleave<0>(part0, part1, part2);
+        second = deinterleave<1>(part0, part1, part2);
+        third = deinterleave<2>(part0, part1, part2);
+    }
+
+    //!\brief Looks up every byte of chars in a table split into blocks.
+    static vector_type lookup(bulk_conversion_nibble_lookup const & lookup, vector_type const chars)
+    {
+        vector_type const low = bit_and(chars, fill(0x0f));
+        vector_type const high = high_nibble(chars);
+        vector_type result = fill(lookup.fallback);
+
+        for (size_t block = 0; block < lookup.count; ++block)
+        {
+            result = blend(result,
+                           shuffle(table(lookup.blocks[block]), low),
+                           equal(high, fill(lookup.high_nibble[block])));
+        }
+
+        return result;
+    }
+
+    //!\brief Converts every byte of chars to its rank.
+    template <typename alphabet_t>
+    static vector_type char_to_rank(vector_type const chars)
+    {
+        using table_t = bulk_conversion_table<alphabet_t>;
+
+        if constexpr (table_t::char_to_rank_is_offset)
+        {
+            vector_type const difference = subtract_signed_saturated(chars, fill(table_t::offset));
+            return min_signed(max_signed(difference, fill(0)), fill(table_t::size - 1));
+        }
+        else
+        {
+            return lookup(table_t::char_to_rank_lookup, chars);
+        }
+    }
+
+    //!\brief Sets every byte of chars that is valid for the alphabet to `0xff` and all others to `0x00`.
+    template <typename alphabet_t>
+    static vector_type char_is_valid(vector_type const chars)
+    {
+        using table_t = bulk_conversion_table<alphabet_t>;
+
+        if constexpr (table_t::char_is_valid_is_offset)
+        {
+            vector_type const difference = subtract(chars, fill(table_t::offset));
+            return equal(min_unsigned(difference, fill(table_t::size - 1)), difference);
+        }
+        else
+        {
+            return lookup(table_t::char_is_valid_lookup, chars);
+        }
+    }
+
+    //!\brief Whether seqan3::detail::bulk_conversion_simd::rank_to_char can be used for the alphabet.
+    template <typename alphabet_t>
+    static constexpr bool has_rank_to_char = bulk_conversion_table<alphabet_t>::rank_to_char_is_offset ||
+                                             (bulk_conversion_table<alphabet_t>::size <= 16);
+
+    //!\brief Converts every byte of ranks to its character.
+    template <typename alphabet_t>
+    static vector_type rank_to_char(vector_type const ranks)
+    {
+        using table_t = bulk_conversion_table<alphabet_t>;
+
+        if constexpr (table_t::rank_to_char_is_offset)
+            return add(ranks, fill(table_t::offset));
+        else
+            return shuffle(table(table_t::rank_to_char_lookup), ranks);
+    }
+};
+#endif // defined(__AVX2__) || defined(__SSE4_1__)
+
+//!\brief Converts count characters to the alphabet; see seqan3::bulk_assign_char_to.
+template <bulk_char_convertible alphabet_t>
+inline void bulk_assign_char_to(char const * chars, alphabet_t * alphabets, size_t const count)
+{
+    using table_t = bulk_conversion_table<alphabet_t>;
+    size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    if constexpr (table_t::rank_is_representation)
+    {
+        using simd_t = bulk_conversion_simd;
+        for (; i + simd_t::width <= count; i += simd_t::width)
+            simd_t::store(alphabets + i, simd_t::char_to_rank<alphabet_t>(simd_t::load(chars + i)));
+    }
+#endif
+
+    for (; i < count; ++i)
+        seqan3::assign_rank_to(table_t::char_to_rank[static_cast<uint8_t>(chars[i])], alphabets[i]);
+}
+
+//!\brief Returns the position of the first character that is not valid for the alphabet or `count` if all are valid.
+template <bulk_char_convertible alphabet_t>
+inline size_t bulk_find_invalid_char(char const * chars, size_t const count)
+{
+    using table_t = bulk_conversion_table<alphabet_t>;
+    size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    using simd_t = bulk_conversion_simd;
+    for (; i + simd_t::width <= count; i += simd_t::width)
+    {
+        uint32_t const valid = simd_t::mask(simd_t::char_is_valid<alphabet_t>(simd_t::load(chars + i)));
+        if (valid != simd_t::full_mask)
+            return i + std::countr_one(valid);
+    }
+#endif
+
+    for (; i < count; ++i)
+        if (!table_t::char_is_valid[static_cast<uint8_t>(chars[i])])
+            return i;
+
+    return count;
+}
+
+//!\brief Converts count letters to characters; see seqan3::bulk_to_char.
+template <bulk_char_convertible alphabet_t>
+inline void bulk_to_char(alphabet_t const * alphabets, char * chars, size_t const count)
+{
+    using table_t = bulk_conversion_table<alphabet_t>;
+    size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    using simd_t = bulk_conversion_simd;
+    if constexpr (table_t::rank_is_representation && simd_t::has_rank_to_char<alphabet_t>)
+    {
+        for (; i + simd_t::width <= count; i += simd_t::width)
+            simd_t::store(chars + i, simd_t::rank_to_char<alphabet_t>(simd_t::load(alphabets + i)));
+    }
+#endif
+
+    for (; i < count; ++i)
+        chars[i] = table_t::rank_to_char[seqan3::to_rank(alphabets[i])];
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Assigns a contiguous range of characters to a contiguous range of letters of the same size.
+ * \ingroup alphabet_range
+ * \param[in]  chars     The characters.
+ * \param[out] alphabets The letters that are assigned to; `alphabets[i]` becomes `assign_char_to(chars[i], ...)`.
+ * \throws std::invalid_argument if the ranges differ in size.
+ *
+ * \details
+ *
+ * The result is the same as assigning every character with seqan3::assign_char_to, but the conversion is vectorised
+ * with SSE4 or AVX2 (if enabled at compile time) for the nucleotide and quality alphabets and every other alphabet
+ * derived from seqan3::alphabet_base with a single byte. All other alphabets fall back to a table lookup per letter.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/range/bulk_conversion.cpp
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::contiguous_range chars_t, std::ranges::contiguous_range alphabets_t>
+//!\cond
+    requires std::ranges::sized_range<chars_t> && std::ranges::sized_range<alphabets_t> &&
+             std::same_as<std::ranges::range_value_t<chars_t>, char> &&
+             detail::bulk_char_convertible<std::ranges::range_value_t<alphabets_t>> &&
+             std::ranges::output_range<alphabets_t, std::ranges::range_value_t<alphabets_t>>
+//!\endcond
+void bulk_assign_char_to(chars_t && chars, alphabets_t && alphabets)
+{
+    if (std::ranges::size(chars) != std::ranges::size(alphabets))
+        throw std::invalid_argument{"The characters and the letters to assign them to differ in size."};
+
+    detail::bulk_assign_char_to(std::ranges::data(chars), std::ranges::data(alphabets), std::ranges::size(chars));
+}
+
+/*!\brief Returns the position of the first character in a contiguous range that is not valid for the alphabet.
+ * \ingroup alphabet_range
+ * \tparam alphabet_t The alphabet to check the characters for.
+ * \param[in] chars   The characters.
+ * \returns The smallest `i` with `!char_is_valid_for<alphabet_t>(chars[i])` or the size of `chars` if all characters
+ *          are valid.
+ *
+ * \details
+ *
+ * Vectorised like seqan3::bulk_assign_char_to; this does not require the alphabet to be a single byte.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <detail::bulk_char_convertible alphabet_t, std::ranges::contiguous_range chars_t>
+//!\cond
+    requires std::ranges::sized_range<chars_t> && std::same_as<std::ranges::range_value_t<chars_t>, char>
+//!\endcond
+size_t bulk_find_invalid_char(chars_t && chars)
+{
+    return detail::bulk_find_invalid_char<alphabet_t>(std::ranges::data(chars), std::ranges::size(chars));
+}
+
+/*!\brief Assigns a contiguous range of characters to a contiguous range of letters of the same size and throws on
+ *        the first invalid character.
+ * \ingroup alphabet_range
+ * \param[in]  chars     The characters.
+ * \param[out] alphabets The letters that are assigned to; `alphabets[i]` becomes `assign_char_to(chars[i], ...)`.
+ * \throws std::invalid_argument if the ranges differ in size.
+ * \throws seqan3::invalid_char_assignment naming the first character that is not valid for the alphabet. The letters
+ *         are not modified in this case.
+ *
+ * \details
+ *
+ * The strict counterpart of seqan3::bulk_assign_char_to, see also seqan3::assign_char_strictly_to.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::contiguous_range chars_t, std::ranges::contiguous_range alphabets_t>
+//!\cond
+    requires std::ranges::sized_range<chars_t> && std::ranges::sized_range<alphabets_t> &&
+             std::same_as<std::ranges::range_value_t<chars_t>, char> &&
+             detail::bulk_char_convertible<std::ranges::range_value_t<alphabets_t>> &&
+             std::ranges::output_range<alphabets_t, std::ranges::range_value_t<alphabets_t>>
+//!\endcond
+void bulk_assign_char_strictly_to(chars_t && chars, alphabets_t && alphabets)
+{
+    using alphabet_t = std::ranges::range_value_t<alphabets_t>;
+
+    if (std::ranges::size(chars) != std::ranges::size(alphabets))
+        throw std::invalid_argument{"The characters and the letters to assign them to differ in size."};
+
+    if (size_t const position = bulk_find_invalid_char<alphabet_t>(chars); position != std::ranges::size(chars))
+        throw invalid_char_assignment{detail::type_name_as_string<alphabet_t>, std::ranges::data(chars)[position]};
+
+    detail::bulk_assign_char_to(std::ranges::data(chars), std::ranges::data(alphabets), std::ranges::size(chars));
+}
+
+/*!\brief Converts a contiguous range of letters to a contiguous range of characters of the same size.
+ * \ingroup alphabet_range
+ * \param[in]  alphabets The letters.
+ * \param[out] chars     The characters; `chars[i]` becomes `to_char(alphabets[i])`.
+ * \throws std::invalid_argument if the ranges differ in size.
+ *
+ * \details
+ *
+ * Vectorised like seqan3::bulk_assign_char_to for alphabets with up to 16 letters and for the quality alphabets.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::contiguous_range alphabets_t, std::ranges::contiguous_range chars_t>
+//!\cond
+    requires std::ranges::sized_range<alphabets_t> && std::ranges::sized_range<chars_t> &&
+             detail::bulk_char_convertible<std::ranges::range_value_t<alphabets_t>> &&
+             std::ranges::output_range<chars_t, char> &&
+             std::same_as<std::ranges::range_value_t<chars_t>, char>
+//!\endcond
+void bulk_to_char(alphabets_t && alphabets, chars_t && chars)
+{
+    if (std::ranges::size(chars) != std::ranges::size(alphabets))
+        throw std::invalid_argument{"The letters and the characters to convert them to differ in size."};
+
+    detail::bulk_to_char(std::ranges::data(alphabets), std::ranges::data(chars), std::ranges::size(chars));
+}
+
+} // namespace seqan3
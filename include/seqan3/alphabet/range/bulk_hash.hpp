@@ -0,0 +1,411 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_hasher, seqan3::bulk_hash and seqan3::sequence_hash.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <cstring>
+#include <seqan3/std/ranges>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/utility/detail/bit_packing.hpp>
+#include <seqan3/utility/math.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The core of seqan3::sequence_hasher: mixes blocks of four 64 bit words into four independent lanes.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * Every word is combined with the state of its lane by a 64 x 64 -> 128 bit multiplication whose halves are xor-ed
+ * (as in wyhash). The lanes do not depend on each other, such that four multiplications are in flight at a time.
+ * Finalising combines the lanes with the length and applies the avalanche step of splitmix64, once for each half of
+ * a 128 bit hash value.
+ */
+class sequence_hash_core
+{
+public:
+    //!\brief The number of words of a block.
+    static constexpr size_t block_words = 4;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_hash_core() noexcept : sequence_hash_core{0u} {} //!< Initialises with seed 0.
+    sequence_hash_core(sequence_hash_core const &) noexcept = default; //!< Defaulted.
+    sequence_hash_core(sequence_hash_core &&) noexcept = default; //!< Defaulted.
+    sequence_hash_core & operator=(sequence_hash_core const &) noexcept = default; //!< Defaulted.
+    sequence_hash_core & operator=(sequence_hash_core &&) noexcept = default; //!< Defaulted.
+    ~sequence_hash_core() noexcept = default; //!< Defaulted.
+
+    //!\brief Initialises the lanes with a seed.
+    explicit sequence_hash_core(uint64_t const seed) noexcept
+    {
+        for (size_t lane = 0; lane < block_words; ++lane)
+            lanes[lane] = mix(seed ^ keys[lane], keys[lane + block_words]);
+    }
+    //!\}
+
+    //!\brief Absorbs block_count blocks of words.
+    void absorb(uint64_t const * words, size_t const block_count) noexcept
+    {
+        for (size_t block = 0; block < block_count; ++block, words += block_words)
+            for (size_t lane = 0; lane < block_words; ++lane)
+                lanes[lane] = mix(lanes[lane] ^ words[lane], keys[lane]);
+    }
+
+    /*!\brief Returns the 128 bit hash value of the absorbed blocks followed by up to three words.
+     * \param[in] tail       The words after the last block.
+     * \param[in] tail_words The number of words after the last block; must be smaller than block_words.
+     * \param[in] length     The length of the hashed sequence, which distinguishes sequences that only differ by
+     *                       trailing zero bits.
+     */
+    std::array<uint64_t, 2> finalise(uint64_t const * tail, size_t const tail_words, uint64_t const length)
+        const noexcept
+    {
+        std::array<uint64_t, block_words> state = lanes;
+        for (size_t lane = 0; lane < tail_words; ++lane)
+            state[lane] = mix(state[lane] ^ tail[lane], keys[lane]);
+
+        uint64_t const low = mix(state[0] ^ keys[4], state[1] ^ keys[5]) ^
+                             mix(state[2] ^ keys[6], state[3] ^ keys[7] ^ length);
+        uint64_t const high = mix(state[0] ^ keys[6], state[3] ^ keys[4]) ^
+                              mix(state[1] ^ keys[7] ^ length, state[2] ^ keys[5]);
+        return {avalanche(low), avalanche(high)};
+    }
+
+private:
+    //!\brief The constants of wyhash and splitmix64.
+    static constexpr std::array<uint64_t, 8> keys{0xa076'1d64'78bd'642fULL, 0xe703'7ed1'a0b4'28dbULL,
+                                                  0x8ebc'6af0'9c88'c6e3ULL, 0x5899'65cc'7537'4cc3ULL,
+                                                  0x1d8e'4e27'c47d'124fULL, 0x9e37'79b9'7f4a'7c15ULL,
+                                                  0xbf58'476d'1ce4'e5b9ULL, 0x94d0'49bb'1331'11ebULL};
+
+    //!\brief Multiplies to 128 bit and folds the halves.
+    static uint64_t mix(uint64_t const lhs, uint64_t const rhs) noexcept
+    {
+        __uint128_t const product = static_cast<__uint128_t>(lhs) * rhs;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+    }
+
+    //!\brief The finaliser of splitmix64.
+    static uint64_t avalanche(uint64_t value) noexcept
+    {
+        value = (value ^ (value >> 30)) * keys[6];
+        value = (value ^ (value >> 27)) * keys[7];
+        return value ^ (value >> 31);
+    }
+
+    //!\brief The state of the lanes.
+    std::array<uint64_t, block_words> lanes{};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Computes 64 and 128 bit hash values of sequences incrementally.
+ * \ingroup alphabet_range
+ * \tparam alphabet_t The alphabet of the sequences.
+ *
+ * \details
+ *
+ * The hash value is computed from the ranks of the letters packed with #bits_per_letter bits each, i.e. from the
+ * words that a seqan3::bitpacked_sequence of the alphabet stores. The words are hashed four at a time with
+ * 64 x 64 -> 128 bit multiplications in independent lanes, i.e. several billion seqan3::dna4 letters per second.
+ * Unlike the `std::hash` specialisation for ranges, all letters affect all bits of the hash value.
+ *
+ * * The ranks of contiguous ranges of alphabets derived from seqan3::alphabet_base with one byte per letter (e.g.
+ *   seqan3::dna4, seqan3::aa27 and seqan3::phred42) are packed directly from memory, 2, 4 and 8 bit ranks with SSE4
+ *   or AVX2 (if enabled at compile time).
+ * * The words of a seqan3::bitpacked_sequence are hashed directly.
+ * * All other ranges are converted to ranks letter by letter.
+ *
+ * The hash value only depends on the letters and the seed: it is the same for all ranges, for any split of a
+ * sequence into multiple calls of #update, on all platforms and for all compile-time flags. It is not a
+ * cryptographic hash.
+ *
+ * Use seqan3::bulk_hash for single sequences and seqan3::sequence_hash for hash tables.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/range/bulk_hash.cpp
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <semialphabet alphabet_t>
+class sequence_hasher
+{
+public:
+    //!\brief The number of bits of a rank.
+    static constexpr size_t bits_per_letter = std::max<size_t>(detail::ceil_log2(alphabet_size<alphabet_t>), 1u);
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_hasher() noexcept = default; //!< Defaulted.
+    sequence_hasher(sequence_hasher const &) noexcept = default; //!< Defaulted.
+    sequence_hasher(sequence_hasher &&) noexcept = default; //!< Defaulted.
+    sequence_hasher & operator=(sequence_hasher const &) noexcept = default; //!< Defaulted.
+    sequence_hasher & operator=(sequence_hasher &&) noexcept = default; //!< Defaulted.
+    ~sequence_hasher() noexcept = default; //!< Defaulted.
+
+    //!\brief Constructs a hasher whose hash values depend on the seed.
+    explicit sequence_hasher(uint64_t const seed) noexcept : core{seed}
+    {}
+    //!\}
+
+    /*!\brief Appends letters to the hashed sequence.
+     * \param[in] letters The letters.
+     * \returns `*this`.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the number of letters.
+     */
+    template <std::ranges::input_range range_t>
+    //!\cond
+        requires std::same_as<std::ranges::range_value_t<range_t>, alphabet_t>
+    //!\endcond
+    sequence_hasher & update(range_t && letters)
+    {
+        if constexpr (std::same_as<std::remove_cvref_t<range_t>, bitpacked_sequence<alphabet_t>> &&
+                      bitpacked_sequence<alphabet_t>::bits_per_letter == bits_per_letter)
+        {
+            update_words(letters.words(), letters.size());
+        }
+        else if constexpr (std::ranges::contiguous_range<range_t> && std::ranges::sized_range<range_t> &&
+                           rank_is_representation)
+        {
+            update_ranks(reinterpret_cast<uint8_t const *>(std::ranges::data(letters)), std::ranges::size(letters));
+        }
+        else
+        {
+            std::array<alphabet_rank_t<alphabet_t>, chunk_size> ranks;
+            size_t count = 0;
+
+            for (auto && letter : letters)
+            {
+                ranks[count++] = seqan3::to_rank(letter);
+                if (count == chunk_size)
+                {
+                    update_ranks(ranks.data(), count);
+                    count = 0;
+                }
+            }
+
+            update_ranks(ranks.data(), count);
+        }
+
+        return *this;
+    }
+
+    //!\brief Returns the 64 bit hash value of the letters appended since construction or the last #reset.
+    uint64_t digest() const noexcept
+    {
+        return digest_128()[0];
+    }
+
+    //!\brief Returns the 128 bit hash value of the letters appended since construction or the last #reset.
+    std::array<uint64_t, 2> digest_128() const noexcept
+    {
+        constexpr size_t block_bits = detail::sequence_hash_core::block_words * 64;
+
+        detail::sequence_hash_core final_core = core;
+        final_core.absorb(buffer.data(), buffer_bits / block_bits);
+
+        size_t const tail_begin = buffer_bits / block_bits * detail::sequence_hash_core::block_words;
+        size_t const tail_words = (buffer_bits % block_bits + 63) / 64;
+        return final_core.finalise(buffer.data() + tail_begin, tail_words, letter_count);
+    }
+
+    //!\brief Returns the number of letters appended since construction or the last #reset.
+    uint64_t size() const noexcept
+    {
+        return letter_count;
+    }
+
+    //!\brief Restarts hashing with the given seed.
+    void reset(uint64_t const seed = 0u) noexcept
+    {
+        *this = sequence_hasher{seed};
+    }
+
+private:
+    //!\brief Whether an object of the alphabet consists of nothing but its rank.
+    static constexpr bool rank_is_representation = [] () constexpr
+    {
+        if constexpr (detail::bulk_char_convertible<alphabet_t>)
+            return detail::bulk_conversion_table<alphabet_t>::rank_is_representation;
+        else
+            return false;
+    }();
+
+    //!\brief The number of ranks that are converted at a time.
+    static constexpr size_t chunk_size = 256;
+
+    //!\brief The number of words that are buffered before they are hashed.
+    static constexpr size_t buffer_words = 16 * detail::sequence_hash_core::block_words;
+
+    //!\brief The hash state of the hashed blocks.
+    detail::sequence_hash_core core{};
+
+    //!\brief The packed ranks that are not yet hashed; one more word, such that a shifted word always fits.
+    std::array<uint64_t, buffer_words + 1> buffer{};
+
+    //!\brief The number of bits in buffer.
+    size_t buffer_bits{};
+
+    //!\brief The number of appended letters.
+    uint64_t letter_count{};
+
+    //!\brief Packs ranks into the buffer.
+    template <typename rank_t>
+    void update_ranks(rank_t const * ranks, size_t count) noexcept
+    {
+        while (count > 0u)
+        {
+            if (buffer_words * 64 - buffer_bits < bits_per_letter)
+                flush();
+
+            size_t const fitting = std::min(count, (buffer_words * 64 - buffer_bits) / bits_per_letter);
+            detail::pack_bits<bits_per_letter>(ranks, fitting, buffer.data(), buffer_bits);
+            ranks += fitting;
+            count -= fitting;
+            buffer_bits += fitting * bits_per_letter;
+            letter_count += fitting;
+        }
+    }
+
+    //!\brief Appends the packed ranks of count letters to the buffer.
+    void update_words(std::span<uint64_t const> const words, size_t const count) noexcept
+    {
+        size_t remaining_bits = count * bits_per_letter;
+
+        for (uint64_t word : words)
+        {
+            size_t const bits = std::min<size_t>(remaining_bits, 64u);
+            if (bits < 64u)
+                word &= (uint64_t{1} << bits) - 1u;
+            remaining_bits -= bits;
+
+            size_t const index = buffer_bits / 64;
+            size_t const offset = buffer_bits % 64;
+            if (offset == 0u)
+            {
+                buffer[index] = word;
+            }
+            else
+            {
+                buffer[index] |= word << offset;
+                if (offset + bits > 64u)
+                    buffer[index + 1] = word >> (64u - offset);
+            }
+
+            buffer_bits += bits;
+            if (buffer_bits >= buffer_words * 64)
+                flush();
+        }
+
+        letter_count += count;
+    }
+
+    //!\brief Hashes the complete blocks of the buffer and moves the remaining bits to its front.
+    void flush() noexcept
+    {
+        constexpr size_t block_words = detail::sequence_hash_core::block_words;
+
+        size_t const blocks = buffer_bits / (block_words * 64);
+        core.absorb(buffer.data(), blocks);
+
+        size_t const used_words = (buffer_bits + 63) / 64;
+        std::copy(buffer.data() + blocks * block_words, buffer.data() + used_words, buffer.data());
+        buffer_bits -= blocks * block_words * 64;
+    }
+};
+
+/*!\brief Returns the 64 bit hash value of a sequence.
+ * \ingroup alphabet_range
+ * \param[in] letters The sequence.
+ * \param[in] seed    The seed of the hash function.
+ *
+ * \details
+ *
+ * This is `seqan3::sequence_hasher<alphabet_t>{seed}.update(letters).digest()`, see seqan3::sequence_hasher.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::input_range range_t>
+//!\cond
+    requires semialphabet<std::ranges::range_reference_t<range_t>>
+//!\endcond
+uint64_t bulk_hash(range_t && letters, uint64_t const seed = 0u)
+{
+    return sequence_hasher<std::ranges::range_value_t<range_t>>{seed}.update(letters).digest();
+}
+
+/*!\brief Returns the 128 bit hash value of a sequence.
+ * \ingroup alphabet_range
+ * \param[in] letters The sequence.
+ * \param[in] seed    The seed of the hash function.
+ *
+ * \details
+ *
+ * This is `seqan3::sequence_hasher<alphabet_t>{seed}.update(letters).digest_128()`, see seqan3::sequence_hasher.
+ * The first half is the 64 bit hash value.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::input_range range_t>
+//!\cond
+    requires semialphabet<std::ranges::range_reference_t<range_t>>
+//!\endcond
+std::array<uint64_t, 2> bulk_hash_128(range_t && letters, uint64_t const seed = 0u)
+{
+    return sequence_hasher<std::ranges::range_value_t<range_t>>{seed}.update(letters).digest_128();
+}
+
+/*!\brief A hash function object for sequences, e.g. for `std::unordered_map<seqan3::dna4_vector, T,
+ *        seqan3::sequence_hash>`.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * Returns seqan3::bulk_hash with seed 0. It is transparent, such that a table of containers can be searched with any
+ * range over the same alphabet if the table supports heterogeneous lookup.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+struct sequence_hash
+{
+    //!\brief Enables heterogeneous lookup.
+    using is_transparent = void;
+
+    //!\brief Returns the 64 bit hash value of the sequence.
+    template <std::ranges::input_range range_t>
+    //!\cond
+        requires semialphabet<std::ranges::range_reference_t<range_t>>
+    //!\endcond
+    size_t operator()(range_t && letters) const
+    {
+        return bulk_hash(std::forward<range_t>(letters));
+    }
+};
+
+} // namespace seqan3
@@ -0,0 +1,600 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bulk_quality_control and the quality trimming and filtering functions it is built from.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/bit>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/quality/concept.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Whether the rank of every letter of a quality alphabet is its Phred score and a letter consists of nothing
+ *        but its rank, e.g. seqan3::phred42. A contiguous range of such letters is a range of Phred scores.
+ * \ingroup alphabet_range
+ */
+template <typename alphabet_t>
+inline constexpr bool bulk_phred_is_rank = [] () constexpr
+{
+    if constexpr (bulk_char_convertible<alphabet_t> && quality_alphabet<alphabet_t>)
+    {
+        if (!bulk_conversion_table<alphabet_t>::rank_is_representation)
+            return false;
+
+        for (size_t rank = 0; rank < alphabet_size<alphabet_t>; ++rank)
+            if (static_cast<size_t>(seqan3::to_phred(seqan3::assign_rank_to(rank, alphabet_t{}))) != rank)
+                return false;
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}();
+
+/*!\brief Returns the Phred scores of a range of quality letters as bytes.
+ * \ingroup alphabet_range
+ * \param[in]  qualities The quality letters.
+ * \param[out] buffer    Holds the Phred scores if they cannot be read from the range directly.
+ *
+ * \details
+ *
+ * If the range is contiguous and seqan3::detail::bulk_phred_is_rank holds, the range itself is returned. Otherwise,
+ * the Phred scores are written to the buffer; negative scores become 0 and scores above 255 become 255.
+ */
+template <std::ranges::forward_range qualities_t>
+std::span<uint8_t const> bulk_phred_scores(qualities_t && qualities, std::vector<uint8_t> & buffer)
+{
+    using alphabet_t = std::ranges::range_value_t<qualities_t>;
+
+    if constexpr (std::ranges::contiguous_range<qualities_t> && std::ranges::sized_range<qualities_t> &&
+                  bulk_phred_is_rank<alphabet_t>)
+    {
+        return {reinterpret_cast<uint8_t const *>(std::ranges::data(qualities)), std::ranges::size(qualities)};
+    }
+    else
+    {
+        buffer.clear();
+        for (auto && quality : qualities)
+            buffer.push_back(static_cast<uint8_t>(std::clamp<int>(seqan3::to_phred(quality), 0, 255)));
+        return buffer;
+    }
+}
+
+/*!\brief Returns the position of the first Phred score in `[begin, end)` that is smaller than threshold, or `end`.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * With SSE4 or AVX2 (if enabled at compile time), a vector of Phred scores is compared at a time.
+ */
+inline size_t bulk_find_below(uint8_t const * phred, size_t begin, size_t const end, uint8_t const threshold) noexcept
+{
+    if (threshold == 0u)
+        return end;
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    using simd_t = bulk_conversion_simd;
+    simd_t::vector_type const largest_below = simd_t::fill(threshold - 1u);
+
+    for (; begin + simd_t::width <= end; begin += simd_t::width)
+    {
+        simd_t::vector_type const scores = simd_t::load(phred + begin);
+        // A score is below the threshold if it is not changed by taking the minimum with threshold - 1.
+        uint32_t const below = simd_t::mask(simd_t::equal(simd_t::min_unsigned(scores, largest_below), scores));
+        if (below != 0u)
+            return begin + std::countr_zero(below);
+    }
+#endif
+
+    for (; begin < end; ++begin)
+        if (phred[begin] < threshold)
+            return begin;
+
+    return end;
+}
+
+/*!\brief The length of the Phred scores after trimming the 3' end with BWA's algorithm, see
+ *        seqan3::bulk_trim_length_bwa.
+ * \ingroup alphabet_range
+ */
+inline size_t bulk_trim_length_bwa(std::span<uint8_t const> const phred, int const threshold) noexcept
+{
+    size_t length = phred.size();
+    int64_t sum{};
+    int64_t max_sum{};
+
+    for (size_t i = phred.size(); i > 0u; --i)
+    {
+        sum += threshold - static_cast<int64_t>(phred[i - 1]);
+        if (sum < 0)
+            break;
+
+        if (sum > max_sum)
+        {
+            max_sum = sum;
+            length = i - 1;
+        }
+    }
+
+    return length;
+}
+
+/*!\brief The length of the Phred scores after sliding window trimming, see seqan3::bulk_trim_length_window.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * A window whose mean is below the threshold contains a score below the threshold. The scores are therefore scanned
+ * for such scores with seqan3::detail::bulk_find_below, and only the windows that contain one are summed up.
+ */
+inline size_t bulk_trim_length_window(std::span<uint8_t const> const phred,
+                                      size_t const window_size,
+                                      int const threshold) noexcept
+{
+    size_t const size = phred.size();
+
+    if (window_size == 0u || threshold <= 0 || size == 0u)
+        return size;
+
+    uint8_t const score_threshold = static_cast<uint8_t>(std::min(threshold, 255));
+    size_t const window = std::min(window_size, size);
+    uint64_t const required = static_cast<uint64_t>(threshold) * window;
+
+    // The length up to the start of the failing window plus the leading scores of the window that reach the threshold.
+    auto trimmed_length = [&] (size_t const start)
+    {
+        size_t length = start;
+        while (length < start + window && phred[length] >= score_threshold)
+            ++length;
+        return length;
+    };
+
+    size_t next_window{}; // all windows that start before are known to pass
+    uint64_t sum{};       // the sum of the scores of next_window if next_window > 0
+
+    for (size_t low = bulk_find_below(phred.data(), 0u, size, score_threshold);
+         low < size;
+         low = bulk_find_below(phred.data(), low + 1u, size, score_threshold))
+    {
+        // The windows that contain the low score.
+        size_t const first = std::max(next_window, low + 1u >= window ? low + 1u - window : size_t{});
+        size_t const last = std::min(low, size - window);
+
+        if (first > last)
+            continue;
+
+        if (first != next_window || first == 0u)
+        {
+            sum = 0u;
+            for (size_t i = first; i < first + window; ++i)
+                sum += phred[i];
+        }
+
+        for (size_t start = first; ; ++start)
+        {
+            if (sum < required)
+                return trimmed_length(start);
+
+            if (start + window < size)
+                sum = sum + phred[start + window] - phred[start];
+
+            if (start == last)
+                break;
+        }
+
+        next_window = last + 1u;
+    }
+
+    return size;
+}
+
+/*!\brief The probability of a base call error for every Phred score, i.e. `10^(-score / 10)`.
+ * \ingroup alphabet_range
+ */
+inline constexpr std::array<double, 256> bulk_error_probability = [] () constexpr
+{
+    // 10^(-i / 10) for i in [0, 10).
+    constexpr std::array<double, 10> decade{1.0, 0.7943282347242815, 0.6309573444801932, 0.5011872336272722,
+                                            0.3981071705534972, 0.31622776601683794, 0.25118864315095796,
+                                            0.19952623149688797, 0.15848931924611134, 0.12589254117941673};
+
+    std::array<double, 256> table{};
+    double power = 1.0;
+    for (size_t score = 0; score < table.size(); ++score)
+    {
+        if (score > 0u && score % 10u == 0u)
+            power /= 10.0;
+        table[score] = decade[score % 10u] * power;
+    }
+    return table;
+}();
+
+/*!\brief The expected number of errors of the Phred scores, see seqan3::bulk_expected_errors.
+ * \ingroup alphabet_range
+ */
+inline double bulk_expected_errors(std::span<uint8_t const> const phred) noexcept
+{
+    // Independent sums, such that the lookups are not serialised by the additions.
+    std::array<double, 4> sums{};
+
+    size_t i = 0;
+    for (; i + 4u <= phred.size(); i += 4u)
+        for (size_t j = 0; j < 4u; ++j)
+            sums[j] += bulk_error_probability[phred[i + j]];
+
+    for (; i < phred.size(); ++i)
+        sums[0] += bulk_error_probability[phred[i]];
+
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+/*!\brief The 2 bit code of every letter of a nucleotide alphabet: 0, 1, 2 and 3 for A, C, G and T/U, and 4 for all
+ *        other letters.
+ * \ingroup alphabet_range
+ */
+template <nucleotide_alphabet alphabet_t>
+inline constexpr std::array<uint8_t, alphabet_size<alphabet_t>> bulk_dust_code = [] () constexpr
+{
+    std::array<uint8_t, alphabet_size<alphabet_t>> codes{};
+
+    for (size_t rank = 0; rank < alphabet_size<alphabet_t>; ++rank)
+    {
+        switch (seqan3::to_char(seqan3::assign_rank_to(rank, alphabet_t{})))
+        {
+            case 'A': case 'a': codes[rank] = 0; break;
+            case 'C': case 'c': codes[rank] = 1; break;
+            case 'G': case 'g': codes[rank] = 2; break;
+            case 'T': case 't': case 'U': case 'u': codes[rank] = 3; break;
+            default: codes[rank] = 4;
+        }
+    }
+
+    return codes;
+}();
+
+/*!\brief A nucleotide alphabet that has the letter `N`, which low-complexity regions are masked with.
+ * \ingroup alphabet_range
+ */
+template <typename alphabet_t>
+concept bulk_maskable = nucleotide_alphabet<alphabet_t> && writable_alphabet<alphabet_t> &&
+                        std::default_initializable<alphabet_t> && char_is_valid_for<alphabet_t>('N');
+
+/*!\brief Masks the low-complexity regions of count letters, see seqan3::bulk_mask_low_complexity.
+ * \ingroup alphabet_range
+ * \param[in,out] letters   The nucleotides.
+ * \param[in]     count     The number of nucleotides.
+ * \param[in]     window    The size of the windows.
+ * \param[in]     threshold The largest score of a window that is not masked.
+ * \param[in,out] triplets  Buffer for the triplet codes.
+ * \returns The number of masked letters.
+ */
+template <std::random_access_iterator iterator_t>
+size_t bulk_mask_low_complexity(iterator_t letters,
+                                size_t const count,
+                                size_t const window_size,
+                                double const threshold,
+                                std::vector<uint8_t> & triplets)
+{
+    using alphabet_t = std::iter_value_t<iterator_t>;
+    constexpr uint8_t invalid = 64;
+
+    if (count < 3u || window_size < 3u)
+        return 0u;
+
+    // The triplet starting at every position, `invalid` if it contains an ambiguous letter.
+    triplets.resize(count - 2u);
+    uint8_t code = 0;
+    uint8_t unambiguous = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t const letter = bulk_dust_code<alphabet_t>[seqan3::to_rank(letters[i])];
+        code = ((code << 2) | (letter & 3u)) & 63u;
+        unambiguous = letter > 3u ? 0u : std::min<uint8_t>(unambiguous + 1u, 3u);
+        if (i >= 2u)
+            triplets[i - 2u] = unambiguous == 3u ? code : invalid;
+    }
+
+    // The score of a window is the number of pairs of equal triplets divided by the number of triplets minus 1.
+    std::array<uint32_t, 64> occurrences{};
+    uint64_t pairs{};
+    size_t valid{};
+
+    auto add = [&] (uint8_t const triplet)
+    {
+        if (triplet != invalid)
+        {
+            pairs += occurrences[triplet]++;
+            ++valid;
+        }
+    };
+
+    auto remove = [&] (uint8_t const triplet)
+    {
+        if (triplet != invalid)
+        {
+            pairs -= --occurrences[triplet];
+            --valid;
+        }
+    };
+
+    size_t const window = std::min(window_size, count);
+    for (size_t i = 0; i + 2u < window; ++i)
+        add(triplets[i]);
+
+    alphabet_t const masked_letter = seqan3::assign_char_to('N', alphabet_t{});
+    size_t masked_end{};
+    size_t masked{};
+
+    for (size_t start = 0; ; ++start)
+    {
+        if (valid > 1u && static_cast<double>(pairs) > threshold * static_cast<double>(valid - 1u))
+        {
+            for (size_t i = std::max(start, masked_end); i < start + window; ++i)
+                letters[i] = masked_letter;
+            masked += start + window - std::max(start, masked_end);
+            masked_end = start + window;
+        }
+
+        if (start + window == count)
+            break;
+
+        remove(triplets[start]);
+        add(triplets[start + window - 2u]);
+    }
+
+    return masked;
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Returns the length of a read after trimming its 3' end with BWA's algorithm.
+ * \ingroup alphabet_range
+ * \param[in] qualities The quality letters of the read.
+ * \param[in] threshold The Phred score that the trimmed end should reach on average.
+ *
+ * \details
+ *
+ * Starting at the 3' end, the differences `threshold - score` are summed up until the sum becomes negative. The read
+ * is cut where the sum is largest, i.e. the trimmed end is the longest suffix whose mean is lowest relative to the
+ * threshold. This is `bwa aln -q` and `cutadapt -q`. Unlike seqan3::views::trim_quality, single low scores within
+ * a high quality end do not cut the read.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::forward_range qualities_t>
+//!\cond
+    requires quality_alphabet<std::ranges::range_reference_t<qualities_t>>
+//!\endcond
+size_t bulk_trim_length_bwa(qualities_t && qualities, int const threshold)
+{
+    std::vector<uint8_t> buffer{};
+    return detail::bulk_trim_length_bwa(detail::bulk_phred_scores(qualities, buffer), threshold);
+}
+
+/*!\brief Returns the length of a read after sliding window trimming.
+ * \ingroup alphabet_range
+ * \param[in] qualities   The quality letters of the read.
+ * \param[in] window_size The number of scores whose mean is compared with the threshold.
+ * \param[in] threshold   The smallest mean Phred score of a window that is kept.
+ *
+ * \details
+ *
+ * The windows are checked from the 5' end. The read is cut in the first window whose mean Phred score is below the
+ * threshold, after the leading scores of that window that reach the threshold. This is Trimmomatic's
+ * `SLIDINGWINDOW`. A read that is shorter than the window is a single window. A window size or threshold of 0
+ * disables the trimming.
+ *
+ * Only the windows around scores below the threshold are summed up; these scores are searched with SSE4 or AVX2 (if
+ * enabled at compile time), such that high quality reads are scanned a vector at a time.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::forward_range qualities_t>
+//!\cond
+    requires quality_alphabet<std::ranges::range_reference_t<qualities_t>>
+//!\endcond
+size_t bulk_trim_length_window(qualities_t && qualities, size_t const window_size, int const threshold)
+{
+    std::vector<uint8_t> buffer{};
+    return detail::bulk_trim_length_window(detail::bulk_phred_scores(qualities, buffer), window_size, threshold);
+}
+
+/*!\brief Returns the expected number of base call errors of a read.
+ * \ingroup alphabet_range
+ * \param[in] qualities The quality letters of the read.
+ *
+ * \details
+ *
+ * The expected number of errors is the sum of the error probabilities `10^(-score / 10)` of all bases. Filtering by
+ * it (e.g. `vsearch --fastq_maxee`) accounts for all low scores of a read instead of a single threshold. Negative
+ * scores (seqan3::phred68solexa) count as probability 1.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::forward_range qualities_t>
+//!\cond
+    requires quality_alphabet<std::ranges::range_reference_t<qualities_t>>
+//!\endcond
+double bulk_expected_errors(qualities_t && qualities)
+{
+    std::vector<uint8_t> buffer{};
+    return detail::bulk_expected_errors(detail::bulk_phred_scores(qualities, buffer));
+}
+
+/*!\brief Replaces the low-complexity regions of a nucleotide sequence by `N`.
+ * \ingroup alphabet_range
+ * \param[in,out] sequence    The nucleotides; the alphabet must have the letter `N`, e.g. seqan3::dna5.
+ * \param[in]     window_size The size of the windows that are scored.
+ * \param[in]     threshold   The largest score of a window that is not masked.
+ * \returns The number of masked letters.
+ *
+ * \details
+ *
+ * Every window is scored with the DUST score: the number of pairs of equal triplets divided by the number of
+ * triplets minus 1. Triplets with ambiguous letters are not counted. A homopolymer scores about half the window
+ * size, a random sequence less than 1. All windows that score above the threshold are masked. The defaults of
+ * `sdust`, a window size of 64 and a threshold of 20, mask repeats of up to about four letters. A sequence that is
+ * shorter than the window is a single window. The windows are scored incrementally in linear time.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::random_access_range sequence_t>
+//!\cond
+    requires std::ranges::sized_range<sequence_t> &&
+             detail::bulk_maskable<std::ranges::range_value_t<sequence_t>> &&
+             std::assignable_from<std::ranges::range_reference_t<sequence_t> &,
+                                  std::ranges::range_value_t<sequence_t> const &>
+//!\endcond
+size_t bulk_mask_low_complexity(sequence_t && sequence, size_t const window_size = 64, double const threshold = 20)
+{
+    std::vector<uint8_t> triplets{};
+    return detail::bulk_mask_low_complexity(std::ranges::begin(sequence), std::ranges::size(sequence),
+                                            window_size, threshold, triplets);
+}
+
+/*!\brief The steps of seqan3::bulk_quality_control; all are disabled by default.
+ * \ingroup alphabet_range
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+struct quality_control_options
+{
+    //!\brief The threshold of seqan3::bulk_trim_length_bwa; 0 disables the trimming.
+    int bwa_threshold{0};
+    //!\brief The window size of seqan3::bulk_trim_length_window; 0 disables the trimming.
+    size_t window_size{0};
+    //!\brief The threshold of seqan3::bulk_trim_length_window; 0 disables the trimming.
+    int window_threshold{0};
+    //!\brief The window size of seqan3::bulk_mask_low_complexity.
+    size_t dust_window_size{64};
+    //!\brief The threshold of seqan3::bulk_mask_low_complexity; 0 disables the masking.
+    double dust_threshold{0};
+    //!\brief The minimum length of a passing read after trimming.
+    size_t min_length{0};
+    //!\brief The maximum seqan3::bulk_expected_errors of a passing read after trimming.
+    double max_expected_errors{std::numeric_limits<double>::infinity()};
+};
+
+/*!\brief The outcome of seqan3::bulk_quality_control for a single read.
+ * \ingroup alphabet_range
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+struct quality_control_result
+{
+    //!\brief The length of the read after trimming.
+    size_t length{};
+    //!\brief The expected number of errors of the trimmed read.
+    double expected_errors{};
+    //!\brief The number of letters replaced by `N`.
+    size_t masked{};
+    //!\brief Whether the read passes the filters.
+    bool passed{};
+
+    //!\brief Two results are equal if all members are equal.
+    constexpr bool operator==(quality_control_result const &) const noexcept = default;
+};
+
+/*!\brief Trims, masks and filters a batch of reads in place.
+ * \ingroup alphabet_range
+ * \param[in,out] records A range of records, e.g. seqan3::sequence_record, whose members `sequence()` and
+ *                        `base_qualities()` return resizable containers of nucleotides and qualities.
+ * \param[in]     options The steps to apply.
+ * \returns The seqan3::quality_control_result of every record.
+ * \throws std::invalid_argument if a sequence and its qualities differ in size or if masking is enabled for an
+ *                               alphabet without `N`.
+ *
+ * \details
+ *
+ * For every read:
+ *
+ *   1. The read is cut at the smaller of the lengths after seqan3::bulk_trim_length_bwa and
+ *      seqan3::bulk_trim_length_window, both computed for the untrimmed read. The sequence and the qualities are
+ *      resized.
+ *   2. The low-complexity regions of the trimmed sequence are masked with seqan3::bulk_mask_low_complexity.
+ *   3. The read passes if it is at least seqan3::quality_control_options::min_length long and its
+ *      seqan3::bulk_expected_errors do not exceed seqan3::quality_control_options::max_expected_errors.
+ *
+ * The reads that do not pass are not removed, such that the results can be matched with the records. The Phred
+ * scores are read directly from contiguous containers of seqan3::phred42, seqan3::phred63 and seqan3::phred94 and
+ * converted once per read otherwise. Batches are independent and can be processed in parallel.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/range/bulk_quality_control.cpp
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::forward_range records_t>
+std::vector<quality_control_result> bulk_quality_control(records_t && records, quality_control_options const & options)
+{
+    std::vector<quality_control_result> results{};
+    std::vector<uint8_t> phred_buffer{};
+    std::vector<uint8_t> triplet_buffer{};
+
+    for (auto && record : records)
+    {
+        auto && sequence = record.sequence();
+        auto && qualities = record.base_qualities();
+        using alphabet_t = std::ranges::range_value_t<decltype(sequence)>;
+
+        if (std::ranges::size(sequence) != std::ranges::size(qualities))
+            throw std::invalid_argument{"The sequence and the qualities of a read differ in size."};
+
+        std::span<uint8_t const> phred = detail::bulk_phred_scores(qualities, phred_buffer);
+        quality_control_result & result = results.emplace_back();
+
+        result.length = phred.size();
+        if (options.bwa_threshold > 0)
+            result.length = std::min(result.length, detail::bulk_trim_length_bwa(phred, options.bwa_threshold));
+        result.length = std::min(result.length,
+                                 detail::bulk_trim_length_window(phred, options.window_size, options.window_threshold));
+
+        result.expected_errors = detail::bulk_expected_errors(phred.first(result.length));
+        result.passed = result.length >= options.min_length && result.expected_errors <= options.max_expected_errors;
+
+        sequence.resize(result.length);
+        qualities.resize(result.length);
+
+        if (options.dust_threshold > 0)
+        {
+            if constexpr (detail::bulk_maskable<alphabet_t>)
+            {
+                result.masked = detail::bulk_mask_low_complexity(std::ranges::begin(sequence), result.length,
+                                                                 options.dust_window_size, options.dust_threshold,
+                                                                 triplet_buffer);
+            }
+            else
+            {
+                throw std::invalid_argument{"Low-complexity regions can only be masked in alphabets that have N."};
+            }
+        }
+    }
+
+    return results;
+}
+
+} // namespace seqan3
@@ -0,0 +1,274 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bulk_reverse_complement.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A nucleotide alphabet that can be reverse complemented with seqan3::bulk_reverse_complement.
+ * \ingroup alphabet_range
+ */
+template <typename alphabet_t>
+concept bulk_complementable = nucleotide_alphabet<alphabet_t> && bulk_char_convertible<alphabet_t>;
+
+/*!\brief The complement of every rank of an alphabet, computed at compile time.
+ * \ingroup alphabet_range
+ */
+template <bulk_complementable alphabet_t>
+struct bulk_complement_table
+{
+    //!\brief The size of the alphabet.
+    static constexpr size_t size = alphabet_size<alphabet_t>;
+
+    //!\brief The rank of the complement of every rank.
+    static constexpr std::array<uint8_t, size> complement_rank = [] () constexpr
+    {
+        std::array<uint8_t, size> table{};
+        for (size_t rank = 0; rank < size; ++rank)
+            table[rank] = static_cast<uint8_t>(seqan3::to_rank(seqan3::complement(seqan3::assign_rank_to(rank,
+                                                                                                         alphabet_t{}))));
+        return table;
+    }();
+
+    //!\brief complement_rank padded to 16 entries, the complement can then be taken with a single byte shuffle.
+    static constexpr std::array<uint8_t, 16> complement_lookup = [] () constexpr
+    {
+        std::array<uint8_t, 16> table{};
+        for (size_t rank = 0; rank < std::min<size_t>(size, 16); ++rank)
+            table[rank] = complement_rank[rank];
+        return table;
+    }();
+
+    //!\brief Whether the letters can be complemented as bytes with complement_lookup.
+    static constexpr bool vectorisable = bulk_conversion_table<alphabet_t>::rank_is_representation && size <= 16;
+
+    //!\brief Whether the complement of rank `r` is `size - 1 - r`, i.e. all bits are flipped for seqan3::dna4.
+    static constexpr bool complement_is_inversion = [] () constexpr
+    {
+        for (size_t rank = 0; rank < size; ++rank)
+            if (complement_rank[rank] != size - 1 - rank)
+                return false;
+        return true;
+    }();
+};
+
+//!\brief Returns the complement of the letter by table lookup.
+template <bulk_complementable alphabet_t>
+alphabet_t bulk_complement(alphabet_t const letter) noexcept
+{
+    return seqan3::assign_rank_to(bulk_complement_table<alphabet_t>::complement_rank[seqan3::to_rank(letter)],
+                                  alphabet_t{});
+}
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+//!\brief Reverse complements a vector of letters.
+template <bulk_complementable alphabet_t>
+bulk_conversion_simd::vector_type bulk_reverse_complement(bulk_conversion_simd::vector_type const letters)
+{
+    using simd_t = bulk_conversion_simd;
+    return simd_t::reverse(simd_t::shuffle(simd_t::table(bulk_complement_table<alphabet_t>::complement_lookup),
+                                           letters));
+}
+#endif
+
+//!\brief Reverse complements count letters in place.
+template <bulk_complementable alphabet_t>
+void bulk_reverse_complement(alphabet_t * letters, size_t const count)
+{
+    alphabet_t * front = letters;
+    alphabet_t * back = letters + count; // one past the last letter that is not yet processed
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    if constexpr (bulk_complement_table<alphabet_t>::vectorisable)
+    {
+        using simd_t = bulk_conversion_simd;
+        for (; back - front >= static_cast<ptrdiff_t>(2 * simd_t::width); front += simd_t::width, back -= simd_t::width)
+        {
+            simd_t::vector_type const front_letters = simd_t::load(front);
+            simd_t::vector_type const back_letters = simd_t::load(back - simd_t::width);
+            simd_t::store(front, bulk_reverse_complement<alphabet_t>(back_letters));
+            simd_t::store(back - simd_t::width, bulk_reverse_complement<alphabet_t>(front_letters));
+        }
+    }
+#endif
+
+    for (; back - front >= 2; ++front)
+    {
+        --back;
+        alphabet_t const front_letter = *front;
+        *front = bulk_complement(*back);
+        *back = bulk_complement(front_letter);
+    }
+
+    if (front != back) // the middle letter
+        *front = bulk_complement(*front);
+}
+
+//!\brief Writes the reverse complement of count letters to output.
+template <bulk_complementable alphabet_t>
+void bulk_reverse_complement_copy(alphabet_t const * input, size_t const count, alphabet_t * output)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    if constexpr (bulk_complement_table<alphabet_t>::vectorisable)
+    {
+        using simd_t = bulk_conversion_simd;
+        for (; i + simd_t::width <= count; i += simd_t::width)
+            simd_t::store(output + i, bulk_reverse_complement<alphabet_t>(simd_t::load(input + count - i -
+                                                                                       simd_t::width)));
+    }
+#endif
+
+    for (; i < count; ++i)
+        output[i] = bulk_complement(input[count - 1 - i]);
+}
+
+/*!\brief Reverse complements a bit vector of 2 bit letters in place, where the complement flips both bits.
+ * \ingroup alphabet_range
+ * \param[in,out] words The words that hold the letters, see seqan3::bitpacked_sequence::words().
+ * \param[in]     count The number of letters.
+ *
+ * \details
+ *
+ * The letters within each word are reversed and complemented with a few bit operations, then the order of the words
+ * is reversed and the letters are shifted down by the unused bits of the last word.
+ */
+inline void bulk_reverse_complement_2bit(uint64_t * words, size_t const count)
+{
+    size_t const word_count = (2 * count + 63) / 64;
+
+    for (size_t i = 0; i < word_count; ++i)
+    {
+        uint64_t word = words[i];
+        word = ((word >> 2) & 0x3333'3333'3333'3333ULL) | ((word & 0x3333'3333'3333'3333ULL) << 2);
+        word = ((word >> 4) & 0x0f0f'0f0f'0f0f'0f0fULL) | ((word & 0x0f0f'0f0f'0f0f'0f0fULL) << 4);
+        word = ((word >> 8) & 0x00ff'00ff'00ff'00ffULL) | ((word & 0x00ff'00ff'00ff'00ffULL) << 8);
+        word = ((word >> 16) & 0x0000'ffff'0000'ffffULL) | ((word & 0x0000'ffff'0000'ffffULL) << 16);
+        word = (word >> 32) | (word << 32);
+        words[i] = ~word;
+    }
+
+    std::reverse(words, words + word_count);
+
+    // The unused bits of the last word are now at the bottom of the first word.
+    size_t const shift = (64 - 2 * count % 64) % 64;
+    if (shift != 0)
+    {
+        for (size_t i = 0; i + 1 < word_count; ++i)
+            words[i] = (words[i] >> shift) | (words[i + 1] << (64 - shift));
+        words[word_count - 1] >>= shift;
+    }
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Replaces a contiguous range of nucleotides by its reverse complement.
+ * \ingroup alphabet_range
+ * \param[in,out] sequence The nucleotides.
+ *
+ * \details
+ *
+ * The result is the same as `std::ranges::copy(sequence | views::complement | std::views::reverse, ...)` into a new
+ * container, but the reverse complement is computed in place and without going through views. For alphabets with up
+ * to 16 letters that are derived from seqan3::alphabet_base (e.g. seqan3::dna4, seqan3::dna5, seqan3::rna15), both
+ * ends are processed a vector at a time with SSE4 or AVX2 (if enabled at compile time): the complement is a byte
+ * shuffle with a lookup table, followed by a byte reversal.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/range/bulk_reverse_complement.cpp
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::contiguous_range sequence_t>
+//!\cond
+    requires std::ranges::sized_range<sequence_t> &&
+             detail::bulk_complementable<std::ranges::range_value_t<sequence_t>> &&
+             std::ranges::output_range<sequence_t, std::ranges::range_value_t<sequence_t>>
+//!\endcond
+void bulk_reverse_complement(sequence_t && sequence)
+{
+    detail::bulk_reverse_complement(std::ranges::data(sequence), std::ranges::size(sequence));
+}
+
+/*!\brief Writes the reverse complement of a contiguous range of nucleotides to a contiguous range of the same size.
+ * \ingroup alphabet_range
+ * \param[in]  input  The nucleotides.
+ * \param[out] output The reverse complement; must not overlap with input.
+ * \throws std::invalid_argument if the ranges differ in size.
+ *
+ * \details
+ *
+ * Vectorised like the in-place seqan3::bulk_reverse_complement.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <std::ranges::contiguous_range input_t, std::ranges::contiguous_range output_t>
+//!\cond
+    requires std::ranges::sized_range<input_t> && std::ranges::sized_range<output_t> &&
+             detail::bulk_complementable<std::ranges::range_value_t<input_t>> &&
+             std::same_as<std::ranges::range_value_t<input_t>, std::ranges::range_value_t<output_t>> &&
+             std::ranges::output_range<output_t, std::ranges::range_value_t<output_t>>
+//!\endcond
+void bulk_reverse_complement(input_t && input, output_t && output)
+{
+    if (std::ranges::size(input) != std::ranges::size(output))
+        throw std::invalid_argument{"The nucleotides and the range for their reverse complement differ in size."};
+
+    detail::bulk_reverse_complement_copy(std::ranges::data(input), std::ranges::size(input), std::ranges::data(output));
+}
+
+/*!\brief Replaces a seqan3::bitpacked_sequence of nucleotides by its reverse complement.
+ * \ingroup alphabet_range
+ * \param[in,out] sequence The nucleotides.
+ *
+ * \details
+ *
+ * For 2 bit alphabets whose complement flips both bits (seqan3::dna4 and seqan3::rna4), the reverse complement is
+ * computed on the packed words, i.e. 32 letters at a time. All other alphabets are unpacked in bulk, reverse
+ * complemented and packed again.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <detail::bulk_complementable alphabet_t>
+void bulk_reverse_complement(bitpacked_sequence<alphabet_t> & sequence)
+{
+    if constexpr (bitpacked_sequence<alphabet_t>::bits_per_letter == 2 &&
+                  alphabet_size<alphabet_t> == 4 &&
+                  detail::bulk_complement_table<alphabet_t>::complement_is_inversion)
+    {
+        detail::bulk_reverse_complement_2bit(sequence.raw_data().data(), sequence.size());
+    }
+    else
+    {
+        std::vector<alphabet_t> letters(sequence.size());
+        sequence.extract(0, letters);
+        bulk_reverse_complement(letters);
+        sequence.assign(letters);
+    }
+}
+
+} // namespace seqan3
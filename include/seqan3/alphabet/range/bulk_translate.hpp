@@ -0,0 +1,387 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bulk_translate.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/aminoacid/translation.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/alphabet/views/translate.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A nucleotide alphabet that can be translated with seqan3::bulk_translate, i.e. one with at most 16 letters.
+ * \ingroup alphabet_range
+ */
+template <typename alphabet_t>
+concept bulk_translatable = nucleotide_alphabet<alphabet_t> && writable_semialphabet<alphabet_t> &&
+                            (alphabet_size<alphabet_t> <= 16);
+
+/*!\brief A container that seqan3::bulk_translate can write a frame to, e.g. seqan3::aa27_vector.
+ * \ingroup alphabet_range
+ */
+template <typename container_t>
+concept bulk_translation_container = std::ranges::contiguous_range<container_t> &&
+                                     std::ranges::sized_range<container_t> &&
+                                     std::same_as<std::ranges::range_value_t<container_t>, aa27> &&
+                                     requires (container_t & container, size_t const size) { container.resize(size); };
+
+/*!\brief The amino acid of every codon in both directions, computed at compile time.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * The codon of the ranks `r1`, `r2` and `r3` has the index `(r1 * size + r2) * size + r3`, i.e. the six bit number
+ * `r1 r2 r3` for 4 letter alphabets.
+ */
+template <genetic_code gc, bulk_translatable alphabet_t>
+struct bulk_translation_table
+{
+    //!\brief The size of the alphabet.
+    static constexpr size_t size = alphabet_size<alphabet_t>;
+
+    //!\brief The number of codons.
+    static constexpr size_t codon_count = size * size * size;
+
+    //!\brief The amino acid of every codon.
+    static constexpr std::array<aa27, codon_count> forward = [] () constexpr
+    {
+        std::array<aa27, codon_count> table{};
+        for (size_t codon = 0; codon < codon_count; ++codon)
+            table[codon] = translate_triplet<gc>(assign_rank_to(codon / size / size, alphabet_t{}),
+                                                 assign_rank_to(codon / size % size, alphabet_t{}),
+                                                 assign_rank_to(codon % size, alphabet_t{}));
+        return table;
+    }();
+
+    //!\brief The amino acid of the reverse complement of every codon.
+    static constexpr std::array<aa27, codon_count> reverse = [] () constexpr
+    {
+        std::array<aa27, codon_count> table{};
+        for (size_t codon = 0; codon < codon_count; ++codon)
+            table[codon] = translate_triplet<gc>(complement(assign_rank_to(codon % size, alphabet_t{})),
+                                                 complement(assign_rank_to(codon / size % size, alphabet_t{})),
+                                                 complement(assign_rank_to(codon / size / size, alphabet_t{})));
+        return table;
+    }();
+
+    //!\brief Whether the codon index fits into a byte and the letters are their ranks, see
+    //!       seqan3::detail::bulk_conversion_table::rank_is_representation.
+    static constexpr bool vectorisable = codon_count <= 256 &&
+                                         bulk_conversion_table<alphabet_t>::rank_is_representation &&
+                                         bulk_conversion_table<aa27>::rank_is_representation;
+
+    //!\brief The number of 16 byte blocks that hold a table.
+    static constexpr size_t block_count = (codon_count + 15) / 16;
+
+    //!\brief Splits a table into 16 byte blocks, which are looked up with a byte shuffle.
+    static constexpr auto blocks(std::array<aa27, codon_count> const & table)
+    {
+        std::array<std::array<uint8_t, 16>, block_count> bytes{};
+        for (size_t codon = 0; codon < codon_count; ++codon)
+            bytes[codon / 16][codon % 16] = static_cast<uint8_t>(table[codon].to_rank());
+        return bytes;
+    }
+
+    //!\brief seqan3::detail::bulk_translation_table::forward split into blocks.
+    static constexpr std::array<std::array<uint8_t, 16>, block_count> forward_blocks = blocks(forward);
+
+    //!\brief seqan3::detail::bulk_translation_table::reverse split into blocks.
+    static constexpr std::array<std::array<uint8_t, 16>, block_count> reverse_blocks = blocks(reverse);
+};
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+//!\brief Multiplies every byte by a constant with additions.
+template <size_t factor>
+bulk_conversion_simd::vector_type bulk_multiply(bulk_conversion_simd::vector_type const vector)
+{
+    using simd_t = bulk_conversion_simd;
+
+    if constexpr (factor == 1)
+        return vector;
+    else if constexpr (factor % 2 == 0)
+    {
+        simd_t::vector_type const half = bulk_multiply<factor / 2>(vector);
+        return simd_t::add(half, half);
+    }
+    else
+        return simd_t::add(bulk_multiply<factor - 1>(vector), vector);
+}
+
+/*!\brief Translates the frames with SSE4 or AVX2, see seqan3::detail::bulk_translate_frames.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * The nucleotides are split into the three streams of the positions `3 * k`, `3 * k + 1` and `3 * k + 2` a chunk at a
+ * time. The codons of every frame are then a vector of consecutive bytes of the streams and are translated with byte
+ * shuffles of the table; the reverse frames are reversed vectors.
+ */
+template <genetic_code gc, bulk_translatable alphabet_t>
+void bulk_translate_frames_simd(alphabet_t const * nucleotides,
+                                size_t const count,
+                                std::array<aa27 *, 3> const & forward,
+                                std::array<size_t, 3> const & forward_length,
+                                std::array<aa27 *, 3> const & reverse,
+                                std::array<size_t, 3> const & reverse_length)
+{
+    using simd_t = bulk_conversion_simd;
+    using table_t = bulk_translation_table<gc, alphabet_t>;
+    constexpr size_t size = table_t::size;
+    constexpr size_t width = simd_t::width;
+    constexpr size_t chunk_size = 16 * width; // The number of codons of a frame per chunk.
+
+    simd_t::vector_type forward_blocks[table_t::block_count];
+    simd_t::vector_type reverse_blocks[table_t::block_count];
+    for (size_t block = 0; block < table_t::block_count; ++block)
+    {
+        forward_blocks[block] = simd_t::table(table_t::forward_blocks[block]);
+        reverse_blocks[block] = simd_t::table(table_t::reverse_blocks[block]);
+    }
+
+    auto translate = [] (simd_t::vector_type const (& blocks)[table_t::block_count], simd_t::vector_type const codons)
+    {
+        simd_t::vector_type letters = simd_t::fill(0);
+        for (size_t block = 0; block < table_t::block_count; ++block)
+        {
+            // Codons outside of the block get the most significant bit set, for which the shuffle returns 0.
+            simd_t::vector_type const offset = simd_t::subtract(codons, simd_t::fill(16 * block));
+            simd_t::vector_type const index = simd_t::add_unsigned_saturated(offset, simd_t::fill(0x70));
+            letters = simd_t::bit_or(letters, simd_t::shuffle(blocks[block], index));
+        }
+        return letters;
+    };
+
+    // The streams hold one codon more than the chunk, the frames 1 and 2 end in the next chunk.
+    std::array<std::array<uint8_t, chunk_size + width>, 3> streams;
+    std::array<alphabet_t, 3 * width> tail;
+    aa27 buffer[width];
+
+    for (size_t begin = 0; begin < count / 3; begin += chunk_size)
+    {
+        size_t const chunk_length = std::min(chunk_size, count / 3 - begin);
+        size_t const stream_length = (chunk_length + width - 1) / width * width + 1;
+
+        for (size_t k = 0; k < stream_length; k += width)
+        {
+            alphabet_t const * input = nucleotides + 3 * (begin + k);
+
+            if (3 * (begin + k + width) > count) // The end of the nucleotides is padded with rank 0.
+            {
+                std::ranges::fill(tail, alphabet_t{});
+                std::copy(nucleotides + std::min(3 * (begin + k), count), nucleotides + count, tail.data());
+                input = tail.data();
+            }
+
+            simd_t::vector_type first, second, third;
+            simd_t::load_deinterleaved(input, first, second, third);
+            simd_t::store(streams[0].data() + k, first);
+            simd_t::store(streams[1].data() + k, second);
+            simd_t::store(streams[2].data() + k, third);
+        }
+
+        for (size_t offset = 0; offset < 3; ++offset)
+        {
+            if (forward[offset] == nullptr && reverse[offset] == nullptr)
+                continue;
+
+            // The codon of frame 0 is streams 0, 1, 2, of frame 1 streams 1, 2 and 0 of the next codon etc.
+            std::array<uint8_t const *, 3> codon_streams{};
+            for (size_t i = 0; i < 3; ++i)
+                codon_streams[i] = streams[(offset + i) % 3].data() + (offset + i) / 3;
+
+            for (size_t j = 0; j < chunk_length; j += width)
+            {
+                simd_t::vector_type const first = bulk_multiply<size * size>(simd_t::load(codon_streams[0] + j));
+                simd_t::vector_type const second = bulk_multiply<size>(simd_t::load(codon_streams[1] + j));
+                simd_t::vector_type const codons = simd_t::add(simd_t::add(first, second),
+                                                               simd_t::load(codon_streams[2] + j));
+                size_t const codon = begin + j;
+
+                if (forward[offset] != nullptr && codon < forward_length[offset])
+                {
+                    size_t const remaining = forward_length[offset] - codon;
+                    simd_t::vector_type const letters = translate(forward_blocks, codons);
+
+                    if (remaining >= width)
+                    {
+                        simd_t::store(forward[offset] + codon, letters);
+                    }
+                    else
+                    {
+                        simd_t::store(buffer, letters);
+                        std::copy_n(buffer, remaining, forward[offset] + codon);
+                    }
+                }
+
+                if (reverse[offset] != nullptr && codon < reverse_length[offset])
+                {
+                    size_t const remaining = reverse_length[offset] - codon;
+                    simd_t::vector_type const letters = simd_t::reverse(translate(reverse_blocks, codons));
+
+                    if (remaining >= width)
+                    {
+                        simd_t::store(reverse[offset] + remaining - width, letters);
+                    }
+                    else
+                    {
+                        simd_t::store(buffer, letters);
+                        std::copy_n(buffer + width - remaining, remaining, reverse[offset]);
+                    }
+                }
+            }
+        }
+    }
+}
+#endif
+
+/*!\brief Translates the selected frames of count nucleotides in one pass.
+ * \ingroup alphabet_range
+ * \param[in]  nucleotides The nucleotides.
+ * \param[in]  count       The number of nucleotides.
+ * \param[out] frames      The output of forward frame 0, 1, 2 and reverse frame 0, 1, 2, `nullptr` if not selected;
+ *                         each must hold `(count - frame) / 3` amino acids.
+ *
+ * \details
+ *
+ * Forward frame `f` translates the codons at the positions `3 * k + f`. Reverse frame `f` translates the reverse
+ * complement of the codons at the positions `count - 3 - f - 3 * j`, which are the codons at `3 * k + (count - f) % 3`
+ * in reverse order. The frames are therefore handled by the offset of their codons, the reverse frames with a
+ * table of the reverse complement.
+ */
+template <genetic_code gc, bulk_translatable alphabet_t>
+void bulk_translate_frames(alphabet_t const * nucleotides, size_t const count, std::array<aa27 *, 6> const & frames)
+{
+    using table_t = bulk_translation_table<gc, alphabet_t>;
+    constexpr size_t size = table_t::size;
+
+    if (count < 3)
+        return;
+
+    std::array<aa27 *, 3> forward{};
+    std::array<size_t, 3> forward_length{};
+    std::array<aa27 *, 3> reverse{};
+    std::array<size_t, 3> reverse_length{};
+    for (size_t frame = 0; frame < 3; ++frame)
+    {
+        forward[frame] = frames[frame];
+        forward_length[frame] = (count - frame) / 3;
+        reverse[(count - frame) % 3] = frames[3 + frame];
+        reverse_length[(count - frame) % 3] = (count - frame) / 3;
+    }
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    if constexpr (table_t::vectorisable)
+    {
+        bulk_translate_frames_simd<gc>(nucleotides, count, forward, forward_length, reverse, reverse_length);
+        return;
+    }
+#endif
+
+    auto codon = [nucleotides] (size_t const position)
+    {
+        return (to_rank(nucleotides[position]) * size + to_rank(nucleotides[position + 1])) * size +
+               to_rank(nucleotides[position + 2]);
+    };
+
+    for (size_t offset = 0; offset < 3; ++offset)
+    {
+        if (aa27 * const output = forward[offset]; output != nullptr)
+            for (size_t k = 0; k < forward_length[offset]; ++k)
+                output[k] = table_t::forward[codon(3 * k + offset)];
+
+        if (aa27 * const output = reverse[offset]; output != nullptr)
+            for (size_t k = 0; k < reverse_length[offset]; ++k)
+                output[reverse_length[offset] - 1 - k] = table_t::reverse[codon(3 * k + offset)];
+    }
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Translates a contiguous range of nucleotides into the selected frames, all in one pass.
+ * \ingroup alphabet_range
+ * \tparam gc                The genetic code, see seqan3::genetic_code.
+ * \param[in]  nucleotides   The nucleotides.
+ * \param[in]  frames        The frames, see seqan3::translation_frames.
+ * \param[out] translations  A container of amino acid sequences, e.g. `std::vector<seqan3::aa27_vector>`.
+ *
+ * \details
+ *
+ * The result is the same as `nucleotides | views::translate(frames)` copied into translations: it is resized to the
+ * number of selected frames, in the same order as the view (forward frame 0, 1, 2, reverse frame 0, 1, 2), and every
+ * amino acid sequence is resized to the length of its frame. Calling this repeatedly with the same translations
+ * reuses their memory.
+ *
+ * The codons are translated with a flat lookup table of all codons (which has 64 entries for seqan3::dna4); the
+ * reverse frames use a second table of the translated reverse complement of every codon instead of complementing the
+ * nucleotides. For alphabets with up to 6 letters that are derived from seqan3::alphabet_base (e.g. seqan3::dna4,
+ * seqan3::dna5, seqan3::rna4), the nucleotides are split into the first, second and third codon positions a vector at
+ * a time with SSE4 or AVX2 (if enabled at compile time), such that a vector of codons of any frame is translated with
+ * a few byte shuffles.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/range/bulk_translate.cpp
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+template <genetic_code gc = genetic_code::canonical,
+          std::ranges::contiguous_range nucleotides_t,
+          typename translations_t>
+//!\cond
+    requires std::ranges::sized_range<nucleotides_t> &&
+             detail::bulk_translatable<std::ranges::range_value_t<nucleotides_t>> &&
+             std::ranges::random_access_range<translations_t> &&
+             detail::bulk_translation_container<std::ranges::range_value_t<translations_t>> &&
+             requires (translations_t & translations, size_t const size) { translations.resize(size); }
+//!\endcond
+void bulk_translate(nucleotides_t && nucleotides, translation_frames const frames, translations_t & translations)
+{
+    constexpr std::array<translation_frames, 6> all_frames{translation_frames::forward_frame0,
+                                                           translation_frames::forward_frame1,
+                                                           translation_frames::forward_frame2,
+                                                           translation_frames::reverse_frame0,
+                                                           translation_frames::reverse_frame1,
+                                                           translation_frames::reverse_frame2};
+
+    size_t const count = std::ranges::size(nucleotides);
+
+    size_t selected = 0;
+    for (translation_frames const frame : all_frames)
+        selected += (frames & frame) == frame;
+    translations.resize(selected);
+
+    std::array<aa27 *, 6> outputs{};
+    auto translation = std::ranges::begin(translations);
+    for (size_t frame = 0; frame < 6; ++frame)
+    {
+        if ((frames & all_frames[frame]) != all_frames[frame])
+            continue;
+
+        size_t const offset = frame % 3;
+        translation->resize(count < offset ? 0 : (count - offset) / 3);
+        outputs[frame] = std::ranges::data(*translation);
+        ++translation;
+    }
+
+    detail::bulk_translate_frames<gc>(std::ranges::data(nucleotides), count, outputs);
+}
+
+} // namespace seqan3
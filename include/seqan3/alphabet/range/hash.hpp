@@ -24,6 +24,9 @@ namespace std
  * \tparam urng_t The type of the range; Must model std::ranges::input_range and the reference type of the range of the
  *                range must model seqan3::semialphabet.
  * \details
+ * The hash value is the number whose digits in base seqan3::alphabet_size are the ranks of the letters, i.e. it is
+ * unique for short sequences, but only the last letters of long sequences determine it. Use seqan3::sequence_hash for
+ * hash tables of sequences.
  * \experimentalapi{Experimental since version 3.1.}
  */
 template <ranges::input_range urng_t>
@@ -26,7 +26,7 @@
 
 #include <seqan3/contrib/parallel/buffer_queue.hpp>
 #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
-#include <seqan3/utility/parallel/detail/reader_writer_manager.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
 
 #if !defined(SEQAN3_HAS_ZLIB) && !defined(SEQAN3_HEADER_TEST)
 #   error "This file cannot be used when building without GZip-support."
@@ -136,153 +136,158 @@ private:
     };
 
     // string of recyclable jobs
-    size_t                        numThreads;
-    size_t                        numJobs;
-    std::vector<DecompressionJob> jobs;
-    TJobQueue                     runningQueue;
-    TJobQueue                     todoQueue;
-    detail::reader_writer_manager runningQueueManager;  // synchronises reader, writer with running queue.
-    detail::reader_writer_manager todoQueueManager;    // synchronises reader, writer with todo queue.
-    int                           currentJobId;
-
-    struct DecompressionThread
+    bgzf_thread_options                       threadOptions;
+    size_t                                    numThreads;
+    size_t                                    numJobs;
+    std::vector<DecompressionJob>             jobs;
+    std::unique_ptr<TJobQueue>                runningQueue;
+    std::unique_ptr<detail::bgzf_task_group>  taskGroup;  // runs the decompression tasks; created on first read
+    bool                                      stopping;   // set on destruction, pending tasks skip reading
+    int                                       currentJobId;
+
+    // Reads the next block from the underlying stream and decompresses it into the given job.
+    // Every task pushes its job into the running queue exactly once, even at the end of the file or on error.
+    struct DecompressionTask
     {
-        basic_bgzf_istreambuf                        *streamBuf;
-        CompressionContext<detail::bgzf_compression> compressionCtx;
+        basic_bgzf_istreambuf *streamBuf;
+        int                   jobId;
 
         void operator()()
         {
-            // Active reader to consume from todo queue.
-            auto reader_raii = streamBuf->todoQueueManager.register_reader();
-            // Active writer to produce work for the decompression queue.
-            auto writer_raii = streamBuf->runningQueueManager.register_writer();
+            DecompressionJob &job = streamBuf->jobs[jobId];
+            size_t tailLen = 0;
 
-            // wait for a new job to become available
-            while (true)
+            // typically the idle queue contains only ready jobs
+            // however, if seek() fast forwards running jobs into the todo tasks
+            // the caller defers the task of waiting to the decompression tasks
+            if (!job.ready)
             {
+                std::unique_lock<std::mutex> lock(job.cs);
+                job.readyEvent.wait(lock, [&job]{return job.ready;});
+                assert(job.ready == true);
+            }
 
-                int jobId = -1;
-                if (streamBuf->todoQueue.wait_pop(jobId) == queue_op_status::closed)
-                    return;
+            {
+                std::lock_guard<std::mutex> scopedLock(streamBuf->serializer.lock);
 
-                DecompressionJob &job = streamBuf->jobs[jobId];
-                size_t tailLen = 0;
+                job.bgzfEofMarker = false;
 
-                // typically the idle queue contains only ready jobs
-                // however, if seek() fast forwards running jobs into the todoQueue
-                // the caller defers the task of waiting to the decompression threads
-                if (!job.ready)
-                {
-                    std::unique_lock<std::mutex> lock(job.cs);
-                    job.readyEvent.wait(lock, [&job]{return job.ready;});
-                    assert(job.ready == true);
-                }
+                // remember start offset (for tellg later)
+                job.fileOfs = streamBuf->serializer.fileOfs;
+                job.size = -1;
+                job.compressedSize = 0;
 
+                // only load if not at EOF, not after an error and not during destruction
+                if (job.fileOfs != -1 && streamBuf->serializer.error == NULL && !streamBuf->stopping)
                 {
-                    std::lock_guard<std::mutex> scopedLock(streamBuf->serializer.lock);
+                    // read header
+                    streamBuf->serializer.istream.read(
+                        (char_type*)&job.inputBuffer[0],
+                        DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH);
+
+                    if (!streamBuf->serializer.istream.good())
+                    {
+                        streamBuf->serializer.fileOfs = -1;
+                        if (streamBuf->serializer.istream.eof())
+                            goto eofSkip;
+                        streamBuf->serializer.error = new io_error("Stream read error.");
+                        goto eofSkip;
+                    }
+
+                    // check header
+                    if (!detail::bgzf_compression::validate_header(std::span{job.inputBuffer}))
+                    {
+                        streamBuf->serializer.fileOfs = -1;
+                        streamBuf->serializer.error = new io_error("Invalid BGZF block header.");
+                        goto eofSkip;
+                    }
 
-                    job.bgzfEofMarker = false;
-                    if (streamBuf->serializer.error != NULL)
-                        return;
+                    // extract length of compressed data
+                    tailLen = _bgzfUnpack16(&job.inputBuffer[0] + 16) +
+                              1u - DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH;
 
-                    // remember start offset (for tellg later)
-                    job.fileOfs = streamBuf->serializer.fileOfs;
-                    job.size = -1;
-                    job.compressedSize = 0;
+                    // read compressed data and tail
+                    streamBuf->serializer.istream.read(
+                        (char_type*)&job.inputBuffer[0] + DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH,
+                        tailLen);
 
-                    // only load if not at EOF
-                    if (job.fileOfs != -1)
+                    // Check if end-of-file marker is set
+                    if (memcmp(reinterpret_cast<uint8_t const *>(&job.inputBuffer[0]),
+                               reinterpret_cast<uint8_t const *>(&BGZF_END_OF_FILE_MARKER[0]),
+                               28) == 0)
                     {
-                        // read header
-                        streamBuf->serializer.istream.read(
-                            (char_type*)&job.inputBuffer[0],
-                            DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH);
-
-                        if (!streamBuf->serializer.istream.good())
-                        {
-                            streamBuf->serializer.fileOfs = -1;
-                            if (streamBuf->serializer.istream.eof())
-                                goto eofSkip;
-                            streamBuf->serializer.error = new io_error("Stream read error.");
-                            return;
-                        }
-
-                        // check header
-                        if (!detail::bgzf_compression::validate_header(std::span{job.inputBuffer}))
-                        {
-                            streamBuf->serializer.fileOfs = -1;
-                            streamBuf->serializer.error = new io_error("Invalid BGZF block header.");
-                            return;
-                        }
-
-                        // extract length of compressed data
-                        tailLen = _bgzfUnpack16(&job.inputBuffer[0] + 16) +
-                                  1u - DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH;
-
-                        // read compressed data and tail
-                        streamBuf->serializer.istream.read(
-                            (char_type*)&job.inputBuffer[0] + DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH,
-                            tailLen);
-
-                        // Check if end-of-file marker is set
-                        if (memcmp(reinterpret_cast<uint8_t const *>(&job.inputBuffer[0]),
-                                   reinterpret_cast<uint8_t const *>(&BGZF_END_OF_FILE_MARKER[0]),
-                                   28) == 0)
-                        {
-                            job.bgzfEofMarker = true;
-                        }
-
-                        if (!streamBuf->serializer.istream.good())
-                        {
-                            streamBuf->serializer.fileOfs = -1;
-                            if (streamBuf->serializer.istream.eof())
-                                goto eofSkip;
-                            streamBuf->serializer.error = new io_error("Stream read error.");
-                            return;
-                        }
-
-                        job.compressedSize = DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH + tailLen;
-                        streamBuf->serializer.fileOfs += job.compressedSize;
-                        job.ready = false;
-
-                    eofSkip:
-                        streamBuf->serializer.istream.clear(
-                            streamBuf->serializer.istream.rdstate() & ~std::ios_base::failbit);
+                        job.bgzfEofMarker = true;
                     }
 
-                    if (streamBuf->runningQueue.try_push(jobId) != queue_op_status::success)
+                    if (!streamBuf->serializer.istream.good())
                     {
-                        // signal that job is ready
-                        {
-                            std::unique_lock<std::mutex> lock(job.cs);
-                            job.ready = true;
-                        }
-                        job.readyEvent.notify_all();
-                        return;  // Terminate this thread.
+                        streamBuf->serializer.fileOfs = -1;
+                        if (streamBuf->serializer.istream.eof())
+                            goto eofSkip;
+                        streamBuf->serializer.error = new io_error("Stream read error.");
+                        goto eofSkip;
                     }
+
+                    job.compressedSize = DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH + tailLen;
+                    streamBuf->serializer.fileOfs += job.compressedSize;
+                    job.ready = false;
+
+                eofSkip:
+                    streamBuf->serializer.istream.clear(
+                        streamBuf->serializer.istream.rdstate() & ~std::ios_base::failbit);
                 }
 
-                if (!job.ready)
-                {
-                    // decompress block
-                    job.size = _decompressBlock(
-                        &job.buffer[0] + MAX_PUTBACK, job.buffer.capacity(),
-                        &job.inputBuffer[0], job.compressedSize, compressionCtx);
+                // the running queue can hold all jobs, hence this never fails
+                [[maybe_unused]] queue_op_status status = streamBuf->runningQueue->try_push(jobId);
+                assert(status == queue_op_status::success);
+            }
 
-                    // signal that job is ready
-                    {
-                        std::unique_lock<std::mutex> lock(job.cs);
-                        job.ready = true;
-                    }
-                    job.readyEvent.notify_all();
+            if (!job.ready)
+            {
+                // decompress block
+                CompressionContext<detail::bgzf_compression> compressionCtx{};
+                job.size = _decompressBlock(
+                    &job.buffer[0] + MAX_PUTBACK, job.buffer.capacity(),
+                    &job.inputBuffer[0], job.compressedSize, compressionCtx);
+
+                // signal that job is ready
+                {
+                    std::unique_lock<std::mutex> lock(job.cs);
+                    job.ready = true;
                 }
+                job.readyEvent.notify_all();
             }
         }
     };
 
-    std::vector<std::thread> pool;  // pool of worker threads
     TBuffer                  putbackBuffer;
 
+    // Sets up the jobs and schedules the first decompression tasks. Called on the first read or seek.
+    void start()
+    {
+        if (taskGroup)
+            return;
+
+        numThreads = (threadOptions.max_concurrency != 0) ? threadOptions.max_concurrency : numThreads;
+        numJobs = (threadOptions.queue_depth != 0) ? threadOptions.queue_depth : numJobs;
+        numJobs = std::max<size_t>(numJobs, 2);
+
+        jobs.resize(numJobs);
+        runningQueue = std::make_unique<TJobQueue>(numJobs);
+        taskGroup = std::make_unique<detail::bgzf_task_group>(threadOptions.pool ? threadOptions.pool
+                                                                                  : bgzf_thread_pool::global(),
+                                                              numThreads);
+
+        for (size_t i = 0; i < numJobs; ++i)
+            scheduleJob(i);
+    }
+
+    // Hands the job over to the decompression tasks.
+    void scheduleJob(int jobId)
+    {
+        taskGroup->submit(DecompressionTask{this, jobId});
+    }
+
 public:
 
     basic_bgzf_istreambuf(istream_reference istream_,
@@ -291,41 +296,36 @@ public:
         serializer(istream_),
         numThreads(numThreads),
         numJobs(numThreads * jobsPerThread),
-        runningQueue(numJobs),
-        todoQueue(numJobs),
-        runningQueueManager(detail::reader_count{1}, detail::writer_count{numThreads}, runningQueue),
-        todoQueueManager(detail::reader_count{numThreads}, detail::writer_count{1}, todoQueue),
+        stopping(false),
         putbackBuffer(MAX_PUTBACK)
     {
-        jobs.resize(numJobs);
         currentJobId = -1;
+    }
 
-        // Prepare todo queue.
-        for (size_t i = 0; i < numJobs; ++i)
+    ~basic_bgzf_istreambuf()
+    {
         {
-            [[maybe_unused]] queue_op_status status = todoQueue.try_push(i);
-            assert(status == queue_op_status::success);
+            std::lock_guard<std::mutex> scopedLock(serializer.lock);
+            stopping = true;
         }
 
-        // Start off the threads.
-        for (size_t i = 0; i < numThreads; ++i)
-            pool.emplace_back(DecompressionThread{this, CompressionContext<detail::bgzf_compression>{}});
+        // Wait for all tasks to finish their active work.
+        taskGroup.reset();
     }
 
-    ~basic_bgzf_istreambuf()
+    /*!\brief Selects the thread pool and the concurrency limits.
+     * \param options The options to apply; members with a value of 0 keep the values given on construction.
+     * \returns `true` if the options were applied, `false` if reading has already started.
+     */
+    bool set_thread_options(bgzf_thread_options const & options)
     {
-        // Signal todoQueue that no more work is coming and close todo queue.
-        todoQueueManager.writer_arrive();
+        if (taskGroup)
+            return false;
 
-        // Wait for threads to finish there active work.
-        for (auto & t : pool)
-        {
-            if (t.joinable())
-                t.join();
-        }
-
-        // Signal running queue that reader is done.
-        runningQueueManager.reader_arrive();
+        threadOptions = options;
+        if (threadOptions.max_concurrency != 0 && threadOptions.queue_depth == 0)
+            threadOptions.queue_depth = threadOptions.max_concurrency * 8;
+        return true;
     }
 
     int_type underflow()
@@ -345,23 +345,24 @@ public:
                 this->gptr(),
                 &putbackBuffer[0]);
 
+        start();
+
         if (currentJobId >= 0)
-            todoQueue.wait_push(currentJobId);
-            // appendValue(todoQueue, currentJobId);
+            scheduleJob(currentJobId);
 
         while (true)
         {
-            if (runningQueue.wait_pop(currentJobId) == queue_op_status::closed)
+            runningQueue->wait_pop(currentJobId);
+
+            DecompressionJob &job = jobs[currentJobId];
+
+            if (job.size == -1 && serializer.error != NULL) // reading the block failed
             {
+                scheduleJob(currentJobId);
                 currentJobId = -1;
-                assert(serializer.error != NULL);
-                if (serializer.error != NULL)
-                    throw *serializer.error;
-                return EOF;
+                throw *serializer.error;
             }
 
-            DecompressionJob &job = jobs[currentJobId];
-
             // restore putback buffer
             this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
             if (putback != 0)
@@ -400,6 +401,8 @@ public:
     {
         if ((openMode & (std::ios_base::in | std::ios_base::out)) == std::ios_base::in)
         {
+            start();
+
             if (dir == std::ios_base::cur && ofs >= 0)
             {
                 // forward delta seek
@@ -453,30 +456,30 @@ public:
                     // find our seek target
 
                     if (currentJobId >= 0)
-                        todoQueue.wait_push(currentJobId);
+                        scheduleJob(currentJobId);
 
                     // Note that if we are here the current job does not represent the sought block.
                     // Hence if the running queue is empty we need to explicitly unset the jobId,
                     // otherwise we would not update the serializers istream pointer to the correct position.
-                    if (runningQueue.is_empty())
+                    if (runningQueue->is_empty())
                         currentJobId = -1;
 
                     // empty is thread-safe in serializer.lock
-                    while (!runningQueue.is_empty())
+                    while (!runningQueue->is_empty())
                     {
-                        runningQueue.wait_pop(currentJobId);
+                        runningQueue->wait_pop(currentJobId);
 
                         if (jobs[currentJobId].fileOfs == (off_type)destFileOfs)
                             break;
 
                         // push back useless job
-                        todoQueue.wait_push(currentJobId);
+                        scheduleJob(currentJobId);
                         currentJobId = -1;
                     }
 
                     if (currentJobId == -1)
                     {
-                        assert(runningQueue.is_empty());
+                        assert(runningQueue->is_empty());
                         serializer.istream.clear(serializer.istream.rdstate() & ~std::ios_base::eofbit);
                         if (serializer.istream.rdbuf()->pubseekpos(destFileOfs, std::ios_base::in) == destFileOfs)
                             serializer.fileOfs = destFileOfs;
@@ -488,7 +491,7 @@ public:
                 // if our block wasn't in the running queue yet, it should now
                 // be the first that falls out after modifying serializer.fileOfs
                 if (currentJobId == -1)
-                    runningQueue.wait_pop(currentJobId);
+                    runningQueue->wait_pop(currentJobId);
                 else if (currentJobId == -2)
                     currentJobId = -1;
 
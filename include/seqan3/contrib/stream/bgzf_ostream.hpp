@@ -23,6 +23,7 @@
 #include <seqan3/contrib/parallel/serialised_resource_pool.hpp>
 #include <seqan3/contrib/parallel/suspendable_queue.hpp>
 #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
 
 #if !defined(SEQAN3_HAS_ZLIB) && !defined(SEQAN3_HEADER_TEST)
 #   error "This file cannot be used when building without GZip-support."
@@ -63,19 +64,6 @@ public:
     typedef typename traits_type::pos_type    pos_type;
     typedef typename traits_type::off_type    off_type;
 
-    struct ScopedLock
-    {
-        ScopedLock(std::function<void()> complete_fn) : completion(std::move(complete_fn))
-        {}
-
-        ~ScopedLock()
-        {
-            completion();
-        }
-
-        std::function<void()> completion;
-    };
-
     // One compressed block.
     struct OutputBuffer
     {
@@ -115,85 +103,54 @@ public:
     };
 
     // string of recycable jobs
-    size_t                                 numThreads;
-    size_t                                 numJobs;
-    std::vector<CompressionJob>            jobs;
-    job_queue_type                         jobQueue;
-    job_queue_type                         idleQueue;
-    Serializer<OutputBuffer, BufferWriter> serializer;
-    size_t                                 currentJobId;
-    bool                                   currentJobAvail;
-
-    struct CompressionThread
+    bgzf_thread_options                      threadOptions;
+    size_t                                   numThreads;
+    size_t                                   numJobs;
+    std::vector<CompressionJob>              jobs;
+    job_queue_type                           idleQueue;
+    Serializer<OutputBuffer, BufferWriter>   serializer;
+    size_t                                   currentJobId;
+    bool                                     currentJobAvail;
+    std::unique_ptr<detail::bgzf_task_group> taskGroup;  // runs the compression tasks; created on first write
+
+    // Compresses one job and hands the compressed block to the serializer, which writes blocks in order.
+    struct CompressionTask
     {
-        basic_bgzf_ostreambuf                        *streamBuf;
-        CompressionContext<detail::bgzf_compression> compressionCtx;
+        basic_bgzf_ostreambuf *streamBuf;
+        size_t                jobId;
 
         void operator()()
         {
-            ScopedLock readLock{[this] () mutable { unlockReading(this->streamBuf->jobQueue); }};
-            // ScopedReadLock<TJobQueue> readLock(streamBuf->jobQueue);
-            ScopedLock writeLock{[this] () mutable { unlockWriting(this->streamBuf->idleQueue); }};
-            // ScopedWriteLock{obQueue> writeLock{str}amBuf->idleQueue);
-
-            // wait for a new job to become available
-            bool success = true;
-            while (success)
-            {
-                size_t jobId = -1;
-                if (!popFront(jobId, streamBuf->jobQueue))
-                    return;
-
-                CompressionJob &job = streamBuf->jobs[jobId];
-
-                // compress block with zlib
-                job.outputBuffer->size = _compressBlock(
-                    job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
-                    &job.buffer[0], job.size, compressionCtx);
-
-                success = releaseValue(streamBuf->serializer, job.outputBuffer);
-                appendValue(streamBuf->idleQueue, jobId);
-            }
+            CompressionJob &job = streamBuf->jobs[jobId];
+            CompressionContext<detail::bgzf_compression> compressionCtx{};
+
+            // compress block with zlib
+            job.outputBuffer->size = _compressBlock(
+                job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
+                &job.buffer[0], job.size, compressionCtx);
+
+            releaseValue(streamBuf->serializer, job.outputBuffer);
+            appendValue(streamBuf->idleQueue, jobId);
         }
     };
 
-    // array of worker threads
-    // using TFuture = decltype(std::async(CompressionThread{nullptr, CompressionContext<BgzfFile>{}, static_cast<size_t>(0)}));
-    std::vector<std::thread>  pool;
-
     basic_bgzf_ostreambuf(ostream_reference ostream_,
                          size_t numThreads = bgzf_thread_count,
                          size_t jobsPerThread = 8) :
         numThreads(numThreads),
-        numJobs(numThreads * jobsPerThread),
-        jobQueue(numJobs),
+        numJobs(std::max<size_t>(numThreads * jobsPerThread, 2)),
+        jobs(1),
         idleQueue(numJobs),
-        serializer(ostream_, numThreads * jobsPerThread)
+        serializer(ostream_, numJobs),
+        currentJobId(0),
+        currentJobAvail(true)
     {
-        jobs.resize(numJobs);
-        currentJobId = 0;
-
-        lockWriting(jobQueue);
+        // Until the first block is full, only a single job is needed; the other jobs are created in start().
+        lockWriting(idleQueue);
         lockReading(idleQueue);
-        setReaderWriterCount(jobQueue, numThreads, 1);
-        setReaderWriterCount(idleQueue, 1, numThreads);
-
-        // Prepare idle queue.
-        for (size_t i = 0; i < numJobs; ++i)
-        {
-            [[maybe_unused]] bool success = appendValue(idleQueue, i);
-            assert(success);
-        }
-
-        // Start off threads.
-        for (size_t i = 0; i < numThreads; ++i)
-            pool.emplace_back(CompressionThread{this, CompressionContext<detail::bgzf_compression>{}});
-
-        currentJobAvail = popFront(currentJobId, idleQueue);
-        assert(currentJobAvail);
+        setReaderWriterCount(idleQueue, 1, 1);
 
         CompressionJob &job = jobs[currentJobId];
-        job.outputBuffer = aquireValue(serializer);
         this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
     }
 
@@ -202,33 +159,69 @@ public:
         // the buffer is now (after addFooter()) and flush will append the empty EOF marker
         flush(true);
 
-        unlockWriting(jobQueue);
+        // Wait for the compression tasks to finish their active work.
+        taskGroup.reset();
 
-        // Wait for threads to finish there active work.
-        for (auto & t : pool)
+        unlockWriting(idleQueue);
+        unlockReading(idleQueue);
+    }
+
+    /*!\brief Selects the thread pool and the concurrency limits.
+     * \param options The options to apply; members with a value of 0 keep the values given on construction.
+     * \returns `true` if the options were applied, `false` if compression has already started.
+     */
+    bool set_thread_options(bgzf_thread_options const & options)
+    {
+        if (taskGroup)
+            return false;
+
+        threadOptions = options;
+        if (threadOptions.max_concurrency != 0 && threadOptions.queue_depth == 0)
+            threadOptions.queue_depth = threadOptions.max_concurrency * 8;
+        return true;
+    }
+
+    // Sets up the remaining jobs and the task group. Called when the first block is handed over for compression.
+    void start()
+    {
+        if (taskGroup)
+            return;
+
+        numThreads = (threadOptions.max_concurrency != 0) ? threadOptions.max_concurrency : numThreads;
+        // the idle queue and the serializer were sized on construction, hence the depth can only be reduced
+        if (threadOptions.queue_depth != 0)
+            numJobs = std::clamp<size_t>(threadOptions.queue_depth, 2, numJobs);
+
+        jobs.resize(numJobs);
+        taskGroup = std::make_unique<detail::bgzf_task_group>(threadOptions.pool ? threadOptions.pool
+                                                                                  : bgzf_thread_pool::global(),
+                                                              numThreads);
+
+        // Prepare idle queue; job 0 is the current job.
+        for (size_t i = 1; i < numJobs; ++i)
         {
-            if (t.joinable())
-                t.join();
+            [[maybe_unused]] bool success = appendValue(idleQueue, i);
+            assert(success);
         }
-
-        unlockReading(idleQueue);
     }
 
     bool compressBuffer(size_t size)
     {
+        start();
+
         // submit current job
         if (currentJobAvail)
         {
-            jobs[currentJobId].size = size;
-            appendValue(jobQueue, currentJobId);
+            CompressionJob &job = jobs[currentJobId];
+            job.size = size;
+            job.outputBuffer = aquireValue(serializer);
+            taskGroup->submit(CompressionTask{this, currentJobId});
         }
 
         // recycle existing idle job
         if (!(currentJobAvail = popFront(currentJobId, idleQueue)))
             return false;
 
-        jobs[currentJobId].outputBuffer = aquireValue(serializer);
-
         return serializer;
     }
 
@@ -265,8 +258,9 @@ public:
             w = 0;
         }
 
-        // wait for running compressor threads
-        waitForMinSize(idleQueue, numJobs - 1);
+        // wait for running compression tasks
+        if (taskGroup)
+            waitForMinSize(idleQueue, numJobs - 1);
 
         serializer.worker.ostream.flush();
         return w;
@@ -0,0 +1,493 @@
+// zipstream Library License:
+// --------------------------
+//
+// The zlib/libpng License Copyright (c) 2003 Jonathan de Halleux.
+//
+// This software is provided 'as-is', without any express or implied warranty. In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose, including commercial applications, and to alter it and redistribute it freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution
+//
+//
+// Author: Jonathan de Halleux, dehalleux@pelikhan.com, 2003   (original zlib stream)
+// Author: David Weese, dave.weese@gmail.com, 2014             (extension to parallel block-wise compression in bgzf format)
+// Author: René Rahn, rene.rahn [at] fu-berlin.de, 2019        (adaptions to SeqAn library version 3)
+//
+// Parallel compression into a single gzip member, following the approach of pigz (https://zlib.net/pigz/):
+// the input is cut into blocks that are deflated independently, each block is primed with the last 32 KiB of the
+// preceding input as dictionary and ends on a byte boundary (Z_SYNC_FLUSH), so that the compressed blocks can simply
+// be concatenated. The CRC of the member is combined from the CRCs of the blocks.
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+
+#include <seqan3/contrib/parallel/serialised_resource_pool.hpp>
+#include <seqan3/contrib/parallel/suspendable_queue.hpp>
+#include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
+
+#if !defined(SEQAN3_HAS_ZLIB) && !defined(SEQAN3_HEADER_TEST)
+#   error "This file cannot be used when building without GZip-support."
+#endif // !defined(SEQAN3_HAS_ZLIB) && !defined(SEQAN3_HEADER_TEST)
+
+#if defined(SEQAN3_HAS_ZLIB)
+
+namespace seqan3::contrib
+{
+
+// Number of uncompressed bytes per block; pigz uses the same default.
+const size_t PGZ_DEFAULT_BLOCK_SIZE = 128 * 1024;
+// Maximal size of a deflate dictionary (the deflate window).
+const size_t PGZ_DICTIONARY_SIZE = 32 * 1024;
+
+// --------------------------------------------------------------------------
+// Class basic_pgz_ostreambuf
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_pgz_ostreambuf : public std::basic_streambuf<Elem, Tr>
+{
+private:
+
+    typedef std::basic_ostream<Elem, Tr>&                ostream_reference;
+    typedef ElemA                                        char_allocator_type;
+    typedef ByteT                                        byte_type;
+    typedef ByteAT                                       byte_allocator_type;
+    typedef byte_type*                                   byte_buffer_type;
+    typedef ConcurrentQueue<size_t, Suspendable<Limit> > job_queue_type;
+    typedef std::vector<byte_type, byte_allocator_type>  byte_vector_type;
+
+public:
+
+    typedef Tr                                traits_type;
+    typedef typename traits_type::char_type   char_type;
+    typedef typename traits_type::int_type    int_type;
+    typedef typename traits_type::pos_type    pos_type;
+    typedef typename traits_type::off_type    off_type;
+
+    // One compressed block together with the checksum of its uncompressed data.
+    struct OutputBuffer
+    {
+        byte_vector_type buffer;
+        size_t           size;
+        uLong            crc;
+        size_t           length;
+    };
+
+    // Writes the gzip header, the blocks in order and keeps track of the checksum of the whole member.
+    struct BufferWriter
+    {
+        ostream_reference ostream;
+        int               level;
+        bool              headerWritten;
+        uLong             crc;
+        uint32_t          length;
+
+        BufferWriter(ostream_reference ostream) :
+            ostream(ostream),
+            level(Z_DEFAULT_COMPRESSION),
+            headerWritten(false),
+            crc(crc32(0u, NULL, 0u)),
+            length(0)
+        {}
+
+        bool operator() (OutputBuffer const & outputBuffer)
+        {
+            if (!headerWritten)
+            {
+                // extra flags as set by zlib: 2 = best compression, 4 = fastest compression
+                char xfl = (level == Z_BEST_COMPRESSION) ? '\x02' :
+                           (level != Z_DEFAULT_COMPRESSION && level < 2) ? '\x04' : '\x00';
+                // no file name, no modification time, OS = unknown
+                char const header[10]{'\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', xfl, '\xff'};
+                ostream.write(header, sizeof(header));
+                headerWritten = true;
+            }
+
+            ostream.write(reinterpret_cast<char const *>(outputBuffer.buffer.data()), outputBuffer.size);
+            crc = crc32_combine(crc, outputBuffer.crc, outputBuffer.length);
+            length += static_cast<uint32_t>(outputBuffer.length); // ISIZE is the length modulo 2^32
+            return ostream.good();
+        }
+
+        void writeFooter()
+        {
+            char footer[8];
+            _bgzfPack32(footer, static_cast<uint32_t>(crc));
+            _bgzfPack32(footer + 4, length);
+            ostream.write(footer, sizeof(footer));
+        }
+    };
+
+    struct CompressionJob
+    {
+        typedef std::vector<char_type, char_allocator_type> TBuffer;
+
+        TBuffer          buffer;
+        size_t           size;
+        byte_vector_type dictionary;
+        bool             last;
+        OutputBuffer     *outputBuffer;
+
+        CompressionJob() :
+            buffer(PGZ_DEFAULT_BLOCK_SIZE / sizeof(char_type), 0),
+            size(0),
+            last(false),
+            outputBuffer(NULL)
+        {}
+    };
+
+    // string of recycable jobs
+    bgzf_thread_options                      threadOptions;
+    int                                      level;
+    size_t                                   numThreads;
+    size_t                                   numJobs;
+    std::vector<CompressionJob>              jobs;
+    job_queue_type                           idleQueue;
+    Serializer<OutputBuffer, BufferWriter>   serializer;
+    size_t                                   currentJobId;
+    bool                                     currentJobAvail;
+    byte_vector_type                         dictionary;   // the tail of the last submitted block
+    std::atomic<bool>                        failed;       // set if deflate failed for any block
+    std::unique_ptr<detail::bgzf_task_group> taskGroup;    // runs the compression tasks; created on first block
+
+    // Compresses one job and hands the compressed block to the serializer, which writes blocks in order.
+    struct CompressionTask
+    {
+        basic_pgz_ostreambuf *streamBuf;
+        size_t               jobId;
+
+        void operator()()
+        {
+            CompressionJob &job = streamBuf->jobs[jobId];
+            OutputBuffer &out = *job.outputBuffer;
+            size_t const length = job.size * sizeof(char_type);
+
+            out.crc = crc32(crc32(0u, NULL, 0u), reinterpret_cast<Bytef const *>(job.buffer.data()), length);
+            out.length = length;
+            out.size = 0;
+
+            z_stream strm{};
+            const int RAW_WINDOW_BITS = -15;   // no zlib header, the gzip header is written by the BufferWriter
+            const int DEFAULT_MEM_LEVEL = 8;
+            bool success = deflateInit2(&strm, streamBuf->level, Z_DEFLATED,
+                                        RAW_WINDOW_BITS, DEFAULT_MEM_LEVEL, Z_DEFAULT_STRATEGY) == Z_OK;
+
+            if (success && !job.dictionary.empty())
+                success = deflateSetDictionary(&strm, reinterpret_cast<Bytef const *>(job.dictionary.data()),
+                                               job.dictionary.size()) == Z_OK;
+
+            if (success)
+            {
+                // the sync flush appends an empty stored block (at most 6 bytes) that aligns the block to a byte
+                out.buffer.resize(deflateBound(&strm, length) + 16);
+                strm.next_in = (Bytef *)(job.buffer.data());
+                strm.avail_in = length;
+                strm.next_out = (Bytef *)(out.buffer.data());
+                strm.avail_out = out.buffer.size();
+
+                int status = deflate(&strm, job.last ? Z_FINISH : Z_SYNC_FLUSH);
+                success = strm.avail_in == 0 && status == (job.last ? Z_STREAM_END : Z_OK);
+                out.size = out.buffer.size() - strm.avail_out;
+            }
+            deflateEnd(&strm);
+
+            if (!success)
+            {
+                out.size = 0;
+                streamBuf->failed = true;
+            }
+
+            releaseValue(streamBuf->serializer, job.outputBuffer);
+            appendValue(streamBuf->idleQueue, jobId);
+        }
+    };
+
+    basic_pgz_ostreambuf(ostream_reference ostream_,
+                         int level_ = Z_DEFAULT_COMPRESSION,
+                         size_t numThreads = bgzf_thread_count,
+                         size_t jobsPerThread = 4) :
+        level(std::clamp(level_, Z_DEFAULT_COMPRESSION, Z_BEST_COMPRESSION)),
+        numThreads(numThreads),
+        numJobs(std::max<size_t>(numThreads * jobsPerThread, 2)),
+        jobs(1),
+        idleQueue(numJobs),
+        serializer(ostream_, numJobs),
+        currentJobId(0),
+        currentJobAvail(true),
+        failed(false)
+    {
+        // Until the first block is full, only a single job is needed; the other jobs are created in start().
+        lockWriting(idleQueue);
+        lockReading(idleQueue);
+        setReaderWriterCount(idleQueue, 1, 1);
+
+        CompressionJob &job = jobs[currentJobId];
+        this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
+    }
+
+    ~basic_pgz_ostreambuf()
+    {
+        // compress the last block with Z_FINISH and wait for all blocks to be written
+        if (!taskGroup || currentJobAvail)
+            submitBuffer(this->pptr() - this->pbase(), true);
+
+        // the last job is not replaced by an idle one, hence all jobs return to the idle queue
+        if (taskGroup)
+            waitForMinSize(idleQueue, numJobs);
+
+        taskGroup.reset();
+
+        // The owning stream is already destroyed, hence a failed block is reported on the underlying stream and
+        // the footer is omitted, such that the incomplete member is rejected by gzip decoders.
+        if (failed)
+            serializer.worker.ostream.setstate(std::ios_base::badbit);
+        else
+            serializer.worker.writeFooter();
+        serializer.worker.ostream.flush();
+
+        unlockWriting(idleQueue);
+        unlockReading(idleQueue);
+    }
+
+    /*!\brief Selects the thread pool and the concurrency limits.
+     * \param options The options to apply; members with a value of 0 keep the values given on construction.
+     * \returns `true` if the options were applied, `false` if compression has already started.
+     */
+    bool set_thread_options(bgzf_thread_options const & options)
+    {
+        if (taskGroup)
+            return false;
+
+        threadOptions = options;
+        if (threadOptions.max_concurrency != 0 && threadOptions.queue_depth == 0)
+            threadOptions.queue_depth = threadOptions.max_concurrency * 4;
+        return true;
+    }
+
+    /*!\brief Selects the compression level.
+     * \param level_ The zlib compression level from 0 (no compression) to 9 (best compression), or -1 for the default.
+     * \returns `true` if the level was applied, `false` if compression has already started.
+     */
+    bool set_compression_level(int level_)
+    {
+        if (taskGroup)
+            return false;
+
+        level = std::clamp(level_, Z_DEFAULT_COMPRESSION, Z_BEST_COMPRESSION);
+        return true;
+    }
+
+    // Sets up the remaining jobs and the task group. Called when the first block is handed over for compression.
+    void start()
+    {
+        if (taskGroup)
+            return;
+
+        serializer.worker.level = level;
+        numThreads = (threadOptions.max_concurrency != 0) ? threadOptions.max_concurrency : numThreads;
+        // the idle queue and the serializer were sized on construction, hence the depth can only be reduced
+        if (threadOptions.queue_depth != 0)
+            numJobs = std::clamp<size_t>(threadOptions.queue_depth, 2, numJobs);
+
+        jobs.resize(numJobs);
+        taskGroup = std::make_unique<detail::bgzf_task_group>(threadOptions.pool ? threadOptions.pool
+                                                                                  : bgzf_thread_pool::global(),
+                                                              numThreads);
+
+        // Prepare idle queue; job 0 is the current job.
+        for (size_t i = 1; i < numJobs; ++i)
+        {
+            [[maybe_unused]] bool success = appendValue(idleQueue, i);
+            assert(success);
+        }
+    }
+
+    bool submitBuffer(size_t size, bool last = false)
+    {
+        start();
+
+        // submit current job
+        if (currentJobAvail)
+        {
+            CompressionJob &job = jobs[currentJobId];
+            job.size = size;
+            job.last = last;
+
+            // the tail of the previous block becomes the dictionary of this block and is replaced by our own tail
+            size_t const length = size * sizeof(char_type);
+            size_t const tailLength = std::min(length, PGZ_DICTIONARY_SIZE);
+            byte_type const * tail = reinterpret_cast<byte_type const *>(job.buffer.data()) + (length - tailLength);
+            job.dictionary.swap(dictionary);
+            dictionary.assign(tail, tail + tailLength);
+
+            job.outputBuffer = aquireValue(serializer);
+            taskGroup->submit(CompressionTask{this, currentJobId});
+        }
+
+        // recycle existing idle job
+        if (last || !(currentJobAvail = popFront(currentJobId, idleQueue)))
+            return false;
+
+        return !failed;
+    }
+
+    int_type overflow(int_type c)
+    {
+        int w = static_cast<int>(this->pptr() - this->pbase());
+        if (c != static_cast<int_type>(EOF))
+        {
+            *this->pptr() = c;
+            ++w;
+        }
+        if (submitBuffer(w))
+        {
+            CompressionJob &job = jobs[currentJobId];
+            this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
+            return c;
+        }
+        else
+        {
+            return EOF;
+        }
+    }
+
+    // Compresses the buffered data, waits until all blocks are written and flushes the underlying stream.
+    // Calling flush often lowers the compression ratio. Returns -1 if the compression of any block failed.
+    std::streamsize flush()
+    {
+        int w = static_cast<int>(this->pptr() - this->pbase());
+        if (w != 0 && submitBuffer(w))
+        {
+            CompressionJob &job = jobs[currentJobId];
+            this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
+        }
+        else
+        {
+            w = 0;
+        }
+
+        // wait for running compression tasks
+        if (taskGroup)
+            waitForMinSize(idleQueue, numJobs - 1);
+
+        serializer.worker.ostream.flush();
+        return failed ? -1 : w;
+    }
+
+    // Like seqan3::contrib::basic_gz_ostreambuf, synchronising does not end the current block. Data is only
+    // compressed once a block is full or on flush(). A failed block is reported, which sets the badbit.
+    int sync()
+    {
+        return failed ? -1 : 0;
+    }
+
+    // returns a reference to the output stream
+    ostream_reference get_ostream() const    { return serializer.worker.ostream; };
+};
+
+// --------------------------------------------------------------------------
+// Class basic_pgz_ostreambase
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_pgz_ostreambase : virtual public std::basic_ios<Elem,Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr>&                        ostream_reference;
+    typedef basic_pgz_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT> pgz_streambuf_type;
+
+    basic_pgz_ostreambase(ostream_reference ostream_, int level_)
+        : m_buf(ostream_, level_)
+    {
+        this->init(&m_buf );
+    };
+
+    // returns the underlying zip ostream object
+    pgz_streambuf_type* rdbuf()             { return &m_buf; };
+
+private:
+    pgz_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_pgz_ostream
+// --------------------------------------------------------------------------
+// A gzip ostream that compresses blocks in parallel.
+//
+// The output is a single standard gzip member that can be read by any gzip decoder. The blocks are compressed by
+// tasks on a seqan3::bgzf_thread_pool, see basic_pgz_ostreambuf::set_thread_options.
+//
+// A failed compression is reported by setting the badbit of this stream on flush(). If it is only detected on
+// destruction, the footer is not written and the badbit of the underlying stream is set instead.
+//
+// level_ level of compression 0, bad and fast, 9, good and slower, -1 default
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_pgz_ostream :
+    public basic_pgz_ostreambase<Elem,Tr,ElemA,ByteT,ByteAT>,
+    public std::basic_ostream<Elem,Tr>
+{
+public:
+    typedef basic_pgz_ostreambase<Elem,Tr,ElemA,ByteT,ByteAT> pgz_ostreambase_type;
+    typedef std::basic_ostream<Elem,Tr>                       ostream_type;
+    typedef ostream_type&                                     ostream_reference;
+
+    basic_pgz_ostream(ostream_reference ostream_, int level_ = Z_DEFAULT_COMPRESSION) :
+        pgz_ostreambase_type(ostream_, level_),
+        ostream_type(pgz_ostreambase_type::rdbuf())
+    {}
+
+    // flush inner buffer and zipper buffer; sets the badbit if the compression of any block failed
+    basic_pgz_ostream<Elem,Tr>& flush()
+    {
+        ostream_type::flush();
+        if (this->rdbuf()->flush() < 0)
+            this->setstate(std::ios_base::badbit);
+        return *this;
+    };
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_pgz_ostream<char>
+typedef basic_pgz_ostream<char> pgz_ostream;
+// A typedef for basic_pgz_ostream<wchar_t>
+typedef basic_pgz_ostream<wchar_t> pgz_wostream;
+
+} // namespace seqan3::contrib
+
+#endif // defined(SEQAN3_HAS_ZLIB)
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <optional>
 #include <seqan3/std/ranges>
@@ -19,6 +20,7 @@
 
 #include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_sequential.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
 
 namespace seqan3::detail
 {
@@ -49,7 +51,10 @@ namespace seqan3::detail
  * Since it is not clear how many results a single invocation of the given algorithm produces the buffered results
  * are placed into buckets. The number of available buckets is determined by the execution policy. In sequential
  * execution mode only one bucket is available and only one invocation is buffered at a time. In the parallel execution,
- * a bucket is allocated for every element of the underlying resource.
+ * a bucket is allocated for every element of the underlying resource. With the
+ * seqan3::detail::execution_handler_work_stealing, the buffer holds at most
+ * seqan3::detail::execution_handler_work_stealing::max_batch_size buckets per thread and is refilled in rounds. Every
+ * thread invokes its own copy of the algorithm.
  */
 template <std::ranges::viewable_range resource_t,
           std::semiregular algorithm_t,
@@ -153,6 +158,8 @@ public:
      * \details
      *
      * If the execution handler is parallel, it allocates a buffer of the size of the given resource range.
+     * If the execution handler is seqan3::detail::execution_handler_work_stealing, the buffer size is additionally
+     * limited by the number of threads times seqan3::detail::execution_handler_work_stealing::max_batch_size.
      * Otherwise the buffer size is 1.
      * Also note that the third argument is used for deducing the algorithm result type and is otherwise
      * not used in the context of the class' construction.
@@ -167,7 +174,15 @@ public:
         algorithm{std::move(algorithm)}
     {
         if constexpr (std::same_as<execution_handler_t, execution_handler_parallel>)
+        {
             buffer_size = static_cast<size_t>(std::ranges::distance(this->resource));
+        }
+        else if constexpr (std::same_as<execution_handler_t, execution_handler_work_stealing>)
+        {
+            buffer_size = std::min(static_cast<size_t>(std::ranges::distance(this->resource)),
+                                   this->exec_handler.thread_count() * execution_handler_work_stealing::max_batch_size);
+            thread_algorithms.resize(this->exec_handler.thread_count(), this->algorithm);
+        }
 
         buffer.resize(buffer_size);
         buffer_it = buffer.end();
@@ -253,16 +268,37 @@ private:
         // Reset the buckets and the buffer iterator.
         reset_buffer();
 
-        // Execute the algorithm (possibly asynchronous) and fill the buckets in this pre-assigned order.
-        for (buffer_end_it = buffer_it; buffer_end_it != buffer.end() && !is_eof(); ++buffer_end_it, ++resource_it)
+        if constexpr (std::same_as<execution_handler_t, execution_handler_work_stealing>)
         {
-            exec_handler.execute(algorithm, *resource_it, [target_buffer_it = buffer_end_it] (auto && algorithm_result)
+            // Collect the inputs of this round, such that every thread can access them by the index of the bucket.
+            pending_inputs.clear();
+            for (buffer_end_it = buffer_it; buffer_end_it != buffer.end() && !is_eof(); ++buffer_end_it, ++resource_it)
+                pending_inputs.push_back(resource_it);
+
+            exec_handler.parallel_for(pending_inputs.size(), [this] (size_t const index, size_t const thread_index)
             {
-                target_buffer_it->push_back(std::move(algorithm_result));
+                thread_algorithms[thread_index](*pending_inputs[index],
+                                                [target_bucket = &buffer[index]] (auto && algorithm_result)
+                {
+                    target_bucket->push_back(std::move(algorithm_result));
+                });
             });
         }
-
-        exec_handler.wait();
+        else
+        {
+            // Execute the algorithm (possibly asynchronous) and fill the buckets in this pre-assigned order.
+            for (buffer_end_it = buffer_it; buffer_end_it != buffer.end() && !is_eof(); ++buffer_end_it, ++resource_it)
+            {
+                exec_handler.execute(algorithm,
+                                     *resource_it,
+                                     [target_buffer_it = buffer_end_it] (auto && algorithm_result)
+                {
+                    target_buffer_it->push_back(std::move(algorithm_result));
+                });
+            }
+
+            exec_handler.wait();
+        }
 
         // Move the results iterator to the next available result. (This skips empty results of the algorithm)
         find_next_non_empty_bucket();
@@ -342,6 +378,7 @@ private:
         algorithm = std::move(other.algorithm);
         buffer_size = std::move(other.buffer_size);
         exec_handler = std::move(other.exec_handler);
+        thread_algorithms = std::move(other.thread_algorithms);
         // Move the resource and set the iterator state accordingly.
         resource_it = std::ranges::next(std::ranges::begin(resource), old_resource_position);
 
@@ -372,6 +409,11 @@ private:
     //!\brief The algorithm to invoke.
     algorithm_t algorithm{};
 
+    //!\brief The copies of the algorithm invoked by the threads of the seqan3::detail::execution_handler_work_stealing.
+    std::vector<algorithm_t> thread_algorithms{};
+    //!\brief The iterators to the inputs of the current round of the seqan3::detail::execution_handler_work_stealing.
+    std::vector<resource_iterator_type> pending_inputs{};
+
     //!\brief The buffer storing the algorithm results in buckets.
     buffer_type buffer{};
     //!\brief The iterator pointing to the current bucket in the buffer.
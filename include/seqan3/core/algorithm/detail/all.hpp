@@ -15,3 +15,4 @@
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_sequential.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
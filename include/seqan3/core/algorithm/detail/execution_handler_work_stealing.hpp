@@ -0,0 +1,546 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_handler_work_stealing.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <seqan3/std/concepts>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <seqan3/std/new>
+#include <seqan3/std/ranges>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Handles the parallel execution of algorithms with per-thread task ranges and work stealing.
+ * \ingroup core_algorithm
+ *
+ * \details
+ *
+ * This execution handler executes a number of indexed tasks with a fixed set of threads. In contrast to
+ * seqan3::detail::execution_handler_parallel, the tasks are not pushed one by one through a shared concurrent queue.
+ * Instead, the indices of the tasks are split into one contiguous range per thread. Every thread takes batches of tasks
+ * from the front of its own range and, once its range is exhausted, steals the back half of the range of another
+ * thread. Only the ranges are shared between the threads; a task is not wrapped into a std::function object.
+ *
+ * The size of the batches adapts to the runtime of the tasks: A thread doubles its batch size while a batch finishes
+ * faster than seqan3::detail::execution_handler_work_stealing::target_batch_duration and halves it if a batch takes
+ * much longer. Thus, tiny tasks are processed with few atomic operations, while long tasks remain available for
+ * stealing.
+ *
+ * The main interface is seqan3::detail::execution_handler_work_stealing::parallel_for, which blocks until all tasks
+ * are processed. The calling thread participates in the computation, such that `thread_count - 1` threads are spawned
+ * on construction. seqan3::detail::execution_handler_work_stealing::execute defers the task until
+ * seqan3::detail::execution_handler_work_stealing::wait is called. seqan3::detail::algorithm_executor_blocking uses
+ * seqan3::detail::execution_handler_work_stealing::parallel_for to fill its buffer.
+ *
+ * ### Exceptions
+ *
+ * If a task throws, the remaining tasks are skipped and the first exception is rethrown by the call that started the
+ * tasks.
+ *
+ * \note Instances of this class are not copyable.
+ *
+ * \warning This class is not thread-safe; only one thread may submit tasks at a time.
+ */
+class execution_handler_work_stealing
+{
+public:
+    //!\brief The runtime of a batch of tasks that the adaptive batch size aims for.
+    static constexpr std::chrono::microseconds target_batch_duration{50};
+    //!\brief The largest number of tasks that a thread takes at once.
+    static constexpr size_t max_batch_size{1024};
+
+    /*!\name Constructors, destructor and assignment
+     * \brief Instances of this class are not copyable.
+     * \{
+     */
+
+    /*!\brief Constructs the execution handler for `thread_count` threads.
+     * \param thread_count The number of threads that execute the tasks, including the calling thread.
+     *
+     * \details
+     *
+     * Spawns `thread_count - 1` many threads that wait for tasks. A thread count of 0 is treated as 1.
+     */
+    execution_handler_work_stealing(size_t const thread_count) :
+        state{std::make_unique<internal_state>(std::max<size_t>(thread_count, 1))}
+    {}
+
+    /*!\brief Constructs the execution handler with 1 thread.
+     *
+     * \details
+     *
+     * As for seqan3::detail::execution_handler_parallel, the default constructed handler is only used as a placeholder
+     * that is immediately replaced by a handler with the configured number of threads.
+     */
+    execution_handler_work_stealing() : execution_handler_work_stealing{1u}
+    {}
+
+    execution_handler_work_stealing(execution_handler_work_stealing const &) = delete; //!< Deleted.
+    execution_handler_work_stealing(execution_handler_work_stealing &&) = default; //!< Defaulted.
+    execution_handler_work_stealing & operator=(execution_handler_work_stealing const &) = delete; //!< Deleted.
+    execution_handler_work_stealing & operator=(execution_handler_work_stealing &&) = default; //!< Defaulted.
+    ~execution_handler_work_stealing() = default; //!< Defaulted.
+    //!\}
+
+    //!\brief Returns the number of threads that execute the tasks, including the calling thread.
+    size_t thread_count() const noexcept
+    {
+        assert(state != nullptr);
+
+        return state->thread_count;
+    }
+
+    /*!\brief Executes the tasks with the indices `[0, task_count)` in parallel and blocks until all are finished.
+     * \tparam task_t The type of the task; must model std::invocable with the task index and the thread index.
+     *
+     * \param[in] task_count The number of tasks.
+     * \param[in] task The callable that is invoked with the index of the task and the index of the executing thread.
+     *
+     * \details
+     *
+     * The thread index is in `[0, thread_count())` and can be used to access per-thread state without
+     * synchronisation, since a thread executes only one task at a time. The task is invoked concurrently and must not
+     * modify shared state without synchronisation.
+     *
+     * \throws Rethrows the first exception thrown by a task.
+     */
+    template <typename task_t>
+    //!\cond
+        requires std::invocable<task_t &, size_t, size_t>
+    //!\endcond
+    void parallel_for(size_t const task_count, task_t && task)
+    {
+        assert(state != nullptr);
+
+        state->run(task_count, task);
+    }
+
+    /*!\brief Schedules a new algorithm task with the given input and callback.
+     * \tparam algorithm_t The type of the algorithm; must model std::copy_constructible and std::invocable with
+     *                     the given input type as first argument and the callback type as second argument.
+     * \tparam algorithm_input_t The input type to invoke the algorithm with (see below for requirements on this type).
+     * \tparam callback_t The type of the callable invoked by the algorithm after generating a new result; must model
+     *                    std::copy_constructible.
+     *
+     * \param[in] algorithm The algorithm to invoke.
+     * \param[in] input The input of the algorithm.
+     * \param[in] callback A callable which will be invoked on each result generated by the algorithm.
+     *
+     * \details
+     *
+     * The task is stored with copies of the algorithm and the callback and executed together with all other scheduled
+     * tasks when seqan3::detail::execution_handler_work_stealing::wait is called. As for
+     * seqan3::detail::execution_handler_parallel, the input is stored as a reference if it is a lvalue reference and
+     * moved otherwise.
+     * This interface type erases every task; prefer seqan3::detail::execution_handler_work_stealing::parallel_for or
+     * seqan3::detail::execution_handler_work_stealing::bulk_execute for many small tasks.
+     */
+    template <std::copy_constructible algorithm_t,
+              typename algorithm_input_t,
+              std::copy_constructible callback_t>
+    //!\cond
+        requires std::invocable<algorithm_t, algorithm_input_t, callback_t> &&
+                 (std::is_lvalue_reference_v<algorithm_input_t> || std::move_constructible<algorithm_input_t>)
+    //!\endcond
+    void execute(algorithm_t && algorithm, algorithm_input_t && input, callback_t && callback)
+    {
+        assert(state != nullptr);
+
+        state->deferred_tasks.emplace_back([=,
+                                            input_tpl = std::tuple<algorithm_input_t>{
+                                                std::forward<algorithm_input_t>(input)}] () mutable
+        {
+            using forward_input_t = std::tuple_element_t<0, decltype(input_tpl)>;
+            algorithm(std::forward<forward_input_t>(std::get<0>(input_tpl)), std::move(callback));
+        });
+    }
+
+    /*!\brief Executes the algorithm for every element of the given input range in parallel.
+     * \tparam algorithm_t The type of the algorithm.
+     * \tparam algorithm_input_range_t The input range type.
+     * \tparam callback_t The type of the callable invoked by the algorithm after generating a new result.
+     *
+     * \param[in] algorithm The algorithm to invoke.
+     * \param[in] input_range The input range to process.
+     * \param[in] callback A callable which will be invoked on each result generated by the algorithm for a given input.
+     *
+     * \details
+     *
+     * Every thread invokes its own copy of the algorithm and of the callback. The input range is processed in windows
+     * whose iterators are collected first, such that the input range only needs to be an input range and the memory
+     * does not depend on the size of the input range. The call blocks until all elements have been processed.
+     */
+    template <std::copy_constructible algorithm_t,
+              std::ranges::input_range algorithm_input_range_t,
+              std::copy_constructible callback_t>
+    //!\cond
+        requires std::invocable<algorithm_t, std::ranges::range_reference_t<algorithm_input_range_t>, callback_t>
+    //!\endcond
+    void bulk_execute(algorithm_t && algorithm, algorithm_input_range_t && input_range, callback_t && callback)
+    {
+        using input_t = std::ranges::range_reference_t<algorithm_input_range_t>;
+        using stored_input_t = std::conditional_t<std::is_lvalue_reference_v<input_t>,
+                                                  std::reference_wrapper<std::remove_reference_t<input_t>>,
+                                                  std::remove_cvref_t<input_t>>;
+
+        std::vector<std::remove_cvref_t<algorithm_t>> thread_algorithms(thread_count(), algorithm);
+        std::vector<std::remove_cvref_t<callback_t>> thread_callbacks(thread_count(), callback);
+        std::vector<stored_input_t> window{};
+        size_t const window_size = thread_count() * max_batch_size;
+        window.reserve(window_size);
+
+        auto run_window = [&] ()
+        {
+            parallel_for(window.size(), [&] (size_t const index, size_t const thread_index)
+            {
+                if constexpr (std::is_lvalue_reference_v<input_t>)
+                    thread_algorithms[thread_index](window[index].get(), thread_callbacks[thread_index]);
+                else
+                    thread_algorithms[thread_index](std::move(window[index]), thread_callbacks[thread_index]);
+            });
+            window.clear();
+        };
+
+        for (auto && input : input_range)
+        {
+            window.emplace_back(std::forward<decltype(input)>(input));
+            if (window.size() == window_size)
+                run_window();
+        }
+        run_window();
+    }
+
+    //!\brief Executes all tasks scheduled with seqan3::detail::execution_handler_work_stealing::execute.
+    void wait()
+    {
+        assert(state != nullptr);
+
+        std::vector<std::function<void()>> tasks = std::move(state->deferred_tasks);
+        state->deferred_tasks.clear();
+        parallel_for(tasks.size(), [&tasks] (size_t const index, size_t) { tasks[index](); });
+    }
+
+private:
+    /*!\brief The range of task indices owned by one thread.
+     *
+     * \details
+     *
+     * The begin and the end of the range are packed into a single atomic value, such that the owner can take tasks
+     * from the front and other threads can steal from the back with a single compare-and-swap operation.
+     */
+    struct alignas(std::hardware_destructive_interference_size) task_range
+    {
+        //!\brief The begin in the lower and the end in the upper 32 bits.
+        std::atomic<uint64_t> packed{0};
+
+        //!\brief Packs the given begin and end.
+        static constexpr uint64_t pack(uint64_t const begin, uint64_t const end) noexcept
+        {
+            return begin | (end << 32);
+        }
+
+        //!\brief Returns the begin of a packed range.
+        static constexpr uint64_t begin_of(uint64_t const range) noexcept
+        {
+            return range & std::numeric_limits<uint32_t>::max();
+        }
+
+        //!\brief Returns the end of a packed range.
+        static constexpr uint64_t end_of(uint64_t const range) noexcept
+        {
+            return range >> 32;
+        }
+    };
+
+    /*!\brief An internal state stored on the heap to allow safe move construction/assignment of the class.
+     *
+     * \details
+     *
+     * The threads sleep on a condition variable until a new job is published. A job consists of a type erased pointer
+     * to the task and a function that invokes it, which are shared by all tasks of the job.
+     */
+    class internal_state
+    {
+    public:
+        /*!\name Constructors, destructor and assignment
+         * \brief Instances of this class are not copyable or movable.
+         * \{
+         */
+        //!\brief Spawns `thread_count - 1` threads.
+        explicit internal_state(size_t const thread_count) :
+            thread_count{thread_count},
+            ranges{std::make_unique<task_range[]>(thread_count)}
+        {
+            for (size_t thread_index = 1; thread_index < thread_count; ++thread_index)
+                thread_pool.emplace_back([this, thread_index] () { wait_for_jobs(thread_index); });
+        }
+
+        internal_state(internal_state const &) = delete; //!< Deleted.
+        internal_state(internal_state &&) = delete; //!< Deleted.
+        internal_state & operator=(internal_state const &) = delete; //!< Deleted.
+        internal_state & operator=(internal_state &&) = delete; //!< Deleted.
+
+        //!\brief Stops and joins the threads.
+        ~internal_state()
+        {
+            {
+                std::lock_guard lock{mutex};
+                stop = true;
+            }
+            job_published.notify_all();
+
+            for (auto & thread : thread_pool)
+                thread.join();
+        }
+        //!\}
+
+        /*!\brief Executes the tasks `[0, task_count)` with all threads and blocks until all are finished.
+         * \param[in] task_count The number of tasks.
+         * \param[in] task The task that is invoked with the task index and the thread index.
+         */
+        template <typename task_t>
+        void run(size_t const task_count, task_t & task)
+        {
+            // The ranges store 32 bit indices, so very large jobs are split.
+            size_t const max_job_size = std::numeric_limits<uint32_t>::max();
+            for (size_t offset = 0; offset < task_count; offset += max_job_size)
+            {
+                auto job = [&task, offset] (size_t const index, size_t const thread_index)
+                {
+                    task(offset + index, thread_index);
+                };
+
+                run_job(std::min(task_count - offset, max_job_size), job);
+            }
+        }
+
+        //!\brief The number of threads including the calling thread.
+        size_t thread_count{};
+        //!\brief The tasks scheduled by execution_handler_work_stealing::execute.
+        std::vector<std::function<void()>> deferred_tasks{};
+
+    private:
+        //!\brief Publishes the job, works on it with the calling thread and waits for the other threads.
+        template <typename job_t>
+        void run_job(size_t const job_size, job_t & job)
+        {
+            if (job_size == 0)
+                return;
+
+            // Every thread starts with a contiguous range of the tasks.
+            for (size_t thread_index = 0; thread_index < thread_count; ++thread_index)
+            {
+                ranges[thread_index].packed.store(task_range::pack(job_size * thread_index / thread_count,
+                                                                   job_size * (thread_index + 1) / thread_count),
+                                                  std::memory_order_relaxed);
+            }
+
+            cancelled.store(false, std::memory_order_relaxed);
+            first_exception = nullptr;
+            current_job = &job;
+            invoke_job = [] (void * job_ptr, size_t const index, size_t const thread_index)
+            {
+                (*static_cast<job_t *>(job_ptr))(index, thread_index);
+            };
+
+            {
+                std::lock_guard lock{mutex};
+                busy_threads = thread_count - 1;
+                ++job_generation;
+            }
+            job_published.notify_all();
+
+            work(0);
+
+            {
+                std::unique_lock lock{mutex};
+                job_finished.wait(lock, [this] () { return busy_threads == 0; });
+            }
+
+            if (first_exception)
+                std::rethrow_exception(first_exception);
+        }
+
+        //!\brief The loop of a spawned thread, which works on every published job until it is stopped.
+        void wait_for_jobs(size_t const thread_index)
+        {
+            size_t finished_generation = 0;
+            std::unique_lock lock{mutex};
+            for (;;)
+            {
+                job_published.wait(lock, [&] () { return stop || job_generation != finished_generation; });
+                if (stop)
+                    return;
+
+                finished_generation = job_generation;
+                lock.unlock();
+                work(thread_index);
+                lock.lock();
+
+                if (--busy_threads == 0)
+                    job_finished.notify_one();
+            }
+        }
+
+        //!\brief Executes batches of the own range and steals from other threads until no tasks are left.
+        void work(size_t const thread_index)
+        {
+            size_t batch_size = 1;
+            while (!cancelled.load(std::memory_order_relaxed))
+            {
+                uint64_t begin{};
+                uint64_t end{};
+                if (!take_batch(thread_index, batch_size, begin, end) && !steal(thread_index))
+                    return;
+
+                if (begin == end) // Stolen tasks are taken in the next iteration.
+                    continue;
+
+                auto const batch_start = std::chrono::steady_clock::now();
+                try
+                {
+                    for (uint64_t index = begin; index < end; ++index)
+                        invoke_job(current_job, index, thread_index);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock{mutex};
+                    if (!first_exception)
+                        first_exception = std::current_exception();
+                    cancelled.store(true, std::memory_order_relaxed);
+                }
+
+                auto const batch_duration = std::chrono::steady_clock::now() - batch_start;
+                if (batch_duration < target_batch_duration / 2)
+                    batch_size = std::min(batch_size * 2, max_batch_size);
+                else if (batch_duration > target_batch_duration * 2)
+                    batch_size = std::max<size_t>(batch_size / 2, 1);
+            }
+        }
+
+        /*!\brief Takes at most `batch_size` tasks from the front of the own range.
+         * \returns `true` if tasks were taken, `false` if the own range is empty.
+         *
+         * \details
+         *
+         * At most half of the remaining range is taken, such that the other half can still be stolen.
+         */
+        bool take_batch(size_t const thread_index, size_t const batch_size, uint64_t & begin, uint64_t & end)
+        {
+            std::atomic<uint64_t> & own = ranges[thread_index].packed;
+            uint64_t range = own.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                uint64_t const range_begin = task_range::begin_of(range);
+                uint64_t const range_end = task_range::end_of(range);
+                if (range_begin >= range_end)
+                    return false;
+
+                uint64_t const count = std::min<uint64_t>(batch_size, (range_end - range_begin + 1) / 2);
+                if (own.compare_exchange_weak(range,
+                                              task_range::pack(range_begin + count, range_end),
+                                              std::memory_order_acquire,
+                                              std::memory_order_relaxed))
+                {
+                    begin = range_begin;
+                    end = range_begin + count;
+                    return true;
+                }
+            }
+        }
+
+        /*!\brief Moves the back half of the range of another thread to the own range.
+         * \returns `true` if tasks were stolen, `false` if the ranges of all threads are empty.
+         *
+         * \details
+         *
+         * The own range is empty when this function is called and no other thread steals from an empty range, so the
+         * stolen range can be stored without synchronisation with the thieves.
+         */
+        bool steal(size_t const thread_index)
+        {
+            for (size_t offset = 1; offset < thread_count; ++offset)
+            {
+                std::atomic<uint64_t> & victim = ranges[(thread_index + offset) % thread_count].packed;
+                uint64_t range = victim.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    uint64_t const range_begin = task_range::begin_of(range);
+                    uint64_t const range_end = task_range::end_of(range);
+                    if (range_begin >= range_end)
+                        break;
+
+                    uint64_t const stolen_begin = range_end - (range_end - range_begin + 1) / 2;
+                    if (victim.compare_exchange_weak(range,
+                                                     task_range::pack(range_begin, stolen_begin),
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_relaxed))
+                    {
+                        ranges[thread_index].packed.store(task_range::pack(stolen_begin, range_end),
+                                                          std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        //!\brief The spawned threads.
+        std::vector<std::thread> thread_pool{};
+        //!\brief The task ranges of all threads; the range of the calling thread comes first.
+        std::unique_ptr<task_range[]> ranges{};
+
+        //!\brief The current job.
+        void * current_job{nullptr};
+        //!\brief Invokes the current job with the task index and the thread index.
+        void (* invoke_job)(void *, size_t, size_t){nullptr};
+        //!\brief Whether a task of the current job has thrown.
+        std::atomic<bool> cancelled{false};
+        //!\brief The first exception thrown by a task of the current job.
+        std::exception_ptr first_exception{};
+
+        //!\brief Protects the job publication, the number of busy threads and the first exception.
+        std::mutex mutex{};
+        //!\brief Signals the spawned threads that a job was published or that they should stop.
+        std::condition_variable job_published{};
+        //!\brief Signals the calling thread that all spawned threads finished the current job.
+        std::condition_variable job_finished{};
+        //!\brief Incremented for every published job.
+        size_t job_generation{0};
+        //!\brief The number of spawned threads that still work on the current job.
+        size_t busy_threads{0};
+        //!\brief Whether the spawned threads should stop.
+        bool stop{false};
+    };
+
+    //!\brief Manages the internal state.
+    std::unique_ptr<internal_state> state{nullptr};
+};
+
+} // namespace seqan3::detail
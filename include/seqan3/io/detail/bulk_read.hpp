@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::bulk_read_legal_chars and seqan3::detail::bulk_read_exactly.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <string_view>
+
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A container that can be read into with seqan3::detail::bulk_read_legal_chars and
+ *        seqan3::detail::bulk_read_exactly, e.g. a `std::vector<seqan3::dna5>`.
+ * \ingroup io
+ *
+ * \details
+ *
+ * Contiguous containers are resized and converted into directly. Other containers need a member function `append`
+ * that takes a span of letters (e.g. seqan3::bitpacked_sequence, which then packs whole words at a time).
+ */
+template <typename sequence_t>
+concept bulk_readable_sequence = std::ranges::sized_range<sequence_t> &&
+                                 bulk_char_convertible<std::ranges::range_value_t<sequence_t>> &&
+                                 ((std::ranges::contiguous_range<sequence_t> &&
+                                   requires (sequence_t & sequence, size_t const size) { sequence.resize(size); }) ||
+                                  requires (sequence_t & sequence,
+                                            std::span<std::ranges::range_value_t<sequence_t> const> letters)
+                                  {
+                                      sequence.append(letters);
+                                  });
+
+//!\brief Whether none of the characters is valid for the alphabet.
+template <typename alphabet_t>
+constexpr bool none_is_valid_for(std::string_view const chars)
+{
+    for (char const chr : chars)
+        if (char_is_valid_for<alphabet_t>(chr))
+            return false;
+    return true;
+}
+
+//!\brief Appends the letters of count characters to the sequence.
+template <bulk_readable_sequence sequence_t>
+void bulk_append_chars(sequence_t & sequence, char const * const chars, size_t const count)
+{
+    using alphabet_t = std::ranges::range_value_t<sequence_t>;
+
+    if constexpr (std::ranges::contiguous_range<sequence_t>)
+    {
+        size_t const old_size = std::ranges::size(sequence);
+        sequence.resize(old_size + count);
+        detail::bulk_assign_char_to(chars, std::ranges::data(sequence) + old_size, count);
+    }
+    else // convert in chunks and append these
+    {
+        std::array<alphabet_t, 1024> letters;
+
+        for (size_t done = 0; done < count; done += letters.size())
+        {
+            size_t const chunk_size = std::min(count - done, letters.size());
+            detail::bulk_assign_char_to(chars + done, letters.data(), chunk_size);
+            sequence.append(std::span<alphabet_t const>{letters.data(), chunk_size});
+        }
+    }
+}
+
+/*!\brief Appends characters to the sequence for as long as they are valid for legal_alphabet_t.
+ * \ingroup io
+ * \tparam legal_alphabet_t The alphabet that the characters are validated with.
+ * \param[in,out] it        The iterator on the stream buffer; points to the first character that is not valid
+ *                          afterwards (or the end).
+ * \param[in,out] sequence  The sequence to append to.
+ *
+ * \details
+ *
+ * The characters are validated and converted in bulk, directly on the buffer of the stream, see
+ * seqan3::bulk_assign_char_to.
+ */
+template <bulk_char_convertible legal_alphabet_t, typename traits_t, bulk_readable_sequence sequence_t>
+void bulk_read_legal_chars(fast_istreambuf_iterator<char, traits_t> & it, sequence_t & sequence)
+{
+    while (it != std::default_sentinel)
+    {
+        std::span<char const> const chunk = it.buffered();
+        size_t const count = detail::bulk_find_invalid_char<legal_alphabet_t>(chunk.data(), chunk.size());
+
+        bulk_append_chars(sequence, chunk.data(), count);
+        it.skip_buffered(count);
+
+        if (count < chunk.size())
+            return;
+    }
+}
+
+/*!\brief Appends exactly count characters that are not whitespace to the sequence and skips the whitespace that
+ *        follows.
+ * \ingroup io
+ * \param[in,out] it       The iterator on the stream buffer.
+ * \param[in,out] sequence The sequence to append to.
+ * \param[in]     count    The number of characters.
+ * \throws seqan3::unexpected_end_of_input if the input ends before count characters were read.
+ *
+ * \details
+ *
+ * This is the same as copying `views::char_to<alphabet>` of
+ * `stream_view | std::views::filter(!is_space) | detail::take_exactly_or_throw(count)`, but converts in bulk.
+ * Only characters that are not valid for the alphabet (which includes whitespace) are handled one at a time.
+ */
+template <typename traits_t, bulk_readable_sequence sequence_t>
+void bulk_read_exactly(fast_istreambuf_iterator<char, traits_t> & it, sequence_t & sequence, size_t count)
+{
+    using alphabet_t = std::ranges::range_value_t<sequence_t>;
+
+    while (true)
+    {
+        while (it != std::default_sentinel && is_space(*it))
+            ++it;
+
+        if (count == 0)
+            return;
+
+        if (it == std::default_sentinel)
+            throw unexpected_end_of_input{"Reached end of input before designated size."};
+
+        std::span<char const> const chunk = it.buffered().first(std::min(count, it.buffered().size()));
+        size_t const valid = detail::bulk_find_invalid_char<alphabet_t>(chunk.data(), chunk.size());
+
+        if (valid > 0)
+        {
+            bulk_append_chars(sequence, chunk.data(), valid);
+            it.skip_buffered(valid);
+            count -= valid;
+        }
+        else // a character that is neither valid nor whitespace
+        {
+            char const chr = *it;
+            bulk_append_chars(sequence, &chr, 1);
+            ++it;
+            --count;
+        }
+    }
+}
+
+} // namespace seqan3::detail
@@ -31,6 +31,8 @@
 #endif
 #include <seqan3/io/detail/magic_header.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
+#include <seqan3/io/stream/memory_mapped_streambuf.hpp>
 #include <seqan3/utility/concept/exposition_only/core_language.hpp>
 
 namespace seqan3::detail
@@ -167,4 +169,45 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream)
     return make_secondary_istream(primary_stream, p);
 }
 
+/*!\brief Passes the thread options to the stream if it decompresses BGZF; does nothing otherwise.
+ * \ingroup io
+ * \param[in,out] stream  The (secondary) stream to configure.
+ * \param[in]     options The thread pool and limits to use.
+ *
+ * \details
+ *
+ * The options only take effect if no data was read from the stream yet.
+ */
+template <builtin_character char_t>
+inline void set_bgzf_thread_options([[maybe_unused]] std::basic_istream<char_t> & stream,
+                                    [[maybe_unused]] bgzf_thread_options const & options)
+{
+#if defined(SEQAN3_HAS_ZLIB)
+    if (auto * buffer = dynamic_cast<contrib::basic_bgzf_istreambuf<char_t> *>(stream.rdbuf()); buffer != nullptr)
+        buffer->set_thread_options(options);
+#endif
+}
+
+/*!\brief Replaces the buffer of a file stream by a memory mapping of the file, keeping the read position.
+ * \ingroup io
+ * \param[in,out] stream   The (uncompressed) file stream.
+ * \param[in]     path     The path of the file that is read by `stream`.
+ * \param[in]     populate Whether to read in all pages on mapping.
+ * \returns The new stream buffer, which must outlive any use of `stream`; `nullptr` if the stream is not readable.
+ * \throws seqan3::file_open_error if the file cannot be mapped.
+ */
+inline std::unique_ptr<memory_mapped_streambuf> memory_map_stream(std::basic_istream<char> & stream,
+                                                                  std::filesystem::path const & path,
+                                                                  bool const populate)
+{
+    std::streampos const position = stream.tellg();
+    if (position == std::streampos(-1))
+        return nullptr;
+
+    auto buffer = std::make_unique<memory_mapped_streambuf>(path, populate);
+    buffer->pubseekpos(position, std::ios_base::in);
+    stream.rdbuf(buffer.get());
+    return buffer;
+}
+
 } // namespace seqan3::detail
@@ -24,8 +24,10 @@
 #if defined(SEQAN3_HAS_ZLIB)
     #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
+    #include <seqan3/contrib/stream/pgz_ostream.hpp>
 #endif
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
 #include <seqan3/utility/concept/exposition_only/core_language.hpp>
 
 namespace seqan3::detail
@@ -53,7 +55,7 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     {
 #if defined(SEQAN3_HAS_ZLIB)
         filename.replace_extension("");
-        return {new contrib::basic_gz_ostream<char_t>{primary_stream}, stream_deleter_default};
+        return {new contrib::basic_pgz_ostream<char_t>{primary_stream}, stream_deleter_default};
 #else
         throw file_open_error{"Trying to write a gzipped file, but no ZLIB available."};
 #endif
@@ -86,4 +88,44 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     return {&primary_stream, stream_deleter_noop};
 }
 
+/*!\brief Passes the thread options to the stream if it compresses to BGZF or gzip; does nothing otherwise.
+ * \ingroup io
+ * \param[in,out] stream  The (secondary) stream to configure.
+ * \param[in]     options The thread pool and limits to use.
+ *
+ * \details
+ *
+ * The options only take effect if no block was compressed yet.
+ */
+template <builtin_character char_t>
+inline void set_bgzf_thread_options([[maybe_unused]] std::basic_ostream<char_t> & stream,
+                                    [[maybe_unused]] bgzf_thread_options const & options)
+{
+#if defined(SEQAN3_HAS_ZLIB)
+    if (auto * buffer = dynamic_cast<contrib::basic_bgzf_ostreambuf<char_t> *>(stream.rdbuf()); buffer != nullptr)
+        buffer->set_thread_options(options);
+    else if (auto * buffer = dynamic_cast<contrib::basic_pgz_ostreambuf<char_t> *>(stream.rdbuf()); buffer != nullptr)
+        buffer->set_thread_options(options);
+#endif
+}
+
+/*!\brief Passes the compression level to the stream if it compresses to gzip; does nothing otherwise.
+ * \ingroup io
+ * \param[in,out] stream The (secondary) stream to configure.
+ * \param[in]     level  The zlib compression level from 0 to 9, or -1 for the default.
+ *
+ * \details
+ *
+ * The level only takes effect if no block was compressed yet.
+ */
+template <builtin_character char_t>
+inline void set_gz_compression_level([[maybe_unused]] std::basic_ostream<char_t> & stream,
+                                     [[maybe_unused]] int const level)
+{
+#if defined(SEQAN3_HAS_ZLIB)
+    if (auto * buffer = dynamic_cast<contrib::basic_pgz_ostreambuf<char_t> *>(stream.rdbuf()); buffer != nullptr)
+        buffer->set_compression_level(level);
+#endif
+}
+
 } // namespace seqan3::detail
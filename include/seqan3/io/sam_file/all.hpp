@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <seqan3/io/sam_file/bam_lazy_record.hpp>
 #include <seqan3/io/sam_file/format_bam.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
 #include <seqan3/io/sam_file/header.hpp>
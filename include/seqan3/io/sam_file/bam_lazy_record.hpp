@@ -0,0 +1,566 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_lazy_record.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <seqan3/std/charconv>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna16sam.hpp>
+#include <seqan3/alphabet/quality/phred94.hpp>
+#include <seqan3/core/debug_stream/detail/to_string.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/sam_flag.hpp>
+#include <seqan3/io/sam_file/sam_tag_dictionary.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A BAM record that keeps the raw record bytes and decodes the variable-length fields on first access.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * In contrast to the record returned by seqan3::sam_file_input, this record does not decode the read name, the
+ * CIGAR, the sequence, the qualities and the optional tags when it is read. It only stores the bytes of the BAM
+ * alignment block (without the leading `block_size`).
+ *
+ * The fixed-size core fields (flag, mapping quality, reference id and position, mate information) are read directly
+ * from the buffer and are therefore always cheap to query. The id is returned as a std::string_view into the buffer.
+ * The CIGAR, the sequence and the qualities are decoded on the first call of the respective member function and
+ * cached until the record is overwritten. Single tags can be queried via seqan3::bam_lazy_record::tag, which only
+ * scans the auxiliary data block and decodes the value of the requested tag.
+ *
+ * This makes filtering passes over large BAM files cheap, if most records are discarded after looking at a few
+ * fields. A record is filled by seqan3::sam_file_input::read_lazy_record.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+class bam_lazy_record
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_lazy_record() = default; //!< Defaulted.
+    bam_lazy_record(bam_lazy_record const &) = default; //!< Defaulted.
+    bam_lazy_record(bam_lazy_record &&) = default; //!< Defaulted.
+    bam_lazy_record & operator=(bam_lazy_record const &) = default; //!< Defaulted.
+    bam_lazy_record & operator=(bam_lazy_record &&) = default; //!< Defaulted.
+    ~bam_lazy_record() = default; //!< Defaulted.
+
+    /*!\brief Constructs the record from the raw bytes of a BAM alignment block.
+     * \param[in] raw_block The bytes of the alignment block excluding the leading `block_size` field.
+     * \throws seqan3::format_error if the block is too small to hold the fields it announces.
+     */
+    explicit bam_lazy_record(std::string raw_block)
+    {
+        assign(std::move(raw_block));
+    }
+    //!\}
+
+    /*!\brief Replaces the content of the record with the given raw bytes of a BAM alignment block.
+     * \param[in] raw_block The bytes of the alignment block excluding the leading `block_size` field.
+     * \throws seqan3::format_error if the block is too small to hold the fields it announces.
+     *
+     * \details
+     *
+     * All cached fields are invalidated. The capacity of the internal buffers is kept.
+     */
+    void assign(std::string raw_block)
+    {
+        data = std::move(raw_block);
+        invalidate_cache();
+        validate();
+    }
+
+    /*!\brief Provides access to the internal buffer, e.g. to read the next block directly into it.
+     * \returns A reference to the buffer that stores the raw bytes of the record.
+     *
+     * \details
+     *
+     * You must call seqan3::bam_lazy_record::reset after modifying the buffer.
+     *
+     * \noapi
+     */
+    std::string & raw_buffer() noexcept
+    {
+        return data;
+    }
+
+    /*!\brief Invalidates the cached fields and validates the buffer content.
+     * \throws seqan3::format_error if the block is too small to hold the fields it announces.
+     * \noapi
+     */
+    void reset()
+    {
+        invalidate_cache();
+        validate();
+    }
+
+    //!\brief Returns the raw bytes of the BAM alignment block (without the leading `block_size`).
+    std::string_view raw_data() const noexcept
+    {
+        return data;
+    }
+
+    /*!\name Fixed-size fields
+     * \brief These fields are read directly from the raw bytes on every call.
+     * \{
+     */
+    //!\brief The index of the reference sequence in the header or std::nullopt if unmapped.
+    std::optional<int32_t> reference_id() const noexcept
+    {
+        int32_t const ref_id = read_core<int32_t>(ref_id_offset);
+        return (ref_id > -1) ? std::optional<int32_t>{ref_id} : std::nullopt;
+    }
+
+    //!\brief The 0-based begin position of the alignment or std::nullopt if unavailable.
+    std::optional<int32_t> reference_position() const noexcept
+    {
+        int32_t const pos = read_core<int32_t>(pos_offset);
+        return (pos > -1) ? std::optional<int32_t>{pos} : std::nullopt;
+    }
+
+    //!\brief The mapping quality.
+    uint8_t mapping_quality() const noexcept
+    {
+        return read_core<uint8_t>(mapq_offset);
+    }
+
+    //!\brief The alignment flag.
+    sam_flag flag() const noexcept
+    {
+        return static_cast<sam_flag>(read_core<uint16_t>(flag_offset));
+    }
+
+    //!\brief The mate information (reference id, position, template length) in the same form as seqan3::field::mate.
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate() const noexcept
+    {
+        int32_t const next_ref_id = read_core<int32_t>(next_ref_id_offset);
+        int32_t const next_pos = read_core<int32_t>(next_pos_offset);
+
+        return {(next_ref_id > -1) ? std::optional<int32_t>{next_ref_id} : std::nullopt,
+                (next_pos > -1) ? std::optional<int32_t>{next_pos} : std::nullopt,
+                read_core<int32_t>(tlen_offset)};
+    }
+
+    //!\brief The number of bases of the read sequence.
+    int32_t sequence_size() const noexcept
+    {
+        return read_core<int32_t>(l_seq_offset);
+    }
+
+    //!\brief The read name as a view into the buffer; the view is invalidated when the record is overwritten.
+    std::string_view id() const noexcept
+    {
+        return {data.data() + core_size, static_cast<size_t>(read_core<uint8_t>(l_read_name_offset) - 1)};
+    }
+    //!\}
+
+    /*!\name Variable-length fields
+     * \brief These fields are decoded on the first access and cached until the record is overwritten.
+     * \{
+     */
+    //!\brief The CIGAR operations of the alignment.
+    std::vector<cigar> const & cigar_sequence() const
+    {
+        if (!(decoded & cigar_bit))
+        {
+            constexpr char const * cigar_mapping = "MIDNSHP=X*******";
+            size_t const n_cigar_op = read_core<uint16_t>(n_cigar_op_offset);
+            char const * it = data.data() + cigar_begin();
+
+            cigar_cache.clear();
+            cigar_cache.reserve(n_cigar_op);
+
+            for (size_t i = 0; i < n_cigar_op; ++i, it += 4)
+            {
+                uint32_t operation_and_count{};
+                std::memcpy(&operation_and_count, it, 4);
+                cigar_cache.emplace_back(operation_and_count >> 4,
+                                         cigar::operation{}.assign_char(cigar_mapping[operation_and_count & 0x0f]));
+            }
+
+            decoded |= cigar_bit;
+        }
+
+        return cigar_cache;
+    }
+
+    //!\brief The read sequence decoded from its 4-bit representation.
+    std::vector<dna16sam> const & sequence() const
+    {
+        if (!(decoded & sequence_bit))
+        {
+            size_t const l_seq = sequence_size();
+            unsigned char const * it = reinterpret_cast<unsigned char const *>(data.data()) + sequence_begin();
+
+            sequence_cache.resize(l_seq);
+
+            size_t i = 0;
+            for (; i + 1 < l_seq; i += 2, ++it)
+            {
+                sequence_cache[i] = nibble_to_dna16sam[*it >> 4];
+                sequence_cache[i + 1] = nibble_to_dna16sam[*it & 0x0f];
+            }
+
+            if (l_seq & 1)
+                sequence_cache[i] = nibble_to_dna16sam[*it >> 4];
+
+            decoded |= sequence_bit;
+        }
+
+        return sequence_cache;
+    }
+
+    //!\brief The base qualities; empty if the qualities are absent (stored as `0xFF` in BAM).
+    std::vector<phred94> const & base_qualities() const
+    {
+        if (!(decoded & quality_bit))
+        {
+            size_t const l_seq = sequence_size();
+            unsigned char const * it = reinterpret_cast<unsigned char const *>(data.data()) + quality_begin();
+
+            quality_cache.clear();
+
+            if (l_seq > 0 && *it != 0xFF)
+            {
+                quality_cache.resize(l_seq);
+
+                for (size_t i = 0; i < l_seq; ++i, ++it)
+                    quality_cache[i].assign_rank(std::min<uint8_t>(*it, phred94::alphabet_size - 1));
+            }
+
+            decoded |= quality_bit;
+        }
+
+        return quality_cache;
+    }
+
+    /*!\brief Returns the value of a single optional field.
+     * \param[in] tag_id The id of the tag, e.g. `"NM"_tag`.
+     * \returns The value of the tag or std::nullopt if the record has no such tag.
+     * \throws seqan3::format_error if the auxiliary data is malformed.
+     *
+     * \details
+     *
+     * The auxiliary data block is scanned from the beginning, skipping all other tags by their size.
+     * Integer values are returned as `int32_t`, as in seqan3::sam_tag_dictionary.
+     */
+    std::optional<detail::sam_tag_variant> tag(uint16_t const tag_id) const
+    {
+        char const * it = data.data() + tags_begin();
+        char const * const end = data.data() + data.size();
+
+        while (it < end)
+        {
+            if (end - it < 3)
+                throw format_error{"The optional fields of the BAM record are truncated."};
+
+            uint16_t const current_tag = (static_cast<uint16_t>(static_cast<unsigned char>(it[0])) << 8) +
+                                         static_cast<uint16_t>(static_cast<unsigned char>(it[1]));
+            char const type_id = it[2];
+            it += 3;
+
+            if (current_tag == tag_id)
+                return read_tag_value(type_id, it, end);
+
+            it += tag_value_size(type_id, it, end);
+        }
+
+        return std::nullopt;
+    }
+
+    //!\brief All optional fields decoded into a seqan3::sam_tag_dictionary.
+    sam_tag_dictionary const & tags() const
+    {
+        if (!(decoded & tags_bit))
+        {
+            char const * it = data.data() + tags_begin();
+            char const * const end = data.data() + data.size();
+
+            tags_cache.clear();
+
+            while (it < end)
+            {
+                if (end - it < 3)
+                    throw format_error{"The optional fields of the BAM record are truncated."};
+
+                uint16_t const current_tag = (static_cast<uint16_t>(static_cast<unsigned char>(it[0])) << 8) +
+                                             static_cast<uint16_t>(static_cast<unsigned char>(it[1]));
+                char const type_id = it[2];
+                it += 3;
+
+                tags_cache[current_tag] = read_tag_value(type_id, it, end);
+                it += tag_value_size(type_id, it, end);
+            }
+
+            decoded |= tags_bit;
+        }
+
+        return tags_cache;
+    }
+    //!\}
+
+private:
+    /*!\name Layout of the fixed-size part of a BAM record (the `block_size` excluded)
+     * \{
+     */
+    static constexpr size_t ref_id_offset{0};       //!< Offset of `refID`.
+    static constexpr size_t pos_offset{4};          //!< Offset of `pos`.
+    static constexpr size_t l_read_name_offset{8};  //!< Offset of `l_read_name`.
+    static constexpr size_t mapq_offset{9};         //!< Offset of `mapq`.
+    static constexpr size_t n_cigar_op_offset{12};  //!< Offset of `n_cigar_op`.
+    static constexpr size_t flag_offset{14};        //!< Offset of `flag`.
+    static constexpr size_t l_seq_offset{16};       //!< Offset of `l_seq`.
+    static constexpr size_t next_ref_id_offset{20}; //!< Offset of `next_refID`.
+    static constexpr size_t next_pos_offset{24};    //!< Offset of `next_pos`.
+    static constexpr size_t tlen_offset{28};        //!< Offset of `tlen`.
+    static constexpr size_t core_size{32};          //!< Size of the fixed-size part.
+    //!\}
+
+    /*!\name Cache state
+     * \{
+     */
+    static constexpr uint8_t cigar_bit{1};    //!< Set if the cigar is decoded.
+    static constexpr uint8_t sequence_bit{2}; //!< Set if the sequence is decoded.
+    static constexpr uint8_t quality_bit{4};  //!< Set if the qualities are decoded.
+    static constexpr uint8_t tags_bit{8};     //!< Set if all tags are decoded.
+    //!\}
+
+    //!\brief Maps the 4-bit BAM encoding to seqan3::dna16sam.
+    static constexpr std::array<dna16sam, 16> nibble_to_dna16sam
+    {
+        [] () constexpr
+        {
+            std::array<dna16sam, 16> ret{};
+
+            for (uint8_t rank = 0; rank < 16; ++rank)
+                ret[rank].assign_rank(rank);
+
+            return ret;
+        }()
+    };
+
+    //!\brief The raw bytes of the BAM alignment block without the `block_size`.
+    std::string data{};
+    //!\brief Bit mask of the fields that are already decoded.
+    mutable uint8_t decoded{0};
+    //!\brief The cached cigar.
+    mutable std::vector<cigar> cigar_cache{};
+    //!\brief The cached sequence.
+    mutable std::vector<dna16sam> sequence_cache{};
+    //!\brief The cached qualities.
+    mutable std::vector<phred94> quality_cache{};
+    //!\brief The cached tag dictionary.
+    mutable sam_tag_dictionary tags_cache{};
+
+    //!\brief Reinterprets the bytes at the given position of the fixed-size part.
+    template <typename number_type>
+    number_type read_core(size_t const offset) const noexcept
+    {
+        assert(offset + sizeof(number_type) <= data.size());
+        number_type value{};
+        std::memcpy(&value, data.data() + offset, sizeof(number_type));
+        return value;
+    }
+
+    //!\brief Marks all fields as not decoded.
+    void invalidate_cache() noexcept
+    {
+        decoded = 0;
+    }
+
+    //!\brief Checks that the buffer is large enough to store the fields it announces.
+    void validate() const
+    {
+        if (data.size() < core_size || tags_begin() > data.size() || read_core<uint8_t>(l_read_name_offset) == 0)
+            throw format_error{detail::to_string("The BAM record of size ", data.size(), " is too small to hold "
+                                                 "the announced fields.")};
+    }
+
+    //!\brief Position of the first cigar operation.
+    size_t cigar_begin() const noexcept
+    {
+        return core_size + read_core<uint8_t>(l_read_name_offset);
+    }
+
+    //!\brief Position of the first sequence byte.
+    size_t sequence_begin() const noexcept
+    {
+        return cigar_begin() + 4 * read_core<uint16_t>(n_cigar_op_offset);
+    }
+
+    //!\brief Position of the first quality byte.
+    size_t quality_begin() const noexcept
+    {
+        return sequence_begin() + (static_cast<size_t>(sequence_size()) + 1) / 2;
+    }
+
+    //!\brief Position of the first optional field.
+    size_t tags_begin() const noexcept
+    {
+        if (data.size() < core_size)
+            return data.size() + 1;
+
+        return quality_begin() + static_cast<size_t>(sequence_size());
+    }
+
+    //!\brief Returns the size in bytes of the scalar BAM type identified by `type_id`.
+    static size_t scalar_size(char const type_id)
+    {
+        switch (type_id)
+        {
+            case 'A': case 'c': case 'C': return 1;
+            case 's': case 'S':           return 2;
+            case 'i': case 'I': case 'f': return 4;
+            default:
+                throw format_error{detail::to_string("The type of a BAM tag value must be one of [AcCsSiIfZHB] but '",
+                                                     type_id, "' was given.")};
+        }
+    }
+
+    /*!\brief Returns the number of bytes the value of a tag of type `type_id` starting at `it` occupies.
+     * \throws seqan3::format_error if the value does not fit into `[it, end)`.
+     */
+    static size_t tag_value_size(char const type_id, char const * it, char const * const end)
+    {
+        size_t const available = end - it;
+        size_t value_size{};
+
+        if (type_id == 'Z' || type_id == 'H')
+        {
+            char const * const value_end = static_cast<char const *>(std::memchr(it, '\0', available));
+
+            if (value_end == nullptr)
+                throw format_error{"A string value of the BAM record is not null-terminated."};
+
+            value_size = value_end - it + 1;
+        }
+        else if (type_id == 'B')
+        {
+            if (available < 5)
+                throw format_error{"The optional fields of the BAM record are truncated."};
+
+            int32_t count{};
+            std::memcpy(&count, it + 1, 4);
+
+            if (count < 0)
+                throw format_error{"The element count of a BAM array value must not be negative."};
+
+            if (it[0] == 'A')
+                throw format_error{"The element type of a BAM array value must be one of [cCsSiIf] but 'A' was given."};
+
+            size_t const element_size = scalar_size(it[0]);
+
+            // Compare by division to not overflow for huge counts.
+            if (static_cast<size_t>(count) > (available - 5) / element_size)
+                throw format_error{"The optional fields of the BAM record are truncated."};
+
+            value_size = 5 + static_cast<size_t>(count) * element_size;
+        }
+        else
+        {
+            value_size = scalar_size(type_id);
+        }
+
+        if (value_size > available)
+            throw format_error{"The optional fields of the BAM record are truncated."};
+
+        return value_size;
+    }
+
+    //!\brief Decodes a scalar number of type `number_type` from `it`.
+    template <typename number_type>
+    static number_type read_number(char const * it) noexcept
+    {
+        number_type value{};
+        std::memcpy(&value, it, sizeof(number_type));
+        return value;
+    }
+
+    //!\brief Decodes a BAM array of `value_type` with `count` elements.
+    template <typename value_type>
+    static detail::sam_tag_variant read_array(char const * it, int32_t const count)
+    {
+        std::vector<value_type> values(count);
+        std::memcpy(values.data(), it, count * sizeof(value_type));
+        return values;
+    }
+
+    //!\brief Decodes the value of a tag of type `type_id` starting at `it`.
+    static detail::sam_tag_variant read_tag_value(char const type_id, char const * it, char const * const end)
+    {
+        size_t const value_size = tag_value_size(type_id, it, end);
+
+        switch (type_id)
+        {
+            case 'A': return *it;
+            // readable sam format only allows int32_t
+            case 'c': return static_cast<int32_t>(read_number<int8_t>(it));
+            case 'C': return static_cast<int32_t>(read_number<uint8_t>(it));
+            case 's': return static_cast<int32_t>(read_number<int16_t>(it));
+            case 'S': return static_cast<int32_t>(read_number<uint16_t>(it));
+            case 'i': return read_number<int32_t>(it);
+            case 'I': return static_cast<int32_t>(read_number<uint32_t>(it));
+            case 'f': return read_number<float>(it);
+            case 'Z': return std::string{it, value_size - 1};
+            case 'H':
+            {
+                if ((value_size - 1) & 1)
+                    throw format_error{"Hexadecimal tag has an uneven number of digits!"};
+
+                std::vector<std::byte> byte_array((value_size - 1) / 2);
+
+                for (size_t i = 0; i < byte_array.size(); ++i)
+                {
+                    std::string_view const hex{it + 2 * i, 2};
+                    uint8_t value{};
+                    auto res = std::from_chars(hex.data(), hex.data() + 2, value, 16);
+
+                    if (res.ec != std::errc{} || res.ptr != hex.data() + 2)
+                        throw format_error{detail::to_string("Could not parse the hexadecimal value '", hex, "'.")};
+
+                    byte_array[i] = static_cast<std::byte>(value);
+                }
+
+                return byte_array;
+            }
+            default: // 'B'
+            {
+                int32_t const count = read_number<int32_t>(it + 1);
+
+                switch (it[0])
+                {
+                    case 'c': return read_array<int8_t>(it + 5, count);
+                    case 'C': return read_array<uint8_t>(it + 5, count);
+                    case 's': return read_array<int16_t>(it + 5, count);
+                    case 'S': return read_array<uint16_t>(it + 5, count);
+                    case 'i': return read_array<int32_t>(it + 5, count);
+                    case 'I': return read_array<uint32_t>(it + 5, count);
+                    default:  return read_array<float>(it + 5, count); // 'f', checked by tag_value_size
+                }
+            }
+        }
+    }
+};
+
+} // namespace seqan3
@@ -20,6 +20,7 @@
 
 #include <seqan3/alphabet/nucleotide/dna16sam.hpp>
 #include <seqan3/core/debug_stream/optional.hpp>
+#include <seqan3/io/sam_file/bam_lazy_record.hpp>
 #include <seqan3/io/sam_file/detail/cigar.hpp>
 #include <seqan3/io/sam_file/detail/format_sam_base.hpp>
 #include <seqan3/io/sam_file/header.hpp>
@@ -89,8 +90,8 @@ protected:
               typename tag_dict_type,
               typename e_value_type,
               typename bit_score_type>
-    void read_alignment_record(stream_type & stream,
-                               sam_file_input_options<seq_legal_alph_type> const & SEQAN3_DOXYGEN_ONLY(options),
+    bool read_alignment_record(stream_type & stream,
+                               sam_file_input_options<seq_legal_alph_type> const & options,
                                ref_seqs_type & ref_seqs,
                                sam_file_header<ref_ids_type> & header,
                                stream_pos_type & position_buffer,
@@ -140,6 +141,23 @@ protected:
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(e_value),
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(bit_score));
 
+    template <typename stream_type,
+              typename seq_legal_alph_type,
+              typename ref_seqs_type,
+              typename ref_ids_type,
+              typename stream_pos_type>
+    bool read_lazy_alignment_record(stream_type & stream,
+                                    sam_file_input_options<seq_legal_alph_type> const & options,
+                                    ref_seqs_type & ref_seqs,
+                                    sam_file_header<ref_ids_type> & header,
+                                    stream_pos_type & position_buffer,
+                                    bam_lazy_record & record);
+
+    template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+    void read_alignment_header(stream_type & stream,
+                               ref_seqs_type & ref_seqs,
+                               sam_file_header<ref_ids_type> & header);
+
 private:
     //!\brief A variable that tracks whether the content of header has been read or not.
     bool header_was_read{false};
@@ -222,6 +240,11 @@ private:
         std::ranges::copy_n(std::ranges::begin(stream_view), sizeof(int32_t), reinterpret_cast<char *>(&target));
     }
 
+    template <typename stream_view_type, typename ref_seqs_type, typename ref_ids_type>
+    void read_header_block(stream_view_type && stream_view,
+                           sam_file_header<ref_ids_type> & header,
+                           ref_seqs_type & ref_seqs);
+
     template <typename stream_view_type, typename value_type>
     void read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant,
                               stream_view_type && stream_view,
@@ -257,8 +280,8 @@ template <typename stream_type,     // constraints checked by file
           typename tag_dict_type,
           typename e_value_type,
           typename bit_score_type>
-inline void format_bam::read_alignment_record(stream_type & stream,
-                                              sam_file_input_options<seq_legal_alph_type> const & SEQAN3_DOXYGEN_ONLY(options),
+inline bool format_bam::read_alignment_record(stream_type & stream,
+                                              sam_file_input_options<seq_legal_alph_type> const & options,
                                               ref_seqs_type & ref_seqs,
                                               sam_file_header<ref_ids_type> & header,
                                               stream_pos_type & position_buffer,
@@ -300,73 +323,11 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if (!header_was_read)
     {
-        // magic BAM string
-        if (!std::ranges::equal(stream_view | detail::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
-            throw format_error{"File is not in BAM format."};
-
-        int32_t l_text{}; // length of header text including \0 character
-        int32_t n_ref{}; // number of reference sequences
-        int32_t l_name{}; // 1 + length of reference name including \0 character
-        int32_t l_ref{}; // length of reference sequence
-
-        read_integral_byte_field(stream_view, l_text);
-
-        if (l_text > 0) // header text is present
-            read_header(stream_view | detail::take_exactly_or_throw(l_text), header, ref_seqs);
-
-        read_integral_byte_field(stream_view, n_ref);
-
-        for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
-        {
-            read_integral_byte_field(stream_view, l_name);
-
-            string_buffer.resize(l_name - 1);
-            std::ranges::copy_n(std::ranges::begin(stream_view), l_name - 1, string_buffer.data()); // copy without \0 character
-            ++std::ranges::begin(stream_view); // skip \0 character
-
-            read_integral_byte_field(stream_view, l_ref);
-
-            if constexpr (detail::decays_to_ignore_v<ref_seqs_type>) // no reference information given
-            {
-                // If there was no header text, we parse reference sequences block as header information
-                if (l_text == 0)
-                {
-                    auto & reference_ids = header.ref_ids();
-                    // put the length of the reference sequence into ref_id_info
-                    header.ref_id_info.emplace_back(l_ref, "");
-                    // put the reference name into reference_ids
-                    reference_ids.push_back(string_buffer);
-                    // assign the reference name an ascending reference id (starts at index 0).
-                    header.ref_dict.emplace(reference_ids.back(), reference_ids.size() - 1);
-                    continue;
-                }
-            }
-
-            auto id_it = header.ref_dict.find(string_buffer);
-
-            // sanity checks of reference information to existing header object:
-            if (id_it == header.ref_dict.end()) // [unlikely]
-            {
-                throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
-                                                     "' found in BAM file header (header.ref_ids():",
-                                                     header.ref_ids(), ").")};
-            }
-            else if (id_it->second != ref_idx) // [unlikely]
-            {
-                throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
-                                                     " does not correspond to the position ", id_it->second,
-                                                     " in the header (header.ref_ids():", header.ref_ids(), ").")};
-            }
-            else if (std::get<0>(header.ref_id_info[id_it->second]) != l_ref) // [unlikely]
-            {
-                throw format_error{"Provided reference has unequal length as specified in the header."};
-            }
-        }
-
+        read_header_block(stream_view, header, ref_seqs);
         header_was_read = true;
 
         if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // no records follow
-            return;
+            return false;
     }
 
     // read alignment record into buffer
@@ -380,11 +341,23 @@ inline void format_bam::read_alignment_record(stream_type & stream,
         throw format_error{detail::to_string("Reference id index '", core.refID, "' is not in range of ",
                                              "header.ref_ids(), which has size ", header.ref_ids().size(), ".")};
     }
-    else if (core.refID > -1) // not unmapped
+
+    if (options.record_filter &&
+        !options.record_filter(sam_record_core_fields{core.flag, static_cast<uint8_t>(core.mapq),
+                                                      core.refID, core.pos, core.tlen}))
     {
-        ref_id = core.refID;                                                   // field::ref_id
+        // skip the variable-length part of the record without decoding it
+        std::streamsize const remaining = core.block_size - (sizeof(core) - sizeof(core.block_size));
+
+        if (stream.ignore(remaining).gcount() != remaining) // [[unlikely]]
+            throw unexpected_end_of_input{"Reached end of input before the end of the BAM record."};
+
+        return false;
     }
 
+    if (core.refID > -1) // not unmapped
+        ref_id = core.refID;                                                   // field::ref_id
+
     flag = core.flag;                                                          // field::flag
     mapq = core.mapq;                                                          // field::mapq
 
@@ -600,6 +573,184 @@ inline void format_bam::read_alignment_record(stream_type & stream,
 
     if constexpr (!detail::decays_to_ignore_v<cigar_type>)
         std::swap(cigar_vector, tmp_cigar_vector);
+
+    return true;
+}
+
+/*!\brief Reads the next BAM record into a seqan3::bam_lazy_record without decoding its variable-length fields.
+ * \tparam stream_type      The input stream type; must be derived from std::istream.
+ * \tparam ref_seqs_type    The type of the reference sequences; std::ignore if no reference information was given.
+ * \tparam ref_ids_type     The type of the reference ids stored in the header.
+ * \tparam stream_pos_type  The type of the position buffer.
+ * \param[in, out] stream           The input stream to read from.
+ * \param[in]      options          File specific options passed to the format.
+ * \param[in]      ref_seqs         The reference sequences given on construction of the file.
+ * \param[in, out] header           The header of the file; read on the first call.
+ * \param[out]     position_buffer  The position of the record in the stream.
+ * \param[out]     record           The record to fill with the raw bytes of the alignment block.
+ * \returns `false` if the file contains no further record, `true` otherwise.
+ * \throws seqan3::format_error if the record is malformed.
+ * \throws seqan3::unexpected_end_of_input if the stream ends within the record.
+ *
+ * \details
+ *
+ * The alignment block is copied with a single read from the stream buffer. Only the reference id is validated against
+ * the header; all other fields are decoded by the seqan3::bam_lazy_record on access. Records rejected by
+ * seqan3::sam_file_input_options::record_filter are skipped.
+ */
+template <typename stream_type,
+          typename seq_legal_alph_type,
+          typename ref_seqs_type,
+          typename ref_ids_type,
+          typename stream_pos_type>
+inline bool format_bam::read_lazy_alignment_record(stream_type & stream,
+                                                   sam_file_input_options<seq_legal_alph_type> const & options,
+                                                   ref_seqs_type & ref_seqs,
+                                                   sam_file_header<ref_ids_type> & header,
+                                                   stream_pos_type & position_buffer,
+                                                   bam_lazy_record & record)
+{
+    auto stream_view = seqan3::detail::istreambuf(stream);
+
+    read_alignment_header(stream, ref_seqs, header);
+
+    while (true)
+    {
+        if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // no records follow
+            return false;
+
+        position_buffer = stream.tellg();
+
+        int32_t block_size{};
+        std::ranges::copy(stream_view | detail::take_exactly_or_throw(sizeof(block_size)),
+                          reinterpret_cast<char *>(&block_size));
+
+        if (block_size < 0) // [[unlikely]]
+            throw format_error{detail::to_string("The BAM record has a negative block size of ", block_size, ".")};
+
+        std::string & buffer = record.raw_buffer();
+        buffer.resize(block_size);
+
+        if (stream.rdbuf()->sgetn(buffer.data(), block_size) != block_size) // [[unlikely]]
+            throw unexpected_end_of_input{"Reached end of input before the end of the BAM record."};
+
+        record.reset();
+
+        int32_t const ref_id = record.reference_id().value_or(-1);
+
+        if (ref_id >= static_cast<int32_t>(header.ref_ids().size())) // [[unlikely]]
+        {
+            throw format_error{detail::to_string("Reference id index '", ref_id, "' is not in range of ",
+                                                 "header.ref_ids(), which has size ", header.ref_ids().size(), ".")};
+        }
+
+        if (!options.record_filter ||
+            options.record_filter(sam_record_core_fields{record.flag(), record.mapping_quality(), ref_id,
+                                                         record.reference_position().value_or(-1),
+                                                         std::get<2>(record.mate())}))
+        {
+            return true;
+        }
+    }
+}
+
+/*!\brief Reads the BAM header block if it has not been read yet and leaves the first record in the stream.
+ * \tparam stream_type   The input stream type; must be derived from std::istream.
+ * \tparam ref_seqs_type The type of the reference sequences; std::ignore if no reference information was given.
+ * \tparam ref_ids_type  The type of the reference ids stored in the header.
+ * \param[in, out] stream   The input stream to read from.
+ * \param[in]      ref_seqs The reference sequences given on construction of the file.
+ * \param[in, out] header   The header to fill.
+ * \throws seqan3::format_error if the header is malformed or inconsistent with the given reference information.
+ */
+template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+inline void format_bam::read_alignment_header(stream_type & stream,
+                                              ref_seqs_type & ref_seqs,
+                                              sam_file_header<ref_ids_type> & header)
+{
+    if (!header_was_read)
+    {
+        read_header_block(seqan3::detail::istreambuf(stream), header, ref_seqs);
+        header_was_read = true;
+    }
+}
+
+/*!\brief Reads the BAM header block: the magic string, the SAM header text and the reference information.
+ * \tparam stream_view_type The type of the stream as a view.
+ * \tparam ref_seqs_type    The type of the reference sequences; std::ignore if no reference information was given.
+ * \tparam ref_ids_type     The type of the reference ids stored in the header.
+ * \param[in, out] stream_view The stream view to read from.
+ * \param[in, out] header      The header to fill; reference information is checked against it if given.
+ * \param[in]      ref_seqs    The reference sequences given on construction of the file.
+ * \throws seqan3::format_error if the header is malformed or inconsistent with the given reference information.
+ */
+template <typename stream_view_type, typename ref_seqs_type, typename ref_ids_type>
+inline void format_bam::read_header_block(stream_view_type && stream_view,
+                                          sam_file_header<ref_ids_type> & header,
+                                          [[maybe_unused]] ref_seqs_type & ref_seqs)
+{
+    // magic BAM string
+    if (!std::ranges::equal(stream_view | detail::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
+        throw format_error{"File is not in BAM format."};
+
+    int32_t l_text{}; // length of header text including \0 character
+    int32_t n_ref{}; // number of reference sequences
+    int32_t l_name{}; // 1 + length of reference name including \0 character
+    int32_t l_ref{}; // length of reference sequence
+
+    read_integral_byte_field(stream_view, l_text);
+
+    if (l_text > 0) // header text is present
+        read_header(stream_view | detail::take_exactly_or_throw(l_text), header, ref_seqs);
+
+    read_integral_byte_field(stream_view, n_ref);
+
+    for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+    {
+        read_integral_byte_field(stream_view, l_name);
+
+        string_buffer.resize(l_name - 1);
+        std::ranges::copy_n(std::ranges::begin(stream_view), l_name - 1, string_buffer.data()); // copy without \0 character
+        ++std::ranges::begin(stream_view); // skip \0 character
+
+        read_integral_byte_field(stream_view, l_ref);
+
+        if constexpr (detail::decays_to_ignore_v<ref_seqs_type>) // no reference information given
+        {
+            // If there was no header text, we parse reference sequences block as header information
+            if (l_text == 0)
+            {
+                auto & reference_ids = header.ref_ids();
+                // put the length of the reference sequence into ref_id_info
+                header.ref_id_info.emplace_back(l_ref, "");
+                // put the reference name into reference_ids
+                reference_ids.push_back(string_buffer);
+                // assign the reference name an ascending reference id (starts at index 0).
+                header.ref_dict.emplace(reference_ids.back(), reference_ids.size() - 1);
+                continue;
+            }
+        }
+
+        auto id_it = header.ref_dict.find(string_buffer);
+
+        // sanity checks of reference information to existing header object:
+        if (id_it == header.ref_dict.end()) // [unlikely]
+        {
+            throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
+                                                 "' found in BAM file header (header.ref_ids():",
+                                                 header.ref_ids(), ").")};
+        }
+        else if (id_it->second != ref_idx) // [unlikely]
+        {
+            throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
+                                                 " does not correspond to the position ", id_it->second,
+                                                 " in the header (header.ref_ids():", header.ref_ids(), ").")};
+        }
+        else if (std::get<0>(header.ref_id_info[id_it->second]) != l_ref) // [unlikely]
+        {
+            throw format_error{"Provided reference has unequal length as specified in the header."};
+        }
+    }
 }
 
 //!\copydoc sam_file_output_format::write_alignment_record
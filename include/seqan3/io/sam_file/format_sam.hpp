@@ -179,8 +179,8 @@ protected:
               typename tag_dict_type,
               typename e_value_type,
               typename bit_score_type>
-    void read_alignment_record(stream_type & stream,
-                               sam_file_input_options<seq_legal_alph_type> const & SEQAN3_DOXYGEN_ONLY(options),
+    bool read_alignment_record(stream_type & stream,
+                               sam_file_input_options<seq_legal_alph_type> const & options,
                                ref_seqs_type & ref_seqs,
                                sam_file_header<ref_ids_type> & header,
                                stream_pos_type & position_buffer,
@@ -369,8 +369,8 @@ template <typename stream_type,     // constraints checked by file
           typename tag_dict_type,
           typename e_value_type,
           typename bit_score_type>
-inline void format_sam::read_alignment_record(stream_type & stream,
-                                              sam_file_input_options<seq_legal_alph_type> const & SEQAN3_DOXYGEN_ONLY(options),
+inline bool format_sam::read_alignment_record(stream_type & stream,
+                                              sam_file_input_options<seq_legal_alph_type> const & options,
                                               ref_seqs_type & ref_seqs,
                                               sam_file_header<ref_ids_type> & header,
                                               stream_pos_type & position_buffer,
@@ -412,7 +412,7 @@ inline void format_sam::read_alignment_record(stream_type & stream,
         read_header(stream_view, header, ref_seqs);
 
         if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // file has no records
-            return;
+            return false;
     }
 
     // Store the current file position in the buffer.
@@ -442,10 +442,22 @@ inline void format_sam::read_alignment_record(stream_type & stream,
     else if (ref_offset_tmp < -1)
         throw format_error{"No negative values are allowed for field::ref_offset."};
 
+    // the core fields are only collected if they are needed by the record filter
+    [[maybe_unused]] sam_record_core_fields core{sam_flag{flag_integral}, 255u, -1, ref_offset_tmp, 0};
+
     if constexpr (!detail::decays_to_ignore_v<mapq_type>)
+    {
         read_arithmetic_field(field_view, mapq);
+        core.mapping_quality = static_cast<uint8_t>(mapq);
+    }
+    else if (options.record_filter)
+    {
+        read_arithmetic_field(field_view, core.mapping_quality);
+    }
     else
+    {
         detail::consume(field_view);
+    }
 
     // Field 6: CIGAR
     // -------------------------------------------------------------------------------------------------------------
@@ -498,13 +510,34 @@ inline void format_sam::read_alignment_record(stream_type & stream,
         // tmp_pnext == 0 indicates an unmapped mate -> do not fill std::optional get<1>(mate)
 
         read_arithmetic_field(field_view, get<2>(mate)); // TLEN
+        core.template_length = get<2>(mate);
     }
     else
     {
-        for (size_t i = 0; i < 3u; ++i)
+        for (size_t i = 0; i < 2u; ++i)
         {
             detail::consume(field_view);
         }
+
+        if (options.record_filter)
+            read_arithmetic_field(field_view, core.template_length);
+        else
+            detail::consume(field_view);
+    }
+
+    // Filter on the fixed-size fields before the variable-length fields are read
+    // -------------------------------------------------------------------------------------------------------------
+    if (options.record_filter)
+    {
+        if (auto search = header.ref_dict.find(ref_id_tmp); search != header.ref_dict.end())
+            core.reference_id = search->second;
+
+        if (!options.record_filter(core))
+        {
+            detail::consume(stream_view | detail::take_until(is_char<'\r'> || is_char<'\n'>)); // skip the record
+            detail::consume(stream_view | detail::take_until(!(is_char<'\r'> || is_char<'\n'>))); // consume new line
+            return false;
+        }
     }
 
     // Field 10: Sequence
@@ -631,6 +664,8 @@ inline void format_sam::read_alignment_record(stream_type & stream,
 
     if constexpr (!detail::decays_to_ignore_v<cigar_type>)
         std::swap(cigar_vector, tmp_cigar_vector);
+
+    return true;
 }
 
 //!\copydoc sam_file_output_format::write_alignment_record
@@ -718,8 +718,8 @@ public:
      */
     header_type & header()
     {
-        // make sure header is read
-        if (!first_record_was_read)
+        // make sure header is read; formats that can read the header on its own leave the first record in the stream
+        if (!first_record_was_read && !read_header_only())
         {
             read_next_record();
             first_record_was_read = true;
@@ -728,6 +728,70 @@ public:
         return *header_ptr;
     }
 
+    /*!\brief Reads the next record into a seqan3::bam_lazy_record without decoding its variable-length fields.
+     * \param[out] record The record to overwrite with the raw bytes of the next alignment block.
+     * \returns `false` if there are no more records in the file, `true` otherwise.
+     * \throws seqan3::format_error if the format does not support lazy reading or if the record is malformed.
+     *
+     * \details
+     *
+     * Lazy reading is supported by seqan3::format_bam. The fields of the record are decoded on first access, which
+     * makes passes that discard most records considerably cheaper than iterating over the file.
+     *
+     * Records rejected by seqan3::sam_file_input_options::record_filter are skipped.
+     *
+     * Lazy reading and the range interface advance the same stream; do not mix both on the same file object.
+     * The header can be accessed via header() before and after calling this function.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bool read_lazy_record(bam_lazy_record & record)
+    {
+        prepare_stream();
+
+        first_record_was_read = true; // header() must not buffer a record from now on
+
+        if (at_end)
+            return false;
+
+        auto call_read_func = [this, &record] (auto & ref_seq_info)
+        {
+            return std::visit([&] (auto & f) -> bool
+            {
+                if constexpr (requires { f.read_lazy_alignment_record(*secondary_stream,
+                                                                      options,
+                                                                      ref_seq_info,
+                                                                      *header_ptr,
+                                                                      position_buffer,
+                                                                      record); })
+                {
+                    return f.read_lazy_alignment_record(*secondary_stream,
+                                                        options,
+                                                        ref_seq_info,
+                                                        *header_ptr,
+                                                        position_buffer,
+                                                        record);
+                }
+                else
+                {
+                    throw format_error{"Lazy reading of records is only supported for the BAM format."};
+                }
+            }, format);
+        };
+
+        assert(!format.valueless_by_exception());
+
+        bool has_record{};
+
+        if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+            has_record = call_read_func(*reference_sequences_ptr);
+        else
+            has_record = call_read_func(std::ignore);
+
+        at_end = !has_record;
+        return has_record;
+    }
+
 protected:
     //!\privatesection
 
@@ -741,7 +805,12 @@ protected:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
+        std::filesystem::path const path = filename;
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
+
+        if (secondary_stream.get() == primary_stream.get()) // not compressed
+            file_path = path;
+
         detail::set_format(format, filename);
     }
 
@@ -785,11 +854,17 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief The path of the file if it was opened by name and is not compressed; used for memory mapping.
+    std::filesystem::path file_path{};
+    //!\brief The memory mapped stream buffer that replaces the file buffer if `options.memory_map` is set.
+    std::unique_ptr<memory_mapped_streambuf> mapped_buffer{};
 
     //!\brief Tracks whether the very first record is buffered when calling begin().
     bool first_record_was_read{false};
     //!\brief File is one position behind the last record.
     bool at_end{false};
+    //!\brief Tracks whether the stream related options have been applied.
+    bool stream_is_prepared{false};
 
     //!\brief Type of the format, a std::variant over the `valid_formats`.
     using format_type = typename detail::variant_from_tags<valid_formats,
@@ -844,54 +919,118 @@ protected:
     }
     //!\}
 
-    //!\brief Tell the format to move to the next record and update the buffer.
-    void read_next_record()
+    //!\brief Applies the stream related options before the stream is read from for the first time.
+    void prepare_stream()
     {
-        // clear the record
-        record_buffer.clear();
-        detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
-
-        // at end if we could not read further
-        if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
-            std::istreambuf_iterator<stream_char_type>{})
-        {
-            at_end = true;
+        if (stream_is_prepared)
             return;
-        }
 
-        auto call_read_func = [this] (auto & ref_seq_info)
+        detail::set_bgzf_thread_options(*secondary_stream, options.bgzf_threads);
+
+        if (options.memory_map && !file_path.empty())
+            mapped_buffer = detail::memory_map_stream(*primary_stream, file_path, options.memory_map_populate);
+
+        stream_is_prepared = true;
+    }
+
+    /*!\brief Reads only the header if the format supports it.
+     * \returns `true` if the header was read, `false` if the format can only read the header with the first record.
+     */
+    bool read_header_only()
+    {
+        auto call_read_func = [this] (auto & ref_seq_info) -> bool
         {
-            std::visit([&] (auto & f)
+            return std::visit([&] (auto & f) -> bool
             {
-                f.read_alignment_record(*secondary_stream,
-                                        options,
-                                        ref_seq_info,
-                                        *header_ptr,
-                                        position_buffer,
-                                        detail::get_or_ignore<field::seq>(record_buffer),
-                                        detail::get_or_ignore<field::qual>(record_buffer),
-                                        detail::get_or_ignore<field::id>(record_buffer),
-                                        detail::get_or_ignore<field::offset>(record_buffer),
-                                        detail::get_or_ignore<field::ref_seq>(record_buffer),
-                                        detail::get_or_ignore<field::ref_id>(record_buffer),
-                                        detail::get_or_ignore<field::ref_offset>(record_buffer),
-                                        detail::get_or_ignore<field::alignment>(record_buffer),
-                                        detail::get_or_ignore<field::cigar>(record_buffer),
-                                        detail::get_or_ignore<field::flag>(record_buffer),
-                                        detail::get_or_ignore<field::mapq>(record_buffer),
-                                        detail::get_or_ignore<field::mate>(record_buffer),
-                                        detail::get_or_ignore<field::tags>(record_buffer),
-                                        detail::get_or_ignore<field::evalue>(record_buffer),
-                                        detail::get_or_ignore<field::bit_score>(record_buffer));
+                if constexpr (requires { f.read_alignment_header(*secondary_stream, ref_seq_info, *header_ptr); })
+                {
+                    prepare_stream();
+                    f.read_alignment_header(*secondary_stream, ref_seq_info, *header_ptr);
+                    return true;
+                }
+                else
+                {
+                    return false;
+                }
             }, format);
         };
 
         assert(!format.valueless_by_exception());
 
         if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
-            call_read_func(*reference_sequences_ptr);
+            return call_read_func(*reference_sequences_ptr);
         else
-            call_read_func(std::ignore);
+            return call_read_func(std::ignore);
+    }
+
+    //!\brief Tell the format to move to the next record and update the buffer.
+    void read_next_record()
+    {
+        prepare_stream();
+
+        auto call_read_func = [this] (auto & ref_seq_info) -> bool
+        {
+            return std::visit([&] (auto & f) -> bool
+            {
+                auto read_record = [&] ()
+                {
+                    return f.read_alignment_record(*secondary_stream,
+                                                   options,
+                                                   ref_seq_info,
+                                                   *header_ptr,
+                                                   position_buffer,
+                                                   detail::get_or_ignore<field::seq>(record_buffer),
+                                                   detail::get_or_ignore<field::qual>(record_buffer),
+                                                   detail::get_or_ignore<field::id>(record_buffer),
+                                                   detail::get_or_ignore<field::offset>(record_buffer),
+                                                   detail::get_or_ignore<field::ref_seq>(record_buffer),
+                                                   detail::get_or_ignore<field::ref_id>(record_buffer),
+                                                   detail::get_or_ignore<field::ref_offset>(record_buffer),
+                                                   detail::get_or_ignore<field::alignment>(record_buffer),
+                                                   detail::get_or_ignore<field::cigar>(record_buffer),
+                                                   detail::get_or_ignore<field::flag>(record_buffer),
+                                                   detail::get_or_ignore<field::mapq>(record_buffer),
+                                                   detail::get_or_ignore<field::mate>(record_buffer),
+                                                   detail::get_or_ignore<field::tags>(record_buffer),
+                                                   detail::get_or_ignore<field::evalue>(record_buffer),
+                                                   detail::get_or_ignore<field::bit_score>(record_buffer));
+                };
+
+                if constexpr (std::same_as<decltype(read_record()), void>) // format cannot skip records
+                {
+                    read_record();
+                    return true;
+                }
+                else
+                {
+                    return read_record();
+                }
+            }, format);
+        };
+
+        assert(!format.valueless_by_exception());
+
+        // formats return false if a record was skipped, e.g. because it was rejected by options.record_filter
+        bool record_was_read{false};
+        while (!record_was_read)
+        {
+            // clear the record
+            record_buffer.clear();
+            detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
+
+            // at end if we could not read further
+            if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
+                std::istreambuf_iterator<stream_char_type>{})
+            {
+                at_end = true;
+                return;
+            }
+
+            if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+                record_was_read = call_read_func(*reference_sequences_ptr);
+            else
+                record_was_read = call_read_func(std::ignore);
+        }
     }
 
     //!\brief Befriend iterator so it can access the buffers.
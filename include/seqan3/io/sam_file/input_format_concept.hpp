@@ -40,7 +40,8 @@ namespace seqan3::detail
  * \details
  *
  * Exposes the protected member function `read_alignment_record` from the given `format_type`, such that the file can
- * call the proper function for the selected format.
+ * call the proper function for the selected format. If the format offers lazy reading, `read_lazy_alignment_record`
+ * is exposed as well.
  */
 template <typename format_type>
 struct sam_file_input_format_exposer : public format_type
@@ -50,9 +51,23 @@ public:
     // for types that do not model the format concept, i.e. don't offer the proper read_alignment_record interface.
     //!\brief Forwards to the seqan3::sam_file_input_format::read_alignment_record interface.
     template <typename ...ts>
-    void read_alignment_record(ts && ...args)
+    auto read_alignment_record(ts && ...args)
+        -> decltype(format_type::read_alignment_record(std::forward<ts>(args)...))
     {
-        format_type::read_alignment_record(std::forward<ts>(args)...);
+        return format_type::read_alignment_record(std::forward<ts>(args)...);
+    }
+
+    //!\brief Forwards to the `read_lazy_alignment_record` interface if the format offers one (e.g. seqan3::format_bam).
+    template <typename ...ts>
+    //!\cond
+        requires requires (sam_file_input_format_exposer & f, ts && ...args)
+        {
+            { f.format_type::read_lazy_alignment_record(std::forward<ts>(args)...) };
+        }
+    //!\endcond
+    bool read_lazy_alignment_record(ts && ...args)
+    {
+        return format_type::read_lazy_alignment_record(std::forward<ts>(args)...);
     }
 };
 
@@ -219,6 +234,9 @@ concept sam_file_input_format =
  *   * The function must also accept std::ignore as parameter for any of the fields,
  *     except stream, options and header. [This is enforced by the concept checker!]
  *   * In this case the data read for that field shall be discarded by the format.
+ *   * The function may return `bool` instead of `void`. A return value of `false` signals that no record was read,
+ *     e.g. because it was rejected by seqan3::sam_file_input_options::record_filter; the file then reads the next
+ *     record.
  */
  /*!\var static inline std::vector<std::string> seqan3::sam_file_input_format::file_extensions
  * \brief The format type is required to provide a vector of all supported file extensions.
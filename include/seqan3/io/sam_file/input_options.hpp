@@ -12,11 +12,40 @@
 
 #pragma once
 
-#include <seqan3/core/platform.hpp>
+#include <cstdint>
+#include <functional>
+
+#include <seqan3/io/sam_file/sam_flag.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
 
 namespace seqan3
 {
 
+/*!\brief The fixed-size fields of an alignment record that are available before the record is fully parsed.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * An object of this type is handed to seqan3::sam_file_input_options::record_filter. For seqan3::format_bam the
+ * values are taken directly from the fixed-size part of the record, for seqan3::format_sam from the first nine
+ * columns. Unset values are represented as in the BAM format, i.e. by `-1`.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+struct sam_record_core_fields
+{
+    //!\brief The SAM flag of the record.
+    sam_flag flag{sam_flag::none};
+    //!\brief The mapping quality of the record (255 if not available).
+    uint8_t mapping_quality{255u};
+    //!\brief The index of the reference in seqan3::sam_file_header::ref_ids() or -1 if the read is unmapped.
+    int32_t reference_id{-1};
+    //!\brief The 0-based position in the reference or -1 if the read is unmapped.
+    int32_t reference_position{-1};
+    //!\brief The observed template length.
+    int32_t template_length{0};
+};
+
 /*!\brief The options type defines various option members that influence the behaviour of all or some formats.
  * \ingroup io_sam_file
  *
@@ -25,7 +54,43 @@ namespace seqan3
 template <typename sequence_legal_alphabet>
 struct sam_file_input_options
 {
-    // options to define
+    /*!\brief A predicate over the fixed-size record fields; records for which it returns `false` are skipped.
+     *
+     * \details
+     *
+     * The filter is evaluated before the variable-length fields (sequence, qualities, tags, ...) are decoded.
+     * Rejected records are skipped without being materialised, e.g. `[] (auto const & r) { return r.mapping_quality
+     * >= 20; }` drops all records with a mapping quality below 20. No filtering is done if the filter is empty.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    std::function<bool(sam_record_core_fields const &)> record_filter{};
+
+    /*!\brief The thread pool and the concurrency limits used if the file is BGZF compressed.
+     *
+     * \details
+     *
+     * The options are applied when the first record is read; changing them afterwards has no effect.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bgzf_thread_options bgzf_threads{};
+
+    /*!\brief Read the file through a memory mapping instead of a file stream (see seqan3::memory_mapped_streambuf).
+     *
+     * \details
+     *
+     * Only applies to uncompressed files that were opened by name; it is ignored otherwise. The mapping is created when
+     * the first record is read; changing the option afterwards has no effect.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bool memory_map = false;
+    /*!\brief Read in all pages of the file when it is mapped (Linux only); see #memory_map.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bool memory_map_populate = false;
 };
 
 } // namespace seqan3
@@ -631,6 +631,8 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief Tracks whether a record has been written, i.e. whether the options were passed to the stream.
+    bool first_record_was_written{false};
 
     //!\brief Type of the format, a std::variant over the `valid_formats`.
     using format_type = typename detail::variant_from_tags<valid_formats,
@@ -682,6 +684,13 @@ protected:
 
         assert(!format.valueless_by_exception());
 
+        if (!first_record_was_written) // nothing has been compressed yet
+        {
+            detail::set_bgzf_thread_options(*secondary_stream, options.bgzf_threads);
+            detail::set_gz_compression_level(*secondary_stream, options.gz_compression_level);
+            first_record_was_written = true;
+        }
+
         std::visit([&] (auto & f)
         {
             // use header from record if explicitly given, e.g. file_output = file_input
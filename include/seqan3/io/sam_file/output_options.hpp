@@ -12,7 +12,7 @@
 
 #pragma once
 
-#include <seqan3/core/platform.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
 
 namespace seqan3
 {
@@ -42,6 +42,27 @@ struct sam_file_output_options
      * `false`.
      */
     bool sam_require_header = true;
+
+    /*!\brief The thread pool and the concurrency limits used if the file is BGZF or gzip compressed.
+     *
+     * \details
+     *
+     * The options are applied when the first record is written; changing them afterwards has no effect.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bgzf_thread_options bgzf_threads{};
+
+    /*!\brief The zlib compression level (0 to 9) used if the file is gzip compressed; -1 selects the zlib default.
+     *
+     * \details
+     *
+     * Files with the extension `.gz` are compressed block-wise in parallel, see #bgzf_threads. The level is
+     * applied when the first record is written; changing it afterwards has no effect.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    int gz_compression_level{-1};
 };
 
 } // namespace seqan3
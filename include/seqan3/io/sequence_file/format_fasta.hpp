@@ -27,6 +27,7 @@
 #include <seqan3/alphabet/views/to_char.hpp>
 #include <seqan3/core/range/detail/misc.hpp>
 #include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/io/detail/bulk_read.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
@@ -277,51 +278,84 @@ private:
         {
             auto constexpr is_legal_alph = char_is_valid_for<seq_legal_alph_type>;
 
-        #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
-            auto it = stream_view.begin();
-            auto e = stream_view.end();
+            // Valid characters are validated and converted in bulk on the buffer of the stream; only the characters
+            // that are skipped or rejected are looked at one at a time.
+            if constexpr (detail::none_is_valid_for<seq_legal_alph_type>(" \t\n\v\f\r0123456789>;") &&
+                          requires (std::ranges::iterator_t<stream_view_t> & it)
+                          {
+                              detail::bulk_read_legal_chars<seq_legal_alph_type>(it, seq);
+                          })
+            {
+                auto it = stream_view.begin();
+                auto e = stream_view.end();
 
-            if (it == e)
-                throw unexpected_end_of_input{"No sequence information given!"};
+                if (it == e)
+                    throw unexpected_end_of_input{"No sequence information given!"};
 
-            for (; (it != e) && ((!is_id)(*it)); ++it)
-            {
-                if ((is_space || is_digit)(*it))
-                    continue;
-                else if (!is_legal_alph(*it))
+                while (true)
                 {
-                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                      "char_is_valid_for<" +
-                                      detail::type_name_as_string<seq_legal_alph_type> +
-                                      "> evaluated to false on " +
-                                      detail::make_printable(*it)};
-                }
+                    detail::bulk_read_legal_chars<seq_legal_alph_type>(it, seq);
 
-                seq.push_back(assign_char_to(*it, std::ranges::range_value_t<seq_type>{}));
+                    if (it == e || is_id(*it))
+                        break;
+                    else if ((is_space || is_digit)(*it))
+                        ++it;
+                    else
+                        throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                          "char_is_valid_for<" +
+                                          detail::type_name_as_string<seq_legal_alph_type> +
+                                          "> evaluated to false on " +
+                                          detail::make_printable(*it)};
+                }
             }
+            else
+            {
+            #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+                auto it = stream_view.begin();
+                auto e = stream_view.end();
+
+                if (it == e)
+                    throw unexpected_end_of_input{"No sequence information given!"};
 
-        #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
+                for (; (it != e) && ((!is_id)(*it)); ++it)
+                {
+                    if ((is_space || is_digit)(*it))
+                        continue;
+                    else if (!is_legal_alph(*it))
+                    {
+                        throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                          "char_is_valid_for<" +
+                                          detail::type_name_as_string<seq_legal_alph_type> +
+                                          "> evaluated to false on " +
+                                          detail::make_printable(*it)};
+                    }
 
-            if (std::ranges::begin(stream_view) == std::ranges::end(stream_view))
-                throw unexpected_end_of_input{"No sequence information given!"};
+                    seq.push_back(assign_char_to(*it, std::ranges::range_value_t<seq_type>{}));
+                }
 
-            std::ranges::copy(stream_view | detail::take_until(is_id)                  // until next header (or end)
-                                          | std::views::filter(!(is_space || is_digit))// ignore whitespace and numbers
-                                          | std::views::transform([is_legal_alph] (char const c)
-                                            {
-                                                if (!is_legal_alph(c))
+            #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
+
+                if (std::ranges::begin(stream_view) == std::ranges::end(stream_view))
+                    throw unexpected_end_of_input{"No sequence information given!"};
+
+                std::ranges::copy(stream_view | detail::take_until(is_id)                  // until next header (or end)
+                                              | std::views::filter(!(is_space || is_digit))// ignore whitespace and numbers
+                                              | std::views::transform([is_legal_alph] (char const c)
                                                 {
-                                                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                                      "char_is_valid_for<" +
-                                                                      detail::type_name_as_string<seq_legal_alph_type> +
-                                                                      "> evaluated to false on " +
-                                                                      detail::make_printable(c)};
-                                                }
-                                                return c;
-                                            })                                      // enforce legal alphabet
-                                          | views::char_to<std::ranges::range_value_t<seq_type>>, // convert to actual target alphabet
-                              std::cpp20::back_inserter(seq));
-        #endif // SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+                                                    if (!is_legal_alph(c))
+                                                    {
+                                                        throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                                                          "char_is_valid_for<" +
+                                                                          detail::type_name_as_string<seq_legal_alph_type> +
+                                                                          "> evaluated to false on " +
+                                                                          detail::make_printable(c)};
+                                                    }
+                                                    return c;
+                                                })                                      // enforce legal alphabet
+                                              | views::char_to<std::ranges::range_value_t<seq_type>>, // convert to actual target alphabet
+                                  std::cpp20::back_inserter(seq));
+            #endif // SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+            }
         }
         else
         {
@@ -28,6 +28,7 @@
 #include <seqan3/core/range/detail/misc.hpp>
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
+#include <seqan3/io/detail/bulk_read.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input_options.hpp>
@@ -154,7 +155,41 @@ protected:
         /* Sequence */
         auto seq_view = stream_view | detail::take_until_or_throw(is_char<'+'>)    // until 2nd ID line
                                     | std::views::filter(!is_space);           // ignore whitespace
-        if constexpr (!detail::decays_to_ignore_v<seq_type>)
+        if constexpr (detail::decays_to_ignore_v<seq_type>) // consume, but count
+        {
+            auto it = begin(seq_view);
+            auto it_end = end(seq_view);
+            while (it != it_end)
+            {
+                ++it;
+                ++sequence_size_after;
+            }
+        }
+        else if constexpr (detail::none_is_valid_for<seq_legal_alph_type>(" \t\n\v\f\r+") &&
+                           requires { detail::bulk_read_legal_chars<seq_legal_alph_type>(stream_it, sequence); })
+        {
+            // Valid characters are validated and converted in bulk on the buffer of the stream; only the characters
+            // that are skipped or rejected are looked at one at a time.
+            while (true)
+            {
+                detail::bulk_read_legal_chars<seq_legal_alph_type>(stream_it, sequence);
+
+                if (stream_it == end(stream_view))
+                    throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+                else if (*stream_it == '+')
+                    break;
+                else if (is_space(*stream_it))
+                    ++stream_it;
+                else
+                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                      "char_is_valid_for<" +
+                                      detail::type_name_as_string<seq_legal_alph_type> +
+                                      "> evaluated to false on " +
+                                      detail::make_printable(*stream_it)};
+            }
+            sequence_size_after = size(sequence);
+        }
+        else
         {
             auto constexpr is_legal_alph = char_is_valid_for<seq_legal_alph_type>;
             std::ranges::copy(seq_view | std::views::transform([is_legal_alph] (char const c) // enforce legal alphabet
@@ -173,30 +208,25 @@ protected:
                               std::cpp20::back_inserter(sequence));
             sequence_size_after = size(sequence);
         }
-        else // consume, but count
-        {
-            auto it = begin(seq_view);
-            auto it_end = end(seq_view);
-            while (it != it_end)
-            {
-                ++it;
-                ++sequence_size_after;
-            }
-        }
 
         detail::consume(stream_view | detail::take_line_or_throw);
 
         /* Qualities */
         auto qview = stream_view | std::views::filter(!is_space)                  // this consumes trailing newline
                                  | detail::take_exactly_or_throw(sequence_size_after - sequence_size_before);
-        if constexpr (!detail::decays_to_ignore_v<qual_type>)
+        if constexpr (detail::decays_to_ignore_v<qual_type>)
         {
-            std::ranges::copy(qview | views::char_to<std::ranges::range_value_t<qual_type>>,
-                              std::cpp20::back_inserter(qualities));
+            detail::consume(qview);
+        }
+        else if constexpr (detail::none_is_valid_for<std::ranges::range_value_t<qual_type>>(" \t\n\v\f\r") &&
+                           requires { detail::bulk_read_exactly(stream_it, qualities, size_t{}); })
+        {
+            detail::bulk_read_exactly(stream_it, qualities, sequence_size_after - sequence_size_before);
         }
         else
         {
-            detail::consume(qview);
+            std::ranges::copy(qview | views::char_to<std::ranges::range_value_t<qual_type>>,
+                              std::cpp20::back_inserter(qualities));
         }
     }
 
@@ -330,9 +330,14 @@ public:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
+        std::filesystem::path const path = filename;
+
         // possibly add intermediate compression stream
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
 
+        if (secondary_stream.get() == primary_stream.get()) // not compressed
+            file_path = path;
+
         // initialise format handler or throw if format is not found
         using format_variant_t = typename detail::variant_from_tags<valid_formats,
                                                                     detail::sequence_file_input_format_exposer>::type;
@@ -514,6 +519,10 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief The path of the file if it was opened by name and is not compressed; used for memory mapping.
+    std::filesystem::path file_path{};
+    //!\brief The memory mapped stream buffer that replaces the file buffer if `options.memory_map` is set.
+    std::unique_ptr<memory_mapped_streambuf> mapped_buffer{};
 
     //!\brief Tracks whether the very first record is buffered when calling begin().
     bool first_record_was_read{false};
@@ -525,6 +534,14 @@ private:
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
+        if (!first_record_was_read) // the stream has not been read from yet
+        {
+            detail::set_bgzf_thread_options(*secondary_stream, options.bgzf_threads);
+
+            if (options.memory_map && !file_path.empty())
+                mapped_buffer = detail::memory_map_stream(*primary_stream, file_path, options.memory_map_populate);
+        }
+
         // clear the record
         record_buffer.clear();
 
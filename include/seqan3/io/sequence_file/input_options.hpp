@@ -12,7 +12,7 @@
 
 #pragma once
 
-#include <seqan3/core/platform.hpp>
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
 
 namespace seqan3
 {
@@ -29,6 +29,32 @@ struct sequence_file_input_options
     bool truncate_ids = false;
     //!\brief Read the complete_header into the seqan3::field::id for embl or genbank format.
     bool embl_genbank_complete_header = false;
+
+    /*!\brief The thread pool and the concurrency limits used if the file is BGZF compressed.
+     *
+     * \details
+     *
+     * The options are applied when the first record is read; changing them afterwards has no effect.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bgzf_thread_options bgzf_threads{};
+
+    /*!\brief Read the file through a memory mapping instead of a file stream (see seqan3::memory_mapped_streambuf).
+     *
+     * \details
+     *
+     * Only applies to uncompressed files that were opened by name; it is ignored otherwise. The mapping is created when
+     * the first record is read; changing the option afterwards has no effect.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bool memory_map = false;
+    /*!\brief Read in all pages of the file when it is mapped (Linux only); see #memory_map.
+     *
+     * \experimentalapi{Experimental since version 3.2.}
+     */
+    bool memory_map_populate = false;
 };
 
 } // namespace seqan3
@@ -17,4 +17,6 @@
 
 #pragma once
 
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
 #include <seqan3/io/stream/concept.hpp>
+#include <seqan3/io/stream/memory_mapped_streambuf.hpp>
@@ -0,0 +1,276 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bgzf_thread_pool and seqan3::bgzf_thread_options.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A pool of worker threads shared by the BGZF (de-)compression streams.
+ * \ingroup io_stream
+ *
+ * \details
+ *
+ * Every BGZF stream splits its work into independent block tasks and submits them to a pool of this type. The pool
+ * can be shared by any number of streams, e.g. all input and output files of an application, so that the number of
+ * compression threads no longer grows with the number of open files. How many tasks a single stream may run at the
+ * same time is limited by seqan3::bgzf_thread_options::max_concurrency.
+ *
+ * By default, all streams use the process-wide pool returned by seqan3::bgzf_thread_pool::global().
+ *
+ * On destruction, all remaining tasks are executed before the threads are joined.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+class bgzf_thread_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bgzf_thread_pool() = delete; //!< Deleted.
+    bgzf_thread_pool(bgzf_thread_pool const &) = delete; //!< Deleted.
+    bgzf_thread_pool(bgzf_thread_pool &&) = delete; //!< Deleted.
+    bgzf_thread_pool & operator=(bgzf_thread_pool const &) = delete; //!< Deleted.
+    bgzf_thread_pool & operator=(bgzf_thread_pool &&) = delete; //!< Deleted.
+
+    /*!\brief Spawns `thread_count` worker threads.
+     * \param thread_count The number of worker threads; must be greater than 0.
+     * \throws std::invalid_argument if `thread_count` is 0.
+     */
+    explicit bgzf_thread_pool(size_t const thread_count)
+    {
+        if (thread_count == 0u)
+            throw std::invalid_argument{"A bgzf_thread_pool needs at least one thread."};
+
+        workers.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+            workers.emplace_back([this] () { run(); });
+    }
+
+    //!\brief Executes all remaining tasks and joins the worker threads.
+    ~bgzf_thread_pool()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stop = true;
+        }
+        task_available.notify_all();
+
+        for (auto & worker : workers)
+            worker.join();
+    }
+    //!\}
+
+    /*!\brief Schedules a task for asynchronous execution.
+     * \param task The task to execute; must not throw.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * Thread-safe.
+     */
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock{mutex};
+            tasks.push_back(std::move(task));
+        }
+        task_available.notify_one();
+    }
+
+    //!\brief Returns the number of worker threads.
+    size_t size() const noexcept
+    {
+        return workers.size();
+    }
+
+    /*!\brief Returns the process-wide pool used by all BGZF streams that are not given a pool explicitly.
+     *
+     * \details
+     *
+     * The pool is created on first use with `std::thread::hardware_concurrency()` many threads.
+     */
+    static std::shared_ptr<bgzf_thread_pool> global()
+    {
+        static std::shared_ptr<bgzf_thread_pool> pool =
+            std::make_shared<bgzf_thread_pool>(std::max(1u, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+private:
+    //!\brief The loop executed by each worker thread.
+    void run()
+    {
+        while (true)
+        {
+            std::function<void()> task{};
+            {
+                std::unique_lock lock{mutex};
+                task_available.wait(lock, [this] () { return stop || !tasks.empty(); });
+
+                if (tasks.empty()) // stop was requested and there is no work left
+                    return;
+
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    //!\brief The worker threads.
+    std::vector<std::thread> workers{};
+    //!\brief The tasks that wait for execution.
+    std::deque<std::function<void()>> tasks{};
+    //!\brief Guards the task queue and the stop flag.
+    std::mutex mutex{};
+    //!\brief Signals that a task was submitted or that the pool is stopped.
+    std::condition_variable task_available{};
+    //!\brief Whether the pool is being destructed.
+    bool stop{false};
+};
+
+/*!\brief Selects the thread pool and the per-stream limits of a BGZF (de-)compression stream.
+ * \ingroup io_stream
+ *
+ * \details
+ *
+ * Objects of this type are members of the file options, e.g. seqan3::sam_file_input_options::bgzf_threads, and are
+ * applied when the first record is read or written. Members with a value of 0 (or no pool) select the defaults.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+struct bgzf_thread_options
+{
+    //!\brief The pool to run the block tasks on; defaults to seqan3::bgzf_thread_pool::global().
+    std::shared_ptr<bgzf_thread_pool> pool{};
+    //!\brief The maximal number of block tasks of one stream running at the same time; defaults to
+    //!       seqan3::contrib::bgzf_thread_count.
+    size_t max_concurrency{0u};
+    //!\brief The maximal number of blocks of one stream that are in flight; defaults to 8 * max_concurrency.
+    size_t queue_depth{0u};
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Runs tasks of a single stream on a seqan3::bgzf_thread_pool with bounded concurrency.
+ * \ingroup io_stream
+ *
+ * \details
+ *
+ * Tasks are queued locally. At most `max_concurrency` pool tasks drain this queue at the same time, so a single
+ * stream can never occupy more threads of a shared pool than it was granted. The destructor waits until all
+ * submitted tasks were executed.
+ */
+class bgzf_task_group
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bgzf_task_group() = delete; //!< Deleted.
+    bgzf_task_group(bgzf_task_group const &) = delete; //!< Deleted.
+    bgzf_task_group(bgzf_task_group &&) = delete; //!< Deleted.
+    bgzf_task_group & operator=(bgzf_task_group const &) = delete; //!< Deleted.
+    bgzf_task_group & operator=(bgzf_task_group &&) = delete; //!< Deleted.
+
+    /*!\brief Constructs the group on the given pool.
+     * \param pool_            The pool to execute the tasks on.
+     * \param max_concurrency_ The maximal number of tasks running at the same time; at least 1.
+     */
+    bgzf_task_group(std::shared_ptr<bgzf_thread_pool> pool_, size_t const max_concurrency_) :
+        pool{std::move(pool_)},
+        max_concurrency{std::max<size_t>(1u, max_concurrency_)}
+    {
+        assert(pool != nullptr);
+    }
+
+    //!\brief Waits for all submitted tasks.
+    ~bgzf_task_group()
+    {
+        wait();
+    }
+    //!\}
+
+    //!\brief Queues a task and starts a drain task on the pool if the concurrency limit allows it.
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock{mutex};
+            pending.push_back(std::move(task));
+
+            if (active == max_concurrency)
+                return;
+
+            ++active;
+        }
+        pool->submit([this] () { drain(); });
+    }
+
+    //!\brief Blocks until all submitted tasks were executed.
+    void wait()
+    {
+        std::unique_lock lock{mutex};
+        idle.wait(lock, [this] () { return active == 0u; });
+    }
+
+private:
+    //!\brief Executes queued tasks until the local queue is empty.
+    void drain()
+    {
+        std::unique_lock lock{mutex};
+        while (!pending.empty())
+        {
+            std::function<void()> task = std::move(pending.front());
+            pending.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+
+        if (--active == 0u)
+            idle.notify_all(); // notify while holding the lock; the group may be destructed right after
+    }
+
+    //!\brief The pool the drain tasks run on.
+    std::shared_ptr<bgzf_thread_pool> pool;
+    //!\brief The maximal number of drain tasks.
+    size_t max_concurrency;
+    //!\brief The number of running drain tasks.
+    size_t active{0u};
+    //!\brief Tasks that were submitted but not yet started.
+    std::deque<std::function<void()>> pending{};
+    //!\brief Guards the members above.
+    std::mutex mutex{};
+    //!\brief Signals that no drain task is running.
+    std::condition_variable idle{};
+};
+
+} // namespace seqan3::detail
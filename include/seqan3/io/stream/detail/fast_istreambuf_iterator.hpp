@@ -15,6 +15,8 @@
 
 #include <cassert>
 #include <seqan3/std/iterator>
+#include <limits>
+#include <seqan3/std/span>
 
 #include <seqan3/io/stream/detail/stream_buffer_exposer.hpp>
 
@@ -97,6 +99,34 @@ public:
         return *stream_buf->gptr();
     }
 
+    /*!\name Bulk access
+     * \brief Gives parsers access to the buffered characters, so that they can be processed in bulk.
+     * \{
+     */
+    //!\brief Returns the characters in the get area of the stream buffer, starting with the current one.
+    std::span<char_t const> buffered() const noexcept
+    {
+        assert(stream_buf != nullptr);
+        return {stream_buf->gptr(), static_cast<size_t>(stream_buf->egptr() - stream_buf->gptr())};
+    }
+
+    /*!\brief Advances by count characters, which must not be more than seqan3::detail::fast_istreambuf_iterator::buffered
+     *        returns; rebuffers if necessary.
+     */
+    void skip_buffered(size_t count)
+    {
+        assert(stream_buf != nullptr);
+        assert(count <= buffered().size());
+
+        for (; count > std::numeric_limits<int>::max(); count -= std::numeric_limits<int>::max())
+            stream_buf->gbump(std::numeric_limits<int>::max());
+        stream_buf->gbump(static_cast<int>(count));
+
+        if (stream_buf->gptr() == stream_buf->egptr())
+            stream_buf->underflow();
+    }
+    //!\}
+
     /*!\name Comparison operators
      * \brief We define comparison only against the sentinel.
      * \{
@@ -0,0 +1,180 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::memory_mapped_streambuf.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <streambuf>
+#include <string>
+
+#ifndef _WIN32
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A read-only stream buffer that exposes a whole file as a single, contiguous get area.
+ * \ingroup io_stream
+ *
+ * \details
+ *
+ * The file is mapped into memory with `mmap` and the kernel is advised that it will be read sequentially. The
+ * stream buffer never copies data: stream buffer iterators and the parsers of the formats (which operate on the get
+ * area directly, see seqan3::detail::fast_istreambuf_iterator) read from the mapped pages. Compared to a
+ * `std::filebuf`, this saves one copy per byte and the system calls for refilling the buffer.
+ *
+ * Optionally, all pages can be read in when the file is opened (`MAP_POPULATE`, Linux only), which avoids page
+ * faults while parsing at the cost of a longer construction.
+ *
+ * The buffer is meant for uncompressed files on fast local storage. Compressed files are read through a
+ * decompression stream anyway and do not profit. Seeking is supported within the file.
+ *
+ * Memory mapping is not available on Windows, where construction throws seqan3::file_open_error.
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+class memory_mapped_streambuf : public std::streambuf
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_streambuf() = delete; //!< Deleted.
+    memory_mapped_streambuf(memory_mapped_streambuf const &) = delete; //!< Deleted.
+    memory_mapped_streambuf(memory_mapped_streambuf &&) = delete; //!< Deleted.
+    memory_mapped_streambuf & operator=(memory_mapped_streambuf const &) = delete; //!< Deleted.
+    memory_mapped_streambuf & operator=(memory_mapped_streambuf &&) = delete; //!< Deleted.
+
+    /*!\brief Maps the given file into memory.
+     * \param[in] path     The file to map.
+     * \param[in] populate Whether to read in all pages of the file on construction (only supported on Linux).
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     */
+    explicit memory_mapped_streambuf(std::filesystem::path const & path, bool const populate = false)
+    {
+#ifndef _WIN32
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        struct stat file_status{};
+        if (::fstat(fd, &file_status) == -1)
+        {
+            ::close(fd);
+            throw file_open_error{"Could not determine the size of file " + path.string() + "."};
+        }
+
+        file_size = static_cast<size_t>(file_status.st_size);
+
+        if (file_size > 0u) // mapping an empty file fails
+        {
+            int flags = MAP_PRIVATE;
+    #ifdef MAP_POPULATE
+            if (populate)
+                flags |= MAP_POPULATE;
+    #endif
+            void * const address = ::mmap(nullptr, file_size, PROT_READ, flags, fd, 0);
+
+            if (address == MAP_FAILED)
+            {
+                ::close(fd);
+                throw file_open_error{"Could not map file " + path.string() + " into memory."};
+            }
+
+            mapping = static_cast<char *>(address);
+            ::posix_madvise(address, file_size, POSIX_MADV_SEQUENTIAL);
+        }
+
+        ::close(fd); // the mapping stays valid
+        setg(mapping, mapping, mapping + file_size);
+#else
+        (void) populate;
+        throw file_open_error{"Could not map file " + path.string() + " into memory: not supported on Windows."};
+#endif
+    }
+
+    //!\brief Unmaps the file.
+    ~memory_mapped_streambuf() override
+    {
+#ifndef _WIN32
+        if (mapping != nullptr)
+            ::munmap(mapping, file_size);
+#endif
+    }
+    //!\}
+
+    //!\brief Returns the size of the mapped file in bytes.
+    size_t size() const noexcept
+    {
+        return file_size;
+    }
+
+    //!\brief Returns a pointer to the first byte of the mapped file.
+    char const * data() const noexcept
+    {
+        return mapping;
+    }
+
+protected:
+    //!\brief The whole file is in the get area, hence there is nothing to read once it is exhausted.
+    int_type underflow() override
+    {
+        return (gptr() < egptr()) ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+    }
+
+    //!\brief Returns the number of bytes that are left.
+    std::streamsize showmanyc() override
+    {
+        return (gptr() < egptr()) ? egptr() - gptr() : -1;
+    }
+
+    //!\brief Moves the read position; only std::ios_base::in is supported.
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override
+    {
+        if (!(mode & std::ios_base::in) || (mode & std::ios_base::out))
+            return pos_type(off_type(-1));
+
+        off_type position{};
+        switch (direction)
+        {
+            case std::ios_base::beg: position = offset; break;
+            case std::ios_base::cur: position = (gptr() - eback()) + offset; break;
+            case std::ios_base::end: position = static_cast<off_type>(file_size) + offset; break;
+            default: return pos_type(off_type(-1));
+        }
+
+        if (position < 0 || position > static_cast<off_type>(file_size))
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + position, egptr());
+        return pos_type(position);
+    }
+
+    //!\brief Moves the read position; only std::ios_base::in is supported.
+    pos_type seekpos(pos_type position, std::ios_base::openmode mode) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, mode);
+    }
+
+private:
+    //!\brief The first byte of the mapping; `nullptr` for empty files.
+    char * mapping{nullptr};
+    //!\brief The size of the file and of the mapping.
+    size_t file_size{0u};
+};
+
+} // namespace seqan3
@@ -122,13 +122,13 @@ inline auto search(queries_t && queries,
     using algorithm_result_t = typename traits_t::search_result_type;
     using execution_handler_t = std::conditional_t<
                                     complete_configuration_t::template exists<search_cfg::parallel>(),
-                                    detail::execution_handler_parallel,
+                                    detail::execution_handler_work_stealing,
                                     detail::execution_handler_sequential>;
 
     // Select the execution handler for the search configuration.
     auto select_execution_handler = [parallel = complete_config.get_or(search_cfg::parallel{})] ()
     {
-        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_work_stealing>)
         {
             auto thread_count = parallel.thread_count;
             if (!thread_count)
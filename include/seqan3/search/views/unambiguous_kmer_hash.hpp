@@ -0,0 +1,473 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::views::unambiguous_kmer_hash.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/core/range/detail/adaptor_from_functor.hpp>
+#include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/utility/range/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The 2 bit code of every letter of a nucleotide alphabet: 0, 1, 2 and 3 for A, C, G and T/U, and
+ *        `unambiguous_kmer_hash_ambiguous` for all other letters.
+ * \ingroup search_views
+ */
+template <nucleotide_alphabet alphabet_t>
+inline constexpr std::array<uint8_t, alphabet_size<alphabet_t>> unambiguous_kmer_hash_code = [] () constexpr
+{
+    std::array<uint8_t, alphabet_size<alphabet_t>> codes{};
+
+    for (size_t rank = 0; rank < alphabet_size<alphabet_t>; ++rank)
+    {
+        switch (to_char(assign_rank_to(rank, alphabet_t{})))
+        {
+            case 'A': case 'a': codes[rank] = 0; break;
+            case 'C': case 'c': codes[rank] = 1; break;
+            case 'G': case 'g': codes[rank] = 2; break;
+            case 'T': case 't': case 'U': case 'u': codes[rank] = 3; break;
+            default: codes[rank] = 0xff;
+        }
+    }
+
+    return codes;
+}();
+
+// ---------------------------------------------------------------------------------------------------------------------
+// unambiguous_kmer_hash_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by seqan3::views::unambiguous_kmer_hash.
+ * \tparam urng_t The type of the underlying range, must model std::forward_range, the reference type must model
+ *                seqan3::nucleotide_alphabet.
+ * \implements std::ranges::view
+ * \implements std::ranges::forward_range
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * Note that most members of this class are generated by ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t>
+class unambiguous_kmer_hash_view : public std::ranges::view_interface<unambiguous_kmer_hash_view<urng_t>>
+{
+private:
+    static_assert(std::ranges::forward_range<urng_t>, "The unambiguous_kmer_hash_view only works on forward_ranges");
+    static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+                  "The reference type of the underlying range must model seqan3::nucleotide_alphabet.");
+
+    //!\brief The underlying range.
+    urng_t urange;
+
+    //!\brief The shape to use.
+    shape shape_;
+
+    template <bool const_range>
+    class basic_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    unambiguous_kmer_hash_view() requires std::default_initializable<urng_t> = default; //!< Defaulted.
+    unambiguous_kmer_hash_view(unambiguous_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    unambiguous_kmer_hash_view(unambiguous_kmer_hash_view && rhs) = default; //!< Defaulted.
+    unambiguous_kmer_hash_view & operator=(unambiguous_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    unambiguous_kmer_hash_view & operator=(unambiguous_kmer_hash_view && rhs) = default; //!< Defaulted.
+    ~unambiguous_kmer_hash_view() = default; //!< Defaulted.
+
+    /*!\brief Construct from a view and a given shape.
+     * \throws std::invalid_argument if the shape spans more than 32 positions.
+     */
+    unambiguous_kmer_hash_view(urng_t urange_, shape const & s_) : urange{std::move(urange_)}, shape_{s_}
+    {
+        if (shape_.size() > 32)
+            throw std::invalid_argument{"The shape of an unambiguous k-mer hash must span at most 32 positions."};
+    }
+
+    /*!\brief Construct from a non-view that can be view-wrapped and a given shape.
+     * \throws std::invalid_argument if the shape spans more than 32 positions.
+     */
+    template <typename rng_t>
+    //!\cond
+     requires (!std::same_as<std::remove_cvref_t<rng_t>, unambiguous_kmer_hash_view>) &&
+              std::ranges::viewable_range<rng_t> &&
+              std::constructible_from<urng_t, std::ranges::ref_view<std::remove_reference_t<rng_t>>>
+    //!\endcond
+    unambiguous_kmer_hash_view(rng_t && urange_, shape const & s_) :
+        unambiguous_kmer_hash_view{std::views::all(std::forward<rng_t>(urange_)), s_}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the number of letters up to the end of the first unambiguous k-mer.
+     */
+    auto begin()
+    {
+        return basic_iterator<false>{std::ranges::begin(urange), std::ranges::end(urange), shape_};
+    }
+
+    //!\copydoc begin()
+    auto begin() const
+    //!\cond
+        requires const_iterable_range<urng_t>
+    //!\endcond
+    {
+        return basic_iterator<true>{std::ranges::cbegin(urange), std::ranges::cend(urange), shape_};
+    }
+
+    /*!\brief Returns a sentinel.
+     * \returns std::default_sentinel.
+     */
+    auto end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+    //!\}
+};
+
+/*!\brief Iterator for calculating the 2 bit hash values of the unambiguous k-mers of a text.
+ * \tparam const_range Whether the underlying range is const.
+ *
+ * \details
+ *
+ * The iterator reads every letter once. The 2 bit codes of the last letters are kept in a 64 bit window together with
+ * the number of unambiguous letters at its end; an ambiguous letter resets this number. Whenever the window holds a
+ * whole k-mer, the hash value is the window for ungapped shapes and the concatenation of the runs of `1`s of the shape
+ * otherwise.
+ */
+template <std::ranges::view urng_t>
+template <bool const_range>
+class unambiguous_kmer_hash_view<urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the underlying range.
+    using it_t = maybe_const_iterator_t<const_range, urng_t>;
+    //!\brief The sentinel type of the underlying range.
+    using sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+    //!\brief The alphabet type of the underlying range.
+    using alphabet_t = std::iter_value_t<it_t>;
+
+    template <bool other_const_range>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::iter_difference_t<it_t>;
+    //!\brief Value type of this iterator.
+    using value_type = size_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief The iterator category; values are returned by value.
+    using iterator_category = std::input_iterator_tag;
+    //!\brief This iterator models std::forward_iterator.
+    using iterator_concept = std::forward_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default; //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default; //!< Defaulted.
+    ~basic_iterator() = default; //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it)
+    //!\cond
+        requires const_range
+    //!\endcond
+        : text_right{it.text_right},
+          text_end{it.text_end},
+          window{it.window},
+          unambiguous{it.unambiguous},
+          text_position{it.text_position},
+          hash_value{it.hash_value},
+          at_end{it.at_end},
+          span{it.span},
+          window_mask{it.window_mask},
+          runs{it.runs},
+          run_count{it.run_count}
+    {}
+
+    /*!\brief Construct from the text and a seqan3::shape and move to the first unambiguous k-mer.
+     * \param[in] it_start Iterator pointing to the first position of the text.
+     * \param[in] it_end   Sentinel pointing to the end of the text.
+     * \param[in] s_       The seqan3::shape that determines which positions participate in hashing.
+     */
+    basic_iterator(it_t it_start, sentinel_t it_end, shape const & s_) :
+        text_right{std::move(it_start)},
+        text_end{std::move(it_end)},
+        span{s_.size()},
+        window_mask{span == 32 ? ~uint64_t{} : (uint64_t{1} << (2 * span)) - 1}
+    {
+        assert(span > 0 && span <= 32);
+
+        if (!s_.all())
+        {
+            for (size_t i = 0; i < span; ++i)
+            {
+                if (!s_[i])
+                    continue;
+
+                if (i == 0 || !s_[i - 1])
+                    runs[run_count++] = {static_cast<uint8_t>(i), 0};
+
+                ++runs[run_count - 1].second;
+            }
+        }
+
+        hash_next();
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Compare to the end of the view.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.at_end;
+    }
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+    {
+        return lhs.text_position == rhs.text_position && lhs.at_end == rhs.at_end;
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++()
+    {
+        hash_next();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int)
+    {
+        basic_iterator tmp{*this};
+        hash_next();
+        return tmp;
+    }
+
+    //!\brief Return the hash value.
+    value_type operator*() const noexcept
+    {
+        return hash_value;
+    }
+
+    //!\brief Returns the position of the first letter of the current k-mer in the text.
+    size_t position() const noexcept
+    {
+        return text_position - span;
+    }
+
+private:
+    //!\brief Iterator to the letter after the current k-mer.
+    it_t text_right{};
+
+    //!\brief The end of the text.
+    sentinel_t text_end{};
+
+    //!\brief The 2 bit codes of the last letters, the last letter in the lowest bits.
+    uint64_t window{};
+
+    //!\brief The number of unambiguous letters at the end of the window, at most the span of the shape.
+    size_t unambiguous{};
+
+    //!\brief The position of text_right in the text.
+    size_t text_position{};
+
+    //!\brief The hash value.
+    size_t hash_value{};
+
+    //!\brief Whether there is no further unambiguous k-mer.
+    bool at_end{false};
+
+    //!\brief The number of positions of the shape.
+    size_t span{};
+
+    //!\brief The bits of span letters.
+    uint64_t window_mask{};
+
+    //!\brief The first position and the length of every run of `1`s of a gapped shape.
+    std::array<std::pair<uint8_t, uint8_t>, 16> runs{};
+
+    //!\brief The number of runs, 0 for an ungapped shape.
+    uint8_t run_count{};
+
+    //!\brief Reads letters until the window holds the next unambiguous k-mer or the text ends.
+    void hash_next()
+    {
+        while (text_right != text_end)
+        {
+            uint8_t const code = unambiguous_kmer_hash_code<alphabet_t>[to_rank(*text_right)];
+            ++text_right;
+            ++text_position;
+
+            if (code > 3)
+            {
+                unambiguous = 0;
+                continue;
+            }
+
+            window = ((window << 2) | code) & window_mask;
+            unambiguous = std::min(unambiguous + 1, span);
+
+            if (unambiguous == span)
+            {
+                hash_value = run_count == 0 ? window : gapped_hash();
+                return;
+            }
+        }
+
+        at_end = true;
+    }
+
+    //!\brief Concatenates the letters of the runs of `1`s of the shape.
+    size_t gapped_hash() const noexcept
+    {
+        size_t hash{};
+
+        for (uint8_t run = 0; run < run_count; ++run)
+        {
+            auto const [first, length] = runs[run];
+            hash = (hash << (2 * length)) |
+                   ((window >> (2 * (span - first - length))) & ((uint64_t{1} << (2 * length)) - 1));
+        }
+
+        return hash;
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+unambiguous_kmer_hash_view(rng_t &&, shape const & shape_) -> unambiguous_kmer_hash_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// unambiguous_kmer_hash_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief views::unambiguous_kmer_hash's range adaptor object type (non-closure).
+//!\ingroup search_views
+struct unambiguous_kmer_hash_fn
+{
+    //!\brief Store the shape and return a range adaptor closure object.
+    constexpr auto operator()(shape const & shape_) const
+    {
+        return adaptor_from_functor{*this, shape_};
+    }
+
+    /*!\brief            Call the view's constructor with the underlying view and a seqan3::shape as argument.
+     * \param[in] urange The input range to process. Must model std::ranges::viewable_range and the reference type
+     *                   of the range must model seqan3::nucleotide_alphabet.
+     * \param[in] shape_ The seqan3::shape to use for hashing.
+     * \throws std::invalid_argument if the shape spans more than 32 positions.
+     * \returns          A range of hash values.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange, shape const & shape_) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+            "The range parameter to views::unambiguous_kmer_hash cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::forward_range<urng_t>,
+            "The range parameter to views::unambiguous_kmer_hash must model std::ranges::forward_range.");
+        static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+            "The range parameter to views::unambiguous_kmer_hash must be over elements of "
+            "seqan3::nucleotide_alphabet.");
+
+        return unambiguous_kmer_hash_view{std::forward<urng_t>(urange), shape_};
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief               Computes 2 bit hash values of all k-mers of a range of nucleotides that contain no ambiguous
+ *                      letter.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] shape     The seqan3::shape that determines how to compute the hash value.
+ * \returns             A range of std::size_t where each value is the hash of an unambiguous k-mer.
+ *                      See below for the properties of the returned range.
+ * \throws std::invalid_argument if the shape spans more than 32 positions.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * seqan3::views::kmer_hash hashes with the size of the alphabet, e.g. base 5 for seqan3::dna5, such that `N` is an
+ * ordinary letter and at most 27-mers fit into 64 bit. This view encodes A, C, G and T/U with 2 bits, i.e. the hash
+ * values are the same as those of seqan3::views::kmer_hash over seqan3::dna4, and k-mers of up to 32 letters can be
+ * hashed. All k-mers whose positions (including the `0`s of a gapped shape) contain any other letter, e.g. `N`, are
+ * skipped: the rolling hash restarts after the ambiguous letter.
+ *
+ * The iterator provides the position of the first letter of the current k-mer via its member function `position()`.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       | *required*                         | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *lost*                           |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | seqan3::nucleotide_alphabet        | std::size_t                      |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/views/unambiguous_kmer_hash.cpp
+ *
+ * \hideinitializer
+ *
+ * \experimentalapi{Experimental since version 3.2.}
+ */
+inline constexpr auto unambiguous_kmer_hash = detail::unambiguous_kmer_hash_fn{};
+
+} // namespace seqan3::views
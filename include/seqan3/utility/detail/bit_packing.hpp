@@ -0,0 +1,428 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pack_bits and seqan3::detail::unpack_bits.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <cstdint>
+#include <cstring>
+
+#include <seqan3/utility/detail/to_little_endian.hpp>
+#include <seqan3/utility/simd/detail/builtin_simd_intrinsics.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Packs values of (at most) bits_per_value bits into whole 64 bit words and back.
+ * \ingroup utility
+ * \tparam bits_per_value The number of bits per value; must be in [1, 64].
+ *
+ * \details
+ *
+ * The layout is the one of `sdsl::int_vector<bits_per_value>`: the values are stored back to back, beginning at the
+ * least significant bit of the first word, i.e. value `i` occupies the bits `[i * bits_per_value,
+ * (i + 1) * bits_per_value)` of the concatenated words.
+ *
+ * Values of 2, 4 and 8 bits are processed a whole word at a time: with SSE4/AVX2, 16/32 values are (un)packed with a
+ * handful of vector instructions, otherwise 8 values at a time within a 64 bit register. Values of 3, 5, 6 and 7 bits
+ * are packed eight at a time as a chunk of `8 * bits_per_value` bits. All other widths are (un)packed one value at a
+ * time, but still write every word only once.
+ */
+template <size_t bits_per_value>
+struct bit_packing
+{
+    static_assert(bits_per_value > 0 && bits_per_value <= 64, "bits_per_value must be in [1, 64].");
+
+    //!\brief The bit mask of a single value.
+    static constexpr uint64_t value_mask = (bits_per_value == 64) ? ~uint64_t{} :
+                                                                    (uint64_t{1} << bits_per_value) - 1u;
+
+    //!\brief Whether whole words can be (un)packed at once.
+    static constexpr bool word_parallel = bits_per_value == 2 || bits_per_value == 4 || bits_per_value == 8;
+
+    //!\brief The number of values in a word if word_parallel is true.
+    static constexpr size_t values_per_word = 64 / bits_per_value;
+
+    /*!\brief Packs count values, starting at bit_position, one value at a time.
+     * \details
+     * The bits before bit_position in the first word are kept, the bits after the last value in its word are cleared.
+     */
+    template <typename value_t>
+    static void pack_scalar(value_t const * values, size_t const count, uint64_t * words, size_t const bit_position)
+    {
+        if (count == 0)
+            return;
+
+        words += bit_position / 64;
+        size_t shift = bit_position % 64;
+        uint64_t word = (shift == 0) ? 0u : (*words & ((uint64_t{1} << shift) - 1u));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t const value = static_cast<uint64_t>(values[i]) & value_mask;
+            word |= value << shift;
+            shift += bits_per_value;
+
+            if (shift >= 64)
+            {
+                *words++ = word;
+                shift -= 64;
+                word = (shift == 0) ? 0u : value >> (bits_per_value - shift);
+            }
+        }
+
+        if (shift != 0)
+            *words = word;
+    }
+
+    /*!\brief Packs octet_count * 8 values of less than 8 bits, starting at bit_position, eight values at a time.
+     * \details
+     * The eight values are combined into a single `8 * bits_per_value` bit chunk with independent shifts, such that
+     * only one chunk per eight values has to be appended. Otherwise like pack_scalar.
+     */
+    static void pack_octets(uint8_t const * values, size_t const octet_count, uint64_t * words,
+                            size_t const bit_position)
+        requires (bits_per_value < 8)
+    {
+        if (octet_count == 0)
+            return;
+
+        constexpr size_t chunk_bits = 8 * bits_per_value;
+
+        words += bit_position / 64;
+        size_t shift = bit_position % 64;
+        uint64_t word = (shift == 0) ? 0u : (*words & ((uint64_t{1} << shift) - 1u));
+
+        for (size_t i = 0; i < octet_count; ++i, values += 8)
+        {
+            uint64_t eight;
+            std::memcpy(&eight, values, 8);
+            eight = to_little_endian(eight); // value j is in byte j
+
+            uint64_t chunk{};
+            for (size_t part = 0; part < 8; ++part)
+                chunk |= ((eight >> (part * 8)) & value_mask) << (part * bits_per_value);
+
+            word |= chunk << shift;
+            shift += chunk_bits;
+
+            if (shift >= 64)
+            {
+                *words++ = word;
+                shift -= 64;
+                word = (shift == 0) ? 0u : chunk >> (chunk_bits - shift);
+            }
+        }
+
+        if (shift != 0)
+            *words = word;
+    }
+
+    //!\brief Unpacks count values, starting at bit_position, one value at a time.
+    template <typename value_t>
+    static void unpack_scalar(uint64_t const * words, size_t const bit_position, size_t const count, value_t * values)
+    {
+        words += bit_position / 64;
+        size_t shift = bit_position % 64;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t value = *words >> shift;
+            if (shift + bits_per_value > 64) // the value continues in the next word
+                value |= words[1] << (64 - shift);
+            values[i] = static_cast<value_t>(value & value_mask);
+
+            shift += bits_per_value;
+            if (shift >= 64)
+            {
+                ++words;
+                shift -= 64;
+            }
+        }
+    }
+
+    //!\brief Packs word_count * values_per_word values into word_count words.
+    static void pack_words(uint8_t const * values, size_t const word_count, uint64_t * words)
+        requires word_parallel
+    {
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        if constexpr (bits_per_value == 2)
+        {
+            // 32 values → 1 word: combine neighbours to 4 bit, then to 8 bit; then gather one byte per 32 bit.
+            __m256i const gather = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                    0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+            for (; i < word_count; ++i, values += 32)
+            {
+                __m256i const vector = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values));
+                __m256i const pairs = _mm256_maddubs_epi16(vector, _mm256_set1_epi16(0x0401));
+                __m256i const quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00100001));
+                __m256i const bytes = _mm256_shuffle_epi8(quads, gather);
+                words[i] = static_cast<uint32_t>(_mm256_extract_epi32(bytes, 0)) |
+                           static_cast<uint64_t>(static_cast<uint32_t>(_mm256_extract_epi32(bytes, 4))) << 32;
+            }
+        }
+        else if constexpr (bits_per_value == 4)
+        {
+            // 32 values → 2 words: combine neighbours to 8 bit; then gather one byte per 16 bit.
+            __m256i const gather = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                    0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1);
+            for (; i + 1 < word_count; i += 2, values += 32)
+            {
+                __m256i const vector = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values));
+                __m256i const pairs = _mm256_maddubs_epi16(vector, _mm256_set1_epi16(0x1001));
+                __m256i const bytes = _mm256_shuffle_epi8(pairs, gather);
+                words[i] = static_cast<uint64_t>(_mm256_extract_epi64(bytes, 0));
+                words[i + 1] = static_cast<uint64_t>(_mm256_extract_epi64(bytes, 2));
+            }
+        }
+#elif defined(__SSE4_1__)
+        if constexpr (bits_per_value == 2)
+        {
+            // 16 values → 1 half word, see the AVX2 version.
+            __m128i const gather = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+            for (; i < word_count; ++i, values += 32)
+            {
+                uint64_t halves[2];
+                for (size_t half = 0; half < 2; ++half)
+                {
+                    __m128i const vector = _mm_loadu_si128(reinterpret_cast<__m128i const *>(values + 16 * half));
+                    __m128i const pairs = _mm_maddubs_epi16(vector, _mm_set1_epi16(0x0401));
+                    __m128i const quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00100001));
+                    halves[half] = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_shuffle_epi8(quads, gather)));
+                }
+                words[i] = halves[0] | halves[1] << 32;
+            }
+        }
+        else if constexpr (bits_per_value == 4)
+        {
+            // 16 values → 1 word, see the AVX2 version.
+            for (; i < word_count; ++i, values += 16)
+            {
+                __m128i const vector = _mm_loadu_si128(reinterpret_cast<__m128i const *>(values));
+                __m128i const pairs = _mm_maddubs_epi16(vector, _mm_set1_epi16(0x1001));
+                words[i] = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_packus_epi16(pairs, pairs)));
+            }
+        }
+#endif
+
+        // 8 values at a time within a word.
+        for (; i < word_count; ++i)
+        {
+            uint64_t word{};
+            for (size_t part = 0; part < values_per_word / 8; ++part, values += 8)
+            {
+                uint64_t eight{};
+                std::memcpy(&eight, values, 8);
+                eight = to_little_endian(eight); // value j is in byte j
+
+                if constexpr (bits_per_value == 2)
+                {
+                    eight = (eight | eight >> 6) & 0x000f'000f'000f'000fULL;
+                    eight = (eight | eight >> 12) & 0x0000'00ff'0000'00ffULL;
+                    eight = (eight | eight >> 24) & 0x0000'0000'0000'ffffULL;
+                }
+                else if constexpr (bits_per_value == 4)
+                {
+                    eight = (eight | eight >> 4) & 0x00ff'00ff'00ff'00ffULL;
+                    eight = (eight | eight >> 8) & 0x0000'ffff'0000'ffffULL;
+                    eight = (eight | eight >> 16) & 0x0000'0000'ffff'ffffULL;
+                }
+
+                word |= eight << (part * 8 * bits_per_value);
+            }
+            words[i] = word;
+        }
+    }
+
+    //!\brief Unpacks word_count words into word_count * values_per_word values.
+    static void unpack_words(uint64_t const * words, size_t const word_count, uint8_t * values)
+        requires word_parallel
+    {
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        if constexpr (bits_per_value == 2)
+        {
+            // 1 word → 32 values: spread every byte to four, mask a different field in each, shift it to bit 0.
+            __m256i const spread = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                                    4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+            for (; i < word_count; ++i, values += 32)
+            {
+                __m256i const word = _mm256_set1_epi64x(static_cast<int64_t>(words[i]));
+                __m256i fields = _mm256_and_si256(_mm256_shuffle_epi8(word, spread),
+                                                  _mm256_set1_epi32(static_cast<int32_t>(0xc0300c03)));
+                fields = _mm256_and_si256(_mm256_or_si256(fields, _mm256_srli_epi16(fields, 4)),
+                                          _mm256_set1_epi8(0x0f));
+                fields = _mm256_and_si256(_mm256_or_si256(fields, _mm256_srli_epi16(fields, 2)),
+                                          _mm256_set1_epi8(0x03));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(values), fields);
+            }
+        }
+        else if constexpr (bits_per_value == 4)
+        {
+            // 2 words → 32 values: spread every byte to two, mask a different nibble in each, shift it to bit 0.
+            __m256i const spread = _mm256_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+                                                    8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+            for (; i + 1 < word_count; i += 2, values += 32)
+            {
+                __m256i const two_words =
+                    _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(words + i)));
+                __m256i nibbles = _mm256_and_si256(_mm256_shuffle_epi8(two_words, spread),
+                                                   _mm256_set1_epi16(static_cast<int16_t>(0xf00f)));
+                nibbles = _mm256_and_si256(_mm256_or_si256(nibbles, _mm256_srli_epi16(nibbles, 4)),
+                                           _mm256_set1_epi8(0x0f));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(values), nibbles);
+            }
+        }
+#elif defined(__SSE4_1__)
+        if constexpr (bits_per_value == 2)
+        {
+            // 1 half word → 16 values, see the AVX2 version.
+            __m128i const spread = _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+            for (; i < word_count; ++i)
+            {
+                for (size_t half = 0; half < 2; ++half, values += 16)
+                {
+                    __m128i const word = _mm_cvtsi32_si128(static_cast<int32_t>(words[i] >> (32 * half)));
+                    __m128i fields = _mm_and_si128(_mm_shuffle_epi8(word, spread),
+                                                   _mm_set1_epi32(static_cast<int32_t>(0xc0300c03)));
+                    fields = _mm_and_si128(_mm_or_si128(fields, _mm_srli_epi16(fields, 4)), _mm_set1_epi8(0x0f));
+                    fields = _mm_and_si128(_mm_or_si128(fields, _mm_srli_epi16(fields, 2)), _mm_set1_epi8(0x03));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(values), fields);
+                }
+            }
+        }
+        else if constexpr (bits_per_value == 4)
+        {
+            // 1 word → 16 values, see the AVX2 version.
+            __m128i const spread = _mm_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+            for (; i < word_count; ++i, values += 16)
+            {
+                __m128i const word = _mm_cvtsi64_si128(static_cast<int64_t>(words[i]));
+                __m128i nibbles = _mm_and_si128(_mm_shuffle_epi8(word, spread),
+                                                _mm_set1_epi16(static_cast<int16_t>(0xf00f)));
+                nibbles = _mm_and_si128(_mm_or_si128(nibbles, _mm_srli_epi16(nibbles, 4)), _mm_set1_epi8(0x0f));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(values), nibbles);
+            }
+        }
+#endif
+
+        // 8 values at a time within a word.
+        for (; i < word_count; ++i)
+        {
+            for (size_t part = 0; part < values_per_word / 8; ++part, values += 8)
+            {
+                uint64_t eight = words[i] >> (part * 8 * bits_per_value);
+                if constexpr (bits_per_value != 8)
+                    eight &= (uint64_t{1} << (8 * bits_per_value)) - 1u;
+
+                if constexpr (bits_per_value == 2)
+                {
+                    eight = (eight | eight << 24) & 0x0000'00ff'0000'00ffULL;
+                    eight = (eight | eight << 12) & 0x000f'000f'000f'000fULL;
+                    eight = (eight | eight << 6) & 0x0303'0303'0303'0303ULL;
+                }
+                else if constexpr (bits_per_value == 4)
+                {
+                    eight = (eight | eight << 16) & 0x0000'ffff'0000'ffffULL;
+                    eight = (eight | eight << 8) & 0x00ff'00ff'00ff'00ffULL;
+                    eight = (eight | eight << 4) & 0x0f0f'0f0f'0f0f'0f0fULL;
+                }
+
+                eight = to_little_endian(eight);
+                std::memcpy(values, &eight, 8);
+            }
+        }
+    }
+};
+
+/*!\brief Packs count values into the bit vector words, beginning at bit_position.
+ * \ingroup utility
+ * \tparam bits_per_value The number of bits per value, see seqan3::detail::bit_packing.
+ * \tparam value_t        An unsigned integral type.
+ * \param[in]  values       The values; must be smaller than `2^bits_per_value`.
+ * \param[in]  count        The number of values.
+ * \param[out] words        The bit vector; must be large enough to hold `bit_position + count * bits_per_value` bits.
+ * \param[in]  bit_position The bit at which the first value is stored.
+ *
+ * \details
+ *
+ * The bits before bit_position are kept, the bits after the last value in its word are cleared.
+ */
+template <size_t bits_per_value, std::unsigned_integral value_t>
+void pack_bits(value_t const * values, size_t count, uint64_t * words, size_t bit_position)
+{
+    using packing_t = bit_packing<bits_per_value>;
+
+    if constexpr (packing_t::word_parallel && std::same_as<value_t, uint8_t>)
+    {
+        // Fill up the first word, if it is partially used.
+        size_t const head = std::min(count, (64 - bit_position % 64) % 64 / bits_per_value);
+        packing_t::pack_scalar(values, head, words, bit_position);
+        values += head;
+        count -= head;
+        bit_position += head * bits_per_value;
+
+        size_t const word_count = count / packing_t::values_per_word;
+        packing_t::pack_words(values, word_count, words + bit_position / 64);
+        values += word_count * packing_t::values_per_word;
+        count -= word_count * packing_t::values_per_word;
+        bit_position += word_count * 64;
+    }
+    else if constexpr (bits_per_value < 8 && std::same_as<value_t, uint8_t>)
+    {
+        size_t const octet_count = count / 8;
+        packing_t::pack_octets(values, octet_count, words, bit_position);
+        values += octet_count * 8;
+        count -= octet_count * 8;
+        bit_position += octet_count * 8 * bits_per_value;
+    }
+
+    packing_t::pack_scalar(values, count, words, bit_position);
+}
+
+/*!\brief Unpacks count values from the bit vector words, beginning at bit_position.
+ * \ingroup utility
+ * \tparam bits_per_value The number of bits per value, see seqan3::detail::bit_packing.
+ * \tparam value_t        An unsigned integral type.
+ * \param[in]  words        The bit vector.
+ * \param[in]  bit_position The bit at which the first value is stored.
+ * \param[in]  count        The number of values.
+ * \param[out] values       The values.
+ */
+template <size_t bits_per_value, std::unsigned_integral value_t>
+void unpack_bits(uint64_t const * words, size_t bit_position, size_t count, value_t * values)
+{
+    using packing_t = bit_packing<bits_per_value>;
+
+    if constexpr (packing_t::word_parallel && std::same_as<value_t, uint8_t>)
+    {
+        // Read until the next word begins.
+        size_t const head = std::min(count, (64 - bit_position % 64) % 64 / bits_per_value);
+        packing_t::unpack_scalar(words, bit_position, head, values);
+        values += head;
+        count -= head;
+        bit_position += head * bits_per_value;
+
+        size_t const word_count = count / packing_t::values_per_word;
+        packing_t::unpack_words(words + bit_position / 64, word_count, values);
+        values += word_count * packing_t::values_per_word;
+        count -= word_count * packing_t::values_per_word;
+        bit_position += word_count * 64;
+    }
+
+    packing_t::unpack_scalar(words, bit_position, count, values);
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,226 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::elias_fano_sequence.
+ */
+
+#pragma once
+
+#include <seqan3/std/bit>
+#include <cassert>
+#include <cstdint>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/span>
+#include <utility>
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only, Elias-Fano encoded sequence of non-decreasing integers.
+ * \ingroup utility
+ *
+ * \details
+ *
+ * Every value is split into its `low_bits` least significant bits, which are stored back to back, and the remaining
+ * high part, which is stored in unary: value `i` sets bit `(value >> low_bits) + i` of the high bit vector. With
+ * `low_bits = floor(log2(universe / size))`, the encoding uses less than `2 + log2(universe / size)` bits per value,
+ * e.g. about 10 bits for the delimiters of 150 bp reads instead of 64.
+ *
+ * Accessing value `i` selects the `i`-th set bit of the high bit vector. The position of every
+ * #sample_rate-th set bit is stored, from there the bit is found by counting the set bits word by word.
+ *
+ * The class does not own its memory; it is a view on words that were written by #encode, e.g. a memory mapped file.
+ * The words are, in this order: the low bits, the high bits and the samples, see #layout.
+ */
+class elias_fano_sequence
+{
+public:
+    //!\brief The position of every sample_rate-th set bit of the high bit vector is stored.
+    static constexpr size_t sample_rate = 256;
+
+    //!\brief The parameters and the size of an encoded sequence.
+    struct layout
+    {
+        //!\brief The number of values.
+        size_t size{};
+        //!\brief The number of bits per value that are stored verbatim.
+        size_t low_bits{};
+        //!\brief The number of words holding the low bits.
+        size_t low_words{};
+        //!\brief The number of words holding the high bit vector.
+        size_t high_words{};
+        //!\brief The number of words holding the samples.
+        size_t sample_words{};
+
+        //!\brief The number of words of the whole encoding.
+        constexpr size_t total_words() const noexcept
+        {
+            return low_words + high_words + sample_words;
+        }
+
+        //!\brief Two layouts are equal if all members are equal.
+        constexpr bool operator==(layout const &) const noexcept = default;
+    };
+
+    /*!\brief Returns the layout of a sequence of `count` values that are not larger than `max_value`.
+     * \param[in] count     The number of values.
+     * \param[in] max_value The largest (i.e. last) value.
+     */
+    static constexpr layout compute_layout(size_t const count, uint64_t const max_value) noexcept
+    {
+        layout result{};
+        result.size = count;
+
+        if (count == 0u)
+            return result;
+
+        uint64_t const universe_per_value = (max_value / count) + 1u;
+        result.low_bits = std::bit_width(universe_per_value) - 1u;
+        result.low_words = (count * result.low_bits + 63u) / 64u;
+        result.high_words = (count + (max_value >> result.low_bits) + 1u + 63u) / 64u;
+        result.sample_words = (count + sample_rate - 1u) / sample_rate;
+        return result;
+    }
+
+    /*!\brief Encodes non-decreasing values.
+     * \param[in]  values The values.
+     * \param[in]  layout The layout as returned by `compute_layout(values.size(), values.back())`.
+     * \param[out] words  The encoding; must be large enough to hold `layout.total_words()` words.
+     */
+    static void encode(std::span<uint64_t const> const values, layout const & layout, uint64_t * const words)
+    {
+        assert(values.size() == layout.size);
+        assert(std::ranges::is_sorted(values));
+
+        uint64_t * const low = words;
+        uint64_t * const high = low + layout.low_words;
+        uint64_t * const samples = high + layout.high_words;
+        std::fill_n(words, layout.total_words(), uint64_t{});
+
+        uint64_t const low_mask = (uint64_t{1} << layout.low_bits) - 1u;
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (layout.low_bits > 0u)
+            {
+                size_t const bit = i * layout.low_bits;
+                uint64_t const low_value = values[i] & low_mask;
+                low[bit / 64u] |= low_value << (bit % 64u);
+                if (bit % 64u + layout.low_bits > 64u)
+                    low[bit / 64u + 1u] |= low_value >> (64u - bit % 64u);
+            }
+
+            size_t const high_bit = (values[i] >> layout.low_bits) + i;
+            high[high_bit / 64u] |= uint64_t{1} << (high_bit % 64u);
+
+            if (i % sample_rate == 0u)
+                samples[i / sample_rate] = high_bit;
+        }
+    }
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    elias_fano_sequence() = default; //!< Defaulted.
+    elias_fano_sequence(elias_fano_sequence const &) = default; //!< Defaulted.
+    elias_fano_sequence(elias_fano_sequence &&) = default; //!< Defaulted.
+    elias_fano_sequence & operator=(elias_fano_sequence const &) = default; //!< Defaulted.
+    elias_fano_sequence & operator=(elias_fano_sequence &&) = default; //!< Defaulted.
+    ~elias_fano_sequence() = default; //!< Defaulted.
+
+    /*!\brief Constructs a view on an encoded sequence.
+     * \param[in] words  The words written by #encode; must stay valid as long as this object is used.
+     * \param[in] layout The layout of the encoding.
+     */
+    elias_fano_sequence(uint64_t const * const words, layout const & layout) noexcept :
+        low{words},
+        high{words + layout.low_words},
+        samples{words + layout.low_words + layout.high_words},
+        count{layout.size},
+        low_bits{layout.low_bits}
+    {}
+    //!\}
+
+    //!\brief Returns the number of values.
+    size_t size() const noexcept
+    {
+        return count;
+    }
+
+    //!\brief Returns the value at position i.
+    uint64_t operator[](size_t const i) const noexcept
+    {
+        assert(i < count);
+        return ((select(i) - i) << low_bits) | low_value(i);
+    }
+
+    //!\brief Returns the values at positions i and i + 1.
+    std::pair<uint64_t, uint64_t> adjacent(size_t const i) const noexcept
+    {
+        assert(i + 1u < count);
+
+        size_t const first = select(i);
+
+        // The next set bit is usually in the same word.
+        size_t word_index = (first + 1u) / 64u;
+        uint64_t word = high[word_index] >> ((first + 1u) % 64u) << ((first + 1u) % 64u);
+        while (word == 0u)
+            word = high[++word_index];
+        size_t const second = word_index * 64u + std::countr_zero(word);
+
+        return {((first - i) << low_bits) | low_value(i), ((second - i - 1u) << low_bits) | low_value(i + 1u)};
+    }
+
+private:
+    //!\brief Returns the position of the i-th set bit of the high bit vector.
+    size_t select(size_t const i) const noexcept
+    {
+        size_t const sample = samples[i / sample_rate];
+        size_t remaining = i % sample_rate;
+
+        size_t word_index = sample / 64u;
+        uint64_t word = high[word_index] >> (sample % 64u) << (sample % 64u);
+
+        for (size_t ones = std::popcount(word); ones <= remaining; ones = std::popcount(word))
+        {
+            remaining -= ones;
+            word = high[++word_index];
+        }
+
+        for (; remaining > 0u; --remaining)
+            word &= word - 1u; // clear the lowest set bit
+
+        return word_index * 64u + std::countr_zero(word);
+    }
+
+    //!\brief Returns the low bits of the value at position i.
+    uint64_t low_value(size_t const i) const noexcept
+    {
+        if (low_bits == 0u)
+            return 0u;
+
+        size_t const bit = i * low_bits;
+        uint64_t value = low[bit / 64u] >> (bit % 64u);
+        if (bit % 64u + low_bits > 64u)
+            value |= low[bit / 64u + 1u] << (64u - bit % 64u);
+        return value & ((uint64_t{1} << low_bits) - 1u);
+    }
+
+    //!\brief The low bits.
+    uint64_t const * low{nullptr};
+    //!\brief The high bit vector.
+    uint64_t const * high{nullptr};
+    //!\brief The positions of every sample_rate-th set bit of the high bit vector.
+    uint64_t const * samples{nullptr};
+    //!\brief The number of values.
+    size_t count{};
+    //!\brief The number of bits per value that are stored verbatim.
+    size_t low_bits{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,103 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/test/alignment/rescore_alignment.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+namespace seqan3::test
+{
+
+/*!\brief Generates random sequence pairs together with similar, identical and empty pairs.
+ *
+ * \details
+ *
+ * The first `count` pairs are generated independently from the seeds `0, ..., 2 * count - 1`, where `count` must
+ * not be 0. They are followed by up to five pairs of a random sequence and a copy with mismatches every few positions
+ * and a short deletion, a pair of identical sequences and pairs in which one or both sequences are empty.
+ */
+template <typename alphabet_t>
+auto generate_reference_test_pairs(size_t const size, size_t const size_variance, size_t const count)
+{
+    using sequence_t = std::vector<alphabet_t>;
+
+    std::vector<std::pair<sequence_t, sequence_t>> pairs{};
+    for (size_t seed = 0; seed < count; ++seed)
+        pairs.emplace_back(seqan3::test::generate_sequence<alphabet_t>(size, size_variance, seed),
+                           seqan3::test::generate_sequence<alphabet_t>(size, size_variance, seed + count));
+
+    for (size_t seed = 0; seed < std::min<size_t>(count, 5); ++seed)
+    {
+        sequence_t similar = pairs[seed].first;
+        for (size_t position = seed; position < similar.size(); position += 13 + seed)
+            similar[position] = seqan3::assign_rank_to((seqan3::to_rank(similar[position]) + 1) %
+                                                       seqan3::alphabet_size<alphabet_t>, alphabet_t{});
+        if (similar.size() > 20)
+            similar.erase(similar.begin() + 7, similar.begin() + 10 + seed);
+        pairs.emplace_back(pairs[seed].first, std::move(similar));
+    }
+
+    pairs.emplace_back(pairs[0].first, pairs[0].first);
+    pairs.emplace_back(sequence_t{}, pairs[0].second);
+    pairs.emplace_back(pairs[0].first, sequence_t{});
+    pairs.emplace_back(sequence_t{}, sequence_t{});
+
+    return pairs;
+}
+
+/*!\brief Expects that the tested configuration computes the same scores and end positions as the reference
+ *        configuration for the pairs of seqan3::test::generate_reference_test_pairs.
+ *
+ * \details
+ *
+ * The reference configuration is typically the same configuration without the element that selects the tested
+ * algorithm, such that the reference is computed with the dynamic programming alignment. If the tested
+ * configuration outputs the alignment, it is expected to be valid and to have the reference score.
+ */
+template <typename alphabet_t, typename reference_config_t, typename tested_config_t>
+void compare_to_reference_alignment(reference_config_t const & reference_config,
+                                    tested_config_t const & tested_config,
+                                    size_t const size,
+                                    size_t const size_variance,
+                                    size_t const count = 20)
+{
+    auto const pairs = generate_reference_test_pairs<alphabet_t>(size, size_variance, count);
+
+    auto expected_results = seqan3::align_pairwise(pairs, reference_config);
+    auto tested_results = seqan3::align_pairwise(pairs, tested_config);
+
+    auto tested_it = tested_results.begin();
+    size_t pair_index = 0;
+    for (auto && expected : expected_results)
+    {
+        auto const & result = *tested_it;
+        auto const & [sequence1, sequence2] = pairs[pair_index++];
+
+        EXPECT_EQ(result.score(), expected.score());
+        EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position());
+
+        if constexpr (!std::is_same_v<std::remove_cvref_t<decltype(result.alignment())>, std::nullopt_t *>)
+            EXPECT_EQ(seqan3::test::rescore_alignment(sequence1, sequence2, result, tested_config), expected.score());
+
+        ++tested_it;
+    }
+    EXPECT_TRUE(tested_it == tested_results.end());
+}
+
+} // namespace seqan3::test
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+namespace seqan3::test
+{
+
+/*!\brief Expects that the alignment of the result spells the sequences between its begin and end positions and
+ *        returns the score of the alignment under the scoring scheme and the gap costs of the given configuration.
+ */
+template <typename sequence1_t, typename sequence2_t, typename result_t, typename config_t>
+int32_t rescore_alignment(sequence1_t const & sequence1,
+                          sequence2_t const & sequence2,
+                          result_t const & result,
+                          config_t const & config)
+{
+    using std::get;
+
+    auto const & scheme = get<seqan3::align_cfg::scoring_scheme>(config).scheme;
+    auto const & gap_cost = get<seqan3::align_cfg::gap_cost_affine>(config);
+
+    size_t sequence1_position = result.sequence1_begin_position();
+    size_t sequence2_position = result.sequence2_begin_position();
+    bool in_gap1 = false;
+    bool in_gap2 = false;
+    int32_t score = 0;
+
+    auto && [aligned_sequence1, aligned_sequence2] = result.alignment();
+    for (auto && [alphabet1, alphabet2] : seqan3::views::zip(aligned_sequence1, aligned_sequence2))
+    {
+        bool const is_gap1 = seqan3::to_char(alphabet1) == '-';
+        bool const is_gap2 = seqan3::to_char(alphabet2) == '-';
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        if (is_gap1)
+        {
+            score += gap_cost.extension_score + (in_gap1 ? 0 : gap_cost.open_score);
+            EXPECT_EQ(seqan3::to_char(alphabet2), seqan3::to_char(sequence2[sequence2_position++]));
+            in_gap1 = true;
+            in_gap2 = false;
+        }
+        else if (is_gap2)
+        {
+            score += gap_cost.extension_score + (in_gap2 ? 0 : gap_cost.open_score);
+            EXPECT_EQ(seqan3::to_char(alphabet1), seqan3::to_char(sequence1[sequence1_position++]));
+            in_gap1 = false;
+            in_gap2 = true;
+        }
+        else
+        {
+            score += scheme.score(sequence1[sequence1_position], sequence2[sequence2_position]);
+            EXPECT_EQ(seqan3::to_char(alphabet1), seqan3::to_char(sequence1[sequence1_position++]));
+            EXPECT_EQ(seqan3::to_char(alphabet2), seqan3::to_char(sequence2[sequence2_position++]));
+            in_gap1 = false;
+            in_gap2 = false;
+        }
+    }
+
+    EXPECT_EQ(sequence1_position, result.sequence1_end_position());
+    EXPECT_EQ(sequence2_position, result.sequence2_end_position());
+
+    return score;
+}
+
+} // namespace seqan3::test
@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/test/alignment/align_pairwise_edit_distance.hpp>
@@ -211,6 +213,77 @@ void seqan2_edit_distance_dna4_generic_collection(benchmark::State & state)
 }
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  edit_distance; score and end position; dna4; many short pairs
+// ============================================================================
+
+template <bool vectorised, bool semi_global>
+void seqan3_edit_distance_dna4_short_collection(benchmark::State & state)
+{
+    size_t sequence_length = 64;
+    size_t set_size = 10'000;
+
+    auto vec = seqan3::test::generate_sequence_pairs<seqan3::dna4>(sequence_length, set_size);
+    int score = 0;
+
+    seqan3::align_cfg::method_global method{seqan3::align_cfg::free_end_gaps_sequence1_leading{semi_global},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                            seqan3::align_cfg::free_end_gaps_sequence1_trailing{semi_global},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+    auto cfg = method | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{}
+                      | seqan3::align_cfg::output_end_position{};
+
+    auto run = [&] (auto const & align_cfg)
+    {
+        for (auto _ : state)
+        {
+            for (auto && rng : align_pairwise(vec, align_cfg))
+                score += rng.score();
+        }
+    };
+
+    if constexpr (vectorised)
+        run(cfg | seqan3::align_cfg::vectorised{});
+    else
+        run(cfg);
+
+    state.counters["score"] = score;
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, edit_distance_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+// ============================================================================
+//  edit_distance; score; dna4; long pairs; banded
+// ============================================================================
+
+// A band of width 0 computes the unbanded edit distance.
+template <int32_t band_width>
+void seqan3_edit_distance_dna4_long_collection_banded(benchmark::State & state)
+{
+    size_t sequence_length = 10'000;
+    size_t set_size = 10;
+
+    auto vec = seqan3::test::generate_sequence_pairs<seqan3::dna4>(sequence_length, set_size);
+    int score = 0;
+
+    auto run = [&] (auto const & align_cfg)
+    {
+        for (auto _ : state)
+        {
+            for (auto && rng : align_pairwise(vec, align_cfg))
+                score += rng.score();
+        }
+    };
+
+    if constexpr (band_width == 0)
+        run(edit_distance_cfg);
+    else
+        run(edit_distance_cfg | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-band_width},
+                                                                   seqan3::align_cfg::upper_diagonal{band_width}});
+
+    state.counters["score"] = score;
+}
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
@@ -228,5 +301,12 @@ BENCHMARK(seqan3_edit_distance_dna4_collection_selector);
 BENCHMARK(seqan2_edit_distance_dna4_collection);
 BENCHMARK(seqan2_edit_distance_dna4_generic_collection);
 #endif
+BENCHMARK_TEMPLATE(seqan3_edit_distance_dna4_short_collection, false, false);
+BENCHMARK_TEMPLATE(seqan3_edit_distance_dna4_short_collection, true, false);
+BENCHMARK_TEMPLATE(seqan3_edit_distance_dna4_short_collection, false, true);
+BENCHMARK_TEMPLATE(seqan3_edit_distance_dna4_short_collection, true, true);
+BENCHMARK_TEMPLATE(seqan3_edit_distance_dna4_long_collection_banded, 0);
+BENCHMARK_TEMPLATE(seqan3_edit_distance_dna4_long_collection_banded, 32);
+BENCHMARK_TEMPLATE(seqan3_edit_distance_dna4_long_collection_banded, 100);
 
 BENCHMARK_MAIN();
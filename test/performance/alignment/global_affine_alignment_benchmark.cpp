@@ -11,10 +11,13 @@
 #include <memory>
 #include <random>
 #include <seqan3/std/ranges>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/alignment_seed.hpp>
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/test/performance/units.hpp>
@@ -55,6 +58,33 @@ void seqan3_affine_dna4(benchmark::State & state)
 
 BENCHMARK(seqan3_affine_dna4);
 
+// ============================================================================
+//  affine; score and end position; dna4; single; long sequences
+// ============================================================================
+
+template <typename alignment_config_t>
+void seqan3_affine_dna4_long(benchmark::State & state, alignment_config_t const & alignment_cfg)
+{
+    size_t sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+    auto cfg = alignment_cfg | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
+                                                                  affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_long, scalar, affine_cfg)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_long, striped, affine_cfg | seqan3::align_cfg::striped_vectorised{})
+    ->Arg(1000)->Arg(10000);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 void seqan2_affine_dna4(benchmark::State & state)
@@ -121,6 +151,190 @@ void seqan2_affine_dna4_trace(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; trace; dna4; single; long sequences
+// ============================================================================
+
+template <typename alignment_config_t>
+void seqan3_affine_dna4_trace_long(benchmark::State & state, alignment_config_t const & alignment_cfg)
+{
+    size_t sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+    auto cfg = alignment_cfg | seqan3::align_cfg::output_alignment{};
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
+                                                                  affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_long, trace_matrix, affine_cfg)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_long, linear_space, affine_cfg | seqan3::align_cfg::linear_space_traceback{})
+    ->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_long, linear_space_4_threads,
+                  affine_cfg | seqan3::align_cfg::linear_space_traceback{4})->Arg(1000)->Arg(10000);
+
+// ============================================================================
+//  affine; trace; dna4; single; similar sequences
+// ============================================================================
+
+// Returns a copy of the sequence with the given percentage of substitutions, insertions and deletions.
+template <typename sequence_t>
+sequence_t mutate_sequence(sequence_t const & sequence, size_t const error_percentage, size_t const seed)
+{
+    using alphabet_t = std::ranges::range_value_t<sequence_t>;
+
+    std::mt19937_64 engine(seed);
+    std::uniform_int_distribution<size_t> percentage_distribution(0, 99);
+    std::uniform_int_distribution<size_t> rank_distribution(1, seqan3::alphabet_size<alphabet_t> - 1);
+    std::uniform_int_distribution<size_t> error_type_distribution(0, 2);
+
+    sequence_t mutated{};
+    for (alphabet_t const symbol : sequence)
+    {
+        if (percentage_distribution(engine) >= error_percentage)
+        {
+            mutated.push_back(symbol);
+            continue;
+        }
+
+        switch (error_type_distribution(engine))
+        {
+            case 0: // substitution
+                mutated.push_back(seqan3::assign_rank_to((seqan3::to_rank(symbol) + rank_distribution(engine)) %
+                                                         seqan3::alphabet_size<alphabet_t>, alphabet_t{}));
+                break;
+            case 1: // insertion
+                mutated.push_back(symbol);
+                mutated.push_back(seqan3::assign_rank_to(rank_distribution(engine), alphabet_t{}));
+                break;
+            default: // deletion
+                break;
+        }
+    }
+    return mutated;
+}
+
+template <typename alignment_config_t>
+void seqan3_affine_dna4_trace_similar(benchmark::State & state, alignment_config_t const & alignment_cfg)
+{
+    size_t sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = mutate_sequence(seq1, state.range(1), 1);
+    auto cfg = alignment_cfg | seqan3::align_cfg::output_alignment{};
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
+                                                                  affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+// Sequences of length 10'000 with 1% and 5% differences.
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_similar, unbanded, affine_cfg)->Args({10000, 1})->Args({10000, 5});
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_similar, banded,
+                  affine_cfg | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-200},
+                                                                  seqan3::align_cfg::upper_diagonal{200}})
+    ->Args({10000, 1})->Args({10000, 5});
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_similar, wavefront, affine_cfg | seqan3::align_cfg::wavefront{})
+    ->Args({10000, 1})->Args({10000, 5});
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_similar, wavefront_adaptive,
+                  affine_cfg | seqan3::align_cfg::wavefront{10, 50})->Args({10000, 1})->Args({10000, 5});
+
+// ============================================================================
+//  affine; score and end position; dna4; collection; seed candidates
+// ============================================================================
+
+// Generates read and reference windows of length 150 with a seed of 16 matching symbols in the middle. The given
+// percentage of the windows are true hits with 2% differences, the other windows are only similar within the seed.
+template <typename sequence_t>
+auto generate_seed_candidates(size_t const set_size, size_t const hit_percentage)
+{
+    size_t const window_length = 150;
+    size_t const seed_position = 67;
+    size_t const seed_length = 16;
+
+    std::vector<std::tuple<sequence_t, sequence_t, seqan3::alignment_seed>> candidates{};
+    for (size_t i = 0; i < set_size; ++i)
+    {
+        sequence_t reference = seqan3::test::generate_sequence<seqan3::dna4>(window_length, 0, i);
+        sequence_t read = seqan3::test::generate_sequence<seqan3::dna4>(window_length, 0, i + set_size);
+
+        if (i * 100 < hit_percentage * set_size)
+            read = mutate_sequence(reference, 2, i);
+
+        size_t const read_seed_position = std::min(seed_position, read.size() - seed_length);
+        std::ranges::copy_n(reference.begin() + seed_position, seed_length, read.begin() + read_seed_position);
+        candidates.emplace_back(std::move(reference),
+                                std::move(read),
+                                seqan3::alignment_seed{seed_position, read_seed_position, seed_length});
+    }
+
+    return candidates;
+}
+
+template <typename alignment_config_t>
+void seqan3_affine_dna4_seed_candidates(benchmark::State & state, alignment_config_t const & alignment_cfg)
+{
+    using sequence_t = decltype(seqan3::test::generate_sequence<seqan3::dna4>());
+
+    auto candidates = generate_seed_candidates<sequence_t>(1000, state.range(0));
+    auto cfg = alignment_cfg | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    for (auto _ : state)
+    {
+        for (auto && result : align_pairwise(candidates, cfg))
+            benchmark::DoNotOptimize(result.score());
+    }
+
+    state.counters["candidates"] = benchmark::Counter(candidates.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// The banded global alignment computes the whole band of every candidate.
+template <typename alignment_config_t>
+void seqan3_affine_dna4_seed_candidates_banded(benchmark::State & state, alignment_config_t const & alignment_cfg)
+{
+    using sequence_t = decltype(seqan3::test::generate_sequence<seqan3::dna4>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> candidates{};
+    for (auto && [reference, read, seed] : generate_seed_candidates<sequence_t>(1000, state.range(0)))
+        candidates.emplace_back(std::move(reference), std::move(read));
+
+    auto cfg = alignment_cfg | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    for (auto _ : state)
+    {
+        for (auto && result : align_pairwise(candidates, cfg))
+            benchmark::DoNotOptimize(result.score());
+    }
+
+    state.counters["candidates"] = benchmark::Counter(candidates.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// 1000 candidates of which 10% and 90% are true hits.
+inline constexpr auto extension_cfg = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{20}} |
+                                      seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                         seqan3::align_cfg::extension_score{-1}} |
+                                      seqan3::align_cfg::scoring_scheme{nt_score_scheme};
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_seed_candidates_banded, banded,
+                  affine_cfg | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-20},
+                                                                  seqan3::align_cfg::upper_diagonal{20}})
+    ->Arg(10)->Arg(90);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_seed_candidates, extension, extension_cfg)->Arg(10)->Arg(90);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_seed_candidates, extension_vectorised,
+                  extension_cfg | seqan3::align_cfg::vectorised{})->Arg(10)->Arg(90);
+
 // ============================================================================
 //  affine; score; dna4; collection
 // ============================================================================
@@ -252,6 +466,48 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace_collection);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; trace; dna4; collection; varying lengths
+// ============================================================================
+
+// The sequence lengths vary between 10 and 190. The alignment matrices of the thread keep their memory across the
+// alignments, such that only the first and the longest alignments allocate memory.
+template <typename alignment_config_t>
+void seqan3_affine_dna4_matrix_memory(benchmark::State & state, alignment_config_t const & alignment_cfg)
+{
+    size_t sequence_length = 100;
+    size_t set_size = 100;
+    using sequence_t = decltype(seqan3::test::generate_sequence<seqan3::dna4>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < set_size; ++i)
+    {
+        sequence_t seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 90, i);
+        sequence_t seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 90, i + set_size);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    seqan3::detail::matrix_memory_statistics & statistics = seqan3::detail::matrix_memory_statistics::local();
+    statistics.reset();
+
+    for (auto _ : state)
+    {
+        for (auto && rng : align_pairwise(vec, alignment_cfg | seqan3::align_cfg::output_alignment{}))
+            rng.alignment();
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocations"] = benchmark::Counter(statistics.allocations, benchmark::Counter::kAvgIterations);
+    state.counters["allocations_avoided"] = benchmark::Counter(statistics.allocations_avoided,
+                                                               benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_matrix_memory, unbanded, affine_cfg);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_matrix_memory, banded,
+                  affine_cfg | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-20},
+                                                                  seqan3::align_cfg::upper_diagonal{20}});
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
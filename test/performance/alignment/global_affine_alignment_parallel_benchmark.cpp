@@ -8,6 +8,7 @@
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <random>
@@ -18,6 +19,8 @@
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
 #include <seqan3/core/debug_stream.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/performance/units.hpp>
@@ -47,16 +50,18 @@ inline constexpr size_t set_size        = 500;
 inline constexpr size_t variance        = 10;
 
 template <typename alphabet_t>
-auto generate_data_seqan3()
+auto generate_data_seqan3(size_t const size = set_size,
+                          size_t const length = sequence_length,
+                          size_t const length_variance = variance)
 {
     using sequence_t = decltype(seqan3::test::generate_sequence<alphabet_t>());
 
     std::vector<sequence_t> vec1;
     std::vector<sequence_t> vec2;
-    for (unsigned i = 0; i < set_size; ++i)
+    for (unsigned i = 0; i < size; ++i)
     {
-        vec1.push_back(seqan3::test::generate_sequence<alphabet_t>(sequence_length, variance, i));
-        vec2.push_back(seqan3::test::generate_sequence<alphabet_t>(sequence_length, variance, i + set_size));
+        vec1.push_back(seqan3::test::generate_sequence<alphabet_t>(length, length_variance, i));
+        vec2.push_back(seqan3::test::generate_sequence<alphabet_t>(length, length_variance, i + size));
     }
     return std::pair{vec1, vec2};
 }
@@ -108,6 +113,65 @@ void seqan3_affine_dna4_parallel(benchmark::State & state)
 BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, score)->UseRealTime();
 BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, trace)->UseRealTime();
 
+// ============================================================================
+//  affine; score; dna4; collection; thread scaling
+// ============================================================================
+
+// The first argument is the number of threads, the second argument the sequence length. The length varies by 90%,
+// such that the work of the alignments is unevenly distributed.
+template <typename result_t>
+void seqan3_affine_dna4_parallel_scaling(benchmark::State & state)
+{
+    uint32_t const thread_count = state.range(0);
+    size_t const length = state.range(1);
+    auto [vec1, vec2] = generate_data_seqan3<seqan3::dna4>(5000 * sequence_length / length, length, length * 9 / 10);
+
+    auto data = seqan3::views::zip(vec1, vec2) | seqan3::views::to<std::vector>;
+
+    int64_t total = 0;
+    for (auto _ : state)
+    {
+        for (auto && res : align_pairwise(data, affine_cfg | result_t{} | seqan3::align_cfg::parallel{thread_count}))
+            total += res.score();
+    }
+
+    state.counters["threads"] = thread_count;
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(seqan3::views::zip(vec1, vec2), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_scaling, score)->ArgsProduct({{1, 2, 4, 8, 16, 32, 64, 128},
+                                                                             {20, 100, 1000}})->UseRealTime();
+
+// ============================================================================
+//  execution handler overhead
+// ============================================================================
+
+// Executes tiny tasks to measure the overhead of distributing the tasks to the threads. As in seqan3::align_pairwise,
+// the handler is constructed for every execution.
+template <typename execution_handler_t>
+void execution_handler_overhead(benchmark::State & state)
+{
+    size_t const thread_count = state.range(0);
+    size_t const task_count = 100'000;
+
+    std::atomic<size_t> total{0};
+    auto algorithm = [] (size_t const task, auto && callback) { callback(task); };
+    auto callback = [&total] (size_t const result) { total.fetch_add(result, std::memory_order_relaxed); };
+
+    for (auto _ : state)
+        execution_handler_t{thread_count}.bulk_execute(algorithm, std::views::iota(size_t{0}, task_count), callback);
+
+    state.counters["threads"] = thread_count;
+    state.counters["tasks/s"] = benchmark::Counter(task_count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_TEMPLATE(execution_handler_overhead, seqan3::detail::execution_handler_parallel)
+    ->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(execution_handler_overhead, seqan3::detail::execution_handler_work_stealing)
+    ->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+
 #if defined(_OPENMP)
 template <typename result_t>
 void seqan3_affine_dna4_omp_for(benchmark::State & state)
@@ -46,6 +46,17 @@ BENCHMARK_CAPTURE(seqan3_affine_accelerated,
                         ->UseRealTime()
                         ->DenseRange(deviation_begin, deviation_end, deviation_step);
 
+BENCHMARK_CAPTURE(seqan3_affine_accelerated,
+                  simd_length_aware_with_score,
+                  seqan3::dna4{},
+                  affine_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::score_type<int16_t>{},
+                  seqan3::align_cfg::vectorised{},
+                  seqan3::align_cfg::length_aware_batching{})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
 BENCHMARK_CAPTURE(seqan3_affine_accelerated,
                   simd_parallel_with_score,
                   seqan3::dna4{},
@@ -69,6 +80,90 @@ BENCHMARK_CAPTURE(seqan3_affine_accelerated,
                         ->UseRealTime()
                         ->DenseRange(deviation_begin, deviation_end, deviation_step);
 
+BENCHMARK_CAPTURE(seqan3_affine_accelerated,
+                  scalar_with_alignment,
+                  seqan3::dna4{},
+                  affine_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::output_alignment{},
+                  seqan3::align_cfg::score_type<int16_t>{})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
+BENCHMARK_CAPTURE(seqan3_affine_accelerated,
+                  simd_with_alignment,
+                  seqan3::dna4{},
+                  affine_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::output_alignment{},
+                  seqan3::align_cfg::score_type<int16_t>{},
+                  seqan3::align_cfg::vectorised{})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
+BENCHMARK_CAPTURE(seqan3_affine_accelerated,
+                  simd_length_aware_with_alignment,
+                  seqan3::dna4{},
+                  affine_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::output_alignment{},
+                  seqan3::align_cfg::score_type<int16_t>{},
+                  seqan3::align_cfg::vectorised{},
+                  seqan3::align_cfg::length_aware_batching{})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
+BENCHMARK_CAPTURE(seqan3_affine_accelerated,
+                  simd_parallel_with_alignment,
+                  seqan3::dna4{},
+                  affine_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::output_alignment{},
+                  seqan3::align_cfg::score_type<int16_t>{},
+                  seqan3::align_cfg::vectorised{},
+                  seqan3::align_cfg::parallel{get_number_of_threads()})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
+// Short read scoring scheme that keeps the scores of reads of up to a few dozen bases within 8 bits.
+constexpr auto short_read_cfg = seqan3::align_cfg::method_global{} |
+                                seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                                   seqan3::align_cfg::extension_score{-2}} |
+                                seqan3::align_cfg::scoring_scheme{
+                                    seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                      seqan3::mismatch_score{-3}}};
+
+BENCHMARK_CAPTURE(seqan3_affine_accelerated_short_reads,
+                  simd_with_score,
+                  seqan3::dna4{},
+                  short_read_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::score_type<int16_t>{},
+                  seqan3::align_cfg::vectorised{})
+                        ->UseRealTime()
+                        ->Arg(16)->Arg(32)->Arg(64)->Arg(100);
+
+BENCHMARK_CAPTURE(seqan3_affine_accelerated_short_reads,
+                  simd_adaptive_with_score,
+                  seqan3::dna4{},
+                  short_read_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::adaptive_score_type{},
+                  seqan3::align_cfg::vectorised{})
+                        ->UseRealTime()
+                        ->Arg(16)->Arg(32)->Arg(64)->Arg(100);
+
+BENCHMARK_CAPTURE(seqan3_affine_accelerated_short_reads,
+                  simd_adaptive_with_alignment,
+                  seqan3::dna4{},
+                  short_read_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::output_alignment{},
+                  seqan3::align_cfg::adaptive_score_type{},
+                  seqan3::align_cfg::vectorised{})
+                        ->UseRealTime()
+                        ->Arg(16)->Arg(32)->Arg(64)->Arg(100);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 // ----------------------------------------------------------------------------
@@ -66,6 +66,26 @@ void seqan3_affine_accelerated(benchmark::State & state, alphabet_t, align_confi
     state.counters["total"] = total;
 }
 
+// Aligns pairs of short reads whose length is given by the benchmark argument.
+template <typename alphabet_t, typename ...align_configs_t>
+void seqan3_affine_accelerated_short_reads(benchmark::State & state, alphabet_t, align_configs_t && ...configs)
+{
+    size_t read_length = state.range(0);
+    auto data = seqan3::test::generate_sequence_pairs<alphabet_t>(read_length, set_size);
+
+    int64_t total = 0;
+    auto accelerate_config = (configs | ...);
+    for (auto _ : state)
+    {
+        for (auto && res : seqan3::align_pairwise(data, accelerate_config))
+            total += res.score();
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(data, accelerate_config);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 // ----------------------------------------------------------------------------
@@ -56,6 +56,46 @@ void seqan3_affine_dna4(benchmark::State & state)
 
 BENCHMARK(seqan3_affine_dna4);
 
+// ============================================================================
+//  affine; score and end position; dna4; single; long sequences
+// ============================================================================
+
+template <typename alignment_config_t>
+void seqan3_affine_dna4_long(benchmark::State & state, alignment_config_t const & alignment_cfg, bool const similar)
+{
+    size_t sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    // In similar sequences the local optimum improves in almost every column.
+    if (similar)
+    {
+        seq2 = seq1;
+        for (size_t i = 0; i < sequence_length; i += 20)
+            seq2[i].assign_rank((seq2[i].to_rank() + 1) % 4);
+    }
+    auto cfg = alignment_cfg | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
+                                                                  local_affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_long, scalar, local_affine_cfg, false)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_long, striped, local_affine_cfg | seqan3::align_cfg::striped_vectorised{}, false)
+    ->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_long, scalar_similar, local_affine_cfg, true)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_long,
+                  striped_similar,
+                  local_affine_cfg | seqan3::align_cfg::striped_vectorised{},
+                  true)->Arg(1000)->Arg(10000);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 void seqan2_affine_dna4(benchmark::State & state)
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <cstring>
 #include <numeric>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -61,6 +62,47 @@ BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna4, seqan3::phred42>
 BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna5, seqan3::phred63>);
 BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna5, seqan3::phred94>);
 
+template <seqan3::alphabet alphabet_t>
+void bulk_assign_char(benchmark::State & state)
+{
+    std::vector<char> chars(1 << 16);
+    for (size_t i = 0; i < chars.size(); ++i)
+        chars[i] = seqan3::to_char(seqan3::assign_rank_to(i % seqan3::alphabet_size<alphabet_t>, alphabet_t{}));
+
+    std::vector<alphabet_t> alphabets(chars.size());
+    for (auto _ : state)
+    {
+        seqan3::bulk_assign_char_to(chars, alphabets);
+        benchmark::DoNotOptimize(alphabets.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * chars.size());
+}
+
+BENCHMARK_TEMPLATE(bulk_assign_char, seqan3::dna4);
+BENCHMARK_TEMPLATE(bulk_assign_char, seqan3::dna5);
+BENCHMARK_TEMPLATE(bulk_assign_char, seqan3::dna15);
+BENCHMARK_TEMPLATE(bulk_assign_char, seqan3::rna5);
+BENCHMARK_TEMPLATE(bulk_assign_char, seqan3::phred42);
+BENCHMARK_TEMPLATE(bulk_assign_char, seqan3::phred94);
+
+template <seqan3::alphabet alphabet_t>
+void bulk_find_invalid_char(benchmark::State & state)
+{
+    std::vector<char> chars(1 << 16);
+    for (size_t i = 0; i < chars.size(); ++i)
+        chars[i] = seqan3::to_char(seqan3::assign_rank_to(i % seqan3::alphabet_size<alphabet_t>, alphabet_t{}));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::bulk_find_invalid_char<alphabet_t>(chars));
+
+    state.SetBytesProcessed(state.iterations() * chars.size());
+}
+
+BENCHMARK_TEMPLATE(bulk_find_invalid_char, seqan3::dna5);
+BENCHMARK_TEMPLATE(bulk_find_invalid_char, seqan3::dna15);
+BENCHMARK_TEMPLATE(bulk_find_invalid_char, seqan3::phred42);
+
 #if SEQAN3_HAS_SEQAN2
 template <typename alphabet_t>
 void assign_char_seqan2(benchmark::State & state)
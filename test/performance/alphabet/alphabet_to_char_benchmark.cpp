@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -81,6 +82,30 @@ BENCHMARK_TEMPLATE(to_char, seqan3::qualified<seqan3::dna4, seqan3::phred42>);
 BENCHMARK_TEMPLATE(to_char, seqan3::qualified<seqan3::dna5, seqan3::phred63>);
 BENCHMARK_TEMPLATE(to_char, seqan3::qualified<seqan3::dna5, seqan3::phred94>);
 
+template <seqan3::alphabet alphabet_t>
+void bulk_to_char(benchmark::State & state)
+{
+    std::vector<alphabet_t> alphabets(1 << 16);
+    for (size_t i = 0; i < alphabets.size(); ++i)
+        seqan3::assign_rank_to(i % seqan3::alphabet_size<alphabet_t>, alphabets[i]);
+
+    std::vector<char> chars(alphabets.size());
+    for (auto _ : state)
+    {
+        seqan3::bulk_to_char(alphabets, chars);
+        benchmark::DoNotOptimize(chars.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * chars.size());
+}
+
+BENCHMARK_TEMPLATE(bulk_to_char, seqan3::dna4);
+BENCHMARK_TEMPLATE(bulk_to_char, seqan3::dna5);
+BENCHMARK_TEMPLATE(bulk_to_char, seqan3::dna15);
+BENCHMARK_TEMPLATE(bulk_to_char, seqan3::rna5);
+BENCHMARK_TEMPLATE(bulk_to_char, seqan3::phred42);
+BENCHMARK_TEMPLATE(bulk_to_char, seqan3::phred94);
+
 #if SEQAN3_HAS_SEQAN2
 template <typename alphabet_t>
 void to_char_seqan2(benchmark::State & state)
@@ -0,0 +1,53 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/range/bulk_hash.hpp>
+#include <seqan3/alphabet/range/hash.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Tags used to define the benchmark type
+struct std_hash_tag{}; // std::hash<std::vector<alphabet_t>>
+struct bulk_hash_tag{}; // seqan3::bulk_hash on a std::vector
+struct bitpacked_tag{}; // seqan3::bulk_hash on a seqan3::bitpacked_sequence
+
+template <typename alphabet_t, typename tag_t>
+void hash(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    std::vector<alphabet_t> sequence = seqan3::test::generate_sequence<alphabet_t>(length, 0, 0);
+    seqan3::bitpacked_sequence<alphabet_t> const packed{sequence};
+
+    for (auto _ : state)
+    {
+        if constexpr (std::is_same_v<tag_t, std_hash_tag>)
+            benchmark::DoNotOptimize(std::hash<std::vector<alphabet_t>>{}(sequence));
+        else if constexpr (std::is_same_v<tag_t, bulk_hash_tag>)
+            benchmark::DoNotOptimize(seqan3::bulk_hash(sequence));
+        else
+            benchmark::DoNotOptimize(seqan3::bulk_hash(packed));
+    }
+
+    state.SetItemsProcessed(state.iterations() * length);
+}
+
+BENCHMARK_TEMPLATE(hash, seqan3::dna4, std_hash_tag)->Arg(150)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(hash, seqan3::dna4, bulk_hash_tag)->Arg(150)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(hash, seqan3::dna4, bitpacked_tag)->Arg(150)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(hash, seqan3::dna5, std_hash_tag)->Arg(150)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(hash, seqan3::dna5, bulk_hash_tag)->Arg(150)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(hash, seqan3::aa27, std_hash_tag)->Arg(150)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(hash, seqan3::aa27, bulk_hash_tag)->Arg(150)->Arg(1'000'000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <random>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/alphabet/range/bulk_quality_control.hpp>
+#include <seqan3/alphabet/views/trim_quality.hpp>
+
+// Tags used to define the benchmark type
+struct view_tag{}; // std::ranges::distance(qualities | views::trim_quality(20))
+struct bwa_tag{}; // seqan3::bulk_trim_length_bwa(qualities, 20)
+struct window_tag{}; // seqan3::bulk_trim_length_window(qualities, 4, 20)
+struct expected_errors_tag{}; // seqan3::bulk_expected_errors(qualities)
+
+// 10'000 reads of 150 bases whose quality drops towards the 3' end.
+std::vector<std::vector<seqan3::phred42>> generate_qualities()
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<int> noise{-5, 5};
+    std::vector<std::vector<seqan3::phred42>> reads(10'000, std::vector<seqan3::phred42>(150));
+
+    for (auto & read : reads)
+        for (size_t i = 0; i < read.size(); ++i)
+            seqan3::assign_phred_to(std::clamp<int>(40 - i * i / 1000 + noise(generator), 2, 41), read[i]);
+
+    return reads;
+}
+
+template <typename tag_t>
+void quality_control(benchmark::State & state)
+{
+    std::vector<std::vector<seqan3::phred42>> const reads = generate_qualities();
+    double sum{};
+
+    for (auto _ : state)
+    {
+        for (auto const & read : reads)
+        {
+            if constexpr (std::is_same_v<tag_t, view_tag>)
+                sum += std::ranges::distance(read | seqan3::views::trim_quality(20));
+            else if constexpr (std::is_same_v<tag_t, bwa_tag>)
+                sum += seqan3::bulk_trim_length_bwa(read, 20);
+            else if constexpr (std::is_same_v<tag_t, window_tag>)
+                sum += seqan3::bulk_trim_length_window(read, 4, 20);
+            else
+                sum += seqan3::bulk_expected_errors(read);
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * reads.size() * reads[0].size());
+}
+
+BENCHMARK_TEMPLATE(quality_control, view_tag);
+BENCHMARK_TEMPLATE(quality_control, bwa_tag);
+BENCHMARK_TEMPLATE(quality_control, window_tag);
+BENCHMARK_TEMPLATE(quality_control, expected_errors_tag);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/range/bulk_reverse_complement.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Tags used to define the benchmark type
+struct view_tag{}; // Copy `views::complement | std::views::reverse` into a vector
+struct bulk_copy_tag{}; // seqan3::bulk_reverse_complement(input, output)
+struct bulk_in_place_tag{}; // seqan3::bulk_reverse_complement(sequence)
+
+template <typename alphabet_t, typename tag_t>
+void reverse_complement(benchmark::State & state)
+{
+    std::vector<alphabet_t> sequence = seqan3::test::generate_sequence<alphabet_t>(1'000'000, 0, 0);
+    std::vector<alphabet_t> output(sequence.size());
+
+    for (auto _ : state)
+    {
+        if constexpr (std::is_same_v<tag_t, view_tag>)
+        {
+            std::ranges::copy(sequence | seqan3::views::complement | std::views::reverse, output.begin());
+            benchmark::DoNotOptimize(output.data());
+        }
+        else if constexpr (std::is_same_v<tag_t, bulk_copy_tag>)
+        {
+            seqan3::bulk_reverse_complement(sequence, output);
+            benchmark::DoNotOptimize(output.data());
+        }
+        else
+        {
+            seqan3::bulk_reverse_complement(sequence);
+            benchmark::DoNotOptimize(sequence.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * sequence.size());
+}
+
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna4, view_tag);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna4, bulk_copy_tag);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna4, bulk_in_place_tag);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna5, view_tag);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna5, bulk_copy_tag);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna5, bulk_in_place_tag);
+
+template <typename alphabet_t, typename tag_t>
+void reverse_complement_bitpacked(benchmark::State & state)
+{
+    auto sequence = seqan3::test::generate_sequence<alphabet_t>(1'000'000, 0, 0);
+    seqan3::bitpacked_sequence<alphabet_t> packed{sequence};
+
+    for (auto _ : state)
+    {
+        if constexpr (std::is_same_v<tag_t, view_tag>)
+        {
+            seqan3::bitpacked_sequence<alphabet_t> reverse_complement{packed | seqan3::views::complement
+                                                                             | std::views::reverse};
+            packed.swap(reverse_complement);
+        }
+        else
+        {
+            seqan3::bulk_reverse_complement(packed);
+        }
+
+        benchmark::DoNotOptimize(packed.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * packed.size());
+}
+
+BENCHMARK_TEMPLATE(reverse_complement_bitpacked, seqan3::dna4, view_tag);
+BENCHMARK_TEMPLATE(reverse_complement_bitpacked, seqan3::dna4, bulk_in_place_tag);
+BENCHMARK_TEMPLATE(reverse_complement_bitpacked, seqan3::dna5, view_tag);
+BENCHMARK_TEMPLATE(reverse_complement_bitpacked, seqan3::dna5, bulk_in_place_tag);
+
+BENCHMARK_MAIN();
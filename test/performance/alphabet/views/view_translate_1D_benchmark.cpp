@@ -11,6 +11,7 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_translate.hpp>
 #include <seqan3/alphabet/views/translate.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/seqan2.hpp>
@@ -25,6 +26,7 @@
 // Tags used to define the benchmark type
 struct baseline_tag{}; // Baseline where view is applied and only iterating the output range is benchmarked
 struct translate_tag{}; // Benchmark seqan3::views::translate_single
+struct bulk_translate_tag{}; // Benchmark seqan3::bulk_translate
 
 // ============================================================================
 //  sequential_read
@@ -115,6 +117,16 @@ void copy_impl(benchmark::State & state, std::vector<seqan3::dna4> const & dna_s
     }
 }
 
+void copy_impl_bulk(benchmark::State & state, std::vector<seqan3::dna4> const & dna_sequence)
+{
+    for (auto _ : state)
+    {
+        std::vector<seqan3::aa27_vector> translated_aa_sequences{};
+        seqan3::bulk_translate(dna_sequence, seqan3::translation_frames::forward_frame0, translated_aa_sequences);
+        benchmark::DoNotOptimize(translated_aa_sequences);
+    }
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 template <typename tag_t>
 void copy_impl_seqan2(benchmark::State & state, seqan::DnaString const & dna_sequence)
@@ -141,6 +153,10 @@ void copy(benchmark::State & state)
         auto adaptor = seqan3::views::translate_single;
         copy_impl(state, seqan3_dna_sequence, adaptor);
     }
+    else if constexpr (std::is_same_v<tag_t, bulk_translate_tag>)
+    {
+        copy_impl_bulk(state, seqan3_dna_sequence);
+    }
 #ifdef SEQAN3_HAS_SEQAN2
     else
     {
@@ -150,6 +166,7 @@ void copy(benchmark::State & state)
 }
 
 BENCHMARK_TEMPLATE(copy, translate_tag);
+BENCHMARK_TEMPLATE(copy, bulk_translate_tag);
 
 #ifdef SEQAN3_HAS_SEQAN2
 BENCHMARK_TEMPLATE(copy, seqan::Serial);
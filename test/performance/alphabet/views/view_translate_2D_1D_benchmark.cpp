@@ -5,12 +5,15 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <iterator>
 #include <random>
+#include <seqan3/std/algorithm>
 #include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_translate.hpp>
 #include <seqan3/alphabet/views/translate.hpp>
 #include <seqan3/alphabet/views/translate_join.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
@@ -28,6 +31,7 @@
 struct baseline_tag{}; // Baseline where view is applied and only iterating the output range is benchmarked
 struct translate_tag{}; // Benchmark view_translate followed by std::views::join
 struct translate_join_tag{}; // Benchmark seqan3::views::translate_join
+struct bulk_translate_tag{}; // Benchmark seqan3::bulk_translate of every sequence
 
 // ============================================================================
 //  sequential_read
@@ -150,6 +154,24 @@ void copy_impl(benchmark::State & state,
     }
 }
 
+void copy_impl_bulk(benchmark::State & state, std::vector<std::vector<seqan3::dna4>> const & dna_sequence_collection)
+{
+    for (auto _ : state)
+    {
+        std::vector<seqan3::aa27_vector> translated_aa_sequences{};
+        translated_aa_sequences.reserve(6 * dna_sequence_collection.size());
+        std::vector<seqan3::aa27_vector> frames{};
+
+        for (auto const & dna_sequence : dna_sequence_collection)
+        {
+            seqan3::bulk_translate(dna_sequence, seqan3::translation_frames::six_frames, frames);
+            std::ranges::move(frames, std::back_inserter(translated_aa_sequences));
+        }
+
+        benchmark::DoNotOptimize(translated_aa_sequences);
+    }
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 template <typename tag_t, typename stringset_t>
 void copy_impl_seqan2(benchmark::State & state, seqan::StringSet<seqan::DnaString> const & dna_sequence_collection)
@@ -181,6 +203,10 @@ void copy(benchmark::State & state)
         auto adaptor = seqan3::views::translate_join;
         copy_impl(state, dna_sequence_collection, adaptor);
     }
+    else if constexpr (std::is_same_v<tag_t, bulk_translate_tag>)
+    {
+        copy_impl_bulk(state, dna_sequence_collection);
+    }
 }
 
 #ifdef SEQAN3_HAS_SEQAN2
@@ -201,6 +227,7 @@ void copy(benchmark::State & state)
 
 BENCHMARK_TEMPLATE(copy, translate_tag);
 BENCHMARK_TEMPLATE(copy, translate_join_tag);
+BENCHMARK_TEMPLATE(copy, bulk_translate_tag);
 
 #ifdef SEQAN3_HAS_SEQAN2
 BENCHMARK_TEMPLATE(copy, seqan::Serial, seqan::Owner<>);
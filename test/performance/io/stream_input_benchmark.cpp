@@ -7,11 +7,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
 
 #include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/io/stream/memory_mapped_streambuf.hpp>
 
 #if defined(SEQAN3_HAS_ZLIB)
     #include <seqan3/contrib/stream/bgzf_istream.hpp>
@@ -151,6 +154,68 @@ void uncompressed(benchmark::State & state)
 
 BENCHMARK(uncompressed);
 
+// ============================================================================
+//  reading an uncompressed file: file stream vs. memory mapping
+// ============================================================================
+
+// Writes the input to a temporary file, which is removed at exit.
+struct input_file_t
+{
+    std::filesystem::path path{std::filesystem::temp_directory_path() / "seqan3_stream_input_benchmark.txt"};
+
+    input_file_t()
+    {
+        std::ofstream out{path, std::ios::binary};
+        out << input;
+    }
+
+    ~input_file_t()
+    {
+        std::filesystem::remove(path);
+    }
+} const input_file{};
+
+void file_ifstream(benchmark::State & state)
+{
+    std::vector<char> stream_buffer(1'000'000); // as used by the files
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        std::ifstream s{};
+        s.rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
+        s.open(input_file.path, std::ios::binary);
+        seqan3::detail::fast_istreambuf_iterator<char> it{*s.rdbuf()};
+
+        for (; it != std::default_sentinel; ++it)
+            i += *it;
+    }
+
+    state.counters["iterations_per_run"] = i;
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(file_ifstream);
+
+template <bool populate>
+void file_memory_mapped(benchmark::State & state)
+{
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        seqan3::memory_mapped_streambuf buffer{input_file.path, populate};
+        seqan3::detail::fast_istreambuf_iterator<char> it{buffer};
+
+        for (; it != std::default_sentinel; ++it)
+            i += *it;
+    }
+
+    state.counters["iterations_per_run"] = i;
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK_TEMPLATE(file_memory_mapped, false);
+BENCHMARK_TEMPLATE(file_memory_mapped, true);
+
 // ============================================================================
 //  compression applied
 // ============================================================================
@@ -187,6 +252,37 @@ BENCHMARK_TEMPLATE(compressed, seqan3::contrib::bgzf_istream);
 BENCHMARK_TEMPLATE(compressed, seqan3::contrib::bz2_istream);
 #endif
 
+// ============================================================================
+//  bgzf decompression with increasing thread count
+// ============================================================================
+
+#if defined(SEQAN3_HAS_ZLIB)
+void bgzf_decompression_threads(benchmark::State & state)
+{
+    size_t const thread_count = state.range(0);
+    seqan3::bgzf_thread_options options{std::make_shared<seqan3::bgzf_thread_pool>(thread_count), thread_count};
+    std::istringstream s{input_comp<seqan3::contrib::bgzf_istream>};
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        s.clear();
+        s.seekg(0, std::ios::beg);
+        seqan3::contrib::bgzf_istream comp{s};
+        comp.rdbuf()->set_thread_options(options);
+        seqan3::detail::fast_istreambuf_iterator<char> it{*comp.rdbuf()};
+
+        for (; it != std::default_sentinel; ++it)
+            i += *it;
+    }
+
+    state.counters["iterations_per_run"] = i;
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(bgzf_decompression_threads)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+#endif
+
 // ============================================================================
 //  compression applied, but stuffed into plain istream
 // ============================================================================
@@ -14,6 +14,7 @@
 #if defined(SEQAN3_HAS_ZLIB)
     #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
+    #include <seqan3/contrib/stream/pgz_ostream.hpp>
 #endif
 
 #if defined(SEQAN3_HAS_BZIP2)
@@ -72,6 +73,7 @@ void compressed(benchmark::State & state)
 #if defined(SEQAN3_HAS_ZLIB)
 BENCHMARK_TEMPLATE(compressed, seqan3::contrib::gz_ostream);
 BENCHMARK_TEMPLATE(compressed, seqan3::contrib::bgzf_ostream);
+BENCHMARK_TEMPLATE(compressed, seqan3::contrib::pgz_ostream);
 #endif
 #if defined(SEQAN3_HAS_BZIP2)
 BENCHMARK_TEMPLATE(compressed, seqan3::contrib::bz2_ostream);
@@ -98,6 +100,7 @@ void compressed_type_erased(benchmark::State & state)
 #if defined(SEQAN3_HAS_ZLIB)
 BENCHMARK_TEMPLATE(compressed_type_erased, seqan3::contrib::gz_ostream);
 BENCHMARK_TEMPLATE(compressed_type_erased, seqan3::contrib::bgzf_ostream);
+BENCHMARK_TEMPLATE(compressed_type_erased, seqan3::contrib::pgz_ostream);
 #endif
 #if defined(SEQAN3_HAS_BZIP2)
 BENCHMARK_TEMPLATE(compressed_type_erased, seqan3::contrib::bz2_ostream);
@@ -124,6 +127,7 @@ void compressed_type_erased2(benchmark::State & state)
 #if defined(SEQAN3_HAS_ZLIB)
 BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::gz_ostream);
 BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bgzf_ostream);
+BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::pgz_ostream);
 #endif
 #if defined(SEQAN3_HAS_BZIP2)
 BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bz2_ostream);
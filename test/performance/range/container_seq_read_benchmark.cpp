@@ -5,6 +5,8 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <seqan3/std/algorithm>
+#include <seqan3/std/bit>
 #include <deque>
 #include <list>
 #include <vector>
@@ -141,6 +143,65 @@ BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::dna15, true);
 BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::aa27, true);
 BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::alphabet_variant<char, seqan3::dna4>, true);
 
+// ============================================================================
+//  bulk_read
+// ============================================================================
+
+template <typename alphabet_t, bool bulk>
+void bitpacked_bulk_read(benchmark::State & state)
+{
+    auto cont_rando = seqan3::test::generate_sequence<alphabet_t>(1'000'000, 0, 0);
+    seqan3::bitpacked_sequence<alphabet_t> const source(cont_rando.begin(), cont_rando.end());
+    std::vector<alphabet_t> target(source.size());
+
+    for (auto _ : state)
+    {
+        if constexpr (bulk)
+            source.extract(0, target);
+        else
+            std::ranges::copy(source, target.begin());
+
+        benchmark::DoNotOptimize(target.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * source.size());
+    state.counters["alph_size"] = seqan3::alphabet_size<alphabet_t>;
+    state.counters["bulk"] = bulk;
+}
+
+BENCHMARK_TEMPLATE(bitpacked_bulk_read, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(bitpacked_bulk_read, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(bitpacked_bulk_read, seqan3::dna15, false);
+BENCHMARK_TEMPLATE(bitpacked_bulk_read, seqan3::dna15, true);
+BENCHMARK_TEMPLATE(bitpacked_bulk_read, seqan3::aa27, false);
+BENCHMARK_TEMPLATE(bitpacked_bulk_read, seqan3::aa27, true);
+
+// ============================================================================
+//  word-wise read
+// ============================================================================
+
+// Counts the letters 'A' (rank 0) in a dna4 sequence, a word (32 letters) at a time.
+void bitpacked_word_read(benchmark::State & state)
+{
+    auto cont_rando = seqan3::test::generate_sequence<seqan3::dna4>(1'000'000, 0, 0);
+    seqan3::bitpacked_sequence<seqan3::dna4> const source(cont_rando.begin(), cont_rando.end());
+
+    for (auto _ : state)
+    {
+        size_t count{};
+        for (uint64_t const word : source.words())
+        {
+            uint64_t const non_zero = (word | word >> 1) & 0x5555'5555'5555'5555ULL; // low bit of each letter
+            count += 32 - std::popcount(non_zero);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+BENCHMARK(bitpacked_word_read);
+
 // ============================================================================
 //  run
 // ============================================================================
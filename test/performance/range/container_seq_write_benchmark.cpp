@@ -104,6 +104,71 @@ BENCHMARK_TEMPLATE(sequential_write, small_vec, seqan3::dna15);
 BENCHMARK_TEMPLATE(sequential_write, small_vec, seqan3::aa27);
 BENCHMARK_TEMPLATE(sequential_write, small_vec, seqan3::alphabet_variant<char, seqan3::dna4>);
 
+// ============================================================================
+//  construct
+// ============================================================================
+
+template <template <typename> typename container_t, typename alphabet_t>
+void construct(benchmark::State & state)
+{
+    auto source = seqan3::test::generate_sequence<alphabet_t>(1'000'000, 0, 0);
+
+    for (auto _ : state)
+    {
+        container_t<alphabet_t> target(source.begin(), source.end());
+        benchmark::DoNotOptimize(target.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * source.size());
+    state.counters["alph_size"] = seqan3::alphabet_size<alphabet_t>;
+}
+
+BENCHMARK_TEMPLATE(construct, std::vector, seqan3::dna4);
+BENCHMARK_TEMPLATE(construct, std::vector, seqan3::dna15);
+BENCHMARK_TEMPLATE(construct, std::vector, seqan3::aa27);
+
+BENCHMARK_TEMPLATE(construct, seqan3::bitpacked_sequence, seqan3::dna4);
+BENCHMARK_TEMPLATE(construct, seqan3::bitpacked_sequence, seqan3::dna15);
+BENCHMARK_TEMPLATE(construct, seqan3::bitpacked_sequence, seqan3::aa27);
+
+// ============================================================================
+//  push_back vs append
+// ============================================================================
+
+template <typename alphabet_t, bool bulk>
+void bitpacked_append(benchmark::State & state)
+{
+    auto source = seqan3::test::generate_sequence<alphabet_t>(1'000'000, 0, 0);
+
+    for (auto _ : state)
+    {
+        seqan3::bitpacked_sequence<alphabet_t> target{};
+
+        if constexpr (bulk)
+        {
+            target.append(source);
+        }
+        else
+        {
+            for (alphabet_t const letter : source)
+                target.push_back(letter);
+        }
+
+        benchmark::DoNotOptimize(target.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * source.size());
+    state.counters["alph_size"] = seqan3::alphabet_size<alphabet_t>;
+    state.counters["bulk"] = bulk;
+}
+
+BENCHMARK_TEMPLATE(bitpacked_append, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(bitpacked_append, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(bitpacked_append, seqan3::dna15, false);
+BENCHMARK_TEMPLATE(bitpacked_append, seqan3::dna15, true);
+BENCHMARK_TEMPLATE(bitpacked_append, seqan3::aa27, false);
+BENCHMARK_TEMPLATE(bitpacked_append, seqan3::aa27, true);
+
 // ============================================================================
 //  run
 // ============================================================================
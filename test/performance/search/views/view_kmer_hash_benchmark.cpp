@@ -8,7 +8,9 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/search/views/unambiguous_kmer_hash.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/performance/naive_kmer_hash.hpp>
 #include <seqan3/test/performance/units.hpp>
@@ -92,6 +94,50 @@ static void seqan_kmer_hash_gapped(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+static void seqan_unambiguous_kmer_hash_ungapped(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    size_t k = static_cast<size_t>(state.range(1));
+    assert(k > 0);
+    auto seq = seqan3::test::generate_sequence<seqan3::dna5>(sequence_length, 0, 0);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{static_cast<uint8_t>(k)}))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
+static void seqan_unambiguous_kmer_hash_gapped(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    size_t k = static_cast<size_t>(state.range(1));
+    assert(k > 0);
+    auto seq = seqan3::test::generate_sequence<seqan3::dna5>(sequence_length, 0, 0);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::unambiguous_kmer_hash(make_gapped_shape(k)))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
 static void naive_kmer_hash(benchmark::State & state)
 {
     auto sequence_length = state.range(0);
@@ -189,6 +235,8 @@ BENCHMARK(seqan2_kmer_hash_gapped)->Apply(arguments);
 
 BENCHMARK(seqan_kmer_hash_ungapped)->Apply(arguments);
 BENCHMARK(seqan_kmer_hash_gapped)->Apply(arguments);
+BENCHMARK(seqan_unambiguous_kmer_hash_ungapped)->Apply(arguments);
+BENCHMARK(seqan_unambiguous_kmer_hash_gapped)->Apply(arguments);
 BENCHMARK(naive_kmer_hash)->Apply(arguments);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,9 @@
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Compute the vectorised alignment with 8 bit lanes and recompute only the sequence pairs that do not fit.
+    auto cfg = seqan3::align_cfg::vectorised{} | seqan3::align_cfg::adaptive_score_type{};
+}
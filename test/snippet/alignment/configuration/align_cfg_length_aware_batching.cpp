@@ -0,0 +1,9 @@
+#include <seqan3/alignment/configuration/align_config_length_aware_batching.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Sort windows of 256 sequence pairs by their lengths before they are filled into the SIMD vectors.
+    auto cfg = seqan3::align_cfg::vectorised{} | seqan3::align_cfg::length_aware_batching{256};
+}
@@ -0,0 +1,9 @@
+#include <seqan3/alignment/configuration/align_config_linear_space_traceback.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Compute the alignment without a trace matrix and split the large sub-problems between two threads.
+    auto cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::linear_space_traceback{2};
+}
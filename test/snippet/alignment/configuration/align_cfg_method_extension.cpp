@@ -0,0 +1,31 @@
+#include <tuple>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/alignment_seed.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::dna4_vector reference = "TTTTTTACGTACGTACGTGGGGGGGG"_dna4;
+    seqan3::dna4_vector read = "CCCCCACGTACGTACGTAAAAA"_dna4;
+
+    // The seed starts at position 9 of the reference and at position 8 of the read and spans 4 symbols.
+    seqan3::alignment_seed seed{9, 8, 4};
+
+    // Extend the seed in both directions until the score drops 5 below the best score.
+    auto config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{5}} |
+                  seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-3}}} |
+                  seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                     seqan3::align_cfg::extension_score{-2}};
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(reference, read, seed), config))
+        seqan3::debug_stream << result << '\n';
+}
@@ -0,0 +1,7 @@
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+
+int main()
+{
+    // Compute the cells of a column of the alignment matrix with SIMD vectors.
+    auto cfg = seqan3::align_cfg::striped_vectorised{};
+}
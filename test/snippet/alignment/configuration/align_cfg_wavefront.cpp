@@ -0,0 +1,32 @@
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::dna4_vector reference = "ACGTGACTGACTAGCTAGCATCGACTAGCTAGCATCGAC"_dna4;
+    seqan3::dna4_vector read = "ACGTGACTGACTAGCAAGCATCGACTAGCTAGCTCGAC"_dna4;
+
+    auto base_config = seqan3::align_cfg::method_global{} |
+                       seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                                                             seqan3::match_score{1}, seqan3::mismatch_score{-4}}} |
+                       seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-6},
+                                                          seqan3::align_cfg::extension_score{-2}};
+
+    // Compute the alignment with the wavefront algorithm.
+    for (auto const & result : seqan3::align_pairwise(std::tie(reference, read),
+                                                      base_config | seqan3::align_cfg::wavefront{}))
+        seqan3::debug_stream << result.score() << '\n';
+
+    // Prune wavefronts with at least 10 diagonals whose diagonals are more than 50 cells behind the best one.
+    for (auto const & result : seqan3::align_pairwise(std::tie(reference, read),
+                                                      base_config | seqan3::align_cfg::wavefront{10, 50}))
+        seqan3::debug_stream << result.score() << '\n';
+}
@@ -0,0 +1,34 @@
+#include <filesystem>
+#include <vector>
+
+#include <seqan3/alphabet/container/packed_concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna5_vector> reads{"ACGTN"_dna5, "GAGGA"_dna5, "TTA"_dna5};
+
+    // Build the container in batches; append may be called from multiple threads at the same time.
+    seqan3::packed_concatenated_sequences<seqan3::dna5>::builder builder{};
+    builder.reserve(reads.size(), 13);
+    builder.append(reads);
+    seqan3::packed_concatenated_sequences<seqan3::dna5> sequences = builder.finalise();
+
+    seqan3::debug_stream << sequences[1] << '\n'; // GAGGA
+
+    // Write the container to a file and map it into memory again.
+    std::filesystem::path const path = std::filesystem::temp_directory_path() / "reads.packed";
+    sequences.save(path);
+
+    auto const mapped = seqan3::packed_concatenated_sequences<seqan3::dna5>::load(path);
+    seqan3::debug_stream << mapped.size() << ' ' << mapped.concat_size() << '\n'; // 3 13
+
+    seqan3::dna5_vector read{};
+    mapped.extract(2, read); // unpacks a whole sequence
+    seqan3::debug_stream << read << '\n'; // TTA
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,33 @@
+#include <sstream>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/quality/phred_binned.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+// Read the qualities binned and packed with 3 bits per quality score.
+struct compact_quality_traits : seqan3::sequence_file_input_default_traits_dna
+{
+    using quality_alphabet = seqan3::phred_binned;
+
+    template <typename alph>
+    using quality_container = seqan3::bitpacked_sequence<alph>;
+};
+
+auto input = R"(@read1
+ACGTTA
++
+!(5?IJ
+)";
+
+int main()
+{
+    seqan3::phred_binned quality{};
+    quality.assign_phred(31);
+    seqan3::debug_stream << quality.to_phred() << ' ' << quality.to_char() << '\n'; // 33 B
+
+    seqan3::sequence_file_input<compact_quality_traits> fin{std::istringstream{input}, seqan3::format_fastq{}};
+
+    for (auto & record : fin)
+        seqan3::debug_stream << record.base_qualities() << '\n'; // #'7BII
+}
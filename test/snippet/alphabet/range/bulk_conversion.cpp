@@ -0,0 +1,22 @@
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    std::string const chars{"ACGTTGCANACGT"};
+
+    std::vector<seqan3::dna4> sequence(chars.size());
+    seqan3::bulk_assign_char_to(chars, sequence);
+    seqan3::debug_stream << sequence << '\n'; // ACGTTGCAAACGT
+
+    std::string converted(sequence.size(), ' ');
+    seqan3::bulk_to_char(sequence, converted);
+    seqan3::debug_stream << converted << '\n'; // ACGTTGCAAACGT
+
+    // The position of the first character that is not valid for seqan3::dna4.
+    seqan3::debug_stream << seqan3::bulk_find_invalid_char<seqan3::dna4>(chars) << '\n'; // 8
+}
@@ -0,0 +1,27 @@
+#include <set>
+#include <vector>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_hash.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4_vector> reads{"ACGTTGCA"_dna4, "GGATTACA"_dna4, "ACGTTGCA"_dna4, "TTTT"_dna4};
+
+    // Deduplicate reads by their 128 bit hash values.
+    std::set<std::array<uint64_t, 2>> seen{};
+    for (seqan3::dna4_vector const & read : reads)
+    {
+        if (!seen.insert(seqan3::bulk_hash_128(read)).second)
+            seqan3::debug_stream << "duplicate: " << read << '\n'; // duplicate: ACGTTGCA
+    }
+
+    // The hash value does not depend on the container or on how the sequence is split.
+    seqan3::sequence_hasher<seqan3::dna4> hasher{};
+    hasher.update("ACGT"_dna4).update(seqan3::bitpacked_sequence<seqan3::dna4>{"TGCA"_dna4});
+    seqan3::debug_stream << (hasher.digest() == seqan3::bulk_hash(reads[0])) << '\n'; // 1
+}
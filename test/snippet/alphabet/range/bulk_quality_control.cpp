@@ -0,0 +1,32 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/alphabet/range/bulk_quality_control.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/record.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    using record_type = seqan3::sequence_record<seqan3::type_list<std::vector<seqan3::dna5>,
+                                                                  std::vector<seqan3::phred42>>,
+                                                seqan3::fields<seqan3::field::seq, seqan3::field::qual>>;
+
+    std::vector<record_type> batch{record_type{"ACGTAGCTTGCA"_dna5, "IIIIIIII5#+#"_phred42},
+                                   record_type{"AAAAAAAAAAAACGTA"_dna5, "IIIIIIIIIIIIIIII"_phred42},
+                                   record_type{"ACGTAGCTTGCA"_dna5, "555555555555"_phred42}};
+
+    seqan3::quality_control_options options{};
+    options.bwa_threshold = 20;          // trim the 3' end like `bwa aln -q 20`
+    options.dust_window_size = 10;       // mask low-complexity regions
+    options.dust_threshold = 2;
+    options.max_expected_errors = 0.1;   // filter by the expected number of errors
+
+    for (seqan3::quality_control_result const & result : seqan3::bulk_quality_control(batch, options))
+        seqan3::debug_stream << result.length << ' ' << result.masked << ' ' << result.passed << '\n';
+
+    for (auto & record : batch)
+        seqan3::debug_stream << record.sequence() << '\n';
+}
@@ -0,0 +1,23 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_reverse_complement.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> sequence = "AACGTTTG"_dna4;
+
+    std::vector<seqan3::dna4> reverse_complement(sequence.size());
+    seqan3::bulk_reverse_complement(sequence, reverse_complement);
+    seqan3::debug_stream << reverse_complement << '\n'; // CAAACGTT
+
+    seqan3::bulk_reverse_complement(sequence); // in place
+    seqan3::debug_stream << sequence << '\n'; // CAAACGTT
+
+    seqan3::bitpacked_sequence<seqan3::dna4> packed{"ACCCGT"_dna4};
+    seqan3::bulk_reverse_complement(packed);
+    seqan3::debug_stream << packed << '\n'; // ACGGGT
+}
@@ -0,0 +1,20 @@
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_translate.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> sequence = "ACGTACGTACGTA"_dna4;
+    std::vector<seqan3::aa27_vector> translations{};
+
+    seqan3::bulk_translate(sequence, seqan3::translation_frames::six_frames, translations);
+    seqan3::debug_stream << translations << '\n'; // [TYVR,RTYV,VRT,YVRT,TYVR,RTY]
+
+    seqan3::bulk_translate(sequence, seqan3::translation_frames::forward_reverse0, translations);
+    seqan3::debug_stream << translations << '\n'; // [TYVR,YVRT]
+}
@@ -0,0 +1,21 @@
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/unambiguous_kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna5> text{"ACGTNAGCA"_dna5};
+
+    // The k-mers GTN, TNA and NAG contain an N and are skipped.
+    auto hashes = text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3});
+    seqan3::debug_stream << hashes << '\n'; // [6,27,9,36]
+
+    std::vector<size_t> positions{};
+    for (auto it = hashes.begin(); it != hashes.end(); ++it)
+        positions.push_back(it.position());
+    seqan3::debug_stream << positions << '\n'; // [0,1,5,6]
+
+    seqan3::debug_stream << (text | seqan3::views::unambiguous_kmer_hash(0b101_shape)) << '\n'; // [2,7,1,8]
+}
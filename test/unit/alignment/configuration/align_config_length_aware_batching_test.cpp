@@ -0,0 +1,37 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_length_aware_batching.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_length_aware_batching, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::length_aware_batching>));
+}
+
+TEST(align_config_length_aware_batching, window_size)
+{
+    { // default
+        seqan3::configuration cfg = seqan3::align_cfg::length_aware_batching{};
+        auto window_size = std::get<seqan3::align_cfg::length_aware_batching>(cfg).window_size;
+
+        EXPECT_TRUE((std::is_same_v<decltype(window_size), uint32_t>));
+        EXPECT_EQ(window_size, 1024u);
+    }
+
+    { // user defined
+        seqan3::configuration cfg = seqan3::align_cfg::vectorised{} | seqan3::align_cfg::length_aware_batching{64};
+
+        EXPECT_TRUE(cfg.exists<seqan3::align_cfg::vectorised>());
+        EXPECT_EQ(std::get<seqan3::align_cfg::length_aware_batching>(cfg).window_size, 64u);
+    }
+}
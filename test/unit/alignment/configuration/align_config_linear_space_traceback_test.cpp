@@ -0,0 +1,38 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_linear_space_traceback.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_linear_space_traceback, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::linear_space_traceback>));
+}
+
+TEST(align_config_linear_space_traceback, thread_count)
+{
+    { // default
+        seqan3::configuration cfg = seqan3::align_cfg::linear_space_traceback{};
+        auto thread_count = std::get<seqan3::align_cfg::linear_space_traceback>(cfg).thread_count;
+
+        EXPECT_TRUE((std::is_same_v<decltype(thread_count), uint32_t>));
+        EXPECT_EQ(thread_count, 1u);
+    }
+
+    { // user defined
+        seqan3::configuration cfg = seqan3::align_cfg::method_global{} |
+                                    seqan3::align_cfg::linear_space_traceback{4};
+
+        EXPECT_TRUE(cfg.exists<seqan3::align_cfg::method_global>());
+        EXPECT_EQ(std::get<seqan3::align_cfg::linear_space_traceback>(cfg).thread_count, 4u);
+    }
+}
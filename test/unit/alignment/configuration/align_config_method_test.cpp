@@ -32,3 +32,28 @@ TEST(method_global, access_member_variables)
     EXPECT_TRUE(opt.free_end_gaps_sequence1_trailing);
     EXPECT_TRUE(opt.free_end_gaps_sequence2_trailing);
 }
+
+TEST(method_extension, access_member_variables)
+{
+    seqan3::align_cfg::method_extension opt{}; // default construction
+
+    EXPECT_TRUE((std::is_same_v<decltype(opt.x_drop), int32_t>));
+    EXPECT_EQ(opt.x_drop, 30);
+    EXPECT_FALSE(opt.z_drop.has_value());
+
+    seqan3::align_cfg::method_extension x_drop_only{seqan3::align_cfg::x_drop{10}};
+    EXPECT_EQ(x_drop_only.x_drop, 10);
+    EXPECT_FALSE(x_drop_only.z_drop.has_value());
+
+    seqan3::align_cfg::method_extension with_z_drop{seqan3::align_cfg::x_drop{10}, seqan3::align_cfg::z_drop{40}};
+    EXPECT_EQ(with_z_drop.x_drop, 10);
+    EXPECT_EQ(with_z_drop.z_drop, 40);
+}
+
+TEST(method_extension, configuration)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{20}};
+
+    EXPECT_TRUE(cfg.exists<seqan3::align_cfg::method_extension>());
+    EXPECT_EQ(std::get<seqan3::align_cfg::method_extension>(cfg).x_drop, 20);
+}
@@ -31,3 +31,14 @@ TEST(align_config_score_type, score_type_exists)
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::score_type<double>>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::score_type>());
 }
+
+TEST(align_config_score_type, adaptive_score_type)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::adaptive_score_type{};
+    EXPECT_TRUE(cfg.exists<seqan3::align_cfg::adaptive_score_type>());
+    EXPECT_FALSE(cfg.exists<seqan3::align_cfg::score_type>());
+
+    // The adaptive score type and a fixed score type are mutually exclusive.
+    EXPECT_FALSE((seqan3::detail::config_element_pipeable_with<seqan3::align_cfg::adaptive_score_type,
+                                                               seqan3::align_cfg::score_type<int32_t>>));
+}
@@ -18,3 +18,9 @@ TEST(align_config_vectorised, config_element)
     seqan3::configuration cfg{seqan3::align_cfg::vectorised{}};
     EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::vectorised>());
 }
+
+TEST(align_config_striped_vectorised, config_element)
+{
+    seqan3::configuration cfg{seqan3::align_cfg::striped_vectorised{}};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::striped_vectorised>());
+}
@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_wavefront, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::wavefront>));
+}
+
+TEST(align_config_wavefront, adaptive_pruning)
+{
+    { // default
+        seqan3::configuration cfg = seqan3::align_cfg::wavefront{};
+        auto const & wavefront = std::get<seqan3::align_cfg::wavefront>(cfg);
+
+        EXPECT_FALSE(wavefront.adaptive_pruning);
+        EXPECT_TRUE((std::is_same_v<decltype(wavefront.min_wavefront_length), uint32_t>));
+        EXPECT_TRUE((std::is_same_v<decltype(wavefront.max_distance_threshold), uint32_t>));
+        EXPECT_EQ(wavefront.min_wavefront_length, 10u);
+        EXPECT_EQ(wavefront.max_distance_threshold, 50u);
+    }
+
+    { // user defined
+        seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::wavefront{20, 100};
+        auto const & wavefront = std::get<seqan3::align_cfg::wavefront>(cfg);
+
+        EXPECT_TRUE(cfg.exists<seqan3::align_cfg::method_global>());
+        EXPECT_TRUE(wavefront.adaptive_pruning);
+        EXPECT_EQ(wavefront.min_wavefront_length, 20u);
+        EXPECT_EQ(wavefront.max_distance_threshold, 100u);
+    }
+}
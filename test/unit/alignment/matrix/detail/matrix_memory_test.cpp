@@ -0,0 +1,147 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
+#include <seqan3/alignment/matrix/detail/score_matrix_single_column.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
+
+using seqan3::detail::column_index_type;
+using seqan3::detail::matrix_memory_statistics;
+using seqan3::detail::row_index_type;
+
+struct matrix_memory_test : public ::testing::Test
+{
+    void SetUp() override
+    {
+        matrix_memory_statistics::local().reset();
+    }
+
+    matrix_memory_statistics & statistics = matrix_memory_statistics::local();
+};
+
+TEST_F(matrix_memory_test, reserve_matrix_memory)
+{
+    std::vector<int> storage{};
+
+    seqan3::detail::reserve_matrix_memory(storage, 10);
+    EXPECT_GE(storage.capacity(), 10u);
+    EXPECT_TRUE(storage.empty()); // Only the capacity is changed.
+    EXPECT_EQ(statistics.allocations, 1u);
+    EXPECT_EQ(statistics.allocations_avoided, 0u);
+
+    size_t const capacity = storage.capacity();
+    seqan3::detail::reserve_matrix_memory(storage, 10);
+    seqan3::detail::reserve_matrix_memory(storage, 5);
+    EXPECT_EQ(storage.capacity(), capacity);
+    EXPECT_EQ(statistics.allocations, 1u);
+    EXPECT_EQ(statistics.allocations_avoided, 2u);
+
+    // Grows geometrically.
+    seqan3::detail::reserve_matrix_memory(storage, capacity + 1);
+    EXPECT_GE(storage.capacity(), 2 * capacity);
+    EXPECT_EQ(statistics.allocations, 2u);
+    EXPECT_EQ(statistics.allocations_avoided, 2u);
+
+    statistics.reset();
+    EXPECT_EQ(statistics.allocations, 0u);
+    EXPECT_EQ(statistics.allocations_avoided, 0u);
+}
+
+TEST_F(matrix_memory_test, reserve_matrix_memory_exact)
+{
+    std::vector<int> storage{};
+
+    seqan3::detail::reserve_matrix_memory(storage, 10, seqan3::detail::matrix_memory_growth::exact);
+    seqan3::detail::reserve_matrix_memory(storage, 11, seqan3::detail::matrix_memory_growth::exact);
+    EXPECT_EQ(storage.capacity(), 11u);
+    EXPECT_EQ(statistics.allocations, 2u);
+}
+
+TEST_F(matrix_memory_test, cache_release)
+{
+    using cache_entry_t = seqan3::detail::matrix_memory_cache::entry<std::vector<int>>;
+
+    cache_entry_t first{};
+    std::optional<cache_entry_t> second{std::in_place};
+    first.matrix.resize(10);
+    second->matrix.resize(10);
+
+    second.reset(); // removes the entry from the cache
+    seqan3::detail::matrix_memory_cache::local().release();
+    EXPECT_EQ(first.matrix.capacity(), 0u);
+
+    // Entries of other threads are not released.
+    std::thread worker{[] ()
+    {
+        cache_entry_t other{};
+        other.matrix.resize(10);
+        seqan3::detail::matrix_memory_cache::local().release();
+        EXPECT_EQ(other.matrix.capacity(), 0u);
+    }};
+    first.matrix.resize(10);
+    worker.join();
+    EXPECT_EQ(first.matrix.size(), 10u);
+}
+
+TEST_F(matrix_memory_test, thread_local_statistics)
+{
+    std::vector<int> storage{};
+    seqan3::detail::reserve_matrix_memory(storage, 10);
+
+    matrix_memory_statistics other_thread_statistics{};
+    std::thread worker{[&other_thread_statistics] ()
+    {
+        std::vector<int> storage{};
+        seqan3::detail::reserve_matrix_memory(storage, 10);
+        seqan3::detail::reserve_matrix_memory(storage, 10);
+        other_thread_statistics = matrix_memory_statistics::local();
+    }};
+    worker.join();
+
+    EXPECT_EQ(statistics.allocations, 1u);
+    EXPECT_EQ(statistics.allocations_avoided, 0u);
+    EXPECT_EQ(other_thread_statistics.allocations, 1u);
+    EXPECT_EQ(other_thread_statistics.allocations_avoided, 1u);
+}
+
+TEST_F(matrix_memory_test, score_matrix_single_column)
+{
+    seqan3::detail::score_matrix_single_column<int32_t> matrix{};
+
+    matrix.resize(column_index_type{10u}, row_index_type{100u});
+    EXPECT_EQ(statistics.allocations, 2u); // optimal and horizontal column
+    EXPECT_EQ(statistics.allocations_avoided, 0u);
+
+    matrix.resize(column_index_type{10u}, row_index_type{50u});
+    matrix.resize_for_overwrite(column_index_type{10u}, row_index_type{100u});
+    EXPECT_EQ(statistics.allocations, 2u);
+    EXPECT_EQ(statistics.allocations_avoided, 4u);
+}
+
+TEST_F(matrix_memory_test, trace_matrix_full)
+{
+    seqan3::detail::trace_matrix_full<seqan3::detail::trace_directions> matrix{};
+
+    matrix.resize(column_index_type{10u}, row_index_type{100u});
+    EXPECT_EQ(statistics.allocations, 2u); // complete matrix and horizontal column
+    EXPECT_EQ(statistics.allocations_avoided, 0u);
+
+    matrix.resize(column_index_type{100u}, row_index_type{10u});
+    matrix.resize(column_index_type{5u}, row_index_type{20u});
+    EXPECT_EQ(statistics.allocations, 2u);
+    EXPECT_EQ(statistics.allocations_avoided, 4u);
+
+    matrix.resize(column_index_type{11u}, row_index_type{100u});
+    EXPECT_EQ(statistics.allocations, 3u);
+    EXPECT_EQ(statistics.allocations_avoided, 5u);
+}
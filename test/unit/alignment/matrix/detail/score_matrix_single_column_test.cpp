@@ -57,3 +57,46 @@ struct iterator_fixture<matrix_iterator_t> : public ::testing::Test
 };
 
 INSTANTIATE_TYPED_TEST_SUITE_P(score_matrix_single_column_test, iterator_fixture, matrix_iterator_t, );
+
+TEST(score_matrix_single_column_test, resize_reuses_memory)
+{
+    using seqan3::detail::column_index_type;
+    using seqan3::detail::row_index_type;
+
+    matrix_t matrix{};
+    matrix.resize(column_index_type{2u}, row_index_type{10u}, 7);
+
+    // Write some values into the matrix.
+    for (auto && cell : *matrix.begin())
+    {
+        cell.best_score() = 1;
+        cell.horizontal_score() = 2;
+    }
+
+    // Shrinking the matrix only reduces the size of the column ranges.
+    matrix.resize(column_index_type{3u}, row_index_type{5u}, -3);
+    EXPECT_EQ(std::ranges::distance(matrix.begin(), matrix.end()), 3);
+    for (auto && column : matrix)
+    {
+        EXPECT_EQ(std::ranges::distance(column), 5);
+        for (auto && cell : column)
+        {
+            EXPECT_EQ(cell.best_score(), -3);
+            EXPECT_EQ(cell.horizontal_score(), -3);
+            EXPECT_EQ(cell.vertical_score(), -3);
+        }
+    }
+
+    // Resizing for overwrite keeps the values of the previous alignment, but sets the vertical column.
+    matrix.resize_for_overwrite(column_index_type{1u}, row_index_type{10u}, 4);
+    auto column = *matrix.begin();
+    EXPECT_EQ(std::ranges::distance(column), 10);
+    auto cell_it = column.begin();
+    for (size_t row = 0; row < 10; ++row, ++cell_it)
+    {
+        auto cell = *cell_it;
+        EXPECT_EQ(cell.best_score(), (row < 5) ? -3 : 1);
+        EXPECT_EQ(cell.horizontal_score(), (row < 5) ? -3 : 2);
+        EXPECT_EQ(cell.vertical_score(), 4);
+    }
+}
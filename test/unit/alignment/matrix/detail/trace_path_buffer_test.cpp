@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/trace_path_buffer.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::detail::trace_directions;
+
+static constexpr trace_directions D = trace_directions::diagonal;
+static constexpr trace_directions L = trace_directions::left;
+static constexpr trace_directions U = trace_directions::up;
+
+TEST(trace_path_buffer, concepts)
+{
+    seqan3::detail::trace_path_buffer buffer{};
+    using path_t = decltype(buffer.trace_path(seqan3::detail::matrix_coordinate{}));
+
+    EXPECT_TRUE(std::ranges::forward_range<path_t>);
+    EXPECT_FALSE(std::ranges::sized_range<path_t>);
+}
+
+TEST(trace_path_buffer, append)
+{
+    seqan3::detail::trace_path_buffer buffer{};
+    EXPECT_EQ(buffer.size(), 0u);
+
+    buffer.append(D);
+    buffer.append(U, 2);
+    EXPECT_EQ(buffer.size(), 3u);
+
+    seqan3::detail::trace_path_buffer other{};
+    other.append(L, 3);
+    buffer.append(other);
+    buffer.append(D, 0);
+    EXPECT_EQ(buffer.size(), 6u);
+
+    buffer.clear();
+    EXPECT_EQ(buffer.size(), 0u);
+}
+
+TEST(trace_path_buffer, trace_path)
+{
+    seqan3::detail::trace_path_buffer buffer{};
+    buffer.append(D);
+    buffer.append(U, 2);
+    buffer.append(L);
+    buffer.append(D);
+
+    // The path begins in (1, 2) and ends in (5, 6).
+    auto path = buffer.trace_path(seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{5u},
+                                                                     seqan3::detail::column_index_type{6u}});
+
+    EXPECT_RANGE_EQ(path, (std::vector<trace_directions>{D, L, U, U, D}));
+
+    std::vector<seqan3::detail::matrix_coordinate> coordinates{};
+    auto it = path.begin();
+    for (; it != path.end(); ++it)
+        coordinates.push_back(it.coordinate());
+
+    using coordinate_t = std::pair<size_t, size_t>;
+    EXPECT_EQ(static_cast<coordinate_t>(coordinates[0]), (coordinate_t{6u, 5u}));
+    EXPECT_EQ(static_cast<coordinate_t>(coordinates[1]), (coordinate_t{5u, 4u}));
+    EXPECT_EQ(static_cast<coordinate_t>(coordinates[2]), (coordinate_t{4u, 4u}));
+    EXPECT_EQ(static_cast<coordinate_t>(coordinates[3]), (coordinate_t{4u, 3u}));
+    EXPECT_EQ(static_cast<coordinate_t>(coordinates[4]), (coordinate_t{4u, 2u}));
+    EXPECT_EQ(static_cast<coordinate_t>(it.coordinate()), (coordinate_t{3u, 1u}));
+}
+
+TEST(trace_path_buffer, empty_trace_path)
+{
+    seqan3::detail::trace_path_buffer buffer{};
+    auto path = buffer.trace_path(seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{2u},
+                                                                     seqan3::detail::column_index_type{3u}});
+
+    EXPECT_TRUE(path.begin() == path.end());
+    EXPECT_EQ(path.begin().coordinate().row, 2u);
+    EXPECT_EQ(path.begin().coordinate().col, 3u);
+}
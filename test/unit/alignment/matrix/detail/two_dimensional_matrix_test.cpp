@@ -199,6 +199,23 @@ TYPED_TEST(two_dimensional_matrix_test, resize)
     EXPECT_EQ(matrix.rows(), 3u);
 }
 
+TYPED_TEST(two_dimensional_matrix_test, reserve)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+
+    matrix_type matrix{};
+    matrix.reserve(20);
+    EXPECT_GE(matrix.capacity(), 20u);
+    EXPECT_EQ(matrix.cols(), 0u);
+    EXPECT_EQ(matrix.rows(), 0u);
+
+    auto * const data = matrix.data();
+    matrix.resize(seqan3::detail::number_rows{4}, seqan3::detail::number_cols{5});
+    EXPECT_EQ(matrix.data(), data); // No reallocation.
+    EXPECT_EQ(matrix.cols(), 5u);
+    EXPECT_EQ(matrix.rows(), 4u);
+}
+
 TYPED_TEST(two_dimensional_matrix_test, range)
 {
     // For an explanation how this works see iterator_fixture further below in this file.
@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_linear_space_traceback.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment/compare_to_reference_alignment.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/local_affine_unbanded.hpp"
+#include "fixture/semi_global_affine_unbanded.hpp"
+#include "pairwise_alignment_single_test_template.hpp"
+
+// The fixtures are aligned with the linear space traceback if the begin positions are requested without the debug
+// matrices. The local alignment is always computed with the trace matrix.
+namespace seqan3::test::alignment::fixture::linear_space
+{
+
+inline constexpr seqan3::align_cfg::linear_space_traceback linear_space_traceback{};
+
+static auto global_dna4_part_01 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01, linear_space_traceback);
+static auto global_dna4_part_02 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02, linear_space_traceback);
+static auto global_dna4_part_03 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_03, linear_space_traceback);
+static auto global_dna4_part_04 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_04, linear_space_traceback);
+static auto global_dna4_part_05 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_05, linear_space_traceback);
+static auto global_dna4_seq1_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty, linear_space_traceback);
+static auto global_dna4_seq2_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty, linear_space_traceback);
+static auto global_dna4_both_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty, linear_space_traceback);
+static auto global_aa27 =
+    with_config(global::affine::unbanded::aa27_blosum62_gap_1_open_10, linear_space_traceback);
+static auto global_aa27_small =
+    with_config(global::affine::unbanded::aa27_blosum62_gap_1_open_10_small, linear_space_traceback);
+static auto semi_global_dna4_01 =
+    with_config(semi_global::affine::unbanded::dna4_01_semi_first, linear_space_traceback);
+static auto semi_global_dna4_02 =
+    with_config(semi_global::affine::unbanded::dna4_02_semi_first, linear_space_traceback);
+static auto semi_global_dna4_03 =
+    with_config(semi_global::affine::unbanded::dna4_03_semi_second, linear_space_traceback);
+static auto semi_global_dna4_04 =
+    with_config(semi_global::affine::unbanded::dna4_04_semi_second, linear_space_traceback);
+static auto local_dna4_01 =
+    with_config(local::affine::unbanded::dna4_01, linear_space_traceback);
+static auto local_dna4_02 =
+    with_config(local::affine::unbanded::dna4_02, linear_space_traceback);
+static auto local_dna4_03 =
+    with_config(local::affine::unbanded::dna4_03, linear_space_traceback);
+static auto local_dna4_04 =
+    with_config(local::affine::unbanded::dna4_04, linear_space_traceback);
+static auto local_dna4_05 =
+    with_config(local::affine::unbanded::dna4_05, linear_space_traceback);
+static auto local_rna5_01 =
+    with_config(local::affine::unbanded::rna5_01, linear_space_traceback);
+static auto local_aa27_01 =
+    with_config(local::affine::unbanded::aa27_01, linear_space_traceback);
+static auto local_aa27_02 =
+    with_config(local::affine::unbanded::aa27_02, linear_space_traceback);
+
+} // namespace seqan3::test::alignment::fixture::linear_space
+
+using pairwise_linear_space_global_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_part_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_part_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_part_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_part_04>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_part_05>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_seq1_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_seq2_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_dna4_both_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_aa27>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::global_aa27_small>
+    >;
+
+using pairwise_linear_space_semi_global_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::semi_global_dna4_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::semi_global_dna4_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::semi_global_dna4_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::semi_global_dna4_04>
+    >;
+
+using pairwise_linear_space_local_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_dna4_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_dna4_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_dna4_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_dna4_04>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_dna4_05>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_rna5_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_aa27_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::linear_space::local_aa27_02>
+    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_linear_space_global,
+                               pairwise_alignment_test,
+                               pairwise_linear_space_global_testing_types, );
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_linear_space_semi_global,
+                               pairwise_alignment_test,
+                               pairwise_linear_space_semi_global_testing_types, );
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_linear_space_local,
+                               pairwise_alignment_test,
+                               pairwise_linear_space_local_testing_types, );
+
+// Compares the linear space alignments of randomly generated pairs with the scores and end positions of the
+// alignments without trace.
+template <typename alphabet_t, typename config_t>
+void compare_to_score_only(config_t const & config,
+                           size_t const size,
+                           size_t const size_variance,
+                           size_t const count = 20,
+                           uint32_t const thread_count = 1)
+{
+    // The end positions of co-optimal alignments are chosen as in the alignment that computes only the end positions.
+    seqan3::test::compare_to_reference_alignment<alphabet_t>(config | seqan3::align_cfg::output_score{} |
+                                                                      seqan3::align_cfg::output_end_position{},
+                                                             config |
+                                                             seqan3::align_cfg::linear_space_traceback{thread_count},
+                                                             size,
+                                                             size_variance,
+                                                             count);
+}
+
+inline constexpr auto dna4_scheme = seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}};
+inline constexpr auto affine_gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                      seqan3::align_cfg::extension_score{-1}};
+inline constexpr auto linear_gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                                      seqan3::align_cfg::extension_score{-2}};
+
+TEST(affine_unbanded_linear_space, global_random_pairs)
+{
+    auto const config = seqan3::align_cfg::method_global{} | dna4_scheme | affine_gap;
+
+    compare_to_score_only<seqan3::dna4>(config, 10, 10);
+    compare_to_score_only<seqan3::dna4>(config, 150, 140);
+    compare_to_score_only<seqan3::dna4>(seqan3::align_cfg::method_global{} | dna4_scheme | linear_gap, 150, 140);
+    compare_to_score_only<seqan3::dna4>(config | seqan3::align_cfg::score_type<double>{}, 150, 140);
+}
+
+TEST(affine_unbanded_linear_space, semi_global_random_pairs)
+{
+    for (bool const sequence1_leading : {false, true})
+    {
+        for (bool const sequence2_leading : {false, true})
+        {
+            for (bool const sequence1_trailing : {false, true})
+            {
+                for (bool const sequence2_trailing : {false, true})
+                {
+                    auto const config = seqan3::align_cfg::method_global{
+                                            seqan3::align_cfg::free_end_gaps_sequence1_leading{sequence1_leading},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_leading{sequence2_leading},
+                                            seqan3::align_cfg::free_end_gaps_sequence1_trailing{sequence1_trailing},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_trailing{sequence2_trailing}} |
+                                        dna4_scheme;
+
+                    compare_to_score_only<seqan3::dna4>(config | affine_gap, 60, 55);
+                    compare_to_score_only<seqan3::dna4>(config | linear_gap, 60, 55);
+                }
+            }
+        }
+    }
+}
+
+TEST(affine_unbanded_linear_space, aa27_random_pairs)
+{
+    auto const blosum62 = seqan3::align_cfg::scoring_scheme{
+                              seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+
+    compare_to_score_only<seqan3::aa27>(seqan3::align_cfg::method_global{} | blosum62 | affine_gap, 100, 90);
+}
+
+TEST(affine_unbanded_linear_space, multiple_threads)
+{
+    auto const config = seqan3::align_cfg::method_global{} | dna4_scheme | affine_gap;
+
+    compare_to_score_only<seqan3::dna4>(config, 150, 140, 20, 4);
+    compare_to_score_only<seqan3::dna4>(config, 1500, 500, 2, 4);
+}
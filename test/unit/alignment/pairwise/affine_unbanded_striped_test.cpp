@@ -0,0 +1,194 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment/compare_to_reference_alignment.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/local_affine_unbanded.hpp"
+#include "fixture/semi_global_affine_unbanded.hpp"
+#include "pairwise_alignment_single_test_template.hpp"
+
+// The fixtures are aligned with the striped vectorisation, except for the tests that request the begin positions,
+// the alignment or the debug matrices, which fall back to the scalar alignment.
+namespace seqan3::test::alignment::fixture::striped
+{
+
+inline constexpr seqan3::align_cfg::striped_vectorised striped_vectorised{};
+
+static auto global_dna4_part_01 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01, striped_vectorised);
+static auto global_dna4_part_02 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02, striped_vectorised);
+static auto global_dna4_part_03 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_03, striped_vectorised);
+static auto global_dna4_part_04 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_04, striped_vectorised);
+static auto global_dna4_part_05 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_05, striped_vectorised);
+static auto global_dna4_seq1_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty, striped_vectorised);
+static auto global_dna4_seq2_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty, striped_vectorised);
+static auto global_dna4_both_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty, striped_vectorised);
+static auto global_aa27 =
+    with_config(global::affine::unbanded::aa27_blosum62_gap_1_open_10, striped_vectorised);
+static auto global_aa27_small =
+    with_config(global::affine::unbanded::aa27_blosum62_gap_1_open_10_small, striped_vectorised);
+static auto semi_global_dna4_01 =
+    with_config(semi_global::affine::unbanded::dna4_01_semi_first, striped_vectorised);
+static auto semi_global_dna4_02 =
+    with_config(semi_global::affine::unbanded::dna4_02_semi_first, striped_vectorised);
+static auto semi_global_dna4_03 =
+    with_config(semi_global::affine::unbanded::dna4_03_semi_second, striped_vectorised);
+static auto semi_global_dna4_04 =
+    with_config(semi_global::affine::unbanded::dna4_04_semi_second, striped_vectorised);
+static auto local_dna4_01 =
+    with_config(local::affine::unbanded::dna4_01, striped_vectorised);
+static auto local_dna4_02 =
+    with_config(local::affine::unbanded::dna4_02, striped_vectorised);
+static auto local_dna4_03 =
+    with_config(local::affine::unbanded::dna4_03, striped_vectorised);
+static auto local_dna4_04 =
+    with_config(local::affine::unbanded::dna4_04, striped_vectorised);
+static auto local_dna4_05 =
+    with_config(local::affine::unbanded::dna4_05, striped_vectorised);
+static auto local_rna5_01 =
+    with_config(local::affine::unbanded::rna5_01, striped_vectorised);
+static auto local_aa27_01 =
+    with_config(local::affine::unbanded::aa27_01, striped_vectorised);
+static auto local_aa27_02 =
+    with_config(local::affine::unbanded::aa27_02, striped_vectorised);
+
+} // namespace seqan3::test::alignment::fixture::striped
+
+using pairwise_striped_global_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_part_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_part_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_part_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_part_04>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_part_05>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_seq1_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_seq2_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_dna4_both_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_aa27>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::global_aa27_small>
+    >;
+
+using pairwise_striped_semi_global_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::semi_global_dna4_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::semi_global_dna4_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::semi_global_dna4_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::semi_global_dna4_04>
+    >;
+
+using pairwise_striped_local_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_dna4_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_dna4_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_dna4_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_dna4_04>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_dna4_05>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_rna5_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_aa27_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::striped::local_aa27_02>
+    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_striped_global,
+                               pairwise_alignment_test,
+                               pairwise_striped_global_testing_types, );
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_striped_semi_global,
+                               pairwise_alignment_test,
+                               pairwise_striped_semi_global_testing_types, );
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_striped_local,
+                               pairwise_alignment_test,
+                               pairwise_striped_local_testing_types, );
+
+// Compares the striped alignments of randomly generated pairs with the scalar ones.
+template <typename alphabet_t, typename config_t>
+void compare_to_scalar(config_t const & config, size_t const size, size_t const size_variance, size_t const count = 20)
+{
+    auto const output_config = config | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    seqan3::test::compare_to_reference_alignment<alphabet_t>(output_config,
+                                                             output_config | seqan3::align_cfg::striped_vectorised{},
+                                                             size,
+                                                             size_variance,
+                                                             count);
+}
+
+inline constexpr auto dna4_scheme = seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}};
+inline constexpr auto affine_gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                      seqan3::align_cfg::extension_score{-1}};
+// Without a gap open score the vertical gaps are propagated between the segments most often.
+inline constexpr auto linear_gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                                      seqan3::align_cfg::extension_score{-2}};
+
+TEST(affine_unbanded_striped, global_random_pairs)
+{
+    auto const config = seqan3::align_cfg::method_global{} | dna4_scheme | affine_gap;
+
+    compare_to_scalar<seqan3::dna4>(config, 10, 10);
+    compare_to_scalar<seqan3::dna4>(config, 150, 140);
+    compare_to_scalar<seqan3::dna4>(config | seqan3::align_cfg::score_type<int16_t>{}, 150, 140);
+    compare_to_scalar<seqan3::dna4>(seqan3::align_cfg::method_global{} | dna4_scheme | linear_gap, 150, 140);
+    compare_to_scalar<seqan3::dna4>(config, 1000, 0, 2);
+}
+
+TEST(affine_unbanded_striped, semi_global_random_pairs)
+{
+    for (bool const sequence1_leading : {false, true})
+    {
+        for (bool const sequence2_leading : {false, true})
+        {
+            for (bool const sequence1_trailing : {false, true})
+            {
+                for (bool const sequence2_trailing : {false, true})
+                {
+                    auto const config = seqan3::align_cfg::method_global{
+                                            seqan3::align_cfg::free_end_gaps_sequence1_leading{sequence1_leading},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_leading{sequence2_leading},
+                                            seqan3::align_cfg::free_end_gaps_sequence1_trailing{sequence1_trailing},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_trailing{sequence2_trailing}} |
+                                        dna4_scheme;
+
+                    compare_to_scalar<seqan3::dna4>(config | affine_gap, 60, 55);
+                    compare_to_scalar<seqan3::dna4>(config | linear_gap, 60, 55);
+                }
+            }
+        }
+    }
+}
+
+TEST(affine_unbanded_striped, local_random_pairs)
+{
+    auto const config = seqan3::align_cfg::method_local{} | dna4_scheme | affine_gap;
+
+    compare_to_scalar<seqan3::dna4>(config, 10, 10);
+    compare_to_scalar<seqan3::dna4>(config, 150, 140);
+    compare_to_scalar<seqan3::dna4>(config | seqan3::align_cfg::score_type<int16_t>{}, 150, 140);
+    compare_to_scalar<seqan3::dna4>(seqan3::align_cfg::method_local{} | dna4_scheme | linear_gap, 150, 140);
+    compare_to_scalar<seqan3::dna4>(config, 1000, 0, 2);
+}
+
+TEST(affine_unbanded_striped, aa27_random_pairs)
+{
+    auto const blosum62 = seqan3::align_cfg::scoring_scheme{
+                              seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+
+    compare_to_scalar<seqan3::aa27>(seqan3::align_cfg::method_global{} | blosum62 | affine_gap, 100, 90);
+    compare_to_scalar<seqan3::aa27>(seqan3::align_cfg::method_local{} | blosum62 | affine_gap, 100, 90);
+}
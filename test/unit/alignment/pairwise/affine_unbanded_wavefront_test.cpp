@@ -0,0 +1,184 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment/compare_to_reference_alignment.hpp>
+#include <seqan3/test/alignment/rescore_alignment.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/semi_global_affine_unbanded.hpp"
+#include "pairwise_alignment_single_test_template.hpp"
+
+// The fixtures are aligned with wavefronts unless the debug matrices are requested. Free end gaps and scoring schemes
+// with different match scores are computed without wavefronts.
+namespace seqan3::test::alignment::fixture::wavefront
+{
+
+inline constexpr seqan3::align_cfg::wavefront wavefront{};
+
+static auto global_dna4_part_01 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01, wavefront);
+static auto global_dna4_part_02 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02, wavefront);
+static auto global_dna4_part_03 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_03, wavefront);
+static auto global_dna4_part_04 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_04, wavefront);
+static auto global_dna4_part_05 =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_05, wavefront);
+static auto global_dna4_seq1_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty, wavefront);
+static auto global_dna4_seq2_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty, wavefront);
+static auto global_dna4_both_empty =
+    with_config(global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty, wavefront);
+static auto global_aa27 =
+    with_config(global::affine::unbanded::aa27_blosum62_gap_1_open_10, wavefront);
+static auto global_aa27_small =
+    with_config(global::affine::unbanded::aa27_blosum62_gap_1_open_10_small, wavefront);
+static auto semi_global_dna4_01 =
+    with_config(semi_global::affine::unbanded::dna4_01_semi_first, wavefront);
+static auto semi_global_dna4_02 =
+    with_config(semi_global::affine::unbanded::dna4_02_semi_first, wavefront);
+static auto semi_global_dna4_03 =
+    with_config(semi_global::affine::unbanded::dna4_03_semi_second, wavefront);
+static auto semi_global_dna4_04 =
+    with_config(semi_global::affine::unbanded::dna4_04_semi_second, wavefront);
+
+} // namespace seqan3::test::alignment::fixture::wavefront
+
+using pairwise_wavefront_global_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_part_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_part_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_part_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_part_04>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_part_05>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_seq1_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_seq2_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_dna4_both_empty>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_aa27>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::global_aa27_small>
+    >;
+
+using pairwise_wavefront_semi_global_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::semi_global_dna4_01>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::semi_global_dna4_02>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::semi_global_dna4_03>,
+        pairwise_alignment_fixture<&seqan3::test::alignment::fixture::wavefront::semi_global_dna4_04>
+    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_wavefront_global,
+                               pairwise_alignment_test,
+                               pairwise_wavefront_global_testing_types, );
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_wavefront_semi_global,
+                               pairwise_alignment_test,
+                               pairwise_wavefront_semi_global_testing_types, );
+
+// Compares the wavefront alignments of randomly generated pairs with the dynamic programming alignments.
+template <typename alphabet_t, typename config_t>
+void compare_to_dynamic_programming(config_t const & config,
+                                    size_t const size,
+                                    size_t const size_variance,
+                                    size_t const count = 20)
+{
+    seqan3::test::compare_to_reference_alignment<alphabet_t>(config,
+                                                             config | seqan3::align_cfg::wavefront{},
+                                                             size,
+                                                             size_variance,
+                                                             count);
+}
+
+inline constexpr auto dna4_scheme = seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}};
+inline constexpr auto affine_gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                      seqan3::align_cfg::extension_score{-1}};
+
+TEST(affine_unbanded_wavefront, global_random_pairs)
+{
+    auto const config = seqan3::align_cfg::method_global{} | dna4_scheme;
+
+    compare_to_dynamic_programming<seqan3::dna4>(config | affine_gap, 10, 10);
+    compare_to_dynamic_programming<seqan3::dna4>(config | affine_gap, 150, 140);
+    compare_to_dynamic_programming<seqan3::dna4>(config | affine_gap | seqan3::align_cfg::score_type<double>{},
+                                                 150, 140);
+
+    // Linear gap costs, only mismatches and only gaps.
+    for (auto const gap_cost : {seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                                   seqan3::align_cfg::extension_score{-2}},
+                                seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-3},
+                                                                   seqan3::align_cfg::extension_score{-4}},
+                                seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-40},
+                                                                   seqan3::align_cfg::extension_score{-40}},
+                                seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-1},
+                                                                   seqan3::align_cfg::extension_score{-1}}})
+    {
+        compare_to_dynamic_programming<seqan3::dna4>(config | gap_cost, 60, 55);
+    }
+
+    auto const negative_match_scheme = seqan3::align_cfg::scoring_scheme{
+                                           seqan3::nucleotide_scoring_scheme{seqan3::match_score{-1},
+                                                                             seqan3::mismatch_score{-3}}};
+    compare_to_dynamic_programming<seqan3::dna4>(seqan3::align_cfg::method_global{} | negative_match_scheme |
+                                                 affine_gap, 60, 55);
+}
+
+TEST(affine_unbanded_wavefront, adaptive_pruning)
+{
+    // The fixtures are too short to be pruned with the default parameters.
+    auto const fixture = seqan3::test::alignment::fixture::global::affine::unbanded::
+                             dna4_match_4_mismatch_5_gap_1_open_10_part_01;
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+    auto fixture_result = *seqan3::align_pairwise(std::tie(database, query),
+                                                  fixture.config | seqan3::align_cfg::wavefront{10, 50}).begin();
+
+    EXPECT_EQ(fixture_result.score(), fixture.score);
+    EXPECT_EQ(seqan3::test::rescore_alignment(database, query, fixture_result, fixture.config), fixture.score);
+
+    // Similar sequences are aligned optimally.
+    using sequence_t = std::vector<seqan3::dna4>;
+    sequence_t sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(2000, 0, 0);
+    sequence_t sequence2 = sequence1;
+    for (size_t position = 5; position < sequence2.size(); position += 50)
+        sequence2[position] = seqan3::assign_rank_to((seqan3::to_rank(sequence2[position]) + 1) % 4, seqan3::dna4{});
+    sequence2.erase(sequence2.begin() + 1000, sequence2.begin() + 1003);
+
+    auto const config = seqan3::align_cfg::method_global{} | dna4_scheme | affine_gap;
+    auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                          config | seqan3::align_cfg::wavefront{10, 50}).begin();
+
+    EXPECT_EQ(result.score(), expected.score());
+    EXPECT_EQ(seqan3::test::rescore_alignment(sequence1, sequence2, result, config), expected.score());
+
+    // A heavily pruned alignment is not optimal anymore, but still a valid alignment.
+    sequence2 = seqan3::test::generate_sequence<seqan3::dna4>(2000, 0, 1);
+    expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    result = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                     config | seqan3::align_cfg::wavefront{1, 0}).begin();
+
+    EXPECT_LE(result.score(), expected.score());
+    EXPECT_EQ(seqan3::test::rescore_alignment(sequence1, sequence2, result, config), result.score());
+}
+
+TEST(affine_unbanded_wavefront, unsupported_configuration)
+{
+    // Positive gap scores cannot be translated into penalties.
+    auto const config = seqan3::align_cfg::method_global{} | dna4_scheme |
+                        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                           seqan3::align_cfg::extension_score{3}};
+    compare_to_dynamic_programming<seqan3::dna4>(config, 20, 10, 5);
+}
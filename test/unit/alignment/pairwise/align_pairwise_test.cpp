@@ -7,12 +7,15 @@
 
 #include <gtest/gtest.h>
 
+#include <optional>
 #include <seqan3/std/ranges>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
+#include <seqan3/alignment/matrix/detail/matrix_memory.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
@@ -314,3 +317,92 @@ TEST(align_pairwise_test, parallel_without_parameter)
 
     EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), cfg), std::runtime_error);
 }
+
+TEST(align_pairwise_test, reuse_matrix_memory)
+{
+    auto seq1 = "TTACGTACGGACTAGCTACAACATTACGGACTAC"_dna4;
+    auto seq2 = "GGACGACATGACGTACGACTTTACGTACGACTAGC"_dna4;
+    auto short_seq1 = "ACGTGATG"_dna4;
+    auto short_seq2 = "AGTGATACT"_dna4;
+
+    seqan3::detail::matrix_memory_statistics & statistics = seqan3::detail::matrix_memory_statistics::local();
+
+    auto check = [&] (auto const & cfg, bool const compare_alignment)
+    {
+        using result_t = std::remove_cvref_t<decltype(*seqan3::align_pairwise(std::tie(short_seq1, short_seq2),
+                                                                                cfg).begin())>;
+
+        // The expected result is computed by a new thread, which does not have cached matrices yet.
+        std::optional<result_t> expected{};
+        std::thread{[&] ()
+        {
+            expected.emplace(*seqan3::align_pairwise(std::tie(short_seq1, short_seq2), cfg).begin());
+        }}.join();
+
+        // The first invocation allocates the matrices of this thread.
+        *seqan3::align_pairwise(std::tie(seq1, seq2), cfg).begin();
+
+        // The long pair leaves dirty matrices that are reused by the short pair.
+        statistics.reset();
+        *seqan3::align_pairwise(std::tie(seq1, seq2), cfg).begin();
+        auto result = *seqan3::align_pairwise(std::tie(short_seq1, short_seq2), cfg).begin();
+
+        EXPECT_EQ(statistics.allocations, 0u);
+        EXPECT_GT(statistics.allocations_avoided, 0u);
+        EXPECT_EQ(result.score(), expected->score());
+
+        if (compare_alignment)
+        {
+            EXPECT_EQ(result.sequence1_begin_position(), expected->sequence1_begin_position());
+            EXPECT_EQ(result.sequence2_begin_position(), expected->sequence2_begin_position());
+            EXPECT_EQ(result.sequence1_end_position(), expected->sequence1_end_position());
+            EXPECT_EQ(result.sequence2_end_position(), expected->sequence2_end_position());
+            EXPECT_RANGE_EQ(std::get<0>(result.alignment()) | seqan3::views::to_char,
+                            std::get<0>(expected->alignment()) | seqan3::views::to_char);
+            EXPECT_RANGE_EQ(std::get<1>(result.alignment()) | seqan3::views::to_char,
+                            std::get<1>(expected->alignment()) | seqan3::views::to_char);
+        }
+    };
+
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} |
+                                seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                                                                      seqan3::match_score{4},
+                                                                      seqan3::mismatch_score{-5}}} |
+                                seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                   seqan3::align_cfg::extension_score{-1}};
+    auto output_alignment = seqan3::align_cfg::output_score{} |
+                            seqan3::align_cfg::output_begin_position{} |
+                            seqan3::align_cfg::output_end_position{} |
+                            seqan3::align_cfg::output_alignment{};
+
+    check(cfg | seqan3::align_cfg::output_score{}, false);
+    check(cfg | output_alignment, true);
+    check(cfg | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-4},
+                                                   seqan3::align_cfg::upper_diagonal{4}} | output_alignment, true);
+}
+
+TEST(align_pairwise_test, release_matrix_memory)
+{
+    auto seq1 = "TTACGTACGGACTAGCTACAACATTACGGACTAC"_dna4;
+    auto seq2 = "GGACGACATGACGTACGACTTTACGTACGACTAGC"_dna4;
+
+    seqan3::detail::matrix_memory_statistics & statistics = seqan3::detail::matrix_memory_statistics::local();
+    auto const cfg = seqan3::align_cfg::method_global{} |
+                     seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+                     seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                        seqan3::align_cfg::extension_score{-1}} |
+                     seqan3::align_cfg::output_alignment{};
+
+    auto expected = *seqan3::align_pairwise(std::tie(seq1, seq2), cfg).begin();
+
+    statistics.reset();
+    *seqan3::align_pairwise(std::tie(seq1, seq2), cfg).begin();
+    EXPECT_EQ(statistics.allocations, 0u);
+
+    // After releasing the memory, the matrices are allocated again.
+    seqan3::release_alignment_matrix_memory();
+    statistics.reset();
+    auto result = *seqan3::align_pairwise(std::tie(seq1, seq2), cfg).begin();
+    EXPECT_GT(statistics.allocations, 0u);
+    EXPECT_EQ(result.score(), expected.score());
+}
@@ -89,10 +89,16 @@ TEST(alignment_configurator, configure_edit_semi)
 
 TEST(alignment_configurator, configure_edit_banded)
 {
+    EXPECT_EQ(run_test(seqan3::align_cfg::method_global{} |
+                       seqan3::align_cfg::edit_scheme |
+                       seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
+                                                          seqan3::align_cfg::upper_diagonal{1}}).score(), 0);
+
+    // invalid band
     EXPECT_THROW((run_test(seqan3::align_cfg::method_global{} |
                            seqan3::align_cfg::edit_scheme |
-                           seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
-                                                              seqan3::align_cfg::upper_diagonal{1}})),
+                           seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{1},
+                                                              seqan3::align_cfg::upper_diagonal{3}})),
                  seqan3::invalid_alignment_configuration);
 }
 
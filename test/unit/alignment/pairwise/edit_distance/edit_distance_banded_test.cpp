@@ -0,0 +1,305 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3::literals;
+
+using pairs_t = std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>>;
+
+pairs_t generate_pairs(size_t const count, size_t const max_size)
+{
+    std::mt19937_64 generator{count};
+    std::uniform_int_distribution<size_t> size{0, max_size};
+    std::uniform_int_distribution<size_t> rank{0, 3};
+    std::uniform_int_distribution<size_t> edit{0, 9};
+
+    pairs_t pairs(count);
+    for (auto & [first, second] : pairs)
+    {
+        first.resize(size(generator));
+        for (seqan3::dna4 & letter : first)
+            seqan3::assign_rank_to(rank(generator), letter);
+
+        // The second sequence is a copy of the first one with some substitutions, insertions and deletions.
+        for (seqan3::dna4 const letter : first)
+        {
+            switch (edit(generator))
+            {
+                case 0: second.push_back(seqan3::assign_rank_to(rank(generator), seqan3::dna4{})); break;
+                case 1: second.push_back(letter); second.push_back(letter); break;
+                case 2: break;
+                default: second.push_back(letter);
+            }
+        }
+    }
+
+    return pairs;
+}
+
+seqan3::align_cfg::method_global const semi_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+auto const global_config = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+auto const semi_global_config = semi_global | seqan3::align_cfg::edit_scheme;
+
+// The edit distance with twice the costs is computed by the banded dynamic programming algorithm.
+auto const doubled_costs =
+    seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{0},
+                                                                        seqan3::mismatch_score{-2}}} |
+    seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0}, seqan3::align_cfg::extension_score{-2}};
+
+auto band(int32_t const lower, int32_t const upper)
+{
+    return seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{lower},
+                                              seqan3::align_cfg::upper_diagonal{upper}};
+}
+
+// The banded edit distance computed cell by cell; cells outside of the band are unreachable.
+int64_t banded_edit_distance(seqan3::dna4_vector const & first, seqan3::dna4_vector const & second,
+                             int64_t const lower, int64_t const upper, bool const is_semi_global)
+{
+    int64_t const infinity = std::numeric_limits<int32_t>::max();
+    int64_t const columns = first.size();
+    int64_t const rows = second.size();
+
+    std::vector<std::vector<int64_t>> matrix(rows + 1, std::vector<int64_t>(columns + 1, infinity));
+    for (int64_t row = 0; row <= rows; ++row)
+    {
+        for (int64_t column = std::max(row + lower, int64_t{0}); column <= std::min(row + upper, columns); ++column)
+        {
+            if (row == 0)
+            {
+                matrix[row][column] = is_semi_global ? 0 : column;
+                continue;
+            }
+
+            int64_t & cell = matrix[row][column];
+            cell = matrix[row - 1][column] + 1;
+            if (column > 0)
+            {
+                cell = std::min(cell, matrix[row][column - 1] + 1);
+                cell = std::min(cell, matrix[row - 1][column - 1] + (first[column - 1] != second[row - 1]));
+            }
+        }
+    }
+
+    if (!is_semi_global)
+        return matrix[rows][columns];
+
+    return std::ranges::min(matrix[rows]);
+}
+
+template <typename sequences_t, typename config_t>
+auto first_result(sequences_t const & sequences, config_t const & config)
+{
+    auto results = seqan3::align_pairwise(sequences, config);
+    return *results.begin();
+}
+
+// Returns the number of edits of the alignment and checks that all of its cells are inside the band.
+template <typename alignment_t>
+int edits_in_band(alignment_t const & alignment, size_t column, size_t row, int32_t const lower, int32_t const upper)
+{
+    auto const & [first, second] = alignment;
+    EXPECT_EQ(first.size(), second.size());
+
+    int edits = 0;
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        bool const first_gap = first[i] == seqan3::gap{};
+        bool const second_gap = second[i] == seqan3::gap{};
+        edits += first_gap || second_gap || first[i] != second[i];
+        column += !first_gap;
+        row += !second_gap;
+
+        int64_t const diagonal = static_cast<int64_t>(column) - static_cast<int64_t>(row);
+        EXPECT_GE(diagonal, lower);
+        EXPECT_LE(diagonal, upper);
+    }
+
+    return edits;
+}
+
+TEST(edit_distance_banded, example)
+{
+    auto const config = global_config | band(-2, 2) | seqan3::align_cfg::output_score{}
+                                      | seqan3::align_cfg::output_alignment{};
+    auto const sequences = std::tuple{"AACCGGTTAACCGGTT"_dna4, "ACGTACGTAACCGGTTA"_dna4};
+    auto result = first_result(sequences, config);
+
+    EXPECT_EQ(result.score(), -7);
+    EXPECT_EQ(edits_in_band(result.alignment(), 0u, 0u, -2, 2), 7);
+
+    // A band that leaves out the optimal alignment.
+    EXPECT_EQ(first_result(std::tuple{"ACGTACGT"_dna4, "CGTACGTA"_dna4}, global_config | band(0, 0)).score(), -8);
+    EXPECT_EQ(first_result(std::tuple{"ACGTACGT"_dna4, "CGTACGTA"_dna4}, global_config | band(-1, 1)).score(), -2);
+}
+
+TEST(edit_distance_banded, wide_band_is_unbanded)
+{
+    auto pairs = generate_pairs(100, 200);
+    auto const output = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_begin_position{} |
+                        seqan3::align_cfg::output_end_position{} |
+                        seqan3::align_cfg::output_alignment{};
+
+    for (auto const & config : {global_config, semi_global_config})
+    {
+        auto unbanded = seqan3::align_pairwise(pairs, config | output);
+        auto banded = seqan3::align_pairwise(pairs, config | output | band(-1000, 1000));
+
+        auto it = banded.begin();
+        for (auto && expected : unbanded)
+        {
+            ASSERT_FALSE(it == banded.end());
+            auto && result = *it;
+            EXPECT_EQ(result.score(), expected.score());
+            EXPECT_EQ(result.sequence1_begin_position(), expected.sequence1_begin_position());
+            EXPECT_EQ(result.sequence2_begin_position(), expected.sequence2_begin_position());
+            EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position());
+            EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position());
+            EXPECT_EQ(result.alignment(), expected.alignment());
+            ++it;
+        }
+    }
+}
+
+TEST(edit_distance_banded, narrow_band)
+{
+    // Up to 150 letters, i.e. the band of some pairs spans more than two machine words.
+    auto pairs = generate_pairs(300, 150);
+    auto const output = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_begin_position{} |
+                        seqan3::align_cfg::output_alignment{};
+
+    for (auto [lower, upper] : {std::pair{-3, 3}, std::pair{-10, 1}, std::pair{0, 0}, std::pair{-70, 70},
+                                std::pair{-5, 90}})
+    {
+        SCOPED_TRACE(testing::Message() << "band [" << lower << ":" << upper << "]");
+
+        for (auto const & [first, second] : pairs)
+        {
+            int64_t const diagonal = static_cast<int64_t>(first.size()) - static_cast<int64_t>(second.size());
+            auto const sequences = std::tuple{first, second};
+
+            if (diagonal < lower || diagonal > upper)
+            {
+                EXPECT_THROW(seqan3::align_pairwise(sequences, global_config | band(lower, upper)).begin(),
+                             seqan3::invalid_alignment_configuration);
+                continue;
+            }
+
+            auto expected = first_result(sequences, seqan3::align_cfg::method_global{} | doubled_costs
+                                                    | band(lower, upper) | seqan3::align_cfg::output_score{});
+            auto result = first_result(sequences, global_config | band(lower, upper) | output);
+
+            EXPECT_EQ(2 * result.score(), expected.score());
+            EXPECT_EQ(-result.score(), banded_edit_distance(first, second, lower, upper, false));
+            EXPECT_EQ(result.sequence1_begin_position(), 0u);
+            EXPECT_EQ(result.sequence2_begin_position(), 0u);
+            EXPECT_EQ(edits_in_band(result.alignment(), 0u, 0u, lower, upper), -result.score());
+        }
+    }
+}
+
+TEST(edit_distance_banded, narrow_band_semi_global)
+{
+    auto pairs = generate_pairs(300, 150);
+    auto const output = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_begin_position{} |
+                        seqan3::align_cfg::output_end_position{} |
+                        seqan3::align_cfg::output_alignment{};
+
+    // The band may start and end in the first and the last row.
+    for (auto [lower, upper] : {std::pair{-3, 3}, std::pair{-10, 1}, std::pair{0, 0}, std::pair{2, 20},
+                                std::pair{-70, 70}})
+    {
+        SCOPED_TRACE(testing::Message() << "band [" << lower << ":" << upper << "]");
+
+        for (auto const & [first, second] : pairs)
+        {
+            int64_t const diagonal = static_cast<int64_t>(first.size()) - static_cast<int64_t>(second.size());
+            auto const sequences = std::tuple{first, second};
+
+            if (diagonal < lower)
+            {
+                EXPECT_THROW(seqan3::align_pairwise(sequences, semi_global_config | band(lower, upper)).begin(),
+                             seqan3::invalid_alignment_configuration);
+                continue;
+            }
+
+            auto result = first_result(sequences, semi_global_config | band(lower, upper) | output);
+
+            EXPECT_EQ(-result.score(), banded_edit_distance(first, second, lower, upper, true));
+            EXPECT_EQ(result.sequence2_begin_position(), 0u);
+            EXPECT_EQ(result.sequence2_end_position(), second.size());
+            EXPECT_EQ(edits_in_band(result.alignment(), result.sequence1_begin_position(), 0u, lower, upper),
+                      -result.score());
+        }
+    }
+}
+
+TEST(edit_distance_banded, invalid_band)
+{
+    auto const sequences = std::tuple{"ACGT"_dna4, "ACGT"_dna4};
+
+    // The band does not start in the first cell.
+    EXPECT_THROW(seqan3::align_pairwise(sequences, global_config | band(1, 3)),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(sequences, semi_global_config | band(-3, -1)),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(sequences, global_config | band(3, 1)),
+                 seqan3::invalid_alignment_configuration);
+
+    // The band does not reach the last cell.
+    EXPECT_THROW(seqan3::align_pairwise(std::tuple{"ACGTACGT"_dna4, "ACGT"_dna4}, global_config | band(-2, 2)).begin(),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(std::tuple{"ACGT"_dna4, "ACGTACGT"_dna4},
+                                        semi_global_config | band(-2, 2)).begin(),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST(edit_distance_banded, empty_sequences)
+{
+    auto score = [] (auto const & sequences, auto const & config)
+    {
+        return first_result(sequences, config).score();
+    };
+
+    EXPECT_EQ(score(std::tuple{""_dna4, ""_dna4}, global_config | band(0, 0)), 0);
+    EXPECT_EQ(score(std::tuple{"ACG"_dna4, ""_dna4}, global_config | band(0, 3)), -3);
+    EXPECT_EQ(score(std::tuple{""_dna4, "ACG"_dna4}, global_config | band(-3, 0)), -3);
+    EXPECT_EQ(score(std::tuple{"ACG"_dna4, ""_dna4}, semi_global_config | band(1, 2)), 0);
+    EXPECT_EQ(score(std::tuple{""_dna4, "ACG"_dna4}, semi_global_config | band(-5, 0)), -3);
+}
+
+TEST(edit_distance_banded, min_score)
+{
+    auto const sequences = std::tuple{"AACCGGTTAACCGGTT"_dna4, "ACGTACGTAACCGGTTA"_dna4};
+    auto const output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    auto result = first_result(sequences, global_config | band(-2, 2) | output | seqan3::align_cfg::min_score{-7});
+    EXPECT_EQ(result.score(), -7);
+    EXPECT_EQ(result.sequence1_end_position(), 16u);
+
+    result = first_result(sequences, global_config | band(-2, 2) | output | seqan3::align_cfg::min_score{-6});
+    EXPECT_EQ(result.score(), std::numeric_limits<int>::max());
+}
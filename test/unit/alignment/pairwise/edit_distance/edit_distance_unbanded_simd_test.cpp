@@ -0,0 +1,184 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3::literals;
+
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> generate_pairs(size_t const count,
+                                                                                       size_t const max_size)
+{
+    std::mt19937_64 generator{count};
+    std::uniform_int_distribution<size_t> size{0, max_size};
+    std::uniform_int_distribution<size_t> rank{0, seqan3::alphabet_size<alphabet_t> - 1};
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> pairs(count);
+    for (auto & [first, second] : pairs)
+    {
+        first.resize(size(generator));
+        for (alphabet_t & letter : first)
+            seqan3::assign_rank_to(rank(generator), letter);
+
+        // The second sequence is a mutated copy of a part of the first one.
+        second.resize(size(generator));
+        for (size_t i = 0; i < second.size(); ++i)
+        {
+            if (i < first.size() && rank(generator) != 0u)
+                second[i] = first[i];
+            else
+                seqan3::assign_rank_to(rank(generator), second[i]);
+        }
+    }
+
+    return pairs;
+}
+
+// Compares the vectorised results to the ones of the scalar algorithm.
+template <typename pairs_t, typename config_t>
+void compare_to_scalar(pairs_t & pairs, config_t const & config)
+{
+    auto const output = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_end_position{} |
+                        seqan3::align_cfg::output_sequence1_id{} |
+                        seqan3::align_cfg::output_sequence2_id{};
+
+    std::vector<std::tuple<int, size_t, size_t, size_t, size_t>> expected{};
+    for (auto && result : seqan3::align_pairwise(pairs, config | output))
+        expected.emplace_back(result.score(), result.sequence1_end_position(), result.sequence2_end_position(),
+                              result.sequence1_id(), result.sequence2_id());
+
+    size_t i = 0;
+    for (auto && result : seqan3::align_pairwise(pairs, config | output | seqan3::align_cfg::vectorised{}))
+    {
+        ASSERT_LT(i, expected.size());
+        EXPECT_EQ(std::tuple(result.score(), result.sequence1_end_position(), result.sequence2_end_position(),
+                             result.sequence1_id(), result.sequence2_id()),
+                  expected[i]) << "pair " << i;
+        ++i;
+    }
+    EXPECT_EQ(i, expected.size());
+
+    std::vector<std::tuple<int, size_t, size_t, size_t, size_t>> parallel{};
+    for (auto && result : seqan3::align_pairwise(pairs, config | output | seqan3::align_cfg::vectorised{}
+                                                                       | seqan3::align_cfg::parallel{4}))
+        parallel.emplace_back(result.score(), result.sequence1_end_position(), result.sequence2_end_position(),
+                              result.sequence1_id(), result.sequence2_id());
+
+    EXPECT_EQ(parallel, expected);
+}
+
+auto const global_config = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+auto const semi_global_config =
+    seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                     seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+    seqan3::align_cfg::edit_scheme;
+
+TEST(edit_distance_unbanded_simd, lanes)
+{
+    seqan3::detail::edit_distance_unbanded_simd<seqan3::dna4, false> global{};
+    seqan3::detail::edit_distance_unbanded_simd<seqan3::dna4, true> semi_global{};
+
+    EXPECT_EQ(global.set_lane("AACCGGTTAACCGGTT"_dna4, "ACGTACGTA"_dna4), 0u);
+    EXPECT_EQ(semi_global.set_lane("AACCGGTTAACCGGTT"_dna4, "ACGTACGTA"_dna4), 0u);
+    global.compute();
+    semi_global.compute();
+
+    EXPECT_EQ(global.score(0), -8);
+    EXPECT_EQ(global.end_position_first(0), 16u);
+    EXPECT_EQ(semi_global.score(0), -5);
+    EXPECT_EQ(semi_global.end_position_first(0), 16u);
+
+    EXPECT_FALSE(decltype(global)::fits(0u));
+    EXPECT_TRUE(decltype(global)::fits(1u));
+    EXPECT_TRUE(decltype(global)::fits(64u));
+    EXPECT_FALSE(decltype(global)::fits(65u));
+}
+
+TEST(edit_distance_unbanded_simd, reuse)
+{
+    seqan3::detail::edit_distance_unbanded_simd<seqan3::dna4, false> algorithm{};
+    size_t const lanes = decltype(algorithm)::lanes;
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+        EXPECT_EQ(algorithm.set_lane(seqan3::dna4_vector(lane + 10, 'A'_dna4), "AAAAAAAAAA"_dna4), lane);
+    algorithm.compute();
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+        EXPECT_EQ(algorithm.score(lane), -static_cast<int64_t>(lane));
+
+    algorithm.clear();
+    algorithm.set_lane(""_dna4, "ACGT"_dna4);
+    algorithm.compute();
+    EXPECT_EQ(algorithm.score(0), -4);
+    EXPECT_EQ(algorithm.end_position_first(0), 0u);
+}
+
+TEST(edit_distance_unbanded_simd, aa27)
+{
+    seqan3::detail::edit_distance_unbanded_simd<seqan3::aa27, true> algorithm{};
+
+    algorithm.set_lane("MANATEEMANATEE"_aa27, "NATE"_aa27);
+    algorithm.compute();
+    EXPECT_EQ(algorithm.score(0), 0);
+    EXPECT_EQ(algorithm.end_position_first(0), 13u);
+
+    algorithm.clear();
+    algorithm.set_lane("MANATEEMANATEE"_aa27, "NAYTE"_aa27);
+    algorithm.compute();
+    EXPECT_EQ(algorithm.score(0), -1);
+    EXPECT_EQ(algorithm.end_position_first(0), 13u);
+}
+
+TEST(edit_distance_unbanded_simd, global)
+{
+    // Up to 70 letters, i.e. some of the second sequences are computed by the scalar algorithm.
+    auto pairs = generate_pairs<seqan3::dna4>(300, 70);
+    compare_to_scalar(pairs, global_config);
+}
+
+TEST(edit_distance_unbanded_simd, semi_global)
+{
+    auto pairs = generate_pairs<seqan3::dna4>(300, 70);
+    compare_to_scalar(pairs, semi_global_config);
+}
+
+TEST(edit_distance_unbanded_simd, long_sequences)
+{
+    auto pairs = generate_pairs<seqan3::dna4>(50, 300);
+    compare_to_scalar(pairs, global_config);
+    compare_to_scalar(pairs, semi_global_config);
+}
+
+TEST(edit_distance_unbanded_simd, with_alignment)
+{
+    // Alignments are computed by the scalar algorithm.
+    auto pairs = generate_pairs<seqan3::dna4>(20, 40);
+    auto const config = global_config | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{};
+
+    auto vectorised_results = seqan3::align_pairwise(pairs, config | seqan3::align_cfg::vectorised{});
+    auto it = vectorised_results.begin();
+    for (auto && result : seqan3::align_pairwise(pairs, config))
+    {
+        ASSERT_FALSE(it == vectorised_results.end());
+        EXPECT_EQ(result.score(), (*it).score());
+        EXPECT_EQ(result.alignment(), (*it).alignment());
+        ++it;
+    }
+}
@@ -204,4 +204,25 @@ alignment_fixture_collection(
 )
 -> alignment_fixture_collection<config_t, fixture_t>;
 
+// Returns a copy of the fixture whose configuration is combined with the given configuration elements.
+template <typename sequence1_t, typename sequence2_t, typename config_t, typename score_t,
+          typename score_vector_or_matrix_t, typename trace_vector_or_matrix_t, typename extension_config_t>
+auto with_config(alignment_fixture<sequence1_t, sequence2_t, config_t, score_t,
+                                   score_vector_or_matrix_t, trace_vector_or_matrix_t> const & fixture,
+                 extension_config_t const & extension_config)
+{
+    return alignment_fixture{fixture.sequence1,
+                             fixture.sequence2,
+                             fixture.config | extension_config,
+                             fixture.score,
+                             fixture.aligned_sequence1,
+                             fixture.aligned_sequence2,
+                             fixture.sequence1_begin_position,
+                             fixture.sequence2_begin_position,
+                             fixture.sequence1_end_position,
+                             fixture.sequence2_end_position,
+                             fixture.score_vector,
+                             fixture.trace_vector};
+}
+
 } // namespace seqan3::test::alignment::fixture
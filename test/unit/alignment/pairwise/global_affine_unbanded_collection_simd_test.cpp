@@ -5,11 +5,13 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 
 #include "fixture/global_affine_unbanded.hpp"
 #include "pairwise_alignment_collection_test_template.hpp"
@@ -86,3 +88,84 @@ using pairwise_collection_simd_global_affine_unbanded_testing_types = ::testing:
 INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_collection_simd_global_affine_unbanded,
                                pairwise_alignment_collection_test,
                                pairwise_collection_simd_global_affine_unbanded_testing_types, );
+
+// Compares the vectorised alignments of randomly generated pairs of different lengths with the scalar ones.
+template <typename simd_config_t>
+void compare_alignments_to_scalar(simd_config_t const & simd_config,
+                                  size_t const size = 60,
+                                  size_t const size_variance = 50)
+{
+    auto const config = seqan3::align_cfg::method_global{} |
+                        seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                            seqan3::mismatch_score{-5}}} |
+                        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                           seqan3::align_cfg::extension_score{-1}} |
+                        seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_begin_position{} |
+                        seqan3::align_cfg::output_end_position{} |
+                        seqan3::align_cfg::output_alignment{};
+
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> pairs{};
+    for (size_t seed = 0; seed < 100; ++seed)
+        pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(size, size_variance, seed),
+                           seqan3::test::generate_sequence<seqan3::dna4>(size, size_variance, seed + 100));
+
+    // Pairs of identical sequences whose scores exceed the range of small score types.
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        seqan3::dna4_vector sequence = seqan3::test::generate_sequence<seqan3::dna4>(size, size_variance, seed);
+        pairs.emplace(pairs.begin() + seed * 7, sequence, sequence);
+    }
+
+    auto scalar_results = seqan3::align_pairwise(pairs, config);
+    auto simd_results = seqan3::align_pairwise(pairs, config | seqan3::align_cfg::vectorised{} | simd_config);
+    auto parallel_results = seqan3::align_pairwise(pairs, config | seqan3::align_cfg::vectorised{}
+                                                                 | simd_config
+                                                                 | seqan3::align_cfg::parallel{4});
+
+    auto simd_it = simd_results.begin();
+    auto parallel_it = parallel_results.begin();
+    for (auto && expected : scalar_results)
+    {
+        for (auto && actual : {*simd_it, *parallel_it})
+        {
+            EXPECT_EQ(actual.score(), expected.score());
+            EXPECT_EQ(actual.sequence1_begin_position(), expected.sequence1_begin_position());
+            EXPECT_EQ(actual.sequence2_begin_position(), expected.sequence2_begin_position());
+            EXPECT_EQ(actual.sequence1_end_position(), expected.sequence1_end_position());
+            EXPECT_EQ(actual.sequence2_end_position(), expected.sequence2_end_position());
+            EXPECT_EQ(actual.alignment(), expected.alignment());
+        }
+        ++simd_it;
+        ++parallel_it;
+    }
+    EXPECT_TRUE(simd_it == simd_results.end());
+    EXPECT_TRUE(parallel_it == parallel_results.end());
+}
+
+TEST(global_affine_unbanded_collection_simd, alignment_of_random_pairs)
+{
+    compare_alignments_to_scalar(seqan3::align_cfg::score_type<int16_t>{});
+    compare_alignments_to_scalar(seqan3::align_cfg::score_type<int32_t>{});
+}
+
+TEST(global_affine_unbanded_collection_simd, adaptive_score_type)
+{
+    // Short pairs are computed with 8 bit lanes, except for the ones exceeding the score range.
+    compare_alignments_to_scalar(seqan3::align_cfg::adaptive_score_type{}, 30, 20);
+    // Long pairs skip the 8 bit lanes.
+    compare_alignments_to_scalar(seqan3::align_cfg::adaptive_score_type{}, 120, 100);
+}
+
+TEST(global_affine_unbanded_collection_simd, length_aware_batching)
+{
+    // The results are returned in the input order, within one window and across several windows.
+    compare_alignments_to_scalar(seqan3::align_cfg::length_aware_batching{}, 60, 55);
+    compare_alignments_to_scalar(seqan3::align_cfg::length_aware_batching{20}, 60, 55);
+    compare_alignments_to_scalar(seqan3::align_cfg::length_aware_batching{} | seqan3::align_cfg::score_type<int16_t>{},
+                                 60,
+                                 55);
+    compare_alignments_to_scalar(seqan3::align_cfg::length_aware_batching{} | seqan3::align_cfg::adaptive_score_type{},
+                                 60,
+                                 55);
+}
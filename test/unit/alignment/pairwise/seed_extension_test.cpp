@@ -0,0 +1,369 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/alignment_seed.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment/rescore_alignment.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using seqan3::operator""_dna4;
+
+// The best cell of an extension computed with the full alignment matrix.
+struct reference_optimum
+{
+    int64_t score{};
+    size_t column{};
+    size_t row{};
+};
+
+// Computes every cell of the alignment matrix and drops the cells like the extension does.
+template <typename sequence_t, typename scheme_t>
+reference_optimum reference_extension(sequence_t const & sequence1,
+                                      sequence_t const & sequence2,
+                                      scheme_t const & scheme,
+                                      seqan3::align_cfg::gap_cost_affine const & gap_cost,
+                                      int64_t const x_drop,
+                                      std::optional<int64_t> const z_drop)
+{
+    int64_t const dropped = -(int64_t{1} << 40);
+    int64_t const gap_open = gap_cost.open_score + gap_cost.extension_score;
+    int64_t const gap_extension = gap_cost.extension_score;
+
+    size_t const columns = sequence1.size();
+    size_t const rows = sequence2.size();
+    std::vector<std::vector<int64_t>> best(columns + 1, std::vector<int64_t>(rows + 1, dropped));
+    std::vector<std::vector<int64_t>> horizontal = best;
+    std::vector<std::vector<int64_t>> vertical = best;
+
+    reference_optimum optimum{};
+    for (size_t column = 0; column <= columns; ++column)
+    {
+        int64_t const threshold = optimum.score - x_drop;
+        bool any_alive = false;
+        int64_t column_max = dropped;
+        size_t column_max_row = 0;
+
+        for (size_t row = 0; row <= rows; ++row)
+        {
+            int64_t score = 0;
+            if (column > 0 || row > 0)
+            {
+                int64_t const diagonal = (column > 0 && row > 0)
+                                       ? best[column - 1][row - 1] + scheme.score(sequence1[column - 1],
+                                                                                  sequence2[row - 1])
+                                       : dropped;
+                if (column > 0)
+                    horizontal[column][row] = std::max(best[column - 1][row] + gap_open,
+                                                       horizontal[column - 1][row] + gap_extension);
+                if (row > 0)
+                    vertical[column][row] = std::max(best[column][row - 1] + gap_open,
+                                                     vertical[column][row - 1] + gap_extension);
+
+                score = std::max({diagonal, horizontal[column][row], vertical[column][row]});
+            }
+
+            if (score < threshold)
+            {
+                score = horizontal[column][row] = vertical[column][row] = dropped;
+                continue;
+            }
+
+            best[column][row] = score;
+            any_alive = true;
+            if (score > optimum.score)
+                optimum = {score, column, row};
+            if (score > column_max)
+            {
+                column_max = score;
+                column_max_row = row;
+            }
+        }
+
+        if (!any_alive)
+            break;
+
+        int64_t const diagonal_distance = std::abs((static_cast<int64_t>(column) - static_cast<int64_t>(optimum.column)) -
+                                                   (static_cast<int64_t>(column_max_row) -
+                                                    static_cast<int64_t>(optimum.row)));
+        if (z_drop.has_value() &&
+            optimum.score - column_max > *z_drop + std::max(0, -gap_cost.extension_score) * diagonal_distance)
+            break;
+    }
+
+    return optimum;
+}
+
+// The expected score, begin and end positions of the extended seed.
+struct expected_extension
+{
+    int64_t score{};
+    size_t sequence1_begin_position{};
+    size_t sequence2_begin_position{};
+    size_t sequence1_end_position{};
+    size_t sequence2_end_position{};
+};
+
+template <typename sequence_t, typename config_t>
+expected_extension expected_result(sequence_t const & sequence1,
+                                   sequence_t const & sequence2,
+                                   seqan3::alignment_seed const & seed,
+                                   config_t const & config)
+{
+    using std::get;
+
+    auto const & scheme = get<seqan3::align_cfg::scoring_scheme>(config).scheme;
+    auto const & gap_cost = get<seqan3::align_cfg::gap_cost_affine>(config);
+    auto const & method = get<seqan3::align_cfg::method_extension>(config);
+    std::optional<int64_t> const z_drop = method.z_drop;
+
+    sequence_t left1(sequence1.rend() - seed.sequence1_position, sequence1.rend());
+    sequence_t left2(sequence2.rend() - seed.sequence2_position, sequence2.rend());
+    sequence_t right1(sequence1.begin() + seed.sequence1_position + seed.length, sequence1.end());
+    sequence_t right2(sequence2.begin() + seed.sequence2_position + seed.length, sequence2.end());
+
+    reference_optimum const left = reference_extension(left1, left2, scheme, gap_cost, method.x_drop, z_drop);
+    reference_optimum const right = reference_extension(right1, right2, scheme, gap_cost, method.x_drop, z_drop);
+
+    int64_t seed_score = 0;
+    for (size_t position = 0; position < seed.length; ++position)
+        seed_score += scheme.score(sequence1[seed.sequence1_position + position],
+                                   sequence2[seed.sequence2_position + position]);
+
+    return {left.score + seed_score + right.score,
+            seed.sequence1_position - left.column,
+            seed.sequence2_position - left.row,
+            seed.sequence1_position + seed.length + right.column,
+            seed.sequence2_position + seed.length + right.row};
+}
+
+// Generates similar sequence pairs with seeds of matching symbols and compares the extensions to the reference.
+template <typename alphabet_t, typename config_t>
+void compare_to_reference(config_t const & config, size_t const size, size_t const count = 30)
+{
+    using sequence_t = std::vector<alphabet_t>;
+
+    std::vector<std::tuple<sequence_t, sequence_t, seqan3::alignment_seed>> inputs{};
+    for (size_t seed = 0; seed < count; ++seed)
+    {
+        sequence_t sequence1 = seqan3::test::generate_sequence<alphabet_t>(size, size / 2, seed);
+        sequence_t sequence2 = sequence1;
+
+        // Mutations, an insertion and a deletion; every third pair is unrelated around the seed.
+        for (size_t position = seed % 7; position < sequence2.size(); position += 5 + seed % 11)
+            sequence2[position] = seqan3::assign_rank_to((seqan3::to_rank(sequence2[position]) + 1) %
+                                                         seqan3::alphabet_size<alphabet_t>, alphabet_t{});
+        if (sequence2.size() > 40)
+        {
+            sequence2.erase(sequence2.begin() + 30, sequence2.begin() + 32 + seed % 5);
+            sequence2.insert(sequence2.begin() + 10, sequence1.begin(), sequence1.begin() + seed % 9);
+        }
+        if (seed % 3 == 2)
+            sequence2 = seqan3::test::generate_sequence<alphabet_t>(size, size / 2, seed + count);
+
+        size_t const length = std::min({seed % 12, sequence1.size(), sequence2.size()});
+        size_t const position1 = (sequence1.size() - length) * (seed % 5) / 4;
+        size_t const position2 = std::min(position1, sequence2.size() - length);
+        inputs.emplace_back(sequence1, sequence2, seqan3::alignment_seed{position1, position2, length});
+    }
+
+    // Seeds at the borders of the sequences.
+    sequence_t const sequence = seqan3::test::generate_sequence<alphabet_t>(size, 0, 1);
+    inputs.emplace_back(sequence, sequence, seqan3::alignment_seed{0, 0, 5});
+    inputs.emplace_back(sequence, sequence, seqan3::alignment_seed{size - 5, size - 5, 5});
+    inputs.emplace_back(sequence, sequence, seqan3::alignment_seed{0, 0, size});
+    inputs.emplace_back(sequence, sequence_t{}, seqan3::alignment_seed{3, 0, 0});
+
+    auto results = seqan3::align_pairwise(inputs, config);
+
+    size_t input_index = 0;
+    for (auto && result : results)
+    {
+        auto const & [sequence1, sequence2, seed] = inputs[input_index++];
+        expected_extension const expected = expected_result(sequence1, sequence2, seed, config);
+
+        EXPECT_EQ(result.score(), expected.score);
+        EXPECT_EQ(result.sequence1_begin_position(), expected.sequence1_begin_position);
+        EXPECT_EQ(result.sequence2_begin_position(), expected.sequence2_begin_position);
+        EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position);
+        EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position);
+
+        // A gap that crosses an empty seed is opened on both sides of the seed.
+        if (seed.length > 0)
+        {
+            EXPECT_EQ(seqan3::test::rescore_alignment(sequence1, sequence2, result, config), expected.score);
+        }
+    }
+    EXPECT_EQ(input_index, inputs.size());
+}
+
+// Compares the vectorised extension to the scalar extension.
+template <typename alphabet_t, typename config_t>
+void compare_to_scalar(config_t const & config, size_t const size, size_t const count = 37)
+{
+    using sequence_t = std::vector<alphabet_t>;
+
+    std::vector<std::tuple<sequence_t, sequence_t, seqan3::alignment_seed>> inputs{};
+    for (size_t seed = 0; seed < count; ++seed)
+    {
+        sequence_t sequence1 = seqan3::test::generate_sequence<alphabet_t>(size, size / 2, seed);
+        sequence_t sequence2 = sequence1;
+        for (size_t position = seed % 3; position < sequence2.size(); position += 4 + seed % 7)
+            sequence2[position] = seqan3::assign_rank_to((seqan3::to_rank(sequence2[position]) + 1) %
+                                                         seqan3::alphabet_size<alphabet_t>, alphabet_t{});
+        if (sequence2.size() > 20)
+            sequence2.erase(sequence2.begin() + 15, sequence2.begin() + 16 + seed % 4);
+
+        size_t const length = std::min<size_t>({4, sequence1.size(), sequence2.size()});
+        size_t const position = (std::min(sequence1.size(), sequence2.size()) - length) * (seed % 4) / 3;
+        inputs.emplace_back(sequence1, sequence2, seqan3::alignment_seed{position, position, length});
+    }
+
+    auto const output = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_begin_position{} |
+                        seqan3::align_cfg::output_end_position{};
+    auto scalar_results = seqan3::align_pairwise(inputs, config | output);
+    auto vectorised_results = seqan3::align_pairwise(inputs, config | output | seqan3::align_cfg::vectorised{});
+
+    auto vectorised_it = vectorised_results.begin();
+    for (auto && expected : scalar_results)
+    {
+        auto const & result = *vectorised_it;
+        EXPECT_EQ(result.score(), expected.score());
+        EXPECT_EQ(result.sequence1_begin_position(), expected.sequence1_begin_position());
+        EXPECT_EQ(result.sequence2_begin_position(), expected.sequence2_begin_position());
+        EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position());
+        ++vectorised_it;
+    }
+    EXPECT_TRUE(vectorised_it == vectorised_results.end());
+}
+
+inline constexpr auto dna4_scheme = seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                          seqan3::mismatch_score{-3}}};
+inline constexpr auto affine_gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                                      seqan3::align_cfg::extension_score{-2}};
+inline constexpr auto linear_gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                                      seqan3::align_cfg::extension_score{-2}};
+
+TEST(seed_extension, single_seed)
+{
+    std::vector sequence1 = "TTTTTTACGTACGTACGTGGGGGGGG"_dna4;
+    std::vector sequence2 = "CCCCCACGTACGTACGTAAAAA"_dna4;
+    auto const config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{5}} | dna4_scheme | affine_gap;
+
+    // The seed covers TACG in the middle of the common part ACGTACGTACGT.
+    seqan3::alignment_seed seed{9, 8, 4};
+    auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2, seed), config).begin();
+
+    EXPECT_EQ(result.score(), 24);
+    EXPECT_EQ(result.sequence1_begin_position(), 6u);
+    EXPECT_EQ(result.sequence2_begin_position(), 5u);
+    EXPECT_EQ(result.sequence1_end_position(), 18u);
+    EXPECT_EQ(result.sequence2_end_position(), 17u);
+    EXPECT_EQ(seqan3::test::rescore_alignment(sequence1, sequence2, result, config), 24);
+}
+
+TEST(seed_extension, random_seeds)
+{
+    for (int32_t const x_drop : {0, 3, 10, 1000})
+    {
+        auto const config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{x_drop}} | dna4_scheme;
+
+        compare_to_reference<seqan3::dna4>(config | affine_gap, 100);
+        compare_to_reference<seqan3::dna4>(config | linear_gap, 100);
+    }
+
+    auto const blosum62 = seqan3::align_cfg::scoring_scheme{
+                              seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+    compare_to_reference<seqan3::aa27>(seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{15}} |
+                                       blosum62 | affine_gap, 80);
+}
+
+TEST(seed_extension, z_drop)
+{
+    for (int32_t const z_drop : {0, 5, 20})
+    {
+        auto const config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{50},
+                                                                seqan3::align_cfg::z_drop{z_drop}} | dna4_scheme;
+
+        compare_to_reference<seqan3::dna4>(config | affine_gap, 100);
+        compare_to_reference<seqan3::dna4>(config | linear_gap, 100);
+    }
+
+    // With the X-drop, a long deletion ends the extension, but the Z-drop lets it continue behind the deletion.
+    std::vector sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(200, 0, 3);
+    std::vector sequence2 = sequence1;
+    sequence2.erase(sequence2.begin() + 100, sequence2.begin() + 110);
+    seqan3::alignment_seed const seed{0, 0, 10};
+
+    auto const gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                        seqan3::align_cfg::extension_score{-1}};
+    auto x_drop_result = *seqan3::align_pairwise(std::tie(sequence1, sequence2, seed),
+                                                 seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{15}} |
+                                                 dna4_scheme | gap).begin();
+    auto z_drop_result = *seqan3::align_pairwise(std::tie(sequence1, sequence2, seed),
+                                                 seqan3::align_cfg::method_extension{
+                                                     seqan3::align_cfg::x_drop{1000},
+                                                     seqan3::align_cfg::z_drop{25}} |
+                                                 dna4_scheme | gap).begin();
+
+    EXPECT_EQ(x_drop_result.sequence1_end_position(), 100u);
+    EXPECT_EQ(x_drop_result.score(), 200);
+    EXPECT_EQ(z_drop_result.sequence1_end_position(), 200u);
+    EXPECT_EQ(z_drop_result.sequence2_end_position(), 190u);
+    EXPECT_EQ(z_drop_result.score(), 2 * 190 - 20);
+}
+
+TEST(seed_extension, vectorised)
+{
+    auto const config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{10}} | dna4_scheme;
+
+    compare_to_scalar<seqan3::dna4>(config | affine_gap, 100);
+    compare_to_scalar<seqan3::dna4>(config | linear_gap, 100);
+    compare_to_scalar<seqan3::dna4>(seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{10},
+                                                                        seqan3::align_cfg::z_drop{8}} |
+                                    dna4_scheme | affine_gap, 100);
+
+    auto const blosum62 = seqan3::align_cfg::scoring_scheme{
+                              seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+    compare_to_scalar<seqan3::aa27>(seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{20}} |
+                                    blosum62 | affine_gap, 80);
+
+    // The alignment is computed with the scalar extension.
+    compare_to_reference<seqan3::dna4>(config | affine_gap | seqan3::align_cfg::vectorised{}, 100);
+}
+
+TEST(seed_extension, invalid_input)
+{
+    std::vector sequence1 = "ACGTACGT"_dna4;
+    std::vector sequence2 = "ACGT"_dna4;
+    auto const config = seqan3::align_cfg::method_extension{} | dna4_scheme | affine_gap;
+
+    seqan3::alignment_seed seed{2, 2, 3};
+    auto seed_outside = seqan3::align_pairwise(std::tie(sequence1, sequence2, seed), config);
+    EXPECT_THROW(seed_outside.begin(), std::invalid_argument);
+
+    seed = seqan3::alignment_seed{0, 0, 1};
+    auto negative_x_drop = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{-1}} | dna4_scheme;
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2, seed), negative_x_drop),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -7,15 +7,21 @@
 
 #include <gtest/gtest.h>
 
+#include <seqan3/std/ranges>
+#include <vector>
+
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
 #include <seqan3/alphabet/composite/alphabet_variant.hpp>
 #include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/alphabet/views/complement.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_same_type.hpp>
 #include <seqan3/test/range/container_test_template.hpp>
+#include <seqan3/utility/views/single_pass_input.hpp>
 
 INSTANTIATE_TYPED_TEST_SUITE_P(bitpacked_sequence, container_over_dna4_test, seqan3::bitpacked_sequence<seqan3::dna4>, );
 
@@ -52,3 +58,76 @@ TEST(bitpacked_sequence_test, issue371)
     auto end = source.end();
     it != end; // This line causes error.
 }
+
+template <typename t>
+struct bitpacked_sequence_bulk_test : public ::testing::Test
+{
+    // A sequence that covers all letters and does not fill the last word.
+    static std::vector<t> letters(size_t const size)
+    {
+        std::vector<t> sequence(size);
+        for (size_t i = 0; i < size; ++i)
+            sequence[i] = seqan3::assign_rank_to((i * 7 + i / 3) % seqan3::alphabet_size<t>, t{});
+        return sequence;
+    }
+};
+
+using bulk_alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna15, seqan3::aa27, seqan3::phred42,
+                                             seqan3::alphabet_variant<seqan3::dna4, seqan3::dna15>, char>;
+
+TYPED_TEST_SUITE(bitpacked_sequence_bulk_test, bulk_alphabet_types, );
+
+TYPED_TEST(bitpacked_sequence_bulk_test, construct_and_extract)
+{
+    std::vector<TypeParam> const expected = TestFixture::letters(10'001);
+    seqan3::bitpacked_sequence<TypeParam> sequence{expected};
+
+    ASSERT_EQ(sequence.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(sequence[i], expected[i]) << "at position " << i;
+
+    for (size_t pos : {0u, 1u, 31u, 100u})
+    {
+        std::vector<TypeParam> extracted(expected.size() - pos - 5);
+        sequence.extract(pos, extracted);
+        EXPECT_TRUE(std::ranges::equal(extracted, expected | std::views::drop(pos)
+                                                           | std::views::take(extracted.size())));
+    }
+
+    std::vector<TypeParam> too_many(expected.size());
+    EXPECT_THROW(sequence.extract(1, too_many), std::out_of_range);
+    EXPECT_NO_THROW(sequence.extract(expected.size(), std::span<TypeParam>{}));
+}
+
+TYPED_TEST(bitpacked_sequence_bulk_test, append)
+{
+    std::vector<TypeParam> const expected = TestFixture::letters(5'000);
+
+    seqan3::bitpacked_sequence<TypeParam> sequence{};
+    sequence.append(expected | std::views::take(3));
+    sequence.append(expected | std::views::drop(3) | std::views::take(1'000));
+    sequence.push_back(expected[1'003]);
+    sequence.insert(sequence.cend(), expected.begin() + 1'004, expected.begin() + 2'000);
+
+    // single pass input range
+    std::vector<TypeParam> rest(expected.begin() + 2'000, expected.end());
+    sequence.append(rest | seqan3::views::single_pass_input);
+
+    EXPECT_TRUE(std::ranges::equal(sequence, expected));
+}
+
+TEST(bitpacked_sequence_test, words)
+{
+    seqan3::bitpacked_sequence<seqan3::dna4> sequence{};
+    EXPECT_TRUE(sequence.words().empty());
+
+    sequence.assign(seqan3::dna4_vector(33, 'A'_dna4));
+    sequence[0] = 'C'_dna4;
+    sequence[1] = 'T'_dna4;
+    sequence[32] = 'G'_dna4;
+
+    EXPECT_EQ(seqan3::bitpacked_sequence<seqan3::dna4>::bits_per_letter, 2u);
+    ASSERT_EQ(sequence.words().size(), 2u);
+    EXPECT_EQ(sequence.words()[0], 0b11'01u);
+    EXPECT_EQ(sequence.words()[1] & 0b11u, 0b10u);
+}
@@ -0,0 +1,250 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/packed_concatenated_sequences.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+template <typename alphabet_t>
+std::vector<std::vector<alphabet_t>> random_sequences(size_t const count, size_t const max_length, size_t const seed)
+{
+    std::mt19937_64 engine{seed};
+    std::uniform_int_distribution<size_t> length{0, max_length};
+    std::uniform_int_distribution<size_t> rank{0, seqan3::alphabet_size<alphabet_t> - 1};
+
+    std::vector<std::vector<alphabet_t>> sequences(count);
+    for (std::vector<alphabet_t> & sequence : sequences)
+    {
+        sequence.resize(length(engine));
+        for (alphabet_t & letter : sequence)
+            seqan3::assign_rank_to(rank(engine), letter);
+    }
+    return sequences;
+}
+
+template <typename sequences_t, typename alphabet_t>
+void expect_same_sequences(sequences_t const & sequences, std::vector<std::vector<alphabet_t>> const & expected)
+{
+    ASSERT_EQ(sequences.size(), expected.size());
+
+    size_t concat_size = 0;
+    std::vector<alphabet_t> buffer{};
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_RANGE_EQ(sequences[i], expected[i]);
+        sequences.extract(i, buffer);
+        EXPECT_EQ(buffer, expected[i]);
+        concat_size += expected[i].size();
+    }
+
+    EXPECT_EQ(sequences.concat_size(), concat_size);
+}
+
+template <typename t>
+class packed_concatenated_sequences_test : public ::testing::Test {};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::aa27>;
+
+TYPED_TEST_SUITE(packed_concatenated_sequences_test, alphabet_types, );
+
+TYPED_TEST(packed_concatenated_sequences_test, concepts)
+{
+    using sequences_t = seqan3::packed_concatenated_sequences<TypeParam>;
+
+    EXPECT_TRUE(std::ranges::random_access_range<sequences_t>);
+    EXPECT_TRUE(std::ranges::sized_range<sequences_t>);
+    EXPECT_TRUE(std::ranges::common_range<sequences_t>);
+    EXPECT_TRUE(std::ranges::random_access_range<std::ranges::range_reference_t<sequences_t>>);
+    EXPECT_TRUE(std::ranges::sized_range<std::ranges::range_reference_t<sequences_t>>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<std::ranges::range_reference_t<sequences_t>>, TypeParam>));
+}
+
+TYPED_TEST(packed_concatenated_sequences_test, bits_per_letter)
+{
+    constexpr size_t expected = seqan3::alphabet_size<TypeParam> <= 4 ? 2 :
+                                seqan3::alphabet_size<TypeParam> <= 16 ? 4 : 8;
+    EXPECT_EQ(seqan3::packed_concatenated_sequences<TypeParam>::bits_per_letter, expected);
+}
+
+TYPED_TEST(packed_concatenated_sequences_test, empty)
+{
+    seqan3::packed_concatenated_sequences<TypeParam> sequences{};
+    EXPECT_TRUE(sequences.empty());
+    EXPECT_EQ(sequences.size(), 0u);
+    EXPECT_EQ(sequences.concat_size(), 0u);
+    EXPECT_TRUE(sequences.begin() == sequences.end());
+    EXPECT_THROW(sequences.at(0), std::out_of_range);
+
+    seqan3::packed_concatenated_sequences<TypeParam> moved{std::move(sequences)};
+    EXPECT_TRUE(moved.empty());
+    EXPECT_TRUE(sequences.empty());
+}
+
+TYPED_TEST(packed_concatenated_sequences_test, construct_from_range)
+{
+    auto const expected = random_sequences<TypeParam>(1000, 300, 0);
+    seqan3::packed_concatenated_sequences<TypeParam> const sequences{expected};
+
+    expect_same_sequences(sequences, expected);
+    EXPECT_RANGE_EQ(sequences.front(), expected.front());
+    EXPECT_RANGE_EQ(sequences.back(), expected.back());
+    EXPECT_RANGE_EQ(sequences.at(5), expected[5]);
+    EXPECT_THROW(sequences.at(1000), std::out_of_range);
+
+    std::vector<TypeParam> buffer{};
+    EXPECT_THROW(sequences.extract(1000, buffer), std::out_of_range);
+
+    size_t i = 0;
+    for (auto && sequence : sequences)
+        EXPECT_RANGE_EQ(sequence, expected[i++]);
+}
+
+TYPED_TEST(packed_concatenated_sequences_test, copy_and_move)
+{
+    auto const expected = random_sequences<TypeParam>(100, 50, 1);
+    seqan3::packed_concatenated_sequences<TypeParam> const sequences{expected};
+
+    seqan3::packed_concatenated_sequences<TypeParam> copy{sequences};
+    EXPECT_TRUE(copy == sequences);
+    expect_same_sequences(copy, expected);
+
+    seqan3::packed_concatenated_sequences<TypeParam> moved{std::move(copy)};
+    expect_same_sequences(moved, expected);
+
+    seqan3::packed_concatenated_sequences<TypeParam> assigned{};
+    assigned = moved;
+    expect_same_sequences(assigned, expected);
+    EXPECT_TRUE(assigned == moved);
+
+    assigned = seqan3::packed_concatenated_sequences<TypeParam>{};
+    EXPECT_TRUE(assigned.empty());
+    EXPECT_FALSE(assigned == moved);
+}
+
+TYPED_TEST(packed_concatenated_sequences_test, builder)
+{
+    auto const first = random_sequences<TypeParam>(10, 100, 2);
+    auto const second = random_sequences<TypeParam>(7, 3, 3);
+
+    typename seqan3::packed_concatenated_sequences<TypeParam>::builder builder{};
+    builder.reserve(17, 1000);
+    EXPECT_EQ(builder.append(first), 0u);
+    EXPECT_EQ(builder.append(second), 10u);
+    EXPECT_EQ(builder.append(std::vector<std::vector<TypeParam>>{}), 17u);
+
+    auto expected = first;
+    expected.insert(expected.end(), second.begin(), second.end());
+    expect_same_sequences(builder.finalise(), expected);
+
+    // The builder is empty again.
+    EXPECT_TRUE(builder.finalise().empty());
+}
+
+TYPED_TEST(packed_concatenated_sequences_test, builder_parallel)
+{
+    size_t const thread_count = 4;
+    size_t const batch_count = 50;
+
+    std::vector<std::vector<std::vector<TypeParam>>> batches{};
+    for (size_t i = 0; i < thread_count * batch_count; ++i)
+        batches.push_back(random_sequences<TypeParam>(20, 40, 10 + i));
+
+    typename seqan3::packed_concatenated_sequences<TypeParam>::builder builder{};
+    std::vector<size_t> positions(batches.size());
+
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t] ()
+        {
+            for (size_t i = t; i < batches.size(); i += thread_count)
+                positions[i] = builder.append(batches[i]);
+        });
+    }
+    for (std::thread & thread : threads)
+        thread.join();
+
+    seqan3::packed_concatenated_sequences<TypeParam> const sequences = builder.finalise();
+    ASSERT_EQ(sequences.size(), batches.size() * 20);
+
+    for (size_t i = 0; i < batches.size(); ++i)
+        for (size_t j = 0; j < batches[i].size(); ++j)
+            EXPECT_RANGE_EQ(sequences[positions[i] + j], batches[i][j]);
+}
+
+TYPED_TEST(packed_concatenated_sequences_test, save_and_load)
+{
+    auto const expected = random_sequences<TypeParam>(500, 200, 4);
+    seqan3::packed_concatenated_sequences<TypeParam> const sequences{expected};
+
+    seqan3::test::tmp_filename filename{"packed_concatenated_sequences"};
+    sequences.save(filename.get_path());
+
+    for (bool const memory_map : {true, false})
+    {
+        auto const loaded = seqan3::packed_concatenated_sequences<TypeParam>::load(filename.get_path(), memory_map);
+        EXPECT_EQ(loaded.is_memory_mapped(), memory_map);
+        expect_same_sequences(loaded, expected);
+        EXPECT_TRUE(std::ranges::equal(loaded.words(), sequences.words()));
+
+        // Copies of a memory mapped container own their data.
+        seqan3::packed_concatenated_sequences<TypeParam> const copy{loaded};
+        EXPECT_FALSE(copy.is_memory_mapped());
+        expect_same_sequences(copy, expected);
+    }
+
+    // An empty container can be saved and loaded as well.
+    seqan3::packed_concatenated_sequences<TypeParam>{}.save(filename.get_path());
+    EXPECT_TRUE(seqan3::packed_concatenated_sequences<TypeParam>::load(filename.get_path()).empty());
+}
+
+TEST(packed_concatenated_sequences, load_errors)
+{
+    using sequences_t = seqan3::packed_concatenated_sequences<seqan3::dna4>;
+    seqan3::test::tmp_filename filename{"packed_concatenated_sequences"};
+
+    EXPECT_THROW(sequences_t::load(filename.get_path()), seqan3::file_open_error);
+    EXPECT_THROW(sequences_t::load(filename.get_path(), false), seqan3::file_open_error);
+
+    {
+        std::ofstream file{filename.get_path()};
+        file << "ACGT\n";
+    }
+    EXPECT_THROW(sequences_t::load(filename.get_path()), seqan3::format_error);
+
+    // A container of a different alphabet.
+    seqan3::packed_concatenated_sequences<seqan3::dna5>{std::vector<std::vector<seqan3::dna5>>(3)}
+        .save(filename.get_path());
+    EXPECT_THROW(sequences_t::load(filename.get_path()), seqan3::format_error);
+    EXPECT_THROW(sequences_t::load(filename.get_path(), false), seqan3::format_error);
+
+    // A truncated file.
+    sequences_t{random_sequences<seqan3::dna4>(100, 100, 5)}.save(filename.get_path());
+    std::filesystem::resize_file(filename.get_path(), std::filesystem::file_size(filename.get_path()) - 8);
+    EXPECT_THROW(sequences_t::load(filename.get_path()), seqan3::format_error);
+}
+
+TEST(packed_concatenated_sequences, memory)
+{
+    // 10'000 reads of 150 bp need 2 bits per letter and about 10 bits per delimiter.
+    std::vector<std::vector<seqan3::dna4>> reads(10'000, std::vector<seqan3::dna4>(150));
+    seqan3::packed_concatenated_sequences<seqan3::dna4> const sequences{reads};
+
+    EXPECT_EQ(sequences.words().size(), (10'000u * 150u * 2u + 63u) / 64u);
+}
@@ -0,0 +1,122 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/alphabet/quality/phred94.hpp>
+#include <seqan3/alphabet/quality/phred_binned.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+
+#include "../alphabet_constexpr_test_template.hpp"
+#include "../alphabet_test_template.hpp"
+#include "../semi_alphabet_constexpr_test_template.hpp"
+#include "../semi_alphabet_test_template.hpp"
+
+INSTANTIATE_TYPED_TEST_SUITE_P(phred_binned, alphabet, seqan3::phred_binned, );
+INSTANTIATE_TYPED_TEST_SUITE_P(phred_binned, semi_alphabet_test, seqan3::phred_binned, );
+INSTANTIATE_TYPED_TEST_SUITE_P(phred_binned, alphabet_constexpr, seqan3::phred_binned, );
+INSTANTIATE_TYPED_TEST_SUITE_P(phred_binned, semi_alphabet_constexpr, seqan3::phred_binned, );
+
+// The representative score of the bin of a Phred score.
+int binned(int const phred)
+{
+    if (phred <= 2)
+        return 2;
+    if (phred <= 9)
+        return 6;
+    if (phred <= 19)
+        return 15;
+    if (phred <= 24)
+        return 22;
+    if (phred <= 29)
+        return 27;
+    if (phred <= 34)
+        return 33;
+    if (phred <= 39)
+        return 37;
+    return 40;
+}
+
+TEST(phred_binned, concept_check)
+{
+    EXPECT_TRUE(seqan3::writable_quality_alphabet<seqan3::phred_binned>);
+    EXPECT_TRUE(seqan3::writable_quality_alphabet<seqan3::phred_binned &>);
+    EXPECT_TRUE(seqan3::quality_alphabet<seqan3::phred_binned const>);
+    EXPECT_FALSE(seqan3::writable_quality_alphabet<seqan3::phred_binned const>);
+}
+
+TEST(phred_binned, conversion_phred)
+{
+    for (int phred = -128; phred < 128; ++phred)
+    {
+        seqan3::phred_binned const quality = seqan3::phred_binned{}.assign_phred(phred);
+        EXPECT_EQ(quality.to_phred(), binned(phred)) << "phred " << phred;
+    }
+}
+
+TEST(phred_binned, conversion_char)
+{
+    for (int chr = -128; chr < 128; ++chr)
+    {
+        seqan3::phred_binned const quality = seqan3::phred_binned{}.assign_char(static_cast<char>(chr));
+        EXPECT_EQ(quality.to_char(), binned(chr - '!') + '!') << "char " << chr;
+        EXPECT_EQ(seqan3::char_is_valid_for<seqan3::phred_binned>(static_cast<char>(chr)), chr >= '!' && chr <= '~');
+    }
+
+    std::string chars{};
+    for (size_t rank = 0; rank < seqan3::phred_binned::alphabet_size; ++rank)
+        chars.push_back(seqan3::to_char(seqan3::phred_binned{}.assign_rank(rank)));
+    EXPECT_EQ(chars, "#'07<BFI");
+}
+
+TEST(phred_binned, conversion_quality)
+{
+    for (int phred = 0; phred < 94; ++phred)
+    {
+        seqan3::phred94 const quality = seqan3::phred94{}.assign_phred(phred);
+        EXPECT_EQ(seqan3::phred_binned{quality}.to_phred(), binned(phred));
+        EXPECT_EQ(seqan3::phred42{seqan3::phred_binned{quality}}.to_phred(), binned(phred));
+    }
+}
+
+TEST(phred_binned, bulk_conversion)
+{
+    std::string chars{};
+    for (size_t i = 0; i < 1000; ++i)
+        chars.push_back(static_cast<char>('!' + (i * 7) % 94));
+
+    std::vector<seqan3::phred_binned> qualities(chars.size());
+    seqan3::bulk_assign_char_to(chars, qualities);
+    EXPECT_EQ(seqan3::bulk_find_invalid_char<seqan3::phred_binned>(chars), chars.size());
+
+    std::string binned_chars(chars.size(), ' ');
+    seqan3::bulk_to_char(qualities, binned_chars);
+
+    for (size_t i = 0; i < chars.size(); ++i)
+    {
+        EXPECT_EQ(qualities[i], seqan3::phred_binned{}.assign_char(chars[i]));
+        EXPECT_EQ(binned_chars[i], binned(chars[i] - '!') + '!');
+    }
+}
+
+TEST(phred_binned, bitpacked_sequence)
+{
+    EXPECT_EQ(seqan3::bitpacked_sequence<seqan3::phred_binned>::bits_per_letter, 3u);
+
+    std::vector<seqan3::phred_binned> qualities(150);
+    for (size_t i = 0; i < qualities.size(); ++i)
+        qualities[i].assign_rank(i % 8);
+
+    seqan3::bitpacked_sequence<seqan3::phred_binned> const packed{qualities};
+    EXPECT_TRUE(std::ranges::equal(packed, qualities));
+    EXPECT_EQ(packed.words().size(), (150u * 3u + 63u) / 64u);
+}
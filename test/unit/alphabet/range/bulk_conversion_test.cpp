@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename T>
+class bulk_conversion : public ::testing::Test
+{
+public:
+    // Every character in several orders and at every offset into the vector width; the length is not a multiple of
+    // any vector width.
+    static inline std::string const chars = [] ()
+    {
+        std::string result{};
+        for (size_t round = 0; round < 3; ++round)
+            for (size_t i = 0; i < 256; ++i)
+                result.push_back(static_cast<char>((i * (2 * round + 1) + round) % 256));
+        result += "ACGTNACGTNacgtnUuRYSWKMBDHVN!#+5IJ~";
+        return result;
+    }();
+};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::dna16sam,
+                                        seqan3::rna4, seqan3::rna5, seqan3::rna15,
+                                        seqan3::phred42, seqan3::phred63, seqan3::phred68solexa, seqan3::phred94,
+                                        seqan3::aa27, char>;
+
+TYPED_TEST_SUITE(bulk_conversion, alphabet_types, );
+
+TYPED_TEST(bulk_conversion, assign_char_to)
+{
+    for (size_t length = 0; length <= this->chars.size(); length += (length < 100) ? 1 : 97)
+    {
+        std::string_view const chars{this->chars.data(), length};
+        std::vector<TypeParam> expected{};
+        for (char const c : chars)
+            expected.push_back(seqan3::assign_char_to(c, TypeParam{}));
+
+        std::vector<TypeParam> actual(length);
+        seqan3::bulk_assign_char_to(chars, actual);
+        EXPECT_RANGE_EQ(actual, expected);
+    }
+}
+
+TYPED_TEST(bulk_conversion, find_invalid_char)
+{
+    for (size_t start = 0; start < this->chars.size(); ++start)
+    {
+        std::string_view const chars{this->chars.data() + start, this->chars.size() - start};
+        size_t expected = 0;
+        while (expected < chars.size() && seqan3::char_is_valid_for<TypeParam>(chars[expected]))
+            ++expected;
+
+        EXPECT_EQ(seqan3::bulk_find_invalid_char<TypeParam>(chars), expected);
+    }
+
+    EXPECT_EQ(seqan3::bulk_find_invalid_char<TypeParam>(std::string{}), 0u);
+}
+
+TYPED_TEST(bulk_conversion, to_char)
+{
+    std::vector<TypeParam> alphabets{};
+    for (size_t i = 0; i < 1000; ++i)
+        alphabets.push_back(seqan3::assign_rank_to((i * 7) % seqan3::alphabet_size<TypeParam>, TypeParam{}));
+
+    for (size_t length = 0; length <= alphabets.size(); length += (length < 100) ? 1 : 97)
+    {
+        std::span<TypeParam const> const letters{alphabets.data(), length};
+        std::string expected{};
+        for (TypeParam const letter : letters)
+            expected.push_back(seqan3::to_char(letter));
+
+        std::string actual(length, ' ');
+        seqan3::bulk_to_char(letters, actual);
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TYPED_TEST(bulk_conversion, size_mismatch)
+{
+    std::string const chars{"ACGT"};
+    std::vector<TypeParam> alphabets(3);
+
+    EXPECT_THROW(seqan3::bulk_assign_char_to(chars, alphabets), std::invalid_argument);
+    EXPECT_THROW(seqan3::bulk_assign_char_strictly_to(chars, alphabets), std::invalid_argument);
+    EXPECT_THROW(seqan3::bulk_to_char(alphabets, std::string(4, ' ')), std::invalid_argument);
+}
+
+TEST(bulk_assign_char_strictly_to, dna4)
+{
+    using namespace seqan3::literals;
+
+    std::string const valid(100, 'G');
+    std::vector<seqan3::dna4> alphabets(valid.size());
+    seqan3::bulk_assign_char_strictly_to(valid, alphabets);
+    EXPECT_RANGE_EQ(alphabets, std::vector<seqan3::dna4>(100, 'G'_dna4));
+
+    std::string invalid(100, 'A');
+    invalid[70] = 'N';
+    invalid[80] = 'X';
+    alphabets.assign(100, 'C'_dna4);
+
+    try
+    {
+        seqan3::bulk_assign_char_strictly_to(invalid, alphabets);
+        FAIL() << "Expected seqan3::invalid_char_assignment.";
+    }
+    catch (seqan3::invalid_char_assignment const & exception)
+    {
+        EXPECT_NE(std::string{exception.what()}.find("Assigning 'N' to an alphabet of type seqan3::dna4"),
+                  std::string::npos);
+    }
+    EXPECT_RANGE_EQ(alphabets, std::vector<seqan3::dna4>(100, 'C'_dna4)); // not modified
+}
+
+TEST(bulk_assign_char_strictly_to, phred42)
+{
+    std::string qualities(50, 'I');
+    std::vector<seqan3::phred42> alphabets(qualities.size());
+    EXPECT_NO_THROW(seqan3::bulk_assign_char_strictly_to(qualities, alphabets));
+
+    qualities[33] = 'K'; // rank 42
+    EXPECT_THROW(seqan3::bulk_assign_char_strictly_to(qualities, alphabets), seqan3::invalid_char_assignment);
+    EXPECT_EQ(seqan3::bulk_find_invalid_char<seqan3::phred42>(qualities), 33u);
+}
@@ -0,0 +1,186 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/alphabet/quality/qualified.hpp>
+#include <seqan3/alphabet/range/bulk_hash.hpp>
+
+template <typename T>
+class bulk_hash : public ::testing::Test
+{
+public:
+    static std::vector<T> letters(size_t const length, std::mt19937_64 & generator)
+    {
+        std::uniform_int_distribution<size_t> rank{0, seqan3::alphabet_size<T> - 1};
+        std::vector<T> result(length);
+        for (T & letter : result)
+            seqan3::assign_rank_to(rank(generator), letter);
+        return result;
+    }
+};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::aa27, seqan3::phred42,
+                                        seqan3::gapped<seqan3::dna4>,
+                                        seqan3::qualified<seqan3::dna4, seqan3::phred42>>;
+
+TYPED_TEST_SUITE(bulk_hash, alphabet_types, );
+
+TYPED_TEST(bulk_hash, same_for_all_ranges)
+{
+    std::mt19937_64 generator{42};
+
+    for (size_t length : {0u, 1u, 2u, 31u, 32u, 33u, 63u, 64u, 65u, 127u, 128u, 129u, 1000u, 2047u, 2048u, 2049u,
+                          10'000u})
+    {
+        SCOPED_TRACE(testing::Message() << "length " << length);
+        std::vector<TypeParam> const sequence = TestFixture::letters(length, generator);
+        std::array<uint64_t, 2> const expected = seqan3::bulk_hash_128(sequence);
+
+        EXPECT_EQ(seqan3::bulk_hash(sequence), expected[0]);
+        EXPECT_EQ(seqan3::bulk_hash_128(seqan3::bitpacked_sequence<TypeParam>{sequence}), expected);
+        EXPECT_EQ(seqan3::bulk_hash_128(std::list<TypeParam>(sequence.begin(), sequence.end())), expected);
+        EXPECT_EQ(seqan3::bulk_hash_128(sequence | std::views::transform(std::identity{})), expected);
+        EXPECT_EQ(seqan3::sequence_hash{}(sequence), expected[0]);
+    }
+}
+
+TYPED_TEST(bulk_hash, incremental)
+{
+    std::mt19937_64 generator{7};
+    std::vector<TypeParam> const sequence = TestFixture::letters(5000, generator);
+    seqan3::bitpacked_sequence<TypeParam> const packed{sequence};
+    uint64_t const expected = seqan3::bulk_hash(sequence, 3u);
+
+    for (size_t part : {1u, 3u, 17u, 64u, 100u, 1000u, 4999u})
+    {
+        SCOPED_TRACE(testing::Message() << "part " << part);
+        seqan3::sequence_hasher<TypeParam> hasher{3u};
+        seqan3::sequence_hasher<TypeParam> mixed_hasher{3u};
+
+        for (size_t begin = 0; begin < sequence.size(); begin += part)
+        {
+            size_t const end = std::min(begin + part, sequence.size());
+            hasher.update(std::span{sequence}.subspan(begin, end - begin));
+
+            // Alternate between the paths for contiguous ranges, packed words and single letters.
+            if (begin / part % 3 == 0)
+                mixed_hasher.update(seqan3::bitpacked_sequence<TypeParam>{sequence | std::views::take(end)
+                                                                                   | std::views::drop(begin)});
+            else if (begin / part % 3 == 1)
+                mixed_hasher.update(packed | std::views::take(end) | std::views::drop(begin));
+            else
+                mixed_hasher.update(std::vector<TypeParam>(sequence.begin() + begin, sequence.begin() + end));
+        }
+
+        EXPECT_EQ(hasher.size(), sequence.size());
+        EXPECT_EQ(hasher.digest(), expected);
+        EXPECT_EQ(mixed_hasher.digest(), expected);
+    }
+
+    seqan3::sequence_hasher<TypeParam> hasher{};
+    hasher.update(sequence);
+    hasher.reset(3u);
+    EXPECT_EQ(hasher.size(), 0u);
+    EXPECT_EQ(hasher.update(sequence).digest(), expected);
+}
+
+TYPED_TEST(bulk_hash, distinct)
+{
+    // Sequences of the first letter only differ in their length.
+    std::unordered_set<uint64_t> hashes{};
+    std::vector<TypeParam> sequence{};
+    for (size_t length = 0; length < 300; ++length)
+    {
+        EXPECT_TRUE(hashes.insert(seqan3::bulk_hash(sequence)).second);
+        sequence.push_back(seqan3::assign_rank_to(0, TypeParam{}));
+    }
+
+    // Seeds and the halves of the 128 bit hash values differ.
+    std::array<uint64_t, 2> const hash = seqan3::bulk_hash_128(sequence);
+    EXPECT_NE(hash[0], hash[1]);
+    EXPECT_NE(seqan3::bulk_hash(sequence, 1u), hash[0]);
+    EXPECT_NE(seqan3::bulk_hash(sequence, 1u), seqan3::bulk_hash(sequence, 2u));
+}
+
+TEST(bulk_hash, distribution)
+{
+    using namespace seqan3::literals;
+
+    std::mt19937_64 generator{11};
+    std::uniform_int_distribution<size_t> rank{0, 3};
+    std::unordered_set<uint64_t> hashes{};
+    std::array<size_t, 256> buckets{};
+    size_t changed_bits{};
+
+    constexpr size_t count = 100'000;
+    for (size_t i = 0; i < count; ++i)
+    {
+        seqan3::dna4_vector sequence(20);
+        for (seqan3::dna4 & letter : sequence)
+            seqan3::assign_rank_to(rank(generator), letter);
+
+        uint64_t const hash = seqan3::bulk_hash(sequence);
+        hashes.insert(hash);
+        ++buckets[hash % buckets.size()];
+
+        // Changing a single letter changes half of the bits.
+        seqan3::assign_rank_to((seqan3::to_rank(sequence[i % 20]) + 1) % 4, sequence[i % 20]);
+        changed_bits += std::popcount(hash ^ seqan3::bulk_hash(sequence));
+    }
+
+    EXPECT_EQ(hashes.size(), count);
+    for (size_t const bucket : buckets)
+    {
+        EXPECT_GT(bucket, count / buckets.size() * 8 / 10);
+        EXPECT_LT(bucket, count / buckets.size() * 12 / 10);
+    }
+    EXPECT_NEAR(static_cast<double>(changed_bits) / count, 32.0, 0.5);
+}
+
+TEST(bulk_hash, hash_table)
+{
+    using namespace seqan3::literals;
+
+    std::unordered_map<seqan3::dna4_vector, size_t, seqan3::sequence_hash> counts{};
+    for (seqan3::dna4_vector const & read : {"ACGT"_dna4, "AC"_dna4, "ACGT"_dna4, ""_dna4, "ACGT"_dna4, "AC"_dna4})
+        ++counts[read];
+
+    EXPECT_EQ(counts.size(), 3u);
+    EXPECT_EQ(counts.at("ACGT"_dna4), 3u);
+    EXPECT_EQ(counts.at("AC"_dna4), 2u);
+    EXPECT_EQ(counts.at(""_dna4), 1u);
+}
+
+TEST(bulk_hash, stable_values)
+{
+    using namespace seqan3::literals;
+
+    // The hash values do not depend on the platform or on the vectorisation.
+    seqan3::dna4_vector sequence{};
+    for (size_t i = 0; i < 1000; ++i)
+        sequence.push_back(seqan3::assign_rank_to((i * 7 + i / 3) % 4, seqan3::dna4{}));
+
+    EXPECT_EQ(seqan3::bulk_hash_128(sequence), (std::array<uint64_t, 2>{0x07fd'65e7'db0f'e6ceULL,
+                                                                         0x62c3'f758'2bba'92adULL}));
+    EXPECT_EQ(seqan3::bulk_hash("ACGT"_dna4), 0x026a'06c6'e67e'052cULL);
+    EXPECT_EQ(seqan3::bulk_hash("MANATEE"_aa27, 5u), 0x6455'80e5'5ecc'b6aaULL);
+}
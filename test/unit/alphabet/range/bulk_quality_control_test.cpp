@@ -0,0 +1,354 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/alphabet/range/bulk_quality_control.hpp>
+#include <seqan3/io/sequence_file/record.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+// ---------------------------------------------------------------------------------------------------------------------
+// naive implementations
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::vector<int> phred_scores(auto const & qualities)
+{
+    std::vector<int> scores{};
+    for (auto const quality : qualities)
+        scores.push_back(std::max<int>(seqan3::to_phred(quality), 0));
+    return scores;
+}
+
+size_t naive_trim_length_bwa(std::vector<int> const & scores, int const threshold)
+{
+    size_t length = scores.size();
+    int sum = 0;
+    int max_sum = 0;
+    for (size_t i = scores.size(); i-- > 0;)
+    {
+        sum += threshold - scores[i];
+        if (sum < 0)
+            break;
+        if (sum > max_sum)
+        {
+            max_sum = sum;
+            length = i;
+        }
+    }
+    return length;
+}
+
+size_t naive_trim_length_window(std::vector<int> const & scores, size_t const window_size, int const threshold)
+{
+    size_t const window = std::min(window_size, scores.size());
+    for (size_t start = 0; start + window <= scores.size() && window > 0; ++start)
+    {
+        int sum = 0;
+        for (size_t i = start; i < start + window; ++i)
+            sum += scores[i];
+
+        if (sum < threshold * static_cast<int>(window))
+        {
+            size_t length = start;
+            while (length < start + window && scores[length] >= threshold)
+                ++length;
+            return length;
+        }
+    }
+    return scores.size();
+}
+
+double naive_expected_errors(std::vector<int> const & scores)
+{
+    double sum = 0;
+    for (int const score : scores)
+        sum += std::pow(10.0, -score / 10.0);
+    return sum;
+}
+
+std::vector<bool> naive_low_complexity(std::string const & sequence, size_t const window_size, double const threshold)
+{
+    std::vector<bool> masked(sequence.size());
+    size_t const window = std::min(window_size, sequence.size());
+    auto unambiguous = [] (char const c) { return c == 'A' || c == 'C' || c == 'G' || c == 'T'; };
+
+    for (size_t start = 0; start + window <= sequence.size() && window >= 3; ++start)
+    {
+        std::map<std::string, size_t> occurrences{};
+        size_t triplets = 0;
+        for (size_t i = start; i + 3 <= start + window; ++i)
+        {
+            std::string const triplet = sequence.substr(i, 3);
+            if (std::ranges::all_of(triplet, unambiguous))
+            {
+                ++occurrences[triplet];
+                ++triplets;
+            }
+        }
+
+        double pairs = 0;
+        for (auto const & [triplet, count] : occurrences)
+            pairs += count * (count - 1) / 2;
+
+        if (triplets > 1 && pairs / (triplets - 1) > threshold)
+            for (size_t i = start; i < start + window; ++i)
+                masked[i] = true;
+    }
+    return masked;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// quality trimming and filtering
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+class bulk_quality_control : public ::testing::Test
+{
+public:
+    // Reads with a high quality start and a decreasing quality towards the end, with random drops.
+    static std::vector<T> qualities(size_t const length, std::mt19937_64 & generator)
+    {
+        std::vector<T> result(length);
+        std::uniform_int_distribution<int> noise{-8, 8};
+        std::bernoulli_distribution drop{0.05};
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            int score = 38 - static_cast<int>(30 * i / std::max<size_t>(length, 1)) + noise(generator);
+            if (drop(generator))
+                score = 2;
+            seqan3::assign_phred_to(std::clamp(score, 0, 40), result[i]);
+        }
+        return result;
+    }
+};
+
+using quality_types = ::testing::Types<seqan3::phred42, seqan3::phred63, seqan3::phred94, seqan3::phred68solexa,
+                                       seqan3::phred_binned>;
+
+TYPED_TEST_SUITE(bulk_quality_control, quality_types, );
+
+TYPED_TEST(bulk_quality_control, phred_is_rank)
+{
+    constexpr bool expected = std::same_as<TypeParam, seqan3::phred42> || std::same_as<TypeParam, seqan3::phred63> ||
+                              std::same_as<TypeParam, seqan3::phred94>;
+    EXPECT_EQ(seqan3::detail::bulk_phred_is_rank<TypeParam>, expected);
+}
+
+TYPED_TEST(bulk_quality_control, trim_and_expected_errors)
+{
+    std::mt19937_64 generator{42};
+
+    for (size_t length : {0u, 1u, 2u, 3u, 4u, 5u, 15u, 16u, 17u, 31u, 32u, 33u, 64u, 100u, 151u, 251u, 1000u})
+    {
+        for (size_t repetition = 0; repetition < 20; ++repetition)
+        {
+            std::vector<TypeParam> const qualities = TestFixture::qualities(length, generator);
+            std::vector<int> const scores = phred_scores(qualities);
+            SCOPED_TRACE(testing::Message() << "length " << length << " repetition " << repetition);
+
+            for (int threshold : {0, 1, 3, 10, 20, 30, 41})
+                EXPECT_EQ(seqan3::bulk_trim_length_bwa(qualities, threshold), naive_trim_length_bwa(scores, threshold));
+
+            for (size_t window : {1u, 4u, 10u, 50u})
+                for (int threshold : {1, 3, 10, 20, 30, 41})
+                    EXPECT_EQ(seqan3::bulk_trim_length_window(qualities, window, threshold),
+                              naive_trim_length_window(scores, window, threshold));
+
+            EXPECT_NEAR(seqan3::bulk_expected_errors(qualities), naive_expected_errors(scores), 1e-9);
+
+            // Non-contiguous qualities are converted.
+            seqan3::bitpacked_sequence<TypeParam> const packed{qualities};
+            EXPECT_EQ(seqan3::bulk_trim_length_bwa(packed, 20), naive_trim_length_bwa(scores, 20));
+            EXPECT_EQ(seqan3::bulk_trim_length_window(packed, 4, 20), naive_trim_length_window(scores, 4, 20));
+        }
+    }
+}
+
+TEST(bulk_quality_control, trim_examples)
+{
+    using namespace seqan3::literals;
+
+    // Phred scores: 40 40 40 40 40 20 40 40 10 5 2 2 2 20 2
+    auto const qualities = "IIIII5II+&###5#"_phred42;
+
+    // The 3' end from the score 10 on has a mean below 20; the single 5 before it does not cut the read.
+    EXPECT_EQ(seqan3::bulk_trim_length_bwa(qualities, 20), 8u);
+    EXPECT_EQ(seqan3::bulk_trim_length_bwa(qualities, 3), 14u);
+    EXPECT_EQ(seqan3::bulk_trim_length_bwa(qualities, 0), 15u);
+
+    // The first window with a mean below 20 starts at the last 40, which is kept.
+    EXPECT_EQ(seqan3::bulk_trim_length_window(qualities, 3, 20), 8u);
+    EXPECT_EQ(seqan3::bulk_trim_length_window(qualities, 1, 20), 8u);
+    EXPECT_EQ(seqan3::bulk_trim_length_window(qualities, 0, 20), 15u);
+    EXPECT_EQ(seqan3::bulk_trim_length_window(qualities, 100, 40), 5u);
+
+    EXPECT_DOUBLE_EQ(seqan3::bulk_expected_errors("+5?I"_phred42), 0.1 + 0.01 + 0.001 + 0.0001);
+    EXPECT_DOUBLE_EQ(seqan3::bulk_expected_errors(std::vector<seqan3::phred42>{}), 0.0);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// low-complexity masking
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(bulk_quality_control, mask_low_complexity)
+{
+    using namespace seqan3::literals;
+
+    std::mt19937_64 generator{7};
+    std::uniform_int_distribution<size_t> letter{0, 4};
+    std::uniform_int_distribution<size_t> repeat_length{1, 4};
+    std::bernoulli_distribution start_repeat{0.02};
+
+    for (size_t length : {0u, 1u, 2u, 3u, 10u, 63u, 64u, 65u, 200u, 1000u})
+    {
+        for (size_t repetition = 0; repetition < 10; ++repetition)
+        {
+            // Random letters with repeats of short units.
+            std::string sequence{};
+            while (sequence.size() < length)
+            {
+                if (start_repeat(generator))
+                {
+                    std::string unit{};
+                    for (size_t i = repeat_length(generator); i > 0; --i)
+                        unit += "ACGT"[letter(generator) % 4];
+                    for (size_t i = 0; i < 20 && sequence.size() < length; ++i)
+                        sequence += unit.substr(0, std::min(unit.size(), length - sequence.size()));
+                }
+                else
+                {
+                    sequence += "ACGTN"[letter(generator)];
+                }
+            }
+
+            for (auto [window, threshold] : {std::pair{64u, 20.0}, std::pair{20u, 2.0}, std::pair{10u, 1.5}})
+            {
+                SCOPED_TRACE(testing::Message() << sequence << " window " << window << " threshold " << threshold);
+                std::vector<bool> const expected_mask = naive_low_complexity(sequence, window, threshold);
+
+                std::vector<seqan3::dna5> nucleotides{};
+                for (char const c : sequence)
+                    nucleotides.push_back(seqan3::assign_char_to(c, seqan3::dna5{}));
+
+                std::vector<seqan3::dna5> expected = nucleotides;
+                for (size_t i = 0; i < expected.size(); ++i)
+                    if (expected_mask[i])
+                        expected[i] = 'N'_dna5;
+
+                EXPECT_EQ(seqan3::bulk_mask_low_complexity(nucleotides, window, threshold),
+                          static_cast<size_t>(std::ranges::count(expected_mask, true)));
+                EXPECT_RANGE_EQ(nucleotides, expected);
+            }
+        }
+    }
+}
+
+TEST(bulk_quality_control, mask_low_complexity_examples)
+{
+    using namespace seqan3::literals;
+
+    auto sequence = "ACGTTGCAAGTC"_dna15;
+    EXPECT_EQ(seqan3::bulk_mask_low_complexity(sequence), 0u);
+    EXPECT_RANGE_EQ(sequence, "ACGTTGCAAGTC"_dna15);
+
+    // Homopolymers and dinucleotide repeats are masked, the unique sequence between them is not.
+    auto repeats = "AAAAAAAAAAAAAAAAAAAAGATTACACTAGCATCACACACACACACACACACA"_dna15;
+    EXPECT_EQ(seqan3::bulk_mask_low_complexity(repeats, 12, 2.0), 43u);
+    EXPECT_RANGE_EQ(repeats, "NNNNNNNNNNNNNNNNNNNNNNNTACACTAGCATNNNNNNNNNNNNNNNNNNNN"_dna15);
+
+    seqan3::bitpacked_sequence<seqan3::dna5> packed{"CCCCCCCCCCCC"_dna5};
+    EXPECT_EQ(seqan3::bulk_mask_low_complexity(packed, 64, 2.0), 12u);
+    EXPECT_RANGE_EQ(packed, "NNNNNNNNNNNN"_dna5);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// batches of records
+// ---------------------------------------------------------------------------------------------------------------------
+
+using record_type = seqan3::sequence_record<seqan3::type_list<std::vector<seqan3::dna5>, std::vector<seqan3::phred42>>,
+                                            seqan3::fields<seqan3::field::seq, seqan3::field::qual>>;
+
+TEST(bulk_quality_control, batch)
+{
+    using namespace seqan3::literals;
+
+    std::vector<record_type> records{record_type{"ACGTACGTACGTAC"_dna5, "IIIIIIIII#####"_phred42},
+                                     record_type{"ACGTACGTACGTAC"_dna5, "IIIIII++++++++"_phred42},
+                                     record_type{"ACGTAAAAAAAAAA"_dna5, "IIIIIIIIIIIIII"_phred42},
+                                     record_type{""_dna5, ""_phred42}};
+
+    seqan3::quality_control_options options{};
+    options.bwa_threshold = 20;
+    options.window_size = 4;
+    options.window_threshold = 15;
+    options.dust_window_size = 8;
+    options.dust_threshold = 2;
+    options.min_length = 5;
+    options.max_expected_errors = 0.5;
+
+    std::vector<seqan3::quality_control_result> const results = seqan3::bulk_quality_control(records, options);
+
+    ASSERT_EQ(results.size(), 4u);
+    EXPECT_EQ(results[0].length, 9u);
+    EXPECT_EQ(results[1].length, 6u);
+    EXPECT_EQ(results[2].length, 14u);
+    EXPECT_EQ(results[3].length, 0u);
+    EXPECT_EQ(results[2].masked, 10u);
+
+    EXPECT_EQ((std::vector<bool>{results[0].passed, results[1].passed, results[2].passed, results[3].passed}),
+              (std::vector<bool>{true, true, true, false}));
+    EXPECT_NEAR(results[0].expected_errors, 9 * 0.0001, 1e-12);
+
+    EXPECT_RANGE_EQ(records[0].sequence(), "ACGTACGTA"_dna5);
+    EXPECT_RANGE_EQ(records[0].base_qualities(), "IIIIIIIII"_phred42);
+    EXPECT_RANGE_EQ(records[1].sequence(), "ACGTAC"_dna5);
+    EXPECT_RANGE_EQ(records[2].sequence(), "ACGTNNNNNNNNNN"_dna5);
+
+    // The expected errors of the trimmed read are filtered.
+    std::vector<record_type> noisy{record_type{"ACGTACGTACGT"_dna5, "++++++++++++"_phred42}};
+    seqan3::quality_control_options filter_options{};
+    filter_options.max_expected_errors = 1.0;
+    EXPECT_FALSE(seqan3::bulk_quality_control(noisy, filter_options)[0].passed);
+    filter_options.max_expected_errors = 1.5;
+    EXPECT_TRUE(seqan3::bulk_quality_control(noisy, filter_options)[0].passed);
+
+    // Disabled steps do not change the reads.
+    std::vector<record_type> unchanged = records;
+    for (seqan3::quality_control_result const & result : seqan3::bulk_quality_control(unchanged, {}))
+        EXPECT_TRUE(result.passed);
+    EXPECT_TRUE(unchanged == records);
+}
+
+TEST(bulk_quality_control, batch_errors)
+{
+    using namespace seqan3::literals;
+
+    std::vector<record_type> records{record_type{"ACGT"_dna5, "III"_phred42}};
+    EXPECT_THROW(seqan3::bulk_quality_control(records, {}), std::invalid_argument);
+
+    using dna4_record_type = seqan3::sequence_record<seqan3::type_list<seqan3::dna4_vector,
+                                                                       std::vector<seqan3::phred42>>,
+                                                     seqan3::fields<seqan3::field::seq, seqan3::field::qual>>;
+    std::vector<dna4_record_type> dna4_records{dna4_record_type{"AAAAAAAA"_dna4, "IIIIIIII"_phred42}};
+    seqan3::quality_control_options options{};
+    EXPECT_NO_THROW(seqan3::bulk_quality_control(dna4_records, options));
+    options.dust_threshold = 20;
+    EXPECT_THROW(seqan3::bulk_quality_control(dna4_records, options), std::invalid_argument);
+}
@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/alphabet/range/bulk_reverse_complement.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename T>
+class bulk_reverse_complement : public ::testing::Test
+{
+public:
+    // All letters in an irregular order.
+    static std::vector<T> letters(size_t const length)
+    {
+        std::vector<T> result(length);
+        for (size_t i = 0; i < length; ++i)
+            result[i] = seqan3::assign_rank_to((i * 7 + i / 5) % seqan3::alphabet_size<T>, T{});
+        return result;
+    }
+
+    static std::vector<T> expected(std::vector<T> const & sequence)
+    {
+        auto reverse_complement = sequence | seqan3::views::complement | std::views::reverse;
+        return {reverse_complement.begin(), reverse_complement.end()};
+    }
+};
+
+using nucleotide_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::dna16sam,
+                                          seqan3::rna4, seqan3::rna5, seqan3::rna15, seqan3::dna3bs>;
+
+TYPED_TEST_SUITE(bulk_reverse_complement, nucleotide_types, );
+
+TYPED_TEST(bulk_reverse_complement, in_place)
+{
+    // Covers the vectorised part from both ends with and without a middle letter.
+    for (size_t length = 0; length <= 300; length += (length < 70) ? 1 : 33)
+    {
+        std::vector<TypeParam> sequence = this->letters(length);
+        std::vector<TypeParam> const expected = this->expected(sequence);
+
+        seqan3::bulk_reverse_complement(sequence);
+        EXPECT_RANGE_EQ(sequence, expected);
+    }
+}
+
+TYPED_TEST(bulk_reverse_complement, copy)
+{
+    for (size_t length = 0; length <= 300; length += (length < 70) ? 1 : 33)
+    {
+        std::vector<TypeParam> const sequence = this->letters(length);
+        std::vector<TypeParam> reverse_complement(length);
+
+        seqan3::bulk_reverse_complement(sequence, reverse_complement);
+        EXPECT_RANGE_EQ(reverse_complement, this->expected(sequence));
+    }
+
+    std::vector<TypeParam> too_short(2);
+    EXPECT_THROW(seqan3::bulk_reverse_complement(this->letters(3), too_short), std::invalid_argument);
+}
+
+TYPED_TEST(bulk_reverse_complement, bitpacked_sequence)
+{
+    for (size_t length = 0; length <= 300; length += (length < 70) ? 1 : 33)
+    {
+        std::vector<TypeParam> const sequence = this->letters(length);
+        seqan3::bitpacked_sequence<TypeParam> packed{sequence};
+
+        seqan3::bulk_reverse_complement(packed);
+        EXPECT_RANGE_EQ(packed, this->expected(sequence));
+
+        // The unused bits are cleared, so the sequence compares equal to a newly constructed one.
+        EXPECT_EQ(packed, seqan3::bitpacked_sequence<TypeParam>{this->expected(sequence)});
+    }
+}
@@ -0,0 +1,93 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/alphabet/range/bulk_translate.hpp>
+#include <seqan3/alphabet/views/translate.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename T>
+class bulk_translate : public ::testing::Test
+{
+public:
+    // All letters in an irregular order.
+    static std::vector<T> letters(size_t const length)
+    {
+        std::vector<T> result(length);
+        for (size_t i = 0; i < length; ++i)
+            result[i] = seqan3::assign_rank_to((i * 7 + i / 5) % seqan3::alphabet_size<T>, T{});
+        return result;
+    }
+};
+
+using nucleotide_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::dna16sam,
+                                          seqan3::rna4, seqan3::rna5, seqan3::rna15, seqan3::dna3bs>;
+
+TYPED_TEST_SUITE(bulk_translate, nucleotide_types, );
+
+TYPED_TEST(bulk_translate, six_frames)
+{
+    std::vector<seqan3::aa27_vector> translations{};
+
+    for (size_t length : {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 31u, 32u, 33u, 34u, 35u, 100u, 767u, 768u, 769u, 770u,
+                          771u, 1536u, 1537u, 1538u, 1539u, 3100u})
+    {
+        std::vector<TypeParam> const nucleotides = TestFixture::letters(length);
+        seqan3::bulk_translate(nucleotides, seqan3::translation_frames::six_frames, translations);
+
+        auto expected = nucleotides | seqan3::views::translate(seqan3::translation_frames::six_frames);
+        ASSERT_EQ(translations.size(), 6u);
+        for (size_t frame = 0; frame < 6; ++frame)
+        {
+            SCOPED_TRACE(testing::Message() << "length " << length << " frame " << frame);
+            EXPECT_RANGE_EQ(translations[frame], expected[frame]);
+        }
+    }
+}
+
+TYPED_TEST(bulk_translate, selected_frames)
+{
+    std::vector<TypeParam> const nucleotides = TestFixture::letters(100);
+    std::vector<seqan3::aa27_vector> translations(10);
+
+    for (seqan3::translation_frames frames : {seqan3::translation_frames::forward_frame0,
+                                              seqan3::translation_frames::reverse_frame2,
+                                              seqan3::translation_frames::forward_reverse1,
+                                              seqan3::translation_frames::forward_frames,
+                                              seqan3::translation_frames::reverse_frames,
+                                              seqan3::translation_frames::forward_frame2 |
+                                              seqan3::translation_frames::reverse_frame0})
+    {
+        seqan3::bulk_translate(nucleotides, frames, translations);
+
+        auto expected = nucleotides | seqan3::views::translate(frames);
+        ASSERT_EQ(translations.size(), expected.size());
+        for (size_t frame = 0; frame < translations.size(); ++frame)
+            EXPECT_RANGE_EQ(translations[frame], expected[frame]);
+    }
+
+    seqan3::bulk_translate(nucleotides, seqan3::translation_frames{}, translations);
+    EXPECT_TRUE(translations.empty());
+}
+
+TEST(bulk_translate, example)
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::aa27_vector> translations{};
+    seqan3::bulk_translate("ACGTACGTACGTA"_dna4, seqan3::translation_frames::six_frames, translations);
+
+    EXPECT_EQ(translations, (std::vector<seqan3::aa27_vector>{"TYVR"_aa27, "RTYV"_aa27, "VRT"_aa27,
+                                                               "YVRT"_aa27, "TYVR"_aa27, "RTY"_aa27}));
+}
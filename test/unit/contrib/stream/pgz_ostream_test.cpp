@@ -0,0 +1,153 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/contrib/stream/gz_istream.hpp>
+#include <seqan3/contrib/stream/gz_ostream.hpp>
+#include <seqan3/contrib/stream/pgz_ostream.hpp>
+
+#include "../../io/stream/ostream_test_template.hpp"
+
+template <>
+class ostream<seqan3::contrib::pgz_ostream> : public ::testing::Test
+{
+public:
+    static constexpr bool zero_out_os_byte = true;
+
+    // A single block is compressed exactly like seqan3::contrib::gz_ostream does.
+    static inline std::string compressed
+    {                                                                  //OS = 0
+        '\x1f','\x8b','\x08','\x00','\x00','\x00','\x00','\x00','\x00','\x00','\x0b','\xc9','\x48','\x55','\x28','\x2c',
+        '\xcd','\x4c','\xce','\x56','\x48','\x2a','\xca','\x2f','\xcf','\x53','\x48','\xcb','\xaf','\x50','\xc8','\x2a',
+        '\xcd','\x2d','\x28','\x56','\xc8','\x2f','\x4b','\x2d','\x52','\x28','\x01','\x4a','\xe7','\x24','\x56','\x55',
+        '\x2a','\xa4','\xe4','\xa7','\x03','\x00','\x39','\xa3','\x4f','\x41','\x2b','\x00','\x00','\x00'
+    };  // Note we zeroed the 10th byte which indicates the OS on which the file was compressed.
+};
+
+using test_types = ::testing::Types<seqan3::contrib::pgz_ostream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, ostream, test_types, );
+
+std::string decompress(std::string const & compressed)
+{
+    std::istringstream in{compressed};
+    seqan3::contrib::gz_istream decompressor{in};
+    return std::string{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+}
+
+std::string make_fastq(size_t const count)
+{
+    std::string data{};
+    for (size_t i = 0; i < count; ++i)
+        data += "@read" + std::to_string(i) + "\nACGTACGTNNACGTTTGA\n+\nIIIIIIII##IIIIIIII\n";
+    return data;
+}
+
+TEST(pgz_ostream, multiple_blocks)
+{
+    std::string const data = make_fastq(50000); // about 2.6 MB, i.e. 20 blocks
+
+    std::ostringstream parallel{};
+    {
+        seqan3::contrib::pgz_ostream out{parallel};
+        out.rdbuf()->set_thread_options({std::make_shared<seqan3::bgzf_thread_pool>(4u), 4u, 0u});
+        out << data;
+    }
+
+    std::ostringstream sequential{};
+    {
+        seqan3::contrib::gz_ostream out{sequential};
+        out << data;
+    }
+
+    EXPECT_EQ(decompress(parallel.str()), data);
+    // blocks are primed with the preceding data, hence the compression ratio is close to single-threaded gzip
+    EXPECT_LT(parallel.str().size(), sequential.str().size() * 1.02);
+}
+
+TEST(pgz_ostream, flush)
+{
+    std::string const data = make_fastq(1000);
+
+    std::ostringstream compressed{};
+    {
+        seqan3::contrib::pgz_ostream out{compressed};
+        out << data;
+        out.flush(); // ends the current block on a byte boundary; the member is not finished
+        out << data;
+        out.flush();
+        out.flush(); // nothing buffered
+    }
+
+    EXPECT_EQ(decompress(compressed.str()), data + data);
+}
+
+TEST(pgz_ostream, empty)
+{
+    std::ostringstream compressed{};
+    {
+        seqan3::contrib::pgz_ostream out{compressed};
+    }
+
+    EXPECT_EQ(compressed.str().size(), 10u + 2u + 8u); // header, empty final block, footer
+    EXPECT_EQ(decompress(compressed.str()), "");
+}
+
+TEST(pgz_ostream, compression_level)
+{
+    std::string const data = make_fastq(10000);
+
+    std::ostringstream stored{};
+    std::ostringstream best{};
+    {
+        seqan3::contrib::pgz_ostream out_stored{stored, 0};
+        seqan3::contrib::pgz_ostream out_best{best};
+        EXPECT_TRUE(out_best.rdbuf()->set_compression_level(9));
+
+        out_stored << data;
+        out_best << data;
+
+        out_best.flush();
+        EXPECT_FALSE(out_best.rdbuf()->set_compression_level(1)); // compression has already started
+    }
+
+    EXPECT_GT(stored.str().size(), data.size());
+    EXPECT_LT(best.str().size(), data.size() / 4);
+    EXPECT_EQ(stored.str()[8], '\x04'); // XFL: fastest compression
+    EXPECT_EQ(best.str()[8], '\x02');   // XFL: best compression
+    EXPECT_EQ(decompress(stored.str()), data);
+    EXPECT_EQ(decompress(best.str()), data);
+}
+
+TEST(pgz_ostream, compression_failure)
+{
+    std::string const data = make_fastq(1000);
+
+    // An invalid level, which bypasses the check of set_compression_level, makes deflate fail for every block.
+    std::ostringstream flushed{};
+    {
+        seqan3::contrib::pgz_ostream out{flushed};
+        out.rdbuf()->level = 42;
+        out << data;
+        EXPECT_TRUE(out.good());
+        out.flush();
+        EXPECT_TRUE(out.bad());
+    }
+    EXPECT_TRUE(flushed.bad());
+
+    // A failure in the final block is reported on the underlying stream.
+    std::ostringstream destructed{};
+    {
+        seqan3::contrib::pgz_ostream out{destructed};
+        out.rdbuf()->level = 42;
+        out << data;
+        EXPECT_TRUE(out.good());
+    }
+    EXPECT_TRUE(destructed.bad());
+    EXPECT_EQ(destructed.str().size(), 10u); // only the header, the failed block and the footer are omitted
+}
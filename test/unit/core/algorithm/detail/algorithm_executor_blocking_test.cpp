@@ -13,6 +13,7 @@
 
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
 #include <seqan3/core/detail/persist_view.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/pretty_printing.hpp>
 #include <seqan3/utility/views/zip.hpp>
 
@@ -64,7 +65,8 @@ struct algorithm_executor_blocking_test : public ::testing::Test
 };
 
 using testing_types = testing::Types<seqan3::detail::execution_handler_sequential,
-                                     seqan3::detail::execution_handler_parallel>;
+                                     seqan3::detail::execution_handler_parallel,
+                                     seqan3::detail::execution_handler_work_stealing>;
 TYPED_TEST_SUITE(algorithm_executor_blocking_test, testing_types, );
 
 TYPED_TEST(algorithm_executor_blocking_test, construction)
@@ -280,3 +282,34 @@ TEST(algorithm_executor_blocking_test, issue_1801)
     // all threads will get a piece of the cake.
     EXPECT_LE(thread_ids.size(), thread_count);
 }
+
+TEST(algorithm_executor_blocking_test, work_stealing_rounds)
+{
+    // Every sequence is mapped to its index, such that the order of the results can be checked.
+    std::function algorithm = [] (size_t const index, std::function<void(size_t)> && callback)
+    {
+        if (index % 3 != 0) // Simulating not to call the callback without a result.
+            callback(index);
+    };
+
+    // The buffer holds fewer elements than the resource, so it is refilled in several rounds.
+    size_t const thread_count = 2u;
+    size_t const resource_size = 3 * thread_count * seqan3::detail::execution_handler_work_stealing::max_batch_size + 7;
+    auto indices = std::views::iota(size_t{0}, resource_size);
+
+    using executor_t = seqan3::detail::algorithm_executor_blocking<decltype(indices),
+                                                                   decltype(algorithm),
+                                                                   size_t,
+                                                                   seqan3::detail::execution_handler_work_stealing>;
+
+    executor_t executor{indices, algorithm, 0u, seqan3::detail::execution_handler_work_stealing{thread_count}};
+    executor_t moved_executor{std::move(executor)};
+
+    std::vector<size_t> results{};
+    for (auto result = moved_executor.next_result(); result.has_value(); result = moved_executor.next_result())
+        results.push_back(*result);
+
+    std::vector<size_t> expected{};
+    std::ranges::copy_if(indices, std::back_inserter(expected), [] (size_t const index) { return index % 3 != 0; });
+    EXPECT_RANGE_EQ(results, expected);
+}
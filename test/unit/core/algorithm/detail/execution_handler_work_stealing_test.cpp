@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
+
+#include "execution_handler_template.hpp"
+
+INSTANTIATE_TYPED_TEST_SUITE_P(execution_handler_work_stealing,
+                               execution_handler,
+                               seqan3::detail::execution_handler_work_stealing, );
+
+TEST(execution_handler_work_stealing, thread_count)
+{
+    EXPECT_EQ(seqan3::detail::execution_handler_work_stealing{}.thread_count(), 1u);
+    EXPECT_EQ(seqan3::detail::execution_handler_work_stealing{0}.thread_count(), 1u);
+    EXPECT_EQ(seqan3::detail::execution_handler_work_stealing{4}.thread_count(), 4u);
+}
+
+TEST(execution_handler_work_stealing, parallel_for)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{4};
+
+    // Every task is executed exactly once, also for repeated jobs of different sizes.
+    for (size_t const task_count : {0u, 1u, 3u, 4u, 5u, 1000u, 100000u})
+    {
+        std::vector<std::atomic<size_t>> executed(task_count);
+        std::vector<size_t> thread_indices(task_count);
+        exec_handler.parallel_for(task_count, [&] (size_t const index, size_t const thread_index)
+        {
+            ++executed[index];
+            thread_indices[index] = thread_index;
+        });
+
+        for (size_t index = 0; index < task_count; ++index)
+        {
+            EXPECT_EQ(executed[index].load(), 1u) << "Task: " << index;
+            EXPECT_LT(thread_indices[index], 4u) << "Task: " << index;
+        }
+    }
+}
+
+TEST(execution_handler_work_stealing, uneven_tasks)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{4};
+
+    // The first task blocks the first thread until another thread executed a task of the first thread's range, which
+    // is only possible by stealing it. The timeout only keeps the test from hanging if no task is ever stolen.
+    size_t const task_count = 2000;
+    std::vector<size_t> thread_indices(task_count);
+    std::mutex mutex{};
+    std::condition_variable stolen_condition{};
+    bool stolen = false;
+
+    exec_handler.parallel_for(task_count, [&] (size_t const index, size_t const thread_index)
+    {
+        thread_indices[index] = thread_index;
+
+        std::unique_lock lock{mutex};
+        if (index < task_count / 4 && thread_index != 0)
+        {
+            stolen = true;
+            stolen_condition.notify_all();
+        }
+
+        if (index == 0)
+            stolen_condition.wait_for(lock, std::chrono::seconds{30}, [&] { return stolen; });
+    });
+
+    EXPECT_TRUE(stolen);
+    for (size_t index = 0; index < task_count; ++index)
+        EXPECT_LT(thread_indices[index], 4u) << "Task: " << index;
+}
+
+TEST(execution_handler_work_stealing, exception)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{4};
+
+    std::atomic<size_t> executed{0};
+    EXPECT_THROW(exec_handler.parallel_for(10000, [&] (size_t const index, size_t)
+                 {
+                     if (index == 5000)
+                         throw std::runtime_error{"task failed"};
+                     ++executed;
+                 }),
+                 std::runtime_error);
+
+    // The handler can be used after an exception.
+    executed = 0;
+    exec_handler.parallel_for(10000, [&] (size_t, size_t) { ++executed; });
+    EXPECT_EQ(executed.load(), 10000u);
+}
+
+TEST(execution_handler_work_stealing, exception_cancels_remaining_tasks)
+{
+    // With a single thread the tasks are executed in order, so no task may run after the first one threw.
+    seqan3::detail::execution_handler_work_stealing exec_handler{1};
+
+    std::atomic<size_t> executed{0};
+    EXPECT_THROW(exec_handler.parallel_for(10000, [&] (size_t const index, size_t)
+                 {
+                     if (index == 0)
+                         throw std::runtime_error{"task failed"};
+                     ++executed;
+                 }),
+                 std::runtime_error);
+    EXPECT_EQ(executed.load(), 0u);
+}
+
+TEST(execution_handler_work_stealing, move)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{3};
+    seqan3::detail::execution_handler_work_stealing moved_handler{std::move(exec_handler)};
+    EXPECT_EQ(moved_handler.thread_count(), 3u);
+
+    std::atomic<size_t> executed{0};
+    moved_handler.parallel_for(100, [&] (size_t, size_t) { ++executed; });
+    EXPECT_EQ(executed.load(), 100u);
+}
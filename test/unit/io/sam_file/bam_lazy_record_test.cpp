@@ -0,0 +1,248 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/quality/phred94.hpp>
+#include <seqan3/io/sam_file/bam_lazy_record.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna16sam;
+using seqan3::operator""_phred94;
+using seqan3::operator""_tag;
+
+struct bam_lazy_record_test : public ::testing::Test
+{
+    // read1	41	ref	1	61	1S1M1D1M1I	ref	10	300	ACGT	!##$	AS:i:2	NM:i:7
+    // read2	42	ref	2	62	1H7M1D1M1S2H	ref	10	300	AGGCTGNAG	!##$&'()*	xy:B:S,3,4,5
+    // read3	43	ref	3	63	1S1M1P1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
+    std::string input{
+        '\x42', '\x41', '\x4D', '\x01', '\x1C', '\x00', '\x00', '\x00', '\x40', '\x48', '\x44', '\x09', '\x56',
+        '\x4E', '\x3A', '\x31', '\x2E', '\x36', '\x0A', '\x40', '\x53', '\x51', '\x09', '\x53', '\x4E', '\x3A',
+        '\x72', '\x65', '\x66', '\x09', '\x4C', '\x4E', '\x3A', '\x33', '\x34', '\x0A', '\x01', '\x00', '\x00',
+        '\x00', '\x04', '\x00', '\x00', '\x00', '\x72', '\x65', '\x66', '\x00', '\x22', '\x00', '\x00', '\x00',
+        '\x48', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x06',
+        '\x3D', '\x49', '\x12', '\x05', '\x00', '\x29', '\x00', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00',
+        '\x00', '\x00', '\x09', '\x00', '\x00', '\x00', '\x2C', '\x01', '\x00', '\x00', '\x72', '\x65', '\x61',
+        '\x64', '\x31', '\x00', '\x14', '\x00', '\x00', '\x00', '\x10', '\x00', '\x00', '\x00', '\x12', '\x00',
+        '\x00', '\x00', '\x10', '\x00', '\x00', '\x00', '\x11', '\x00', '\x00', '\x00', '\x12', '\x48', '\x00',
+        '\x02', '\x02', '\x03', '\x41', '\x53', '\x43', '\x02', '\x4E', '\x4D', '\x43', '\x07', '\x5A', '\x00',
+        '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x01', '\x00', '\x00', '\x00', '\x06', '\x3E', '\x49',
+        '\x12', '\x06', '\x00', '\x2A', '\x00', '\x09', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+        '\x09', '\x00', '\x00', '\x00', '\x2C', '\x01', '\x00', '\x00', '\x72', '\x65', '\x61', '\x64', '\x32',
+        '\x00', '\x15', '\x00', '\x00', '\x00', '\x70', '\x00', '\x00', '\x00', '\x12', '\x00', '\x00', '\x00',
+        '\x10', '\x00', '\x00', '\x00',
+        '\x14', '\x00', '\x00', '\x00', '\x25', '\x00', '\x00', '\x00', '\x14', '\x42', '\x84', '\xF1', '\x40',
+        '\x00', '\x02', '\x02', '\x03', '\x05', '\x06', '\x07', '\x08', '\x09', '\x78', '\x79', '\x42', '\x53',
+        '\x03', '\x00', '\x00', '\x00', '\x03', '\x00', '\x04', '\x00', '\x05', '\x00', '\x5A', '\x00', '\x00',
+        '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x00', '\x00', '\x00', '\x06', '\x3F', '\x49', '\x12',
+        '\x0A', '\x00', '\x2B', '\x00', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x09',
+        '\x00', '\x00', '\x00', '\x2C', '\x01', '\x00', '\x00', '\x72', '\x65', '\x61', '\x64', '\x33', '\x00',
+        '\x14', '\x00', '\x00', '\x00', '\x10', '\x00', '\x00', '\x00', '\x16', '\x00', '\x00', '\x00', '\x10',
+        '\x00', '\x00', '\x00', '\x11', '\x00', '\x00', '\x00', '\x10', '\x00', '\x00', '\x00', '\x11', '\x00',
+        '\x00', '\x00', '\x12', '\x00', '\x00', '\x00', '\x10', '\x00', '\x00', '\x00', '\x14', '\x00', '\x00',
+        '\x00', '\x44', '\x14', '\x81', '\x81', '\x00', '\x00', '\x09', '\x0A', '\x0B', '\x0C', '\x0D', '\x0E'
+    };
+};
+
+TEST(bam_lazy_record, concepts)
+{
+    EXPECT_TRUE(std::semiregular<seqan3::bam_lazy_record>);
+}
+
+TEST(bam_lazy_record, too_small)
+{
+    EXPECT_THROW(seqan3::bam_lazy_record{std::string(10, '\0')}, seqan3::format_error);
+}
+
+TEST_F(bam_lazy_record_test, fixed_size_fields)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}};
+    seqan3::bam_lazy_record record{};
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read1");
+    EXPECT_EQ(record.flag(), seqan3::sam_flag{41u});
+    EXPECT_EQ(record.mapping_quality(), 61u);
+    EXPECT_EQ(record.reference_id(), 0);
+    EXPECT_EQ(record.reference_position(), 0);
+    EXPECT_EQ(std::get<0>(record.mate()), 0);
+    EXPECT_EQ(std::get<1>(record.mate()), 9);
+    EXPECT_EQ(std::get<2>(record.mate()), 300);
+    EXPECT_EQ(record.sequence_size(), 4);
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read2");
+    EXPECT_EQ(record.reference_position(), 1);
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read3");
+    EXPECT_EQ(record.mapping_quality(), 63u);
+
+    EXPECT_FALSE(fin.read_lazy_record(record));
+    EXPECT_FALSE(fin.read_lazy_record(record));
+
+    EXPECT_EQ(fin.header().ref_ids().size(), 1u);
+}
+
+TEST_F(bam_lazy_record_test, header_before_first_record)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}};
+    seqan3::bam_lazy_record record{};
+
+    EXPECT_EQ(fin.header().ref_ids().size(), 1u);
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read1");
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read2");
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read3");
+    EXPECT_FALSE(fin.read_lazy_record(record));
+}
+
+TEST_F(bam_lazy_record_test, header_before_range_interface)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}, seqan3::fields<seqan3::field::id>{}};
+
+    EXPECT_EQ(fin.header().ref_ids().size(), 1u);
+
+    std::vector<std::string> ids{};
+    for (auto & record : fin)
+        ids.push_back(record.id());
+
+    EXPECT_EQ(ids, (std::vector<std::string>{"read1", "read2", "read3"}));
+}
+
+TEST_F(bam_lazy_record_test, record_filter)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}};
+    fin.options.record_filter = [] (seqan3::sam_record_core_fields const & fields)
+    {
+        return fields.mapping_quality != 62u;
+    };
+    seqan3::bam_lazy_record record{};
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read1");
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(record.id(), "read3");
+    EXPECT_FALSE(fin.read_lazy_record(record));
+}
+
+TEST_F(bam_lazy_record_test, variable_length_fields)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}};
+    seqan3::bam_lazy_record record{};
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_RANGE_EQ(record.sequence(), "ACGT"_dna16sam);
+    EXPECT_RANGE_EQ(record.base_qualities(), "!##$"_phred94);
+    std::vector<seqan3::cigar> expected_cigar{{1, 'S'_cigar_operation}, {1, 'M'_cigar_operation},
+                                              {1, 'D'_cigar_operation}, {1, 'M'_cigar_operation},
+                                              {1, 'I'_cigar_operation}};
+    EXPECT_RANGE_EQ(record.cigar_sequence(), expected_cigar);
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_RANGE_EQ(record.sequence(), "AGGCTGNAG"_dna16sam);
+    EXPECT_RANGE_EQ(record.base_qualities(), "!##$&'()*"_phred94);
+    EXPECT_EQ(record.cigar_sequence().size(), 6u);
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_RANGE_EQ(record.sequence(), "GGAGTATA"_dna16sam);
+    EXPECT_EQ(record.cigar_sequence().size(), 10u);
+}
+
+TEST_F(bam_lazy_record_test, tags)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}};
+    seqan3::bam_lazy_record record{};
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(std::get<int32_t>(record.tag("AS"_tag).value()), 2);
+    EXPECT_EQ(std::get<int32_t>(record.tag("NM"_tag).value()), 7);
+    EXPECT_FALSE(record.tag("xy"_tag).has_value());
+    EXPECT_EQ(record.tags().size(), 2u);
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_EQ(std::get<std::vector<uint16_t>>(record.tag("xy"_tag).value()), (std::vector<uint16_t>{3, 4, 5}));
+    EXPECT_FALSE(record.tag("AS"_tag).has_value());
+    EXPECT_EQ(record.tags().size(), 1u);
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_TRUE(record.tags().empty());
+}
+
+TEST_F(bam_lazy_record_test, malformed_tags)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}};
+    seqan3::bam_lazy_record record{};
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    std::string const valid_block{record.raw_data()}; // AS:C:2 NM:C:7
+
+    auto append_int32 = [] (std::string str, int32_t const value)
+    {
+        char bytes[4];
+        std::memcpy(bytes, &value, 4);
+        return str.append(bytes, 4);
+    };
+
+    std::vector<std::string> const malformed_tags
+    {
+        append_int32("xyBS", -1),                          // negative array size
+        append_int32("xyBS", -2147483647 - 1),             // smallest negative array size
+        append_int32("xyBi", 2147483647),                  // array size overflows the value size
+        append_int32("xyBS", 3) + std::string{"\x03\x00", 2}, // array truncated
+        std::string{"xyBS\x03\x00", 6},                    // array size truncated
+        std::string{"xyBA"} + append_int32("", 1) + "a",   // no valid array type
+        std::string{"xyi\x03\x00", 5},                     // integer truncated
+        std::string{"xyZab"},                              // string not null-terminated
+        std::string{"xy"}                                  // type truncated
+    };
+
+    for (std::string const & malformed_tag : malformed_tags)
+    {
+        seqan3::bam_lazy_record malformed_record{valid_block + malformed_tag};
+
+        // Tags in front of the malformed one can still be accessed.
+        EXPECT_EQ(std::get<int32_t>(malformed_record.tag("AS"_tag).value()), 2);
+        EXPECT_THROW(malformed_record.tag("xy"_tag), seqan3::format_error);
+        EXPECT_THROW(malformed_record.tag("zz"_tag), seqan3::format_error);
+        EXPECT_THROW(malformed_record.tags(), seqan3::format_error);
+    }
+}
+
+TEST_F(bam_lazy_record_test, copy)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_bam{}};
+    seqan3::bam_lazy_record record{};
+
+    ASSERT_TRUE(fin.read_lazy_record(record));
+    EXPECT_RANGE_EQ(record.sequence(), "ACGT"_dna16sam); // fill cache
+
+    seqan3::bam_lazy_record copy{record};
+    ASSERT_TRUE(fin.read_lazy_record(record));
+
+    EXPECT_EQ(copy.id(), "read1");
+    EXPECT_RANGE_EQ(copy.sequence(), "ACGT"_dna16sam);
+    EXPECT_RANGE_EQ(record.sequence(), "AGGCTGNAG"_dna16sam);
+}
+
+TEST(bam_lazy_record, sam_format_unsupported)
+{
+    seqan3::sam_file_input fin{std::istringstream{std::string{"@HD\tVN:1.6\n"}}, seqan3::format_sam{}};
+    seqan3::bam_lazy_record record{};
+
+    EXPECT_THROW(fin.read_lazy_record(record), seqan3::format_error);
+}
@@ -542,6 +542,31 @@ TEST_F(sam_file_input_sam_format_f, construct_by_filename_and_read_alignments)
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(sam_file_input_sam_format_f, memory_map)
+{
+    seqan3::test::tmp_filename filename{"sam_file_input_memory_map.sam"};
+    {
+        std::ofstream filecreator{filename.get_path(), std::ios::out | std::ios::binary};
+        filecreator << input;
+    }
+
+    seqan3::sam_file_input fin{filename.get_path(), ref_ids, ref_seqs, seqan3::fields<seqan3::field::alignment>{}};
+    fin.options.memory_map = true;
+
+    EXPECT_EQ(fin.header().ref_ids(), ref_ids);
+
+    size_t counter = 0;
+    for (auto & [ alignment ] : fin)
+    {
+        EXPECT_RANGE_EQ(std::get<0>(alignment), std::get<0>(alignments_expected[counter]));
+        EXPECT_RANGE_EQ(std::get<1>(alignment), std::get<1>(alignments_expected[counter]));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
 TEST_F(sam_file_input_sam_format_f, construct_from_stream_and_read_alignments)
 {
     seqan3::sam_file_input fin{std::istringstream{input},
@@ -581,6 +606,59 @@ TEST_F(sam_file_input_sam_format_f, construct_from_stream_and_read_alignment_wit
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(sam_file_input_sam_format_f, record_filter)
+{
+    seqan3::sam_file_input fin{std::istringstream{input},
+                               ref_ids,
+                               ref_seqs,
+                               seqan3::format_sam{},
+                               seqan3::fields<seqan3::field::id, seqan3::field::mapq, seqan3::field::alignment>{}};
+
+    fin.options.record_filter = [] (seqan3::sam_record_core_fields const & core)
+    {
+        EXPECT_EQ(core.reference_id, 0);
+        EXPECT_EQ(core.template_length, 300);
+        return core.mapping_quality >= 62u;
+    };
+
+    size_t counter = 1;
+    for (auto & [ id, mapq, alignment ] : fin)
+    {
+        EXPECT_EQ(id, id_comp[counter]);
+        EXPECT_EQ(mapq, 61u + counter);
+        EXPECT_RANGE_EQ(std::get<0>(alignment), std::get<0>(alignments_expected[counter]));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sam_file_input_sam_format_f, record_filter_ignored_fields)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_sam{}, seqan3::fields<seqan3::field::id>{}};
+
+    fin.options.record_filter = [] (seqan3::sam_record_core_fields const & core)
+    {
+        return static_cast<bool>(core.flag & seqan3::sam_flag::paired) && core.reference_position != 1;
+    };
+
+    std::vector<std::string> ids{};
+    for (auto & [ id ] : fin)
+        ids.push_back(id);
+
+    EXPECT_EQ(ids, (std::vector<std::string>{"read1", "read3"}));
+}
+
+TEST_F(sam_file_input_sam_format_f, record_filter_rejects_all)
+{
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_sam{}};
+    fin.options.record_filter = [] (seqan3::sam_record_core_fields const &) { return false; };
+
+    EXPECT_RANGE_EQ(fin.header().ref_ids(), ref_ids);
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
 // ----------------------------------------------------------------------------
 // BAM format specificities
 // ----------------------------------------------------------------------------
@@ -681,4 +759,65 @@ TEST_F(sam_file_input_bam_format_f, construct_by_stream)
 
     EXPECT_EQ(counter, 3u);
 }
+
+TEST_F(sam_file_input_bam_format_f, bgzf_thread_options)
+{
+    std::istringstream stream{binary_input};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}, seqan3::fields<seqan3::field::id>{}};
+    fin.options.bgzf_threads = {std::make_shared<seqan3::bgzf_thread_pool>(1u), 1u, 2u};
+
+    std::vector<std::string> ids{};
+    for (auto & [ id ] : fin)
+        ids.push_back(id);
+
+    EXPECT_EQ(ids, id_comp);
+}
+
+TEST_F(sam_file_input_bam_format_f, record_filter)
+{
+    std::istringstream stream{binary_input};
+
+    seqan3::sam_file_input fin{stream,
+                               ref_ids,
+                               ref_seqs,
+                               seqan3::format_bam{},
+                               seqan3::fields<seqan3::field::id,
+                                              seqan3::field::seq,
+                                              seqan3::field::qual,
+                                              seqan3::field::alignment>{}};
+
+    fin.options.record_filter = [] (seqan3::sam_record_core_fields const & core)
+    {
+        EXPECT_EQ(core.reference_id, 0);
+        EXPECT_EQ(core.template_length, 300);
+        return core.mapping_quality != 62u;
+    };
+
+    std::vector<size_t> expected_records{0u, 2u};
+    size_t counter = 0;
+    for (auto & [ id, seq, qual, alignment ] : fin)
+    {
+        ASSERT_LT(counter, expected_records.size());
+        size_t const i = expected_records[counter];
+
+        EXPECT_EQ(id, id_comp[i]);
+        EXPECT_EQ(seq, seq_comp[i]);
+        EXPECT_EQ(qual, qual_comp[i]);
+        EXPECT_RANGE_EQ(std::get<0>(alignment), std::get<0>(alignments_expected[i]));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 2u);
+}
+
+TEST_F(sam_file_input_bam_format_f, record_filter_rejects_all)
+{
+    std::istringstream stream{binary_input};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}};
+    fin.options.record_filter = [] (seqan3::sam_record_core_fields const &) { return false; };
+
+    EXPECT_RANGE_EQ(fin.header().ref_ids(), ref_ids);
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
 #endif // defined(SEQAN3_HAS_ZLIB)
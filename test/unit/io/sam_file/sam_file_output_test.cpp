@@ -663,6 +663,29 @@ TEST(compression, by_stream_gz)
     EXPECT_EQ(buffer, expected_gz);
 }
 
+TEST(compression, gz_compression_level)
+{
+    seqan3::test::tmp_filename filename{"sam_file_output_test.sam.gz"};
+
+    {
+        seqan3::sam_file_output fout{filename.get_path(), seqan3::fields<seqan3::field::seq, seqan3::field::id>{}};
+        fout.options.gz_compression_level = 0; // store only
+        fout.options.bgzf_threads = {std::make_shared<seqan3::bgzf_thread_pool>(2u), 2u, 0u};
+
+        for (size_t i = 0; i < 3; ++i)
+            fout.emplace_back(seqs[i], ids[i]);
+    }
+
+    std::ifstream fi{filename.get_path(), std::ios::binary};
+    std::string buffer{std::istreambuf_iterator<char>{fi}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(buffer[8], '\x04'); // XFL: fastest compression
+
+    seqan3::contrib::gz_istream decompressor{fi.seekg(0)};
+    std::string sam{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+    EXPECT_NE(sam.find("read1\t"), std::string::npos);
+    EXPECT_NE(buffer.find("read1\t"), std::string::npos); // not compressed
+}
+
 TEST(compression, by_filename_bgzf)
 {
     seqan3::test::tmp_filename filename{"sam_file_output_test.sam.bgzf"};
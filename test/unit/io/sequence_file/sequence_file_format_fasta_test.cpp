@@ -180,6 +180,37 @@ TEST_F(read, mixed_issues)
     do_read_test(input);
 }
 
+TEST_F(read, small_stream_buffer)
+{
+    std::string input
+    {
+        ">ID1\n"
+        "ACGTTTTTTT\n1 TTTTTTTT\n"
+        ">ID2\n"
+        "ACGTTTTTTTTTTTTTTTTTTTTTTTTTTTTT\r\nTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTT\n"
+        ";ID3 lala\n"
+        "ACGTTTA"
+    };
+
+    small_buffer_streambuf buffer{input};
+    std::istream istream{&buffer};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fasta{}};
+
+    auto it = fin.begin();
+    for (unsigned i = 0; i < 3; ++i, ++it)
+    {
+        EXPECT_RANGE_EQ((*it).id(), ids[i]);
+        EXPECT_RANGE_EQ((*it).sequence(), seqs[i]);
+    }
+}
+
+TEST_F(read, fail_illegal_character_in_seq)
+{
+    std::stringstream istream{std::string{">ID1\nACGTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTT\nACGT!T\n"}};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fasta{}};
+    EXPECT_THROW(fin.begin(), seqan3::parse_error);
+}
+
 TEST_F(read, fail_no_newline_after_id)
 {
     std::string input{
@@ -12,7 +12,10 @@
 
 #include <gtest/gtest.h>
 
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
 #include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/alphabet/quality/phred_binned.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/format_fastq.hpp>
@@ -202,6 +205,30 @@ TEST_F(read, mixed_issues)
     do_read_test(input);
 }
 
+TEST_F(read, small_stream_buffer)
+{
+    small_buffer_streambuf buffer{input};
+    std::istream istream{&buffer};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
+
+    auto it = fin.begin();
+    for (unsigned i = 0; i < 3; ++i, ++it)
+    {
+        EXPECT_RANGE_EQ((*it).id(), ids[i]);
+        EXPECT_RANGE_EQ((*it).sequence(), seqs[i]);
+        EXPECT_RANGE_EQ((*it).base_qualities(), quals[i]);
+    }
+}
+
+TEST_F(read, qualities_out_of_range)
+{
+    // Qualities that exceed the alphabet are clamped, like seqan3::assign_char_to does.
+    std::stringstream istream{std::string{"@ID1\nACGT\n+\n!J K~\n"}};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
+
+    EXPECT_RANGE_EQ((*fin.begin()).base_qualities(), "!JJJ"_phred42);
+}
+
 TEST_F(read, only_qual)
 {
     std::stringstream istream{input};
@@ -225,7 +252,21 @@ TEST_F(read, fail_no_seq_after_id)
     EXPECT_THROW(fin.begin(), seqan3::unexpected_end_of_input);
 }
 
-//TODO fail_no_quals
+TEST_F(read, fail_illegal_character_in_seq)
+{
+    std::stringstream istream{std::string{"@ID1\nACGTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTT!ACGT\n+\n!!!\n"}};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
+    EXPECT_THROW(fin.begin(), seqan3::parse_error);
+}
+
+TEST_F(read, fail_no_quals)
+{
+    std::stringstream istream{std::string{"@ID1\nACGT\n+\n!!"}};
+    seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
+    EXPECT_THROW(fin.begin(), seqan3::unexpected_end_of_input);
+}
+
+
 //TODO fail_quals_shorter_seq
 
 // ----------------------------------------------------------------------------
@@ -358,3 +399,63 @@ TEST_F(write, options_all)
 
     EXPECT_EQ(ostream.str(), comp);
 }
+
+// ----------------------------------------------------------------------------
+// compact quality containers
+// ----------------------------------------------------------------------------
+
+template <typename quality_alphabet_t>
+struct bitpacked_quality_traits : seqan3::sequence_file_input_default_traits_dna
+{
+    using quality_alphabet = quality_alphabet_t;
+
+    template <typename _quality_alphabet>
+    using quality_container = seqan3::bitpacked_sequence<_quality_alphabet>;
+};
+
+template <typename quality_alphabet_t>
+void check_compact_qualities()
+{
+    // The qualities are converted and packed in bulk.
+    EXPECT_TRUE(seqan3::detail::bulk_readable_sequence<seqan3::bitpacked_sequence<quality_alphabet_t>>);
+
+    std::string const qualities{"!##$&'()*+,-./+)*+,-)*+,-)*+,-)*+,BDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDE"};
+    std::string const sequence(qualities.size(), 'A');
+    std::istringstream istream{"@ID1\n" + sequence + "\n+\n" + qualities.substr(0, 40) + "\n" + qualities.substr(40) +
+                               "\n@ID2\nAC\n+\nI!\n"};
+
+    seqan3::sequence_file_input<bitpacked_quality_traits<quality_alphabet_t>> fin{istream, seqan3::format_fastq{}};
+
+    std::vector<std::string> quality_strings{};
+    for (auto & record : fin)
+    {
+        EXPECT_TRUE((std::same_as<std::remove_cvref_t<decltype(record.base_qualities())>,
+                                  seqan3::bitpacked_sequence<quality_alphabet_t>>));
+        EXPECT_EQ(std::ranges::size(record.base_qualities()), std::ranges::size(record.sequence()));
+
+        std::string quality_string{};
+        for (quality_alphabet_t const quality : record.base_qualities())
+            quality_string.push_back(seqan3::to_char(quality));
+        quality_strings.push_back(quality_string);
+    }
+
+    auto expected = [] (std::string const & chars)
+    {
+        std::string result{};
+        for (char const chr : chars)
+            result.push_back(seqan3::to_char(quality_alphabet_t{}.assign_char(chr)));
+        return result;
+    };
+
+    EXPECT_EQ(quality_strings, (std::vector<std::string>{expected(qualities), expected("I!")}));
+}
+
+TEST(compact_qualities, bitpacked_phred42)
+{
+    check_compact_qualities<seqan3::phred42>();
+}
+
+TEST(compact_qualities, bitpacked_phred_binned)
+{
+    check_compact_qualities<seqan3::phred_binned>();
+}
@@ -53,6 +53,31 @@ struct sequence_file_data : public ::testing::Test
     std::ostringstream ostream{};
 };
 
+// Buffers only three new characters at a time, so that every field spans several refills of the buffer. The
+// characters that were read before can be put back.
+struct small_buffer_streambuf : public std::streambuf
+{
+    small_buffer_streambuf(std::string data) : data{std::move(data)}
+    {}
+
+    int_type underflow() override
+    {
+        if (gptr() != egptr())
+            return traits_type::to_int_type(*gptr());
+
+        if (position == data.size())
+            return traits_type::eof();
+
+        size_t const count = std::min<size_t>(3u, data.size() - position);
+        setg(data.data(), data.data() + position, data.data() + position + count); // allows putting back
+        position += count;
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::string data{};
+    size_t position{};
+};
+
 template <typename format_t>
 struct sequence_file_read : public sequence_file_data
 {};
@@ -284,6 +284,43 @@ TEST_F(sequence_file_input_f, record_reading_custom_options)
     EXPECT_EQ((*it).id(), "ID3");
 }
 
+TEST_F(sequence_file_input_f, record_reading_memory_map)
+{
+    for (bool populate : {false, true})
+    {
+        seqan3::test::tmp_filename filename{"sequence_file_input_memory_map.fasta"};
+        {
+            std::ofstream filecreator{filename.get_path(), std::ios::out | std::ios::binary};
+            filecreator << input;
+        }
+
+        seqan3::sequence_file_input fin{filename.get_path()};
+        fin.options.memory_map = true;
+        fin.options.memory_map_populate = populate;
+
+        size_t counter = 0;
+        for (auto & rec : fin)
+        {
+            EXPECT_RANGE_EQ(rec.id(),  id_comp[counter]);
+            EXPECT_RANGE_EQ(rec.sequence(), seq_comp[counter]);
+            counter++;
+        }
+
+        EXPECT_EQ(counter, 3u);
+    }
+}
+
+TEST_F(sequence_file_input_f, empty_file_memory_map)
+{
+    seqan3::test::tmp_filename filename{"empty.fasta"};
+    std::ofstream filecreator{filename.get_path(), std::ios::out | std::ios::binary};
+
+    seqan3::sequence_file_input fin{filename.get_path()};
+    fin.options.memory_map = true;
+
+    EXPECT_EQ(fin.begin(), fin.end());
+}
+
 TEST_F(sequence_file_input_f, file_view)
 {
     seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sstream>
+#include <string>
+
+#include <seqan3/io/stream/bgzf_thread_pool.hpp>
+
+#if defined(SEQAN3_HAS_ZLIB)
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+
+TEST(bgzf_thread_pool, construction)
+{
+    EXPECT_THROW(seqan3::bgzf_thread_pool{0u}, std::invalid_argument);
+
+    seqan3::bgzf_thread_pool pool{3u};
+    EXPECT_EQ(pool.size(), 3u);
+
+    EXPECT_GE(seqan3::bgzf_thread_pool::global()->size(), 1u);
+    EXPECT_EQ(seqan3::bgzf_thread_pool::global(), seqan3::bgzf_thread_pool::global());
+}
+
+TEST(bgzf_thread_pool, executes_all_tasks)
+{
+    std::atomic<size_t> counter{0u};
+    {
+        seqan3::bgzf_thread_pool pool{4u};
+        for (size_t i = 0; i < 1000u; ++i)
+            pool.submit([&counter] () { ++counter; });
+    } // the destructor runs all remaining tasks
+
+    EXPECT_EQ(counter.load(), 1000u);
+}
+
+TEST(bgzf_task_group, limits_concurrency)
+{
+    auto pool = std::make_shared<seqan3::bgzf_thread_pool>(8u);
+    std::atomic<size_t> running{0u};
+    std::atomic<size_t> max_running{0u};
+    std::atomic<size_t> counter{0u};
+
+    {
+        seqan3::detail::bgzf_task_group group{pool, 2u};
+        for (size_t i = 0; i < 200u; ++i)
+        {
+            group.submit([&] ()
+            {
+                size_t const now = ++running;
+                size_t expected = max_running.load();
+                while (now > expected && !max_running.compare_exchange_weak(expected, now))
+                {}
+
+                std::this_thread::yield();
+                ++counter;
+                --running;
+            });
+        }
+    } // the destructor waits for all tasks
+
+    EXPECT_EQ(counter.load(), 200u);
+    EXPECT_LE(max_running.load(), 2u);
+    EXPECT_GE(max_running.load(), 1u);
+}
+
+#if defined(SEQAN3_HAS_ZLIB)
+TEST(bgzf_thread_pool, shared_by_streams)
+{
+    // Several streams share a single thread, which must not dead-lock.
+    seqan3::bgzf_thread_options options{std::make_shared<seqan3::bgzf_thread_pool>(1u), 2u, 4u};
+
+    std::string data{};
+    for (size_t i = 0; i < 20000u; ++i)
+        data += "@read" + std::to_string(i) + "\nACGTACGTNNACGT\n+\nIIIIIIIIIIIIII\n";
+
+    std::ostringstream compressed_1{};
+    std::ostringstream compressed_2{};
+    {
+        seqan3::contrib::bgzf_ostream out_1{compressed_1};
+        seqan3::contrib::bgzf_ostream out_2{compressed_2};
+        EXPECT_TRUE(out_1.rdbuf()->set_thread_options(options));
+        EXPECT_TRUE(out_2.rdbuf()->set_thread_options(options));
+
+        out_1 << data;
+        out_2 << data;
+        out_1 << data;
+
+        EXPECT_FALSE(out_1.rdbuf()->set_thread_options(options)); // compression has already started
+    }
+
+    std::istringstream compressed_in_1{compressed_1.str()};
+    std::istringstream compressed_in_2{compressed_2.str()};
+    seqan3::contrib::bgzf_istream in_1{compressed_in_1};
+    seqan3::contrib::bgzf_istream in_2{compressed_in_2};
+    EXPECT_TRUE(in_1.rdbuf()->set_thread_options(options));
+    EXPECT_TRUE(in_2.rdbuf()->set_thread_options(options));
+
+    std::string decompressed_1{std::istreambuf_iterator<char>{in_1}, std::istreambuf_iterator<char>{}};
+    std::string decompressed_2{std::istreambuf_iterator<char>{in_2}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(decompressed_1, data + data);
+    EXPECT_EQ(decompressed_2, data);
+    EXPECT_FALSE(in_1.rdbuf()->set_thread_options(options)); // decompression has already started
+}
+#endif // defined(SEQAN3_HAS_ZLIB)
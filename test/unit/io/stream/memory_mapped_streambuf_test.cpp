@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/io/stream/memory_mapped_streambuf.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+std::string const content{"ACGTACGTACGT\nThe quick brown fox jumps over the lazy dog\n"};
+
+seqan3::test::tmp_filename write_file(std::string const & data)
+{
+    seqan3::test::tmp_filename filename{"memory_mapped_streambuf_test"};
+    std::ofstream out{filename.get_path(), std::ios::binary};
+    out << data;
+    return filename;
+}
+
+TEST(memory_mapped_streambuf, read)
+{
+    auto filename = write_file(content);
+    seqan3::memory_mapped_streambuf buffer{filename.get_path()};
+
+    EXPECT_EQ(buffer.size(), content.size());
+    EXPECT_EQ((std::string{buffer.data(), buffer.size()}), content);
+
+    std::istream stream{&buffer};
+    std::string read{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(read, content);
+    EXPECT_EQ(stream.peek(), std::char_traits<char>::eof());
+}
+
+TEST(memory_mapped_streambuf, populate)
+{
+    auto filename = write_file(content);
+    seqan3::memory_mapped_streambuf buffer{filename.get_path(), true};
+
+    std::istream stream{&buffer};
+    std::string line{};
+    std::getline(stream, line);
+    EXPECT_EQ(line, "ACGTACGTACGT");
+}
+
+TEST(memory_mapped_streambuf, fast_istreambuf_iterator)
+{
+    auto filename = write_file(content);
+    seqan3::memory_mapped_streambuf buffer{filename.get_path()};
+
+    seqan3::detail::fast_istreambuf_iterator<char> it{buffer};
+
+    std::string read{};
+    for (; it != std::default_sentinel; ++it)
+        read.push_back(*it);
+    EXPECT_EQ(read, content);
+}
+
+TEST(memory_mapped_streambuf, seek)
+{
+    auto filename = write_file(content);
+    seqan3::memory_mapped_streambuf buffer{filename.get_path()};
+    std::istream stream{&buffer};
+
+    stream.seekg(13);
+    EXPECT_EQ(stream.tellg(), 13);
+    EXPECT_EQ(stream.get(), 'T');
+
+    stream.seekg(-4, std::ios_base::end);
+    EXPECT_EQ(stream.get(), 'd');
+
+    stream.seekg(-4, std::ios_base::cur);
+    EXPECT_EQ(stream.get(), 'z');
+
+    stream.seekg(content.size() + 1); // out of range
+    EXPECT_TRUE(stream.fail());
+}
+
+TEST(memory_mapped_streambuf, empty_file)
+{
+    auto filename = write_file("");
+    seqan3::memory_mapped_streambuf buffer{filename.get_path()};
+
+    EXPECT_EQ(buffer.size(), 0u);
+    std::istream stream{&buffer};
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+}
+
+TEST(memory_mapped_streambuf, non_existing_file)
+{
+    seqan3::test::tmp_filename filename{"memory_mapped_streambuf_test_missing"};
+    EXPECT_THROW(seqan3::memory_mapped_streambuf{filename.get_path()}, seqan3::file_open_error);
+}
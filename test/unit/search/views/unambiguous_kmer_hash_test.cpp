@@ -0,0 +1,181 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <forward_list>
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna5.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/search/views/unambiguous_kmer_hash.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include "../../range/iterator_test_template.hpp"
+
+#include <gtest/gtest.h>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_dna5;
+using seqan3::operator""_shape;
+using result_t = std::vector<size_t>;
+
+using iterator_type = std::ranges::iterator_t<decltype(std::declval<seqan3::dna5_vector &>()
+                                                       | seqan3::views::unambiguous_kmer_hash(0b101_shape))>;
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = true;
+
+    seqan3::dna5_vector text{"ACGTNAGCN"_dna5};
+
+    decltype(text | seqan3::views::unambiguous_kmer_hash(0b101_shape)) test_range =
+        text | seqan3::views::unambiguous_kmer_hash(0b101_shape);
+
+    std::vector<size_t> expected_range{2, 7, 1};
+};
+
+using test_type = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_type, );
+
+// The hash values and positions of the unambiguous k-mers, computed with views::kmer_hash over dna4.
+template <typename alphabet_t>
+std::pair<result_t, result_t> expected_hashes(std::vector<alphabet_t> const & text, seqan3::shape const & shape)
+{
+    std::vector<seqan3::dna4> dna4_text{};
+    std::vector<bool> ambiguous{};
+    for (alphabet_t const letter : text)
+    {
+        char const chr = seqan3::to_char(letter);
+        ambiguous.push_back(!seqan3::char_is_valid_for<seqan3::dna4>(chr) && chr != 'U');
+        dna4_text.push_back(seqan3::assign_char_to(chr, seqan3::dna4{}));
+    }
+
+    result_t hashes{};
+    result_t positions{};
+    size_t position = 0;
+    for (size_t const hash : dna4_text | seqan3::views::kmer_hash(shape))
+    {
+        if (std::none_of(ambiguous.begin() + position, ambiguous.begin() + position + shape.size(), std::identity{}))
+        {
+            hashes.push_back(hash);
+            positions.push_back(position);
+        }
+        ++position;
+    }
+
+    return {hashes, positions};
+}
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_text(size_t const length, double const ambiguous_rate)
+{
+    std::mt19937_64 engine{length};
+    std::bernoulli_distribution ambiguous{ambiguous_rate};
+    std::uniform_int_distribution<size_t> rank{0, seqan3::alphabet_size<alphabet_t> - 1};
+
+    std::vector<alphabet_t> text(length);
+    for (alphabet_t & letter : text)
+        letter = seqan3::assign_char_to(ambiguous(engine) ? 'N' : "ACGT"[rank(engine) % 4], alphabet_t{});
+    return text;
+}
+
+template <typename T>
+class unambiguous_kmer_hash_test : public ::testing::Test {};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::rna5>;
+
+TYPED_TEST_SUITE(unambiguous_kmer_hash_test, alphabet_types, );
+
+TYPED_TEST(unambiguous_kmer_hash_test, random)
+{
+    for (seqan3::shape const & shape : {seqan3::shape{seqan3::ungapped{1}},
+                                        seqan3::shape{seqan3::ungapped{5}},
+                                        seqan3::shape{seqan3::ungapped{21}},
+                                        seqan3::shape{seqan3::ungapped{31}},
+                                        seqan3::shape{seqan3::ungapped{32}},
+                                        0b101_shape,
+                                        0b1100111_shape,
+                                        0b1010'1010'1010'1010'1010'1010'1010'1011_shape})
+    {
+        for (size_t length : {0u, 1u, 10u, 31u, 32u, 33u, 1000u})
+        {
+            std::vector<TypeParam> const text = random_text<TypeParam>(length, 0.02);
+            auto [expected, expected_positions] = expected_hashes(text, shape);
+
+            auto view = text | seqan3::views::unambiguous_kmer_hash(shape);
+            result_t hashes{};
+            result_t positions{};
+            for (auto it = view.begin(); it != view.end(); ++it)
+            {
+                hashes.push_back(*it);
+                positions.push_back(it.position());
+            }
+
+            EXPECT_EQ(hashes, expected) << "length " << length << " span " << shape.size();
+            EXPECT_EQ(positions, expected_positions) << "length " << length << " span " << shape.size();
+        }
+    }
+}
+
+TEST(unambiguous_kmer_hash, same_as_kmer_hash_for_dna4)
+{
+    seqan3::dna4_vector const text{"ACGTAGCTTGACCA"_dna4};
+
+    EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3}),
+                    text | seqan3::views::kmer_hash(seqan3::ungapped{3}));
+    EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(0b1101_shape),
+                    text | seqan3::views::kmer_hash(0b1101_shape));
+}
+
+TEST(unambiguous_kmer_hash, ambiguous)
+{
+    seqan3::dna5_vector const text{"NACGNNTTAGNNNCN"_dna5};
+
+    auto view = text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3});
+    EXPECT_RANGE_EQ(view, (result_t{6, 60, 50})); // ACG, TTA, TAG
+
+    std::vector<size_t> positions{};
+    for (auto it = view.begin(); it != view.end(); ++it)
+        positions.push_back(it.position());
+    EXPECT_EQ(positions, (std::vector<size_t>{1, 6, 7}));
+
+    EXPECT_TRUE(std::ranges::empty("NNNN"_dna5 | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3})));
+    EXPECT_TRUE(std::ranges::empty("AC"_dna5 | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3})));
+}
+
+TEST(unambiguous_kmer_hash, forward_range)
+{
+    std::forward_list<seqan3::dna5> const text{'A'_dna5, 'C'_dna5, 'N'_dna5, 'G'_dna5, 'T'_dna5, 'A'_dna5};
+
+    EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{2}), (result_t{1, 11, 12}));
+}
+
+TEST(unambiguous_kmer_hash, concepts)
+{
+    using view_t = decltype(std::declval<seqan3::dna5_vector &>()
+                            | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3}));
+
+    EXPECT_TRUE(std::ranges::forward_range<view_t>);
+    EXPECT_TRUE(std::ranges::view<view_t>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<view_t>);
+    EXPECT_FALSE(std::ranges::sized_range<view_t>);
+    EXPECT_TRUE(seqan3::const_iterable_range<view_t>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_reference_t<view_t>, size_t>));
+}
+
+TEST(unambiguous_kmer_hash, invalid_shape)
+{
+    seqan3::dna5_vector const text{"ACGT"_dna5};
+
+    EXPECT_THROW((text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{33})), std::invalid_argument);
+    EXPECT_NO_THROW((text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{32})));
+}
@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/utility/detail/bit_packing.hpp>
+
+template <typename t>
+struct bit_packing_test : public ::testing::Test
+{
+    static constexpr size_t bits = t::value;
+
+    // Generates count random values of the given number of bits.
+    template <typename value_t>
+    static std::vector<value_t> random_values(size_t const count)
+    {
+        std::mt19937_64 engine{bits};
+        std::vector<value_t> values(count);
+        for (value_t & value : values)
+            value = static_cast<value_t>(engine() & seqan3::detail::bit_packing<bits>::value_mask);
+        return values;
+    }
+
+    // Value i is stored in the bits [i * bits, (i + 1) * bits).
+    template <typename value_t>
+    static value_t get(std::vector<uint64_t> const & words, size_t const i)
+    {
+        value_t value{};
+        for (size_t bit = 0; bit < bits; ++bit)
+            value |= static_cast<value_t>((words[(i * bits + bit) / 64] >> ((i * bits + bit) % 64)) & 1u) << bit;
+        return value;
+    }
+};
+
+using bit_widths = ::testing::Types<std::integral_constant<size_t, 1>,
+                                    std::integral_constant<size_t, 2>,
+                                    std::integral_constant<size_t, 3>,
+                                    std::integral_constant<size_t, 4>,
+                                    std::integral_constant<size_t, 5>,
+                                    std::integral_constant<size_t, 7>,
+                                    std::integral_constant<size_t, 8>,
+                                    std::integral_constant<size_t, 13>,
+                                    std::integral_constant<size_t, 64>>;
+
+TYPED_TEST_SUITE(bit_packing_test, bit_widths, );
+
+TYPED_TEST(bit_packing_test, pack_bits)
+{
+    constexpr size_t bits = TestFixture::bits;
+    using value_t = std::conditional_t<bits <= 8, uint8_t, uint64_t>;
+
+    for (size_t offset : {0u, 1u, 31u, 63u, 100u})
+    {
+        for (size_t count : {0u, 1u, 7u, 64u, 129u, 1000u})
+        {
+            std::vector<value_t> const values = TestFixture::template random_values<value_t>(offset + count);
+            std::vector<uint64_t> words((bits * (offset + count) + 63) / 64 + 1, ~uint64_t{});
+
+            // Pack a prefix first, then the rest behind it.
+            seqan3::detail::pack_bits<bits>(values.data(), offset, words.data(), 0);
+            seqan3::detail::pack_bits<bits>(values.data() + offset, count, words.data(), offset * bits);
+
+            for (size_t i = 0; i < offset + count; ++i)
+                EXPECT_EQ((TestFixture::template get<value_t>(words, i)), values[i]) << "offset " << offset
+                                                                                     << " count " << count
+                                                                                     << " index " << i;
+
+            // The bits after the last value are cleared.
+            size_t const end_bit = bits * (offset + count);
+            if (end_bit % 64 != 0)
+            {
+                EXPECT_EQ(words[end_bit / 64] >> (end_bit % 64), 0u);
+            }
+        }
+    }
+}
+
+TYPED_TEST(bit_packing_test, unpack_bits)
+{
+    constexpr size_t bits = TestFixture::bits;
+    using value_t = std::conditional_t<bits <= 8, uint8_t, uint64_t>;
+
+    std::vector<value_t> const values = TestFixture::template random_values<value_t>(1000);
+    std::vector<uint64_t> words((bits * values.size() + 63) / 64);
+    seqan3::detail::pack_bits<bits>(values.data(), values.size(), words.data(), 0);
+
+    for (size_t offset : {0u, 1u, 31u, 63u, 100u})
+    {
+        for (size_t count : {0u, 1u, 7u, 64u, 129u, 900u})
+        {
+            std::vector<value_t> unpacked(count);
+            seqan3::detail::unpack_bits<bits>(words.data(), offset * bits, count, unpacked.data());
+
+            EXPECT_TRUE(std::equal(unpacked.begin(), unpacked.end(), values.begin() + offset)) << "offset " << offset
+                                                                                               << " count " << count;
+        }
+    }
+}
+
+TEST(bit_packing, layout)
+{
+    std::vector<uint8_t> const values{0, 1, 2, 3, 3, 2, 1, 0};
+    uint64_t word{};
+    seqan3::detail::pack_bits<2>(values.data(), values.size(), &word, 0);
+    EXPECT_EQ(word, 0b00'01'10'11'11'10'01'00u);
+}
@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/utility/detail/elias_fano.hpp>
+
+using seqan3::detail::elias_fano_sequence;
+
+// Encodes the values and checks that every value and every pair of neighbours is decoded correctly.
+void check(std::vector<uint64_t> const & values)
+{
+    elias_fano_sequence::layout const layout = elias_fano_sequence::compute_layout(values.size(), values.back());
+    std::vector<uint64_t> words(layout.total_words());
+    elias_fano_sequence::encode(values, layout, words.data());
+
+    elias_fano_sequence const sequence{words.data(), layout};
+    ASSERT_EQ(sequence.size(), values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(sequence[i], values[i]) << "i = " << i;
+        if (i + 1 < values.size())
+        {
+            EXPECT_EQ(sequence.adjacent(i), (std::pair{values[i], values[i + 1]})) << "i = " << i;
+        }
+    }
+}
+
+std::vector<uint64_t> random_values(size_t const count, uint64_t const max_gap, size_t const seed)
+{
+    std::mt19937_64 engine{seed};
+    std::uniform_int_distribution<uint64_t> gap{0, max_gap};
+
+    std::vector<uint64_t> values{0};
+    for (size_t i = 1; i < count; ++i)
+        values.push_back(values.back() + gap(engine));
+    return values;
+}
+
+TEST(elias_fano_sequence, single_value)
+{
+    check({0});
+    check({1});
+    check({1'000'000'000'000});
+}
+
+TEST(elias_fano_sequence, equal_values)
+{
+    check(std::vector<uint64_t>(1000, 0));
+    check(std::vector<uint64_t>(1000, 42));
+}
+
+TEST(elias_fano_sequence, random)
+{
+    for (uint64_t const max_gap : {1u, 2u, 150u, 10'000u, 1'000'000'000u})
+        for (size_t const count : {2u, 255u, 256u, 257u, 513u, 5000u})
+            check(random_values(count, max_gap, count + max_gap));
+}
+
+TEST(elias_fano_sequence, layout)
+{
+    // Read lengths of 150 need 7 low bits and about 2 high bits per value.
+    elias_fano_sequence::layout const layout = elias_fano_sequence::compute_layout(1'000'001, 150'000'000);
+    EXPECT_EQ(layout.low_bits, 7u);
+    EXPECT_LT(layout.total_words() * 64, 10 * 1'000'001);
+    EXPECT_EQ(elias_fano_sequence::compute_layout(0, 0).total_words(), 0u);
+}